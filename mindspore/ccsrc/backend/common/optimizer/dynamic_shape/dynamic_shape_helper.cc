@@ -208,7 +208,7 @@ AnfNodePtr GenInitNode(const AnfNodePtr &node) {
     if (args == nullptr) {
       args = std::make_shared<kernel::KernelArgs>();
     }
-    if (kernel_mod->Resize(args->op, args->inputs, args->outputs, args->depend_tensor_map) ==
+    if (kernel_mod->ResizeWithCache(args->op, args->inputs, args->outputs, args->depend_tensor_map) ==
         static_cast<int>(kernel::KRET_RESIZE_FAILED)) {
       MS_LOG(EXCEPTION) << "Node " << cnode->fullname_with_scope() << " Resize failed.";
     }
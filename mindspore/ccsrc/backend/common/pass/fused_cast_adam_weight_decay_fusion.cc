@@ -0,0 +1,108 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "backend/common/pass/fused_cast_adam_weight_decay_fusion.h"
+#include <memory>
+#include <vector>
+#include "ir/primitive.h"
+#include "include/common/utils/convert_utils.h"
+#include "include/common/utils/anfalgo.h"
+#include "include/common/utils/utils.h"
+#include "backend/common/optimizer/helper.h"
+#include "backend/common/session/kernel_graph.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+// The 1-based cnode input position of the gradient in AdamWeightDecay:
+// (var, m, v, lr, beta1, beta2, epsilon, decay, gradient).
+constexpr size_t kAdamWeightDecayGradInputIndex = 9;
+
+// FusedCastAdamWeightDecay additionally takes a global norm scalar which divides the gradient.
+// The plain AdamWeightDecay pattern has no such input, so feed the neutral value 1.0.
+ValueNodePtr CreateGlobalNormValueNode(const FuncGraphPtr &func_graph, const AnfNodePtr &node) {
+  MS_EXCEPTION_IF_NULL(func_graph);
+  MS_EXCEPTION_IF_NULL(node);
+  tensor::TensorPtr tensor_ptr = ScalarToTensor(std::make_shared<FP32Imm>(1.0f));
+  MS_EXCEPTION_IF_NULL(tensor_ptr);
+  auto value_node = std::make_shared<ValueNode>(tensor_ptr);
+  MS_EXCEPTION_IF_NULL(value_node);
+  value_node->set_abstract(tensor_ptr->ToAbstract());
+  auto kernel_graph = func_graph->cast<KernelGraphPtr>();
+  if (kernel_graph != nullptr) {
+    value_node = kernel_graph->NewValueNode(value_node);
+    kernel_graph->AddValueNodeToGraph(value_node);
+  } else {
+    value_node = MakeValueNode(value_node);
+  }
+  value_node->set_scope(node->scope());
+  return value_node;
+}
+}  // namespace
+
+const BaseRef FusedCastAdamWeightDecayFusion::DefinePattern() const {
+  VarPtr Xs = std::make_shared<SeqVar>();
+  return VectorRef({prim::kPrimAdamWeightDecay, Xs});
+}
+
+const AnfNodePtr FusedCastAdamWeightDecayFusion::Process(const FuncGraphPtr &graph, const AnfNodePtr &node,
+                                                         const EquivPtr &) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(node);
+  auto adam = node->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(adam);
+  if (adam->inputs().size() <= kAdamWeightDecayGradInputIndex) {
+    return nullptr;
+  }
+  auto cast = adam->input(kAdamWeightDecayGradInputIndex);
+  MS_EXCEPTION_IF_NULL(cast);
+  if (!cast->isa<CNode>() || common::AnfAlgo::GetCNodeName(cast) != kCastOpName) {
+    return nullptr;
+  }
+  // Only the fp16 gradient to fp32 update cast can be folded into the kernel, and only when the
+  // fp32 copy of the gradient has no other consumer.
+  if (common::AnfAlgo::GetOutputInferDataType(cast, 0) != kNumberTypeFloat32 ||
+      common::AnfAlgo::GetPrevNodeOutputInferDataType(cast, 0) != kNumberTypeFloat16) {
+    return nullptr;
+  }
+  auto manager = graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  auto &node_users = manager->node_users();
+  auto users_iter = node_users.find(cast);
+  if (users_iter == node_users.end() || users_iter->second.size() != 1) {
+    return nullptr;
+  }
+  auto gradient = common::AnfAlgo::GetInputNode(cast->cast<CNodePtr>(), 0);
+  MS_EXCEPTION_IF_NULL(gradient);
+
+  std::vector<AnfNodePtr> fused_inputs = {NewValueNode(std::make_shared<Primitive>(kFusedCastAdamWeightDecayName))};
+  for (size_t i = 1; i < kAdamWeightDecayGradInputIndex; ++i) {
+    (void)fused_inputs.emplace_back(adam->input(i));
+  }
+  (void)fused_inputs.emplace_back(gradient);
+  (void)fused_inputs.emplace_back(CreateGlobalNormValueNode(graph, node));
+  // Keep the monad inputs behind the gradient so the side effect ordering is unchanged.
+  for (size_t i = kAdamWeightDecayGradInputIndex + 1; i < adam->inputs().size(); ++i) {
+    (void)fused_inputs.emplace_back(adam->input(i));
+  }
+  auto fused_node = NewCNode(fused_inputs, graph);
+  MS_EXCEPTION_IF_NULL(fused_node);
+  fused_node->set_scope(adam->scope());
+  fused_node->set_abstract(adam->abstract());
+  common::AnfAlgo::CopyNodeAttrs(adam, fused_node);
+  return fused_node;
+}
+}  // namespace opt
+}  // namespace mindspore
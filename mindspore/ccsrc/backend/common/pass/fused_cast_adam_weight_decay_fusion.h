@@ -0,0 +1,39 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_PASS_FUSED_CAST_ADAM_WEIGHT_DECAY_FUSION_H_
+#define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_PASS_FUSED_CAST_ADAM_WEIGHT_DECAY_FUSION_H_
+
+#include <memory>
+#include "backend/common/optimizer/optimizer.h"
+
+namespace mindspore {
+namespace opt {
+// Fuse the fp16->fp32 cast of the gradient into the AdamWeightDecay update:
+//   AdamWeightDecay(var, m, v, ..., Cast(grad_fp16)) -> FusedCastAdamWeightDecay(var, m, v, ..., grad_fp16)
+// In mixed precision training the gradient cast reads and writes one full parameter size per step
+// before the optimizer touches the data. FusedCastAdamWeightDecay converts the gradient element
+// wise inside the update loop, so the extra pass over memory disappears.
+class FusedCastAdamWeightDecayFusion : public PatternProcessPass {
+ public:
+  explicit FusedCastAdamWeightDecayFusion(bool multigraph = true)
+      : PatternProcessPass("fused_cast_adam_weight_decay_fusion", multigraph) {}
+  ~FusedCastAdamWeightDecayFusion() override = default;
+  const BaseRef DefinePattern() const override;
+  const AnfNodePtr Process(const FuncGraphPtr &graph, const AnfNodePtr &node, const EquivPtr &) const override;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_BACKEND_OPTIMIZER_PASS_FUSED_CAST_ADAM_WEIGHT_DECAY_FUSION_H_
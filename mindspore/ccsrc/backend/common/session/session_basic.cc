@@ -2731,6 +2731,68 @@ void SetGraphBpropAttr(const KernelGraphPtr &graph) {
   }
 }
 
+// The env to configure size based gradient bucket assembly for data parallel training. The value is the target
+// byte size of the grads fused into one AllReduce, in MB. Unset or invalid keeps the single fused AllReduce.
+constexpr auto kAllReduceFusionSizeEnv = "MS_DEV_ALLREDUCE_FUSION_SIZE";
+constexpr uint64_t kMegaByte = 1024 * 1024;
+
+uint64_t GetAllReduceFusionSizeThreshold() {
+  static const uint64_t fusion_size = []() -> uint64_t {
+    auto env = common::GetEnv(kAllReduceFusionSizeEnv);
+    if (env.empty()) {
+      return 0;
+    }
+    uint64_t size_mb = 0;
+    try {
+      size_mb = std::stoull(env);
+    } catch (const std::exception &) {
+      MS_LOG(WARNING) << "Invalid value of env " << kAllReduceFusionSizeEnv << ": " << env << ", ignore it.";
+      return 0;
+    }
+    return size_mb * kMegaByte;
+  }();
+  return fusion_size;
+}
+
+// Assemble the grads of the bprop graph into buckets by accumulated byte size: a bucket is closed once the fused
+// size of its grads reaches the threshold, so the AllReduce of a full bucket is launched while the grads of the
+// later buckets are still being computed, instead of one fused AllReduce after the whole backward pass. The grads
+// are walked in the graph output order, which is also the order they are added to the buckets.
+std::vector<uint32_t> GenerateBucketSizeListByFusionSize(const KernelGraphPtr &graph, uint64_t fusion_size,
+                                                         uint32_t grads_count) {
+  std::vector<uint32_t> bucket_size_list;
+  uint32_t total_grads_count = 0;
+  uint32_t bucket_grads_count = 0;
+  uint64_t bucket_grads_size = 0;
+  auto outputs = common::AnfAlgo::GetAllOutputWithIndex(graph->output());
+  for (const auto &output : outputs) {
+    MS_EXCEPTION_IF_NULL(output.first);
+    if (!output.first->isa<CNode>()) {
+      continue;
+    }
+    ++total_grads_count;
+    ++bucket_grads_count;
+    bucket_grads_size += AnfAlgo::GetOutputTensorMemSize(output.first, output.second);
+    if (bucket_grads_size >= fusion_size) {
+      bucket_size_list.emplace_back(bucket_grads_count);
+      bucket_grads_count = 0;
+      bucket_grads_size = 0;
+    }
+  }
+  if (bucket_grads_count > 0) {
+    bucket_size_list.emplace_back(bucket_grads_count);
+  }
+  if (total_grads_count != grads_count) {
+    MS_LOG(WARNING) << "The grads count walked by size based bucket assembly: " << total_grads_count
+                    << " is not equal to the bprop graph grads count: " << grads_count
+                    << ", fall back to one fused AllReduce.";
+    return {};
+  }
+  MS_LOG(INFO) << "Assemble grads into " << bucket_size_list.size() << " buckets by fusion size " << fusion_size
+               << ", bucket size list: " << bucket_size_list;
+  return bucket_size_list;
+}
+
 std::vector<uint32_t> GenerateBucketSizeList(const KernelGraphPtr &graph, const std::vector<uint32_t> &split_index) {
   if (split_index.empty()) {
     auto grads_count = GetBpropGraphGradsCount(graph);
@@ -2738,10 +2800,19 @@ std::vector<uint32_t> GenerateBucketSizeList(const KernelGraphPtr &graph, const
     if (grads_count == 0) {
       MS_LOG(EXCEPTION) << "Bprop graph has no grad";
     }
-    uint32_t remove_number = 0;
     auto parallel_context = parallel::ParallelContext::GetInstance();
     MS_EXCEPTION_IF_NULL(parallel_context);
     auto parallel_mode = parallel_context->parallel_mode();
+    // In data parallel mode every graph output is a grad, so the bucket boundaries can be chosen freely by the
+    // accumulated grad size without the risk of miscounting the parallel ops removed below.
+    auto fusion_size = GetAllReduceFusionSizeThreshold();
+    if (fusion_size > 0 && parallel_mode == parallel::kDataParallel) {
+      auto bucket_size_list = GenerateBucketSizeListByFusionSize(graph, fusion_size, grads_count);
+      if (!bucket_size_list.empty()) {
+        return bucket_size_list;
+      }
+    }
+    uint32_t remove_number = 0;
     if (parallel_mode == parallel::kSemiAutoParallel || parallel_mode == parallel::kAutoParallel) {
       auto ret = graph->get_return();
       auto current_node = ret->cast<CNodePtr>();
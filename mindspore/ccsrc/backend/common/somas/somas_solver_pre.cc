@@ -17,6 +17,7 @@
 #include <cstdio>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include "include/common/thread_pool.h"
@@ -27,6 +28,16 @@
 
 namespace mindspore {
 namespace somas {
+namespace {
+// Cache of solved assignments keyed by the hash of the solver input (tensors, conflict constraints and continuous
+// lists), so that a recompilation with identical tensor lifetimes reuses the prior solution without solving again.
+struct SolverSolutionCacheEntry {
+  mindspore::HashMap<size_t, size_t> offsets;
+  size_t max_offset{0};
+};
+std::mutex solution_cache_mutex;
+mindspore::HashMap<uint64_t, SolverSolutionCacheEntry> solution_cache;
+}  // namespace
 constexpr auto kSolNumThresholdMultiThread = 8;
 Status SomasSolverPre::CheckTensors(const TensorsDescMap *pTensors, uint32_t index1, uint32_t index2) const {
   auto tensors = *pTensors;
@@ -97,6 +108,48 @@ vector<TensorsDescMap> SomasSolverPre::CreateTensorsMaps(const TensorsDescMap &t
   }
   return vecTensorsMap;
 }
+uint64_t SomasSolverPre::ComputeSolverInputHash(const TensorsDescMap &tensors,
+                                                const std::vector<DynamicBitSet> *pConstraints,
+                                                const vector<vector<size_t>> &continuous_v) const {
+  // FNV-1a over the solver input. Tensors are combined in sorted index order since the map iteration order is not
+  // deterministic across runs.
+  constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+  constexpr uint64_t kFnvPrime = 1099511628211ULL;
+  uint64_t hash = kFnvOffsetBasis;
+  auto combine = [&hash](uint64_t value) { hash = (hash ^ value) * kFnvPrime; };
+
+  vector<size_t> indices;
+  indices.reserve(tensors.size());
+  for (auto &pairT : tensors) {
+    indices.push_back(pairT.first);
+  }
+  std::sort(indices.begin(), indices.end());
+  combine(tensors.size());
+  for (auto index : indices) {
+    auto &tensor = tensors.at(index);
+    MS_EXCEPTION_IF_NULL(tensor);
+    combine(tensor->index_);
+    combine(tensor->size_);
+    combine(static_cast<uint64_t>(tensor->lifelong_));
+  }
+  if (pConstraints != nullptr) {
+    combine(pConstraints->size());
+    for (auto &row : *pConstraints) {
+      for (auto word : row.bit_) {
+        combine(word);
+      }
+    }
+  }
+  combine(continuous_v.size());
+  for (auto &aux : continuous_v) {
+    combine(aux.size());
+    for (auto index : aux) {
+      combine(index);
+    }
+  }
+  return hash;
+}
+
 Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap *ptensors,
                                const std::vector<DynamicBitSet> *pConstraints,
                                const vector<vector<size_t>> &continuous_v, bool bVerifySolution, bool ball,
@@ -104,6 +157,29 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
   Status ret = SUCCESS;
   try {
     TensorsDescMap &tensors = *ptensors;
+    uint64_t input_hash = ComputeSolverInputHash(tensors, pConstraints, continuous_v);
+    {
+      std::lock_guard<std::mutex> lock(solution_cache_mutex);
+      auto cache_iter = solution_cache.find(input_hash);
+      if (cache_iter != solution_cache.end() && cache_iter->second.offsets.size() == tensors.size()) {
+        bool all_found = true;
+        for (auto &tensor : tensors) {
+          auto offset_iter = cache_iter->second.offsets.find(tensor.first);
+          if (offset_iter == cache_iter->second.offsets.end()) {
+            all_found = false;
+            break;
+          }
+          tensor.second->offset_ = offset_iter->second;
+        }
+        if (all_found) {
+          max_offset_ = cache_iter->second.max_offset;
+          MS_LOG(INFO) << "SomasSolver::Solving reuse the cached solution, input hash: " << input_hash
+                       << ", max offset: " << max_offset_;
+          return SUCCESS;
+        }
+      }
+    }
+    bool solved = false;
     constexpr size_t numSortingTypes = static_cast<size_t>(kNumSortingTypes);
     constexpr size_t numFittingTypes = static_cast<size_t>(kNumFittingTypes);
     constexpr size_t numAlgorithmTypes = static_cast<size_t>(kNumAlgorithmTypes);
@@ -161,6 +237,7 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
         *(tensor.second.get()) = *(vecTensorsMap[best_sol][tensor.first]);
       }
       max_offset_ = best_solver->GetUpperbound();
+      solved = true;
       constexpr float kFloatPresent = 100.0;
       MS_LOG(INFO) << "SOMAS SOLVER RESUME:";
       MS_LOG(INFO) << "Best Solution:[" << 1 + best_sol << "/" << total_sol << "] ";
@@ -186,10 +263,20 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
       pSolver->VerifySolution(bVerifySolution);
       if (SUCCESS == (pSolver->MemoryAllocationSolver())) {
         max_offset_ = pSolver->GetUpperbound();
+        solved = true;
         MS_LOG(INFO) << "SomasSolver::Solving SUCCESS";
         MS_LOG(INFO) << "SomasSolver::Solving RESULT: " << max_offset_ << " (" << max_offset_ / (giga) << " GB)";
       }
     }
+    if (solved) {
+      std::lock_guard<std::mutex> lock(solution_cache_mutex);
+      auto &entry = solution_cache[input_hash];
+      entry.offsets.clear();
+      for (auto &tensor : tensors) {
+        (void)entry.offsets.emplace(tensor.first, tensor.second->offset_);
+      }
+      entry.max_offset = max_offset_;
+    }
     Log(graph, tensors, pConstraints, continuous_v);
   } catch (const std::exception &e) {
     MS_LOG(EXCEPTION) << "SomasSolver::Solving FAILED: " << e.what();
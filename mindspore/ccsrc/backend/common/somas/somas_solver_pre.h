@@ -201,6 +201,8 @@ class SomasSolverPre {
 
  private:
   size_t max_offset_;
+  uint64_t ComputeSolverInputHash(const TensorsDescMap &tensors, const std::vector<DynamicBitSet> *pConstraints,
+                                  const vector<vector<size_t>> &continuous_v) const;
   void SolverInputLog(const session::KernelGraph *graph, const TensorsDescMap &tensors,
                       const vector<vector<size_t>> &continuous_v) const;
   void SolverOutputLog(const session::KernelGraph *graph, const TensorsDescMap &tensors) const;
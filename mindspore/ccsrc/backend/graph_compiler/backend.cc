@@ -1026,12 +1026,13 @@ void MindRTBackend::RunGraphByActors(const ActorInfo &actor_info, const GraphCom
     }
   }
 
-  std::vector<std::vector<tensor::TensorPtr>> input_tensors = GetRunGraphInputs(graph_compiler_info, args);
-  pynative::GraphAdapter::HandleHeterogeneousTensors(input_tensors, device_contexts);
+  // The inputs fetched at the beginning can be reused directly, fetching them again would repeat the whole
+  // host-side flatten work and dominates the step time of small graphs.
+  pynative::GraphAdapter::HandleHeterogeneousTensors(inputs, device_contexts);
 
   // Release GIL and run actor DAG.
   mindspore::ScopedLongRunning long_running;
-  runtime::GraphScheduler::GetInstance().Run(actor_set, graph_compiler_info.device_contexts_, input_tensors);
+  runtime::GraphScheduler::GetInstance().Run(actor_set, graph_compiler_info.device_contexts_, inputs);
 
   MS_EXCEPTION_IF_NULL(graph_compiler_);
   graph_compiler_->Summary(graph_compiler_info.graphs_);
@@ -1329,6 +1330,32 @@ void MindRTBackend::WaitTaskFinish() const { runtime::OpExecutor::GetInstance().
 
 void MindRTBackend::ClearOpExecutorResource() const { runtime::OpExecutor::GetInstance().Reset(); }
 
+size_t MindRTBackend::EvictColdGraphs(size_t max_kept) {
+  if (actor_to_graph_compiler_info_.size() <= max_kept) {
+    return 0;
+  }
+  size_t evict_num = actor_to_graph_compiler_info_.size() - max_kept;
+  size_t evicted_num = 0;
+  // Walk the actor sets from the least to the most recently run and release the compiler info of the cold
+  // ones, whose destructor tears down the actor set and frees its device memory.
+  const auto &actor_infos = runtime::GraphScheduler::GetInstance().FetchActorSetsByColdness();
+  for (const auto &actor_info : actor_infos) {
+    if (evicted_num >= evict_num) {
+      break;
+    }
+    const auto &iter = actor_to_graph_compiler_info_.find(actor_info);
+    if (iter == actor_to_graph_compiler_info_.end()) {
+      continue;
+    }
+    MS_LOG(INFO) << "Evict the cold compiled graph: " << actor_info;
+    (void)actor_to_graph_compiler_info_.erase(iter);
+    ++evicted_num;
+  }
+  MS_LOG(INFO) << "Evict cold graphs finished, evicted num: " << evicted_num
+               << ", kept num: " << actor_to_graph_compiler_info_.size();
+  return evicted_num;
+}
+
 void MindRTBackend::SyncStream() {
   const auto &device_context =
     device::DeviceContextManager::GetInstance().GetOrCreateDeviceContext({device_name_, device_id_});
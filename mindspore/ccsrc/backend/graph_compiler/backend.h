@@ -123,6 +123,11 @@ class BACKEND_EXPORT MindRTBackend : public Backend {
   void WaitTaskFinish() const;
   // Clear resource when python exit.
   void ClearOpExecutorResource() const;
+  // Evict the least recently run compiled graphs until at most max_kept remain, freeing their actor sets and
+  // device memory. Intended for the idle periods of long-running dynamic shape services whose shape buckets
+  // accumulate compiled variants; never call it on the request path, as an evicted variant must be compiled
+  // again before its next run. Return the number of evicted graphs.
+  size_t EvictColdGraphs(size_t max_kept);
   // Get the device target.
   std::string GetDeviceTarget() { return device_name_; }
   // Sync default stream in PyNative mode.
@@ -24,8 +24,11 @@
 #include <set>
 #include <algorithm>
 #include "mindspore/core/ops/core_ops.h"
+#include "abstract/dshape.h"
+#include "utils/hash_map.h"
 #include "include/common/utils/utils.h"
 #include "utils/ms_context.h"
+#include "utils/ms_utils.h"
 #include "ps/ps_context.h"
 #include "utils/anf_utils.h"
 #ifdef ENABLE_D
@@ -619,6 +622,105 @@ void NodesToSegments(const std::vector<AnfNodePtr> &segment_nodes, std::vector<G
   }
   SplitDynamicNodeSegment(segment_nodes, segments, node_to_segment, dynamic_nodes_set);
 }
+
+bool HasExplicitTarget(const CNodePtr &cnode) {
+  if (cnode->user_data<std::string>(kAttrPrimitiveTarget) != nullptr) {
+    return true;
+  }
+  auto prim = GetCNodePrimitive(cnode);
+  return prim != nullptr && prim->GetAttr(kAttrPrimitiveTarget) != nullptr;
+}
+
+bool IsPlacementVirtualNode(const AnfNodePtr &node) {
+  return IsPrimitiveCNode(node, prim::kPrimDepend) || IsPrimitiveCNode(node, prim::kPrimLoad) ||
+         IsPrimitiveCNode(node, prim::kPrimUpdateState) || IsPrimitiveCNode(node, prim::kPrimMakeTuple) ||
+         IsPrimitiveCNode(node, prim::kPrimTupleGetItem);
+}
+
+bool IsSmallStaticOutput(const AnfNodePtr &node, int64_t max_elements) {
+  auto abs = node->abstract();
+  if (abs == nullptr) {
+    return false;
+  }
+  auto shape = abs->BuildShape();
+  if (shape == nullptr || !shape->isa<abstract::Shape>()) {
+    return false;
+  }
+  int64_t elements = 1;
+  for (auto dim : shape->cast<abstract::ShapePtr>()->shape()) {
+    if (dim < 0) {
+      return false;
+    }
+    elements *= dim;
+  }
+  return elements <= max_elements;
+}
+
+// A local transfer-cost refinement of the heterogeneous placement: a default-target op whose producer
+// and consumer cnodes all live on the other target costs two device transfers, while running it on that
+// target costs none, so pulling it over is a strict win for cheap ops. Migrations are limited to small
+// static outputs (the compute time of a big op can outweigh the saved copies) and to nodes placed by the
+// context default, never to an op the user pinned to a device. Repeat until no op moves, so the sandwich
+// collapses outside in.
+void RefineHeterogeneousPlacement(const std::vector<AnfNodePtr> &nodes, const std::string &default_target,
+                                  const std::string &other_target) {
+  constexpr int64_t kMaxMigrateElements = 16384;
+  mindspore::HashMap<AnfNodePtr, std::vector<AnfNodePtr>> users;
+  for (auto &node : nodes) {
+    auto cnode = node->cast<CNodePtr>();
+    if (cnode == nullptr) {
+      continue;
+    }
+    for (auto &input : cnode->inputs()) {
+      users[input].push_back(node);
+    }
+  }
+  bool changed = true;
+  size_t migrated = 0;
+  while (changed) {
+    changed = false;
+    for (auto &node : nodes) {
+      auto cnode = node->cast<CNodePtr>();
+      if (cnode == nullptr || IsPlacementVirtualNode(node) || HasExplicitTarget(cnode)) {
+        continue;
+      }
+      if (GetCNodePrimitive(cnode) == nullptr || GetCNodeTarget(node) != default_target ||
+          !IsSmallStaticOutput(node, kMaxMigrateElements)) {
+        continue;
+      }
+      // Parameters and value nodes are target neutral, only cnode neighbors vote.
+      bool consistent = true;
+      bool has_neighbor = false;
+      auto consider = [&consistent, &has_neighbor, &other_target](const AnfNodePtr &neighbor) {
+        if (neighbor == nullptr || !neighbor->isa<CNode>()) {
+          return;
+        }
+        has_neighbor = true;
+        if (GetCNodeTarget(neighbor) != other_target) {
+          consistent = false;
+        }
+      };
+      for (auto &input : cnode->inputs()) {
+        consider(input);
+      }
+      auto users_iter = users.find(node);
+      if (users_iter != users.end()) {
+        for (auto &user : users_iter->second) {
+          consider(user);
+        }
+      }
+      if (has_neighbor && consistent) {
+        node->set_user_data(kAttrPrimitiveTarget, std::make_shared<std::string>(other_target));
+        ++migrated;
+        changed = true;
+      }
+    }
+  }
+  if (migrated > 0) {
+    MS_LOG(INFO) << "Heterogeneous placement refine migrated " << migrated << " nodes from " << default_target
+                 << " to " << other_target << " to remove transfer edges.";
+  }
+}
 }  // namespace
 
 GraphPartition::GraphPartition(const std::vector<PrimitivePtr> &cut_list, const std::string &backend_name)
@@ -672,6 +774,13 @@ std::vector<GraphSegmentPtr> GraphPartition::Partition(const FuncGraphPtr &graph
   MS_EXCEPTION_IF_NULL(context_ptr);
   auto enable_loop_sink = context_ptr->get_param<bool>(MS_CTX_ENABLE_LOOP_SINK);
   std::string default_target = context_ptr->get_param<std::string>(MS_CTX_DEVICE_TARGET);
+  static const bool auto_placement = common::GetEnv("MS_DEV_AUTO_HETEROGENEOUS_PLACEMENT") == "1";
+  if (auto_placement && contain_multi_target) {
+    auto other_target = GetOtherTarget(nodes);
+    if (!other_target.empty()) {
+      RefineHeterogeneousPlacement(nodes, default_target, other_target);
+    }
+  }
   if (contain_multi_target || !enable_loop_sink) {
     if (context_ptr->get_param<bool>(MS_CTX_ENABLE_PARALLEL_SPLIT)) {
       auto other_target = GetOtherTarget(nodes);
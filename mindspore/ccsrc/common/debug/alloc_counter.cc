@@ -0,0 +1,179 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "include/common/debug/alloc_counter.h"
+
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#if defined(ENABLE_ALLOC_AUDIT) && !defined(_WIN32) && !defined(_WIN64)
+#include <malloc.h>
+#endif
+
+#ifdef ENABLE_ALLOC_AUDIT
+namespace {
+// Reentrancy guard: the counter bookkeeping itself allocates (first registration of a scope, lazy
+// singleton construction), those internal allocations must not be charged or recurse into the counter.
+thread_local bool g_in_alloc_hook = false;
+
+class AllocHookGuard {
+ public:
+  AllocHookGuard() : entered_(!g_in_alloc_hook) {
+    if (entered_) {
+      g_in_alloc_hook = true;
+    }
+  }
+  ~AllocHookGuard() {
+    if (entered_) {
+      g_in_alloc_hook = false;
+    }
+  }
+  bool entered() const { return entered_; }
+
+ private:
+  bool entered_;
+};
+}  // namespace
+#endif
+
+namespace mindspore {
+AllocCounter &AllocCounter::GetInstance() {
+  static AllocCounter instance;
+  return instance;
+}
+
+AllocCounterStat *&AllocCounter::CurrentStat() noexcept {
+  static thread_local AllocCounterStat *current_stat = nullptr;
+  return current_stat;
+}
+
+AllocCounter::AllocCounter() : untagged_(nullptr) { untagged_ = RegisterScope("untagged"); }
+
+AllocCounterStat *AllocCounter::RegisterScope(const std::string &name) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto &stat = stats_[name];
+  if (stat == nullptr) {
+    stat = std::make_unique<AllocCounterStat>();
+  }
+  return stat.get();
+}
+
+void AllocCounter::OnAlloc(std::size_t size) noexcept {
+  auto *stat = CurrentStat();
+  if (stat == nullptr) {
+    stat = untagged_;
+  }
+  (void)stat->alloc_calls.fetch_add(1, std::memory_order_relaxed);
+  (void)stat->alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+  auto live = stat->live_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) +
+              static_cast<int64_t>(size);
+  auto peak = stat->peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !stat->peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void AllocCounter::OnFree(std::size_t size) noexcept {
+  auto *stat = CurrentStat();
+  if (stat == nullptr) {
+    stat = untagged_;
+  }
+  (void)stat->free_calls.fetch_add(1, std::memory_order_relaxed);
+  (void)stat->live_bytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+}
+
+std::string AllocCounter::DumpToString() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  std::ostringstream oss;
+  oss << "scope, alloc_calls, alloc_bytes, free_calls, live_bytes, peak_live_bytes\n";
+  for (const auto &[name, stat] : stats_) {
+    oss << name << ", " << stat->alloc_calls.load(std::memory_order_relaxed) << ", "
+        << stat->alloc_bytes.load(std::memory_order_relaxed) << ", "
+        << stat->free_calls.load(std::memory_order_relaxed) << ", "
+        << stat->live_bytes.load(std::memory_order_relaxed) << ", "
+        << stat->peak_live_bytes.load(std::memory_order_relaxed) << "\n";
+  }
+  return oss.str();
+}
+
+#ifdef ENABLE_ALLOC_AUDIT
+AllocCounterScope::AllocCounterScope(const char *name) {
+  AllocHookGuard guard;
+  auto *&current = AllocCounter::CurrentStat();
+  previous_ = current;
+  current = AllocCounter::GetInstance().RegisterScope(name);
+}
+
+AllocCounterScope::~AllocCounterScope() { AllocCounter::CurrentStat() = previous_; }
+#endif
+}  // namespace mindspore
+
+#if defined(ENABLE_ALLOC_AUDIT) && !defined(_WIN32) && !defined(_WIN64)
+namespace {
+void RecordAlloc(void *ptr) noexcept {
+  AllocHookGuard guard;
+  if (ptr == nullptr || !guard.entered()) {
+    return;
+  }
+  mindspore::AllocCounter::GetInstance().OnAlloc(malloc_usable_size(ptr));
+}
+
+void RecordFree(void *ptr) noexcept {
+  AllocHookGuard guard;
+  if (ptr == nullptr || !guard.entered()) {
+    return;
+  }
+  mindspore::AllocCounter::GetInstance().OnFree(malloc_usable_size(ptr));
+}
+}  // namespace
+
+// Interposed global allocation operators. The charged size is the usable size reported by the allocator,
+// so the unsized operator delete can be accounted symmetrically.
+void *operator new(std::size_t size) {
+  void *ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  RecordAlloc(ptr);
+  return ptr;
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  void *ptr = std::malloc(size == 0 ? 1 : size);
+  RecordAlloc(ptr);
+  return ptr;
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept { return operator new(size, tag); }
+
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  RecordFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept { operator delete(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+void operator delete[](void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { operator delete(ptr); }
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { operator delete(ptr); }
+#endif
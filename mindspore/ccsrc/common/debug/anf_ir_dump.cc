@@ -596,8 +596,10 @@ void DumpIRInSubgraph(const std::vector<AnfNodePtr> &nodes, OrderedMap<AnfNodePt
   }
 }
 
+// oss is the final sink: a string buffer for the in-memory variants, the dump file itself for the
+// file variants so the whole-graph text is never materialized a second time.
 void DumpSubgraph(const OrderedMap<FuncGraphPtr, std::shared_ptr<SubGraphIRInfo>> *sub_graphs,
-                  const FuncGraphPtr &graph, OrderedMap<AnfNodePtr, int32_t> *para_map, std::ostringstream &oss) {
+                  const FuncGraphPtr &graph, OrderedMap<AnfNodePtr, int32_t> *para_map, std::ostream &oss) {
   if (sub_graphs == nullptr || graph == nullptr) {
     return;
   }
@@ -637,7 +639,10 @@ void DumpSubgraph(const OrderedMap<FuncGraphPtr, std::shared_ptr<SubGraphIRInfo>
     }
     oss << ") {" << std::endl;
     MS_EXCEPTION_IF_NULL(sg.second);
-    oss << sg.second->buffer.str();
+    // Stream the subgraph body straight out of its buffer; str() would copy the whole text first.
+    if (sg.second->buffer.rdbuf()->in_avail() > 0) {
+      oss << sg.second->buffer.rdbuf();
+    }
     oss << "}" << std::endl;
     oss << std::endl;
   }
@@ -790,12 +795,10 @@ void DumpIR(const std::string &filename, const FuncGraphPtr &graph, bool dump_fu
 
   // Output global info
   fout << buffer.str() << std::endl;
-  buffer.str(std::string());
-  buffer.clear();
 
-  // Output each sub graph
-  DumpSubgraph(&sub_graphs, graph, &para_map, buffer);
-  fout << buffer.str();
+  // Output each sub graph, streamed straight to the file. Concatenating everything into one string
+  // buffer first doubles the peak memory of dumping a big graph.
+  DumpSubgraph(&sub_graphs, graph, &para_map, fout);
 
   fout.close();
   // Set file mode to read only by user
@@ -855,12 +858,9 @@ void DumpIRForRDR(const std::string &filename, const FuncGraphPtr &graph, bool d
 
   // Output global info
   fout << buffer.str() << std::endl;
-  buffer.str(std::string());
-  buffer.clear();
 
-  // Output each sub graph
-  DumpSubgraph(&sub_graphs, graph, &para_map, buffer);
-  fout << buffer.str();
+  // Output each sub graph, streamed straight to the file like DumpIR above.
+  DumpSubgraph(&sub_graphs, graph, &para_map, fout);
 
   fout.close();
   // Set file mode to read only by user
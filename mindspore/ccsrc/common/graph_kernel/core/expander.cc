@@ -16,6 +16,9 @@
 
 #include "common/graph_kernel/core/expander.h"
 
+#include <map>
+#include <sstream>
+#include "ir/func_graph_cloner.h"
 #include "utils/anf_utils.h"
 #include "common/graph_kernel/core/graph_kernel_callback.h"
 #include "common/graph_kernel/core/graph_kernel_utils.h"
@@ -49,13 +52,77 @@ AnfNodePtr InputToAttrDeco::Run(const AnfNodePtr &node) {
   return decorated_->Run(cnode);
 }
 
+std::unordered_map<std::string, FuncGraphPtr> DefaultExpander::expand_cache_;
+std::mutex DefaultExpander::expand_cache_mutex_;
+
+void DefaultExpander::ClearCache() {
+  std::lock_guard<std::mutex> lock(expand_cache_mutex_);
+  expand_cache_.clear();
+}
+
+std::string DefaultExpander::ExpandCacheKey(const CNodePtr &node) const {
+  auto prim = GetCNodePrimitive(node);
+  MS_EXCEPTION_IF_NULL(prim);
+  MS_EXCEPTION_IF_NULL(cb_);
+  std::ostringstream oss;
+  oss << AnfUtils::GetCNodeName(node) << "/" << cb_->GetProcessor(node);
+  // Sort the attrs so that the key does not depend on the hash map iteration order.
+  std::map<std::string, std::string> ordered_attrs;
+  for (const auto &attr : prim->attrs()) {
+    ordered_attrs[attr.first] = (attr.second == nullptr ? "null" : attr.second->ToString());
+  }
+  for (const auto &attr : ordered_attrs) {
+    oss << "/" << attr.first << "=" << attr.second;
+  }
+  auto input_num = node->size() - 1;
+  for (size_t i = 0; i < input_num; i++) {
+    oss << "/i";
+    for (auto d : cb_->GetInputShape(node, i)) {
+      oss << d << "_";
+    }
+    oss << static_cast<int>(cb_->GetInputType(node, i)) << "_" << cb_->GetInputFormat(node, i);
+  }
+  auto output_num = AnfUtils::GetOutputTensorNum(node);
+  for (size_t i = 0; i < output_num; i++) {
+    oss << "/o";
+    for (auto d : cb_->GetOutputShape(node, i)) {
+      oss << d << "_";
+    }
+    oss << static_cast<int>(cb_->GetOutputType(node, i)) << "_" << cb_->GetOutputFormat(node, i);
+  }
+  return oss.str();
+}
+
 AnfNodePtr DefaultExpander::Run(const AnfNodePtr &node) {
   MS_LOG(DEBUG) << "Expanding node: " << node->fullname_with_scope();
   auto cnode = node->cast<CNodePtr>();
   MS_EXCEPTION_IF_NULL(cnode);
-  auto new_fg = ExpandToGraph(cnode);
-  auto res = new_fg ? "success" : "failed";
-  MS_LOG(DEBUG) << "Expanding node " << res << " : " << node->fullname_with_scope();
+  auto cache_key = ExpandCacheKey(cnode);
+  FuncGraphPtr cached_fg = nullptr;
+  bool cached = false;
+  {
+    std::lock_guard<std::mutex> lock(expand_cache_mutex_);
+    auto iter = expand_cache_.find(cache_key);
+    if (iter != expand_cache_.end()) {
+      cached = true;
+      cached_fg = iter->second;
+    }
+  }
+  FuncGraphPtr new_fg = nullptr;
+  if (cached) {
+    // Nodes with the same op, attrs and input/output infos always expand to the same graph,
+    // so the memoized result only needs a clone. A nullptr means the expansion already failed.
+    MS_LOG(DEBUG) << "Expanding node hits cache: " << node->fullname_with_scope();
+    new_fg = (cached_fg == nullptr ? nullptr : BasicClone(cached_fg));
+  } else {
+    new_fg = ExpandToGraph(cnode);
+    auto res = new_fg ? "success" : "failed";
+    MS_LOG(DEBUG) << "Expanding node " << res << " : " << node->fullname_with_scope();
+    // Keep a pristine copy in the cache: the returned graph is mutated by the following fusion
+    // and optimization passes.
+    std::lock_guard<std::mutex> lock(expand_cache_mutex_);
+    expand_cache_[cache_key] = (new_fg == nullptr ? nullptr : BasicClone(new_fg));
+  }
   if (new_fg == nullptr) {
     return nullptr;
   }
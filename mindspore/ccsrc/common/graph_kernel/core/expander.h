@@ -17,6 +17,9 @@
 #define MINDSPORE_CCSRC_COMMON_GRAPH_KERNEL_CORE_EXPANDER_H_
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include "ir/func_graph.h"
 #include "include/common/visible.h"
 #include "common/graph_kernel/core/graph_kernel_callback.h"
@@ -39,9 +42,23 @@ class DefaultExpander : public Expander {
   virtual ~DefaultExpander() = default;
   AnfNodePtr Run(const AnfNodePtr &node) override;
 
+  // Drop the memoized expansion results, called when an expander pass finishes so the cached
+  // graphs do not outlive the compile that produced them.
+  static void ClearCache();
+
  protected:
   virtual FuncGraphPtr ExpandToGraph(const CNodePtr &node);
+  // Build the memoization key of the node: everything the expander reads, i.e. the op name,
+  // processor, attrs and the shape/type/format of every input and output.
+  std::string ExpandCacheKey(const CNodePtr &node) const;
   CallbackPtr cb_;
+
+ private:
+  // Expansion results keyed by ExpandCacheKey, shared across instances since a fresh expander
+  // is created for every node. A nullptr value memoizes an expansion failure. The cache keeps
+  // pristine copies, every user gets a clone.
+  static std::unordered_map<std::string, FuncGraphPtr> expand_cache_;
+  static std::mutex expand_cache_mutex_;
 };
 
 class COMMON_EXPORT ExpanderDecorator : public Expander {
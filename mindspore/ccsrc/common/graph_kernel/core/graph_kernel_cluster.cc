@@ -100,10 +100,22 @@ std::vector<PrimitivePtr> GraphKernelCluster::GetClusterableOpList() {
     {kGPUDevice, OpLevel_1, prim::kPrimCumSum},
     {kGPUDevice, OpLevel_1, prim::kPrimOneHot},
     // cpu
+    {kCPUDevice, OpLevel_0, prim::kPrimCos},
+    {kCPUDevice, OpLevel_0, prim::kPrimDiv},
+    {kCPUDevice, OpLevel_0, prim::kPrimFloor},
+    {kCPUDevice, OpLevel_0, prim::kPrimFloorDiv},
+    {kCPUDevice, OpLevel_0, prim::kPrimFloorMod},
+    {kCPUDevice, OpLevel_0, prim::kPrimGreater},
+    {kCPUDevice, OpLevel_0, prim::kPrimGreaterEqual},
+    {kCPUDevice, OpLevel_0, prim::kPrimLogicalAnd},
     {kCPUDevice, OpLevel_0, prim::kPrimLogicalNot},
+    {kCPUDevice, OpLevel_0, prim::kPrimLogicalOr},
     {kCPUDevice, OpLevel_0, prim::kPrimMod},
+    {kCPUDevice, OpLevel_0, prim::kPrimNotEqual},
     {kCPUDevice, OpLevel_1, prim::kPrimReduceMax},
+    {kCPUDevice, OpLevel_1, prim::kPrimReduceMin},
     {kCPUDevice, OpLevel_0, prim::kPrimSelect},
+    {kCPUDevice, OpLevel_0, prim::kPrimSin},
     {kCPUDevice, OpLevel_0, prim::kPrimLess},
     {kCPUDevice, OpLevel_0, prim::kPrimLessEqual},
   };
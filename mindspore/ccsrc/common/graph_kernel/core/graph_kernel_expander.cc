@@ -68,6 +68,10 @@ bool GraphKernelExpander::DoExpand(const FuncGraphPtr &func_graph) {
 
 bool GraphKernelExpander::Run(const FuncGraphPtr &func_graph) {
   expand_ops_ = InitOpList();
-  return DoExpand(func_graph);
+  auto changed = DoExpand(func_graph);
+  // The memoized expansions are only meant to dedup identical nodes within one pass run, drop
+  // them so the cached graphs do not outlive the compile.
+  DefaultExpander::ClearCache();
+  return changed;
 }
 }  // namespace mindspore::graphkernel
@@ -15,6 +15,7 @@
  */
 
 #include "common/mem_reuse/mem_dynamic_allocator.h"
+#include <set>
 #include <string>
 #include "include/common/utils/convert_utils.h"
 #include "utils/log_adapter.h"
@@ -31,6 +32,26 @@ const size_t kMinimumAllocMem = 10 << 20;
 
 thread_local AllocatorDebugInfo DynamicMemAllocatorDebugInfo::debug_info_;
 
+const std::string *InternAllocatorName(const std::string &name) {
+  // Per-thread memo: an allocating thread usually repeats the same name many times in a row (one
+  // actor, many allocations), so the common case is a single string compare without taking the lock.
+  thread_local const std::string *last_interned = nullptr;
+  if (last_interned != nullptr && *last_interned == name) {
+    return last_interned;
+  }
+  // std::set keeps the element addresses stable on insert, which the recorded pointers rely on.
+  static std::set<std::string> interned_names;
+  static std::mutex intern_mutex;
+  std::lock_guard<std::mutex> locker(intern_mutex);
+  last_interned = &(*interned_names.insert(name).first);
+  return last_interned;
+}
+
+const std::string &AllocatorName(const std::string *name) {
+  static const std::string kUnknownAllocatorName = "Unknown";
+  return name == nullptr ? kUnknownAllocatorName : *name;
+}
+
 static const std::map<DynamicMemBufStatus, std::string> kBufStatusString = {
   {DynamicMemBufStatus::kMemBufIdle, "idle"},
   {DynamicMemBufStatus::kMemBufUsed, "used"},
@@ -48,13 +69,32 @@ DynamicMemPoolBestFit::~DynamicMemPoolBestFit() {
   common_mem_->clear();
 }
 
-DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persistent_mem) {
+DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persistent_mem, uint32_t stream_id) {
   size_t align_size = AlignMemorySize(size);
-  std::lock_guard<std::mutex> locker(mutex_);
-  // Find the idle memory buf by tensor size, if not find, then add new memory block and memory buf.
-  DeviceMemPtr device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
-  if (!device_addr) {
-    device_addr = AddMemBlockAndMemBuf(align_size, from_persistent_mem);
+  DeviceMemPtr device_addr = nullptr;
+  {
+    std::lock_guard<std::mutex> locker(mutex_);
+    // Find the idle memory buf by tensor size, if not find, then add new memory block and memory buf.
+    device_addr = FindIdleMemBuf(align_size, from_persistent_mem, stream_id);
+    if (!device_addr) {
+      device_addr = AddMemBlockAndMemBuf(align_size, from_persistent_mem, stream_id);
+    }
+    // Under device memory pressure, give the wholly idle blocks back to the device first: the freed memory
+    // may let the new block request succeed, both here and in the co-located processes sharing the device.
+    if (!device_addr && ReleaseIdleMemBlocksLocked() > 0) {
+      device_addr = AddMemBlockAndMemBuf(align_size, from_persistent_mem, stream_id);
+    }
+  }
+
+  // Last chance: let the registered owners of cached device memory release it, then retry. The callback
+  // runs without the pool lock held as it usually frees the cached memory through FreeTensorMem.
+  if (!device_addr && mem_pressure_callback_ != nullptr) {
+    mem_pressure_callback_(align_size);
+    std::lock_guard<std::mutex> locker(mutex_);
+    device_addr = FindIdleMemBuf(align_size, from_persistent_mem, stream_id);
+    if (!device_addr) {
+      device_addr = AddMemBlockAndMemBuf(align_size, from_persistent_mem, stream_id);
+    }
   }
 
   // Alloc memory failed and dump the info.
@@ -63,7 +103,7 @@ DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persis
     DumpDynamicMemPoolStateInfo();
   }
 
-  MS_LOG(DEBUG) << "Alloc memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
+  MS_LOG(DEBUG) << "Alloc memory details, name:" << AllocatorName(DynamicMemAllocatorDebugInfo::GetDebugInfo().name_)
                 << ", address:" << device_addr << ", size:" << size << "B, total allocated mem:" << TotalMemStatistics()
                 << "B, peak used mem:" << UsedMemPeakStatistics() << "B, in used mem:" << TotalUsedMemStatistics()
                 << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
@@ -122,13 +162,19 @@ size_t DynamicMemPoolBestFit::AlignMemorySize(size_t size) const {
   return ((size + DYNAMIC_MEM_ALIGN_SIZE - 1) / DYNAMIC_MEM_ALIGN_SIZE) * DYNAMIC_MEM_ALIGN_SIZE;
 }
 
-DeviceMemPtr DynamicMemPoolBestFit::FindIdleMemBuf(size_t size, bool from_persistent_mem) {
+DeviceMemPtr DynamicMemPoolBestFit::FindIdleMemBuf(size_t size, bool from_persistent_mem, uint32_t stream_id) {
   auto mem_mng = common_mem_;
   if (from_persistent_mem) {
     mem_mng = persistent_mem_;
   }
   MS_EXCEPTION_IF_NULL(mem_mng);
-  const auto &iter = mem_mng->idle_mem_buf_map_.lower_bound(size);
+  auto iter = mem_mng->idle_mem_buf_map_.lower_bound(size);
+  // Skip the bufs freed by other streams: they are safely reusable in stream order only for allocations of
+  // the same stream, other streams must wait until the tags are cleared at a synchronization point.
+  while (iter != mem_mng->idle_mem_buf_map_.end() && iter->second != nullptr &&
+         iter->second->free_stream_id_ != stream_id && iter->second->free_stream_id_ != kAnyStreamIdx) {
+    ++iter;
+  }
   if (iter != mem_mng->idle_mem_buf_map_.end()) {
     auto mem_buf = iter->second;
     MS_EXCEPTION_IF_NULL(mem_buf);
@@ -189,10 +235,10 @@ void DynamicMemPoolBestFit::SetMemPoolBlockSize(size_t available_device_mem_size
   SetMemAllocUintSize(real_block_size);
 }
 
-DeviceMemPtr DynamicMemPoolBestFit::AddMemBlockAndMemBuf(size_t size, bool from_persistent_mem) {
+DeviceMemPtr DynamicMemPoolBestFit::AddMemBlockAndMemBuf(size_t size, bool from_persistent_mem, uint32_t stream_id) {
   // Persistent mem is not enough, find from common
   if (from_persistent_mem && !persistent_mem_->mem_block_list_.empty()) {
-    auto mem_addr = FindIdleMemBuf(size, false);
+    auto mem_addr = FindIdleMemBuf(size, false, stream_id);
     if (mem_addr != nullptr) {
       return mem_addr;
     }
@@ -201,7 +247,7 @@ DeviceMemPtr DynamicMemPoolBestFit::AddMemBlockAndMemBuf(size_t size, bool from_
   size_t alloc_mem_size = CalMemBlockAllocSize(size, from_persistent_mem);
   if (alloc_mem_size == 0) {
     MS_LOG(DEBUG) << "Try to find in other mem";
-    auto mem_addr = FindIdleMemBuf(size, !from_persistent_mem);
+    auto mem_addr = FindIdleMemBuf(size, !from_persistent_mem, stream_id);
     if (mem_addr != nullptr) {
       return mem_addr;
     }
@@ -289,6 +335,8 @@ void DynamicMemPoolBestFit::SplitMemBuf(size_t size, const DynamicMemBufPtr &mem
   mem_buf->size_ = size;
   DeviceMemPtr newbuf_addr = AddressOffset(mem_buf->device_addr_, size);
   auto new_mem_buf = std::make_shared<DynamicMemBuf>(newbuf_addr, DynamicMemBufStatus::kMemBufIdle, newbuf_size);
+  // The remainder is reusable by exactly the streams that could reuse the original buf.
+  new_mem_buf->free_stream_id_ = mem_buf->free_stream_id_;
   // Add map of new memory buf in the block
   (void)mem_block->block_all_mem_buf_map_.emplace(newbuf_addr, new_mem_buf);
   // Add map of new idle memory buf
@@ -312,7 +360,7 @@ DynamicMemBlockPtr DynamicMemPoolBestFit::FindMemBlock(const DeviceMemPtr &devic
   return nullptr;
 }
 
-void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
+void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr, uint32_t stream_id) {
   MS_EXCEPTION_IF_NULL(device_addr);
   std::lock_guard<std::mutex> locker(mutex_);
   auto fn = [this](const MemStatusManagerPtr &mem_mng, const DeviceMemPtr &device_addr) -> DynamicMemBlockPtr {
@@ -333,19 +381,33 @@ void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
       MS_LOG(DEBUG) << "Can't find the mem_block of the device address[" << device_addr << "].";
       return;
     }
-    CombineMemBuf(mem_block, device_addr, persistent_mem_);
+    CombineMemBuf(mem_block, device_addr, persistent_mem_, stream_id);
   } else {
-    CombineMemBuf(mem_block, device_addr, common_mem_);
+    CombineMemBuf(mem_block, device_addr, common_mem_, stream_id);
   }
 
-  MS_LOG(DEBUG) << "Free memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
+  MS_LOG(DEBUG) << "Free memory details, name:" << AllocatorName(DynamicMemAllocatorDebugInfo::GetDebugInfo().name_)
                 << ", address:" << device_addr << ", total allocated mem:" << TotalMemStatistics()
                 << "B, peak used mem:" << UsedMemPeakStatistics() << "B, in used mem:" << TotalUsedMemStatistics()
                 << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
 }
 
+uint32_t DynamicMemPoolBestFit::MergeStreamTag(uint32_t tag1, uint32_t tag2) {
+  if (tag1 == tag2) {
+    return tag1;
+  }
+  if (tag1 == kAnyStreamIdx) {
+    return tag2;
+  }
+  if (tag2 == kAnyStreamIdx) {
+    return tag1;
+  }
+  // Combined from frees of different streams, no single stream may reuse it before a synchronization point.
+  return kMultiStreamIdx;
+}
+
 void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block, const DeviceMemPtr &device_addr,
-                                          const MemStatusManagerPtr &mem_mng) {
+                                          const MemStatusManagerPtr &mem_mng, uint32_t stream_id) {
   MS_EXCEPTION_IF_NULL(mem_block);
   MS_EXCEPTION_IF_NULL(device_addr);
   const auto &iter = mem_block->block_all_mem_buf_map_.find(device_addr);
@@ -360,6 +422,7 @@ void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block, c
     MS_LOG(EXCEPTION) << "Find the mem_buf is not used, mem_buf_address[" << mem_buf->device_addr_ << "].";
   }
   mem_buf->status_ = DynamicMemBufStatus::kMemBufIdle;
+  mem_buf->free_stream_id_ = stream_id;
   if (mem_mng->mps_.total_used_mem_size_ < mem_buf->size_) {
     DumpDynamicMemPoolDebugInfo();
     MS_LOG(EXCEPTION) << "The total used mem size is less than the size of membuf.";
@@ -373,6 +436,7 @@ void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block, c
     MS_EXCEPTION_IF_NULL(next_mem_buf);
     if (next_mem_buf->status_ == DynamicMemBufStatus::kMemBufIdle) {
       mem_buf->size_ += next_mem_buf->size_;
+      mem_buf->free_stream_id_ = MergeStreamTag(mem_buf->free_stream_id_, next_mem_buf->free_stream_id_);
       EraseIdleMemBuf(next_mem_buf->size_, next_mem_buf->device_addr_, mem_mng);
       (void)mem_block->block_all_mem_buf_map_.erase(next_iter);
     }
@@ -388,6 +452,7 @@ void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block, c
     if (prev_mem_buf->status_ == DynamicMemBufStatus::kMemBufIdle) {
       EraseIdleMemBuf(prev_mem_buf->size_, prev_mem_buf->device_addr_, mem_mng);
       prev_mem_buf->size_ += mem_buf->size_;
+      prev_mem_buf->free_stream_id_ = MergeStreamTag(prev_mem_buf->free_stream_id_, mem_buf->free_stream_id_);
       (void)mem_block->block_all_mem_buf_map_.erase(iter);
       forward_combine = true;
     }
@@ -400,6 +465,64 @@ void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block, c
   }
 }
 
+void DynamicMemPoolBestFit::SyncFreeStreamTags() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  auto fn = [](const MemStatusManagerPtr &mem_mng) {
+    for (auto &iter : mem_mng->idle_mem_buf_map_) {
+      MS_EXCEPTION_IF_NULL(iter.second);
+      iter.second->free_stream_id_ = kAnyStreamIdx;
+    }
+  };
+  fn(common_mem_);
+  fn(persistent_mem_);
+}
+
+size_t DynamicMemPoolBestFit::ReleaseIdleMemBlocks() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  return ReleaseIdleMemBlocksLocked();
+}
+
+size_t DynamicMemPoolBestFit::ReleaseIdleMemBlocksLocked() {
+  size_t released_size = 0;
+  auto fn = [this, &released_size](const MemStatusManagerPtr &mem_mng) {
+    for (auto iter = mem_mng->mem_block_list_.begin(); iter != mem_mng->mem_block_list_.end();) {
+      auto &mem_block = *iter;
+      MS_EXCEPTION_IF_NULL(mem_block);
+      // After the combining in CombineMemBuf, a wholly idle block is exactly one idle buf covering the
+      // block. Only release it when every stream may already reuse the buf, otherwise an in-flight task of
+      // the freeing stream could still be accessing the memory when the device hands it to another process.
+      if (mem_block->block_all_mem_buf_map_.size() != 1) {
+        ++iter;
+        continue;
+      }
+      auto mem_buf = mem_block->block_all_mem_buf_map_.begin()->second;
+      MS_EXCEPTION_IF_NULL(mem_buf);
+      if (mem_buf->status_ != DynamicMemBufStatus::kMemBufIdle || mem_buf->free_stream_id_ != kAnyStreamIdx) {
+        ++iter;
+        continue;
+      }
+      EraseIdleMemBuf(mem_buf->size_, mem_buf->device_addr_, mem_mng);
+      if (!FreeDeviceMem(mem_block->device_addr_base_)) {
+        MS_LOG(EXCEPTION) << "Free device memory[" << mem_block->device_addr() << "] error.";
+      }
+      if (mem_mng->mps_.total_mem_size_ < mem_block->size()) {
+        DumpDynamicMemPoolDebugInfo();
+        MS_LOG(EXCEPTION) << "The total mem size is less than the size of the released mem block.";
+      }
+      mem_mng->mps_.total_mem_size_ -= mem_block->size();
+      released_size += mem_block->size();
+      iter = mem_mng->mem_block_list_.erase(iter);
+    }
+  };
+  fn(common_mem_);
+  fn(persistent_mem_);
+  if (released_size > 0) {
+    MS_LOG(INFO) << "Released " << released_size << "B of wholly idle memory blocks back to the device, "
+                 << "total allocated mem:" << TotalMemStatistics() << "B.";
+  }
+  return released_size;
+}
+
 void DynamicMemPoolBestFit::EraseIdleMemBuf(size_t size, const DeviceMemPtr &device_addr,
                                             const MemStatusManagerPtr &mem_mng) {
   MS_EXCEPTION_IF_NULL(device_addr);
@@ -507,7 +630,8 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
           total_used_mem += mem_buf->size_;
         }
         MS_LOG(INFO) << "  MemBuf info: address[" << mem_buf->device_addr_ << "] size[" << mem_buf->size_ << "] status["
-                     << kBufStatusString.at(mem_buf->status_) << "] name[" << mem_buf->allocator_name_ << "] type["
+                     << kBufStatusString.at(mem_buf->status_) << "] name[" << AllocatorName(mem_buf->allocator_name_)
+                     << "] type["
                      << kAllocatorTypeString.at(mem_buf->allocator_type_) << "].";
       }
     }
@@ -21,6 +21,7 @@
 #include <map>
 #include <vector>
 #include <algorithm>
+#include <functional>
 #include <utility>
 #include <thread>
 #include <mutex>
@@ -44,14 +45,35 @@ static const size_t DYNAMIC_MEM_ALIGN_SIZE = 512;
 // The minimum unit size (1G) of memory block used for dynamic extend.
 static const size_t DYNAMIC_MEM_ALLOC_UNIT_SIZE = 1024 << 20;
 
+// The default stream id used by the callers which do not distinguish streams yet.
+static const uint32_t kDefaultStreamIdx = 0;
+// Stream tag of an idle memory buf which is safe for reuse by every stream: fresh device memory, or memory
+// whose producing stream has been synchronized.
+static const uint32_t kAnyStreamIdx = UINT32_MAX;
+// Stream tag of an idle memory buf combined from frees of several streams, reusable only after the streams
+// are synchronized.
+static const uint32_t kMultiStreamIdx = UINT32_MAX - 1;
+
 // The Comparator of device address from small to large.
 struct DeviceAddrCmp {
   bool operator()(const DeviceMemPtr &addr1, const DeviceMemPtr &addr2) const { return addr1 < addr2; }
 };
 
+// Intern an allocator name and return its stable address. The hot allocation paths record the
+// address instead of copying the string into the thread local debug info and into every memory
+// buf; the characters are only read back when a log sink or the pool dump actually formats them.
+// The interned pool holds the kernel and actor names, so it is bounded by the graph size and
+// lives for the whole process, which also keeps the recorded pointers valid for callers that
+// pass a temporary name.
+const std::string *InternAllocatorName(const std::string &name);
+
+// Format helper for the possibly unset interned name pointers.
+const std::string &AllocatorName(const std::string *name);
+
 // Recording information for debugging the memory allocator.
 struct AllocatorDebugInfo {
-  std::string name_{"Unknown"};
+  // Interned name pointer, see InternAllocatorName.
+  const std::string *name_{nullptr};
   AllocatorType type_{AllocatorType::kOther};
   int input_index_{-1};
   int output_index_{-1};
@@ -62,9 +84,11 @@ class DynamicMemAllocatorDebugInfo {
  public:
   static AllocatorDebugInfo &GetDebugInfo() noexcept { return debug_info_; }
 
-  // Set the debug info when memory alloc.
+  // Set the debug info when memory alloc. The name is recorded by its interned address, so the
+  // per allocation cost is a handful of POD stores instead of a string copy; formatting is
+  // deferred to the sink that reads the info back.
   static void SetDebugInfo(const std::string &name, AllocatorType type, int input_index = -1, int output_index = -1) {
-    debug_info_.name_ = name;
+    debug_info_.name_ = InternAllocatorName(name);
     debug_info_.type_ = type;
     debug_info_.input_index_ = input_index;
     debug_info_.output_index_ = output_index;
@@ -81,7 +105,7 @@ class DynamicMemAllocatorDebugInfo {
 // Memory buf is the smallest operation object of dynamic memory pool.
 struct DynamicMemBuf {
   DynamicMemBuf(DeviceMemPtr addr, DynamicMemBufStatus status, size_t size,
-                const std::string &allocator_name = "Unknown", AllocatorType allocator_type = AllocatorType::kOther)
+                const std::string *allocator_name = nullptr, AllocatorType allocator_type = AllocatorType::kOther)
       : device_addr_(addr),
         status_(status),
         size_(size),
@@ -91,8 +115,12 @@ struct DynamicMemBuf {
   DynamicMemBufStatus status_;
   size_t size_;
 
-  // Debug info.
-  std::string allocator_name_;
+  // For an idle buf, the stream whose allocations may reuse it immediately in stream order; other streams
+  // must wait until the tags are cleared at a synchronization point.
+  uint32_t free_stream_id_{kAnyStreamIdx};
+
+  // Debug info. The name is an interned pointer, see InternAllocatorName.
+  const std::string *allocator_name_;
   AllocatorType allocator_type_;
 };
 using DynamicMemBufPtr = std::shared_ptr<DynamicMemBuf>;
@@ -151,12 +179,27 @@ class DynamicMemPoolBestFit {
       : persistent_mem_(std::make_shared<MemStatusManager>()), common_mem_(std::make_shared<MemStatusManager>()) {}
   virtual ~DynamicMemPoolBestFit();
 
-  // The main program entry of memory alloc.
-  DeviceMemPtr AllocTensorMem(size_t size, bool from_persistent_mem = false);
+  // The main program entry of memory alloc. The stream id makes the reuse stream ordered: an idle buf freed
+  // on the same stream can be reused immediately without waiting for a synchronization point.
+  DeviceMemPtr AllocTensorMem(size_t size, bool from_persistent_mem = false, uint32_t stream_id = kDefaultStreamIdx);
   // The main program entry of continuous memory alloc.
   std::vector<DeviceMemPtr> AllocContinuousTensorMem(const std::vector<size_t> &size_list);
-  // The main program entry of memory free.
-  void FreeTensorMem(const DeviceMemPtr &device_addr);
+  // The main program entry of memory free. The stream id tags the idle buf with the freeing stream.
+  void FreeTensorMem(const DeviceMemPtr &device_addr, uint32_t stream_id = kDefaultStreamIdx);
+
+  // Clear the stream tags of all the idle memory bufs so every stream may reuse them, called by the device
+  // runtimes after the streams are synchronized.
+  void SyncFreeStreamTags();
+
+  // Return the wholly idle memory blocks to the device so that co-located processes can use them, and
+  // return the number of bytes released. Only blocks whose idle memory is already safe for every stream
+  // are released, so call SyncFreeStreamTags after a device synchronization to make more blocks eligible.
+  size_t ReleaseIdleMemBlocks();
+
+  // Register a callback invoked (without the pool lock held) when an allocation cannot be satisfied, so
+  // that owners of cached device memory may release it through FreeTensorMem before the allocation fails
+  // for good. The argument is the required size in bytes.
+  void SetMemPressureCallback(const std::function<void(size_t)> &callback) { mem_pressure_callback_ = callback; }
 
   // Release the real device memory.
   void ReleaseDeviceRes();
@@ -198,10 +241,10 @@ class DynamicMemPoolBestFit {
   virtual size_t CalMemBlockAllocSize(size_t size, bool from_persistent_mem);
 
  private:
-  // Find the idle memory buf by aligned size when memory alloc.
-  DeviceMemPtr FindIdleMemBuf(size_t size, bool from_persistent_mem);
+  // Find the idle memory buf by aligned size when memory alloc, restricted to bufs reusable by the stream.
+  DeviceMemPtr FindIdleMemBuf(size_t size, bool from_persistent_mem, uint32_t stream_id);
   // Add the memory block and memory buf when memory alloc not find the idle memory buf.
-  DeviceMemPtr AddMemBlockAndMemBuf(size_t size, bool from_persistent_mem);
+  DeviceMemPtr AddMemBlockAndMemBuf(size_t size, bool from_persistent_mem, uint32_t stream_id);
   // Judge whether need split the memory buf by alloc size and memory buf size.
   bool IsSplit(size_t tensor_size, size_t mem_buf_size) const;
   // Split the memory buf by alloc size.
@@ -212,14 +255,20 @@ class DynamicMemPoolBestFit {
   static bool CmpMemBlock(const DeviceMemPtr &device_addr, const DynamicMemBlockPtr &mem_block);
   // Combine the memory buf when memory free, to avoid the memory fragmentation.
   void CombineMemBuf(const DynamicMemBlockPtr &mem_block, const DeviceMemPtr &device_addr,
-                     const MemStatusManagerPtr &mem_mng);
+                     const MemStatusManagerPtr &mem_mng, uint32_t stream_id);
+  // The stream tag of an idle buf combined from two idle neighbours.
+  static uint32_t MergeStreamTag(uint32_t tag1, uint32_t tag2);
   // Erase the idle memory buf by size and device address when idle memory buf is combined.
   void EraseIdleMemBuf(size_t size, const DeviceMemPtr &device_addr, const MemStatusManagerPtr &mem_mng);
+  // The implementation of ReleaseIdleMemBlocks, the caller must hold mutex_.
+  size_t ReleaseIdleMemBlocksLocked();
 
   // Support multi-thread.
   std::mutex mutex_;
   MemStatusManagerPtr persistent_mem_{nullptr};
   MemStatusManagerPtr common_mem_{nullptr};
+  // Invoked under memory pressure so cached device memory can be given back, see SetMemPressureCallback.
+  std::function<void(size_t)> mem_pressure_callback_{nullptr};
   // In the graph mode, the unit size set in the context will be modified through the FetchMemUnitSize function, so it
   // needs to be changed back after that
   size_t config_unit_size_{DYNAMIC_MEM_ALLOC_UNIT_SIZE};
@@ -0,0 +1,221 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cxx_api/model/dynamic_batch_scheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include "include/common/utils/utils.h"
+#include "utils/log_adapter.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace {
+constexpr uint64_t kDefaultWindowUs = 2000;
+constexpr size_t kDefaultMaxRequests = 32;
+
+uint64_t GetWindowUs() {
+  auto window_env = common::GetEnv("MS_API_DYNAMIC_BATCH_WINDOW_US");
+  if (window_env.empty()) {
+    return kDefaultWindowUs;
+  }
+  auto window = std::atoll(window_env.c_str());
+  return window > 0 ? static_cast<uint64_t>(window) : kDefaultWindowUs;
+}
+
+size_t GetMaxRequests() {
+  auto max_env = common::GetEnv("MS_API_DYNAMIC_BATCH_MAX_REQUESTS");
+  if (max_env.empty()) {
+    return kDefaultMaxRequests;
+  }
+  auto max_requests = std::atoll(max_env.c_str());
+  return max_requests > 0 ? static_cast<size_t>(max_requests) : kDefaultMaxRequests;
+}
+}  // namespace
+
+DynamicBatchScheduler::DynamicBatchScheduler(RunGraphFunc run_graph)
+    : run_graph_(std::move(run_graph)), window_us_(GetWindowUs()), max_requests_(GetMaxRequests()) {}
+
+bool DynamicBatchScheduler::Enabled() {
+  static const bool enabled = common::GetEnv("MS_API_ENABLE_DYNAMIC_BATCH") == "1";
+  return enabled;
+}
+
+bool DynamicBatchScheduler::IsBatchable(const RequestPtr &request, const RequestPtr &first) {
+  const auto &inputs = *request->inputs;
+  const auto &first_inputs = *first->inputs;
+  if (inputs.size() != first_inputs.size() || inputs.empty()) {
+    return false;
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const auto &shape = inputs[i].Shape();
+    if (inputs[i].DataType() != first_inputs[i].DataType() || shape != first_inputs[i].Shape() || shape.empty() ||
+        shape[0] <= 0) {
+      return false;
+    }
+    // The per request data is concatenated by memory copy, so device resident inputs are not batched.
+    if (inputs[i].IsDevice() || inputs[i].DataSize() == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Status DynamicBatchScheduler::RunBatchedRequests(const std::vector<RequestPtr> &batch) const {
+  const auto &first_inputs = *batch.front()->inputs;
+  // Gather: concatenate the request tensors along the batch dimension.
+  std::vector<MSTensor> batched_inputs;
+  for (size_t i = 0; i < first_inputs.size(); ++i) {
+    auto batched_shape = first_inputs[i].Shape();
+    batched_shape[0] *= static_cast<int64_t>(batch.size());
+    size_t batched_size = first_inputs[i].DataSize() * batch.size();
+    MSTensor batched_tensor(first_inputs[i].Name(), first_inputs[i].DataType(), batched_shape, nullptr, batched_size);
+    auto *dst = reinterpret_cast<uint8_t *>(batched_tensor.MutableData());
+    if (dst == nullptr) {
+      MS_LOG(ERROR) << "Allocate the batched input tensor failed.";
+      return kMCFailed;
+    }
+    size_t offset = 0;
+    for (const auto &request : batch) {
+      const auto &input = (*request->inputs)[i];
+      auto src = input.Data();
+      if (src == nullptr) {
+        MS_LOG(ERROR) << "The input tensor has no host data.";
+        return kMCFailed;
+      }
+      auto ret = memcpy_s(dst + offset, batched_size - offset, src.get(), input.DataSize());
+      if (ret != 0) {
+        MS_LOG(ERROR) << "Gather the batched input tensor failed, memcpy_s error: " << ret;
+        return kMCFailed;
+      }
+      offset += input.DataSize();
+    }
+    batched_inputs.push_back(batched_tensor);
+  }
+
+  std::vector<MSTensor> batched_outputs;
+  auto status = run_graph_(batched_inputs, &batched_outputs);
+  if (status != kSuccess) {
+    return status;
+  }
+
+  // Scatter: every request gets its share of rows of each output.
+  int64_t total_rows = (*batch.front()->inputs)[0].Shape()[0] * static_cast<int64_t>(batch.size());
+  for (const auto &output : batched_outputs) {
+    const auto &shape = output.Shape();
+    if (shape.empty() || shape[0] != total_rows || output.DataSize() == 0) {
+      MS_LOG(INFO) << "The output is not aligned to the batch dimension, fall back to individual runs.";
+      return kMCFailed;
+    }
+  }
+  std::vector<std::shared_ptr<const void>> output_data;
+  for (const auto &output : batched_outputs) {
+    output_data.push_back(output.Data());
+    if (output_data.back() == nullptr) {
+      MS_LOG(ERROR) << "The batched output tensor has no host data.";
+      return kMCFailed;
+    }
+  }
+  for (size_t k = 0; k < batch.size(); ++k) {
+    auto &request = batch[k];
+    request->outputs->clear();
+    for (size_t j = 0; j < batched_outputs.size(); ++j) {
+      const auto &output = batched_outputs[j];
+      auto request_shape = output.Shape();
+      request_shape[0] /= static_cast<int64_t>(batch.size());
+      size_t request_size = output.DataSize() / batch.size();
+      MSTensor request_tensor(output.Name(), output.DataType(), request_shape, nullptr, request_size);
+      auto ret = memcpy_s(request_tensor.MutableData(), request_size,
+                          reinterpret_cast<const uint8_t *>(output_data[j].get()) + k * request_size, request_size);
+      if (ret != 0) {
+        MS_LOG(ERROR) << "Scatter the batched output tensor failed, memcpy_s error: " << ret;
+        return kMCFailed;
+      }
+      request->outputs->push_back(request_tensor);
+    }
+    request->result = kSuccess;
+  }
+  return kSuccess;
+}
+
+void DynamicBatchScheduler::RunBatch(const std::vector<RequestPtr> &batch) const {
+  if (batch.size() > 1) {
+    MS_LOG(INFO) << "Run one batched execution for " << batch.size() << " predict requests.";
+    if (RunBatchedRequests(batch) == kSuccess) {
+      return;
+    }
+  }
+  // A single request, or a batch that could not be executed as one: run the requests one by one.
+  for (const auto &request : batch) {
+    request->result = run_graph_(*request->inputs, request->outputs);
+  }
+}
+
+void DynamicBatchScheduler::RunAsLeader(std::unique_lock<std::mutex> *lock) {
+  // Let the window elapse so the concurrent requests can join, then take a snapshot; the requests arriving later
+  // elect the next leader.
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(window_us_);
+  while (waiting_.size() < max_requests_ && cv_.wait_until(*lock, deadline) != std::cv_status::timeout) {
+  }
+  std::vector<RequestPtr> snapshot;
+  snapshot.swap(waiting_);
+
+  while (!snapshot.empty()) {
+    // Group the snapshot by batchability; each group runs as one batched execution.
+    std::vector<RequestPtr> batch;
+    auto first = snapshot.front();
+    auto iter = std::stable_partition(snapshot.begin(), snapshot.end(),
+                                      [&first](const RequestPtr &request) { return !IsBatchable(request, first); });
+    if (iter == snapshot.end()) {
+      // Nothing is batchable with the first request (including itself, e.g. device resident inputs).
+      batch.push_back(first);
+      snapshot.erase(snapshot.begin());
+    } else {
+      (void)batch.insert(batch.end(), iter, snapshot.end());
+      snapshot.erase(iter, snapshot.end());
+    }
+
+    lock->unlock();
+    RunBatch(batch);
+    lock->lock();
+    for (const auto &request : batch) {
+      request->done = true;
+    }
+    cv_.notify_all();
+  }
+}
+
+Status DynamicBatchScheduler::Predict(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs) {
+  auto request = std::make_shared<Request>();
+  request->inputs = &inputs;
+  request->outputs = outputs;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  waiting_.push_back(request);
+  cv_.notify_all();
+  while (!request->done) {
+    if (!leader_active_) {
+      leader_active_ = true;
+      RunAsLeader(&lock);
+      leader_active_ = false;
+      cv_.notify_all();
+    } else {
+      cv_.wait(lock, [&request, this] { return request->done || !leader_active_; });
+    }
+  }
+  return request->result;
+}
+}  // namespace mindspore
@@ -0,0 +1,68 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_CXX_API_MODEL_DYNAMIC_BATCH_SCHEDULER_H
+#define MINDSPORE_CCSRC_CXX_API_MODEL_DYNAMIC_BATCH_SCHEDULER_H
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "include/api/status.h"
+#include "include/api/types.h"
+
+namespace mindspore {
+// Coalesces concurrent Predict calls into one batched graph execution: the requests arriving within the batching
+// window are concatenated along the batch dimension, executed once, and the outputs are scattered back to the
+// callers. Requests whose inputs cannot be batched (different shapes or types, or a failed batched run) fall back
+// to individual execution, so enabling the scheduler never changes results. Enabled by
+// MS_API_ENABLE_DYNAMIC_BATCH=1, with the window in microseconds set by MS_API_DYNAMIC_BATCH_WINDOW_US and the
+// batch capped by MS_API_DYNAMIC_BATCH_MAX_REQUESTS.
+class DynamicBatchScheduler {
+ public:
+  using RunGraphFunc = std::function<Status(const std::vector<MSTensor> &, std::vector<MSTensor> *)>;
+  explicit DynamicBatchScheduler(RunGraphFunc run_graph);
+  ~DynamicBatchScheduler() = default;
+
+  static bool Enabled();
+  Status Predict(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs);
+
+ private:
+  struct Request {
+    const std::vector<MSTensor> *inputs;
+    std::vector<MSTensor> *outputs;
+    Status result = kSuccess;
+    bool done = false;
+  };
+  using RequestPtr = std::shared_ptr<Request>;
+
+  // Whether the request can join a batch led by the first request: same input count, types and shapes.
+  static bool IsBatchable(const RequestPtr &request, const RequestPtr &first);
+  // Collect the requests arrived within the window and execute them group by group. Called with the lock held.
+  void RunAsLeader(std::unique_lock<std::mutex> *lock);
+  // Execute one group of batchable requests; falls back to individual runs when batching is not possible.
+  void RunBatch(const std::vector<RequestPtr> &batch) const;
+  Status RunBatchedRequests(const std::vector<RequestPtr> &batch) const;
+
+  RunGraphFunc run_graph_;
+  uint64_t window_us_;
+  size_t max_requests_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<RequestPtr> waiting_;
+  bool leader_active_ = false;
+};
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_CXX_API_MODEL_DYNAMIC_BATCH_SCHEDULER_H
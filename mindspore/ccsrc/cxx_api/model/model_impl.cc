@@ -34,6 +34,15 @@ Status ModelImpl::Predict(const std::vector<MSTensor> &inputs, std::vector<MSTen
   }
 
   MS_EXCEPTION_IF_NULL(graph_cell_);
+  if (DynamicBatchScheduler::Enabled()) {
+    std::call_once(batch_scheduler_flag_, [this]() {
+      batch_scheduler_ = std::make_shared<DynamicBatchScheduler>(
+        [this](const std::vector<MSTensor> &batched_inputs, std::vector<MSTensor> *batched_outputs) {
+          return graph_cell_->Run(batched_inputs, batched_outputs);
+        });
+    });
+    return batch_scheduler_->Predict(inputs, outputs);
+  }
   Status ret = graph_cell_->Run(inputs, outputs);
   if (ret != kSuccess) {
     MS_LOG(ERROR) << "Run graph failed.";
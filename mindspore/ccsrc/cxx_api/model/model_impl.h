@@ -16,12 +16,14 @@
 #ifndef MINDSPORE_CCSRC_CXX_API_MODEL_MODEL_IMPL_H
 #define MINDSPORE_CCSRC_CXX_API_MODEL_MODEL_IMPL_H
 #include <functional>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include "include/api/context.h"
 #include "include/api/model.h"
 #include "include/api/graph.h"
 #include "cxx_api/graph/graph_data.h"
+#include "cxx_api/model/dynamic_batch_scheduler.h"
 #include "include/common/utils/utils.h"
 #include "ir/func_graph.h"
 
@@ -63,6 +65,9 @@ class ModelImpl {
   std::shared_ptr<Graph> graph_ = nullptr;
   std::shared_ptr<GraphCell> graph_cell_ = nullptr;
   std::shared_ptr<Context> model_context_ = nullptr;
+  // Coalesces concurrent Predict calls into batched executions, created lazily when the dynamic batching is enabled.
+  std::shared_ptr<DynamicBatchScheduler> batch_scheduler_ = nullptr;
+  std::once_flag batch_scheduler_flag_;
 
  private:
   friend class Model;
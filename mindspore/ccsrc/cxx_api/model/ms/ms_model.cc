@@ -66,7 +66,11 @@ std::shared_ptr<GraphCell> MsModel::GenerateGraphCell(const std::vector<std::vec
       MS_LOG(ERROR) << "Inputs " << i << " is not supported to resize, debug string: " << param->DebugString();
       return nullptr;
     }
-    shape_ptr->set_shape(dims[i]);
+    // The Shape instance can be shared through the static shape intern pool, so never mutate it in place:
+    // give the parameter's abstract a freshly constructed shape instead.
+    auto abstract = param->abstract();
+    MS_EXCEPTION_IF_NULL(abstract);
+    abstract->set_shape(std::make_shared<abstract::Shape>(dims[i]));
   }
 
   auto graph = std::make_shared<Graph>(std::make_shared<Graph::GraphData>(func_graph, ModelType::kMindIR));
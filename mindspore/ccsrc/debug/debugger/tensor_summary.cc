@@ -118,8 +118,47 @@ TensorSummary<T>::TensorSummary(const void *current_tensor_ptr, const void *cons
  * Description: Initialize watchpoints calculators based on the watchpoint category. Process all the elements within the
  * current tensor.
  */
+/*
+ * Feature group: Online debugger, Offline debugger.
+ * Target device group: Ascend, GPU.
+ * Runtime category: Old runtime, MindRT.
+ * Description: Decide the nan/inf only watchpoints with a tight scan. The general element loop converts every
+ * element to double and feeds the calculators of all the watchpoints, which is what makes watching every tensor
+ * too expensive for production. Overflow watchpoints only read nan_count_ and inf_count_ as presence flags, so
+ * the scan can stop at the first nan once an inf was seen and vice versa.
+ */
+template <typename T>
+bool TensorSummary<T>::SummarizeOverflowOnly(const std::vector<DebugServices::watchpoint_t> &wps) {
+  for (auto &wp : wps) {
+    CONDITION_TYPE type = wp.condition.type;
+    if (type != CONDITION_TYPE::HAS_NAN && type != CONDITION_TYPE::HAS_INF &&
+        type != CONDITION_TYPE::GENERAL_OVERFLOW) {
+      return false;
+    }
+  }
+  if (!std::is_floating_point<T>::value && !std::is_same<T, float16>::value) {
+    // Integer and bool tensors can not hold nan or inf, the zero initialized counts are the answer.
+    return true;
+  }
+  for (size_t i = 0; i < num_elements_; ++i) {
+    auto current_value = static_cast<double>(current_tensor_ptr_[i]);
+    if (std::isnan(current_value)) {
+      nan_count_ += 1;
+    } else if (std::isinf(current_value)) {
+      inf_count_ += 1;
+    }
+    if (nan_count_ > 0 && inf_count_ > 0) {
+      break;
+    }
+  }
+  return true;
+}
+
 template <typename T>
 void TensorSummary<T>::SummarizeTensor(const std::vector<DebugServices::watchpoint_t> &wps) {
+  if (SummarizeOverflowOnly(wps)) {
+    return;
+  }
   InitCalculators(wps);
   for (size_t i = 0; i < num_elements_; ++i) {
     auto current_value = static_cast<double>(current_tensor_ptr_[i]);
@@ -163,6 +163,10 @@ class TensorSummary : public ITensorSummary {
   double_t GetZeroValPercent();
   void TensorStatisticsSingleThread();
   void InitCalculators(const std::vector<DebugServices::watchpoint_t> &);
+  // Fast path when every watchpoint only asks for nan/inf presence: scan without the per element
+  // calculators and stop as soon as the outcome of all the watchpoints is decided. Returns false
+  // when some watchpoint needs the full summary.
+  bool SummarizeOverflowOnly(const std::vector<DebugServices::watchpoint_t> &wps);
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_TENSOR_SUMMARY_H
@@ -0,0 +1,55 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "debug/rdr/alloc_counter_recorder.h"
+#include <sys/stat.h>
+#include <fstream>
+#include <utility>
+#include "include/common/debug/alloc_counter.h"
+#include "include/common/debug/rdr/recorder_manager.h"
+#include "mindspore/core/utils/file_utils.h"
+#include "mindspore/core/utils/log_adapter.h"
+
+namespace mindspore {
+void AllocCounterRecorder::Export() {
+  auto realpath = GetFileRealPath();
+  if (!realpath.has_value()) {
+    return;
+  }
+  std::string file_path = realpath.value() + ".csv";
+  ChangeFileMode(file_path, S_IRWXU);
+  std::ofstream fout(file_path, std::ofstream::app);
+  if (!fout.is_open()) {
+    MS_LOG(WARNING) << "Open file for saving alloc counter failed. File path: '" << file_path << "'.";
+    return;
+  }
+  fout << AllocCounter::GetInstance().DumpToString();
+  fout.close();
+  // set file mode to read only by user
+  ChangeFileMode(file_path, S_IRUSR);
+}
+
+namespace RDR {
+bool RecordAllocCounter(SubModuleId module, const std::string &name) {
+  if (!mindspore::RecorderManager::Instance().RdrEnable()) {
+    return false;
+  }
+  std::string submodule_name = std::string(GetSubModuleName(module));
+  AllocCounterRecorderPtr alloc_counter_recorder = std::make_shared<AllocCounterRecorder>(submodule_name, name);
+  bool ans = mindspore::RecorderManager::Instance().RecordObject(std::move(alloc_counter_recorder));
+  return ans;
+}
+}  // namespace RDR
+}  // namespace mindspore
@@ -0,0 +1,41 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_DEBUG_RDR_ALLOC_COUNTER_RECORDER_H_
+#define MINDSPORE_CCSRC_DEBUG_RDR_ALLOC_COUNTER_RECORDER_H_
+
+#include <string>
+#include <memory>
+
+#include "include/common/debug/rdr/base_recorder.h"
+
+namespace mindspore {
+// Exports the per-scope host allocation counters gathered by AllocCounter. The counters are read at
+// export time, so the report reflects the state when rdr is triggered, not when the recorder was
+// registered.
+class AllocCounterRecorder : public BaseRecorder {
+ public:
+  AllocCounterRecorder() : BaseRecorder() {}
+  AllocCounterRecorder(const std::string &module, const std::string &name) : BaseRecorder(module, name) {}
+  ~AllocCounterRecorder() {}
+  void Export() override;
+};
+using AllocCounterRecorderPtr = std::shared_ptr<AllocCounterRecorder>;
+
+namespace RDR {
+bool RecordAllocCounter(SubModuleId module, const std::string &name);
+}  // namespace RDR
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_DEBUG_RDR_ALLOC_COUNTER_RECORDER_H_
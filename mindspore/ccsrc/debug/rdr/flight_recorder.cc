@@ -0,0 +1,113 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "debug/rdr/flight_recorder.h"
+#include <sys/stat.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <utility>
+#include "include/common/utils/utils.h"
+#include "mindspore/core/utils/log_adapter.h"
+#include "include/common/debug/rdr/recorder_manager.h"
+#include "mindspore/core/utils/file_utils.h"
+
+namespace mindspore {
+namespace {
+// 64K events of 32 bytes: a fixed 2MB footprint covering the recent-history window we need for a hang.
+constexpr uint64_t kFlightRingCapacity = 1 << 16;
+FlightEvent g_flight_ring[kFlightRingCapacity];
+// Total number of events ever written; slot = index % capacity. A writer claims its slot with one
+// relaxed fetch_add, so appending never takes a lock and never contends beyond the single counter.
+std::atomic<uint64_t> g_flight_next{0};
+std::atomic<bool> g_flight_registered{false};
+
+// Header prepended to the raw ring in the exported file, everything an offline decoder needs to
+// reconstruct event order (including whether the ring has wrapped).
+struct FlightFileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t event_size;
+  uint32_t reserved;
+  uint64_t capacity;
+  uint64_t next_index;
+};
+
+uint32_t FlightThreadId() {
+  static std::atomic<uint32_t> next_tid{0};
+  static thread_local uint32_t tid = next_tid.fetch_add(1, std::memory_order_relaxed);
+  return tid;
+}
+}  // namespace
+
+void FlightRecorder::Export() {
+  auto realpath = GetFileRealPath();
+  if (!realpath.has_value()) {
+    return;
+  }
+  std::string file_path = realpath.value() + ".bin";
+  ChangeFileMode(file_path, S_IRWXU);
+  std::ofstream fout(file_path, std::ofstream::binary);
+  if (!fout.is_open()) {
+    MS_LOG(WARNING) << "Open file for saving flight events failed. File path: '" << file_path << "'.";
+    return;
+  }
+  FlightFileHeader header;
+  header.magic[0] = 'M';
+  header.magic[1] = 'S';
+  header.magic[2] = 'F';
+  header.magic[3] = 'R';
+  header.version = 1;
+  header.event_size = sizeof(FlightEvent);
+  header.reserved = 0;
+  header.capacity = kFlightRingCapacity;
+  header.next_index = g_flight_next.load(std::memory_order_acquire);
+  fout.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  // Writers are not stopped; at most a handful of slots near next_index are torn and the decoder
+  // discards them by timestamp. Dumping raw keeps the failure path free of per-event formatting.
+  fout.write(reinterpret_cast<const char *>(g_flight_ring), sizeof(g_flight_ring));
+  fout.close();
+  // set file mode to read only by user
+  ChangeFileMode(file_path, S_IRUSR);
+}
+
+namespace RDR {
+bool RecordFlightEvent(SubModuleId module, uint16_t event, uint64_t arg0, uint64_t arg1) {
+  if (!mindspore::RecorderManager::Instance().RdrEnable()) {
+    return false;
+  }
+  // Unlike the string recorders there is one global ring; register its recorder on the first event so
+  // the dump shows up with the others, then every later call is just the slot claim and six stores.
+  if (!g_flight_registered.load(std::memory_order_acquire)) {
+    bool expected = false;
+    if (g_flight_registered.compare_exchange_strong(expected, true)) {
+      FlightRecorderPtr flight_recorder = std::make_shared<FlightRecorder>("RDR", "flight_events");
+      (void)mindspore::RecorderManager::Instance().RecordObject(std::move(flight_recorder));
+    }
+  }
+  uint64_t slot = g_flight_next.fetch_add(1, std::memory_order_relaxed) % kFlightRingCapacity;
+  FlightEvent &ev = g_flight_ring[slot];
+  ev.timestamp_ns = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count());
+  ev.tid = FlightThreadId();
+  ev.module = static_cast<uint16_t>(module);
+  ev.event = event;
+  ev.arg0 = arg0;
+  ev.arg1 = arg1;
+  return true;
+}
+}  // namespace RDR
+}  // namespace mindspore
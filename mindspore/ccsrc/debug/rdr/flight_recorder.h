@@ -0,0 +1,53 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_DEBUG_RDR_FLIGHT_RECORDER_H_
+#define MINDSPORE_CCSRC_DEBUG_RDR_FLIGHT_RECORDER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "include/common/debug/rdr/base_recorder.h"
+namespace mindspore {
+// One fixed-size flight recorder entry. Writers only store plain integers, never build strings, so
+// recording stays cheap enough to leave enabled in production; the meaning of event and the arguments
+// is decoded offline from the dumped binary.
+struct FlightEvent {
+  uint64_t timestamp_ns;  // monotonic clock
+  uint32_t tid;           // small per-process thread number, stable for the thread lifetime
+  uint16_t module;        // SubModuleId of the writer
+  uint16_t event;         // writer-defined event code
+  uint64_t arg0;
+  uint64_t arg1;
+};
+
+// Dumps the global binary event ring on failure, see RDR::RecordFlightEvent.
+class FlightRecorder : public BaseRecorder {
+ public:
+  FlightRecorder() : BaseRecorder() {}
+  FlightRecorder(const std::string &module, const std::string &name) : BaseRecorder(module, name) {}
+  ~FlightRecorder() {}
+  void Export() override;
+};
+using FlightRecorderPtr = std::shared_ptr<FlightRecorder>;
+namespace RDR {
+// Append one structured event to the global flight ring. Lock-free: the writer claims a slot with one
+// atomic increment and stores 32 bytes, old events are overwritten once the ring wraps. The ring is
+// dumped with the other rdr recorders on failure and decoded offline.
+bool RecordFlightEvent(SubModuleId module, uint16_t event, uint64_t arg0, uint64_t arg1);
+}  // namespace RDR
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_DEBUG_RDR_FLIGHT_RECORDER_H_
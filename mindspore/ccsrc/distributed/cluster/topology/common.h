@@ -54,6 +54,19 @@ constexpr char kEnvMetaServerPort[] = "MS_SCHED_PORT";
 
 constexpr char kEnvNodeId[] = "MS_NODE_ID";
 
+// The timeout(milliseconds) of heartbeat from compute graph node, overriding the node timeout passed to the
+// meta server node. Sub-second values shorten the failure detection latency for fast failover.
+constexpr char kEnvNodeTimeout[] = "MS_NODE_TIMEOUT";
+
+// The interval(milliseconds) between two heartbeats from compute graph node to meta server node.
+constexpr char kEnvHeartbeatInterval[] = "MS_HEARTBEAT_INTERVAL";
+
+// The default interval(milliseconds) for heartbeat sending and node state monitoring.
+static const uint64_t kDefaultHeartbeatInterval = 3000;
+
+// For the conversion from the second-based node timeout to milliseconds.
+static const uint64_t kMsPerSecond = 1000;
+
 // The key of compute graph node's hostname metadata stored in meta server.
 constexpr char kHostNames[] = "hostnames";
 
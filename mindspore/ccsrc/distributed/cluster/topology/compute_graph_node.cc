@@ -235,7 +235,13 @@ bool ComputeGraphNode::Heartbeat() {
     MS_EXCEPTION_IF_NULL(hb_client_);
 
     MS_LOG(INFO) << "The heartbeat thread is started.";
-    size_t interval = 3;
+    // The heartbeat interval can be shortened(in milliseconds) by the env MS_HEARTBEAT_INTERVAL to match a
+    // sub-second node timeout configured on the meta server node.
+    uint64_t interval = kDefaultHeartbeatInterval;
+    const auto &env_interval = common::GetEnv(kEnvHeartbeatInterval);
+    if (!env_interval.empty()) {
+      interval = std::strtoull(env_interval.c_str(), nullptr, kDecimal);
+    }
     size_t timeout = 10;
 
     while (enable_hb_) {
@@ -282,7 +288,7 @@ bool ComputeGraphNode::Heartbeat() {
         }
       }
 
-      sleep(interval);
+      std::this_thread::sleep_for(std::chrono::milliseconds(interval));
     }
 
     MS_LOG(INFO) << "The heartbeat thread is finished.";
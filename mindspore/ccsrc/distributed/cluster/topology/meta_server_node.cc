@@ -59,6 +59,21 @@ bool MetaServerNode::Initialize() {
 
   start_time_ = Now();
 
+  // Refine the failure detection granularity to milliseconds so that sub-second node timeouts can be
+  // configured for fast failover.
+  const auto &env_timeout = common::GetEnv(kEnvNodeTimeout);
+  if (!env_timeout.empty()) {
+    node_timeout_ms_ = std::strtoull(env_timeout.c_str(), nullptr, kDecimal);
+  } else {
+    node_timeout_ms_ = node_timeout_ * kMsPerSecond;
+  }
+  const auto &env_interval = common::GetEnv(kEnvHeartbeatInterval);
+  const uint64_t heartbeat_interval_ms =
+    env_interval.empty() ? kDefaultHeartbeatInterval : std::strtoull(env_interval.c_str(), nullptr, kDecimal);
+  // The monitor has to poll at least twice within a node timeout, otherwise a failed node could stay
+  // undetected for a whole extra polling period.
+  monitor_interval_ms_ = std::min(heartbeat_interval_ms, std::max<uint64_t>(node_timeout_ms_ / 2, 1));
+
   // Init the thread for monitoring the state of the cluster topo.
   topo_monitor_ = std::thread(&MetaServerNode::UpdateTopoState, this);
   return true;
@@ -175,7 +190,7 @@ MessageBase *const MetaServerNode::ProcessRegister(MessageBase *const message) {
     node_info->role = role;
     node_info->rank_id = rank_id;
     node_info->state = NodeState::kRegistered;
-    time(&(node_info->last_update));
+    node_info->last_update = Now();
     nodes_[node_id] = node_info;
     MS_LOG(INFO) << "The new node: " << node_id << "(role: " << role << ")"
                  << " is registered successfully.";
@@ -194,6 +209,11 @@ MessageBase *const MetaServerNode::ProcessRegister(MessageBase *const message) {
     MS_LOG(INFO) << "The node: " << node_id << " have been recovered.";
     auto node_info = nodes_[node_id];
     MS_EXCEPTION_IF_NULL(node_info);
+    // The node is re-registered, eg. replaced by a standby process after failover. Mark it alive immediately
+    // with its original rank id instead of waiting for the next heartbeat, so that only this node needs to
+    // rebuild its state and the rest of the cluster resumes as soon as possible.
+    node_info->state = NodeState::kRegistered;
+    node_info->last_update = Now();
 
     RegistrationRespMessage reg_resp_msg;
     reg_resp_msg.set_success(true);
@@ -250,7 +270,7 @@ MessageBase *const MetaServerNode::ProcessHeartbeat(MessageBase *const message)
   std::shared_lock<std::shared_mutex> lock(nodes_mutex_);
   if (nodes_.find(node_id) != nodes_.end()) {
     auto &node = nodes_[node_id];
-    time(&(node->last_update));
+    node->last_update = Now();
     node->state = NodeState::kRegistered;
 
     HeartbeatRespMessage resp_msg;
@@ -403,9 +423,8 @@ void MetaServerNode::UpdateTopoState() {
         auto node_id = iter->first;
         auto node_info = iter->second;
         MS_EXCEPTION_IF_NULL(node_info);
-        time_t now = time(&now);
-        auto elapsed = difftime(now, node_info->last_update);
-        if (elapsed > node_timeout_) {
+        auto elapsed = ElapsedTime(node_info->last_update);
+        if (static_cast<uint64_t>(elapsed.count()) > node_timeout_ms_) {
           node_info->state = NodeState::kTimeout;
           ++abnormal_node_num;
           MS_LOG(ERROR) << "The node: " << node_id << " is timed out.";
@@ -418,8 +437,7 @@ void MetaServerNode::UpdateTopoState() {
 
       nodes_mutex_.unlock();
 
-      static const size_t interval = 3;
-      sleep(interval);
+      std::this_thread::sleep_for(std::chrono::milliseconds(monitor_interval_ms_));
     }
   } catch (const std::exception &e) {
     nodes_mutex_.unlock();
@@ -472,7 +490,7 @@ bool MetaServerNode::Recovery() {
     for (auto iter = node_states.begin(); iter != node_states.end(); ++iter) {
       const auto &node_id = iter.key();
       std::shared_ptr<NodeInfo> node_info = std::make_shared<NodeInfo>(node_id);
-      time(&(node_info->last_update));
+      node_info->last_update = Now();
       node_info->host_name = iter.value().at(kHostName);
       node_info->role = iter.value().at(kRole);
       node_info->rank_id = iter.value().at(kRankId);
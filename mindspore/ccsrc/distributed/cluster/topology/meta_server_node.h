@@ -20,6 +20,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <chrono>
 #include <thread>
 #include <shared_mutex>
 #include "distributed/rpc/tcp/tcp_server.h"
@@ -61,7 +62,7 @@ struct NodeInfo {
 
   // The timestamp of last heartbeat.
   // This timestamp is considered the health state of the node.
-  time_t last_update;
+  std::chrono::high_resolution_clock::time_point last_update;
 
   // Maintain the state of the node.
   NodeState state{NodeState::kNew};
@@ -172,6 +173,11 @@ class MetaServerNode : public NodeBase {
 
   uint64_t node_timeout_;
 
+  // The node timeout and the monitor polling interval in milliseconds, refined by the env MS_NODE_TIMEOUT
+  // and MS_HEARTBEAT_INTERVAL so that sub-second failure detection can be configured.
+  uint64_t node_timeout_ms_{kDefaultNodeTimeout * kMsPerSecond};
+  uint64_t monitor_interval_ms_{kDefaultHeartbeatInterval};
+
   // A key-value pairs metadata config used for failover recovery if enabled.
   std::unique_ptr<recovery::Configuration> configuration_;
 
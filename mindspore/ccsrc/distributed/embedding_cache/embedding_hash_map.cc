@@ -33,18 +33,18 @@ int EmbeddingHashMap::ParseData(const int id, int *const swap_out_index, int *co
   if (!need_swap) {
     hash_count_++;
     (void)hash_id_to_index_.emplace(id, hash_index);
-    hash_map_elements_[hash_index].set_id(id);
-    hash_map_elements_[hash_index].set_step(data_step);
+    hash_map_ids_[hash_index] = id;
+    hash_map_steps_[hash_index] = data_step;
     return hash_index;
   }
 
   swap_out_index[*swap_out_size] = hash_index;
-  swap_out_ids[*swap_out_size] = hash_map_elements_[hash_index].id_;
+  swap_out_ids[*swap_out_size] = hash_map_ids_[hash_index];
   (*swap_out_size)++;
-  (void)hash_id_to_index_.erase(hash_map_elements_[hash_index].id_);
+  (void)hash_id_to_index_.erase(hash_map_ids_[hash_index]);
   (void)hash_id_to_index_.emplace(id, hash_index);
-  hash_map_elements_[hash_index].set_id(id);
-  hash_map_elements_[hash_index].set_step(data_step);
+  hash_map_ids_[hash_index] = id;
+  hash_map_steps_[hash_index] = data_step;
   return hash_index;
 }
 
@@ -54,12 +54,14 @@ int EmbeddingHashMap::FindInsertionPos(const size_t, const size_t graph_running_
   MS_EXCEPTION_IF_NULL(need_wait_graph);
   int hash_index = INVALID_INDEX_VALUE;
   while (!expired_element_full_) {
-    if (hash_map_elements_[current_pos_].IsEmpty()) {
+    // The sweep only reads the dense step array, so a long run of busy slots stays within few cache lines.
+    const size_t step = hash_map_steps_[current_pos_];
+    if (step == INVALID_STEP_VALUE) {
       hash_index = current_pos_;
-    } else if (hash_map_elements_[current_pos_].IsExpired(graph_running_step)) {
+    } else if (graph_running_step > step) {
       hash_index = current_pos_;
       *need_swap = true;
-    } else if (hash_map_elements_[current_pos_].StepEqual(graph_running_step)) {
+    } else if (step == graph_running_step) {
       graph_running_index_[graph_running_index_num_++] = current_pos_;
     }
     current_pos_ = (current_pos_ + 1) % hash_capacity_;
@@ -88,10 +90,9 @@ void EmbeddingHashMap::DumpHashMap() {
     MS_LOG(INFO) << "  id: " << iter->first << " index: " << iter->second;
   }
   MS_LOG(INFO) << "Dump hash_map_unit: ";
-  for (size_t i = 0; i < hash_map_elements_.size(); i++) {
-    if (!hash_map_elements_[i].IsEmpty()) {
-      MS_LOG(INFO) << "  index: " << i << " id: " << hash_map_elements_[i].id_
-                   << " step: " << hash_map_elements_[i].step_;
+  for (size_t i = 0; i < hash_map_steps_.size(); i++) {
+    if (hash_map_steps_[i] != INVALID_STEP_VALUE) {
+      MS_LOG(INFO) << "  index: " << i << " id: " << hash_map_ids_[i] << " step: " << hash_map_steps_[i];
     }
   }
   MS_LOG(INFO) << "Dump hash map info end.";
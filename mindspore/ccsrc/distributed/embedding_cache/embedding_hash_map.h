@@ -31,18 +31,6 @@ static constexpr size_t INVALID_STEP_VALUE = 0;
 // Define the value of an invalid index.
 static constexpr int INVALID_INDEX_VALUE = -1;
 
-struct HashMapElement {
-  int id_{INVALID_INDEX_VALUE};
-  // The current global step of cache prefetching operation.
-  size_t step_{INVALID_STEP_VALUE};
-
-  bool IsEmpty() const { return step_ == INVALID_STEP_VALUE; }
-  bool IsExpired(size_t graph_running_step) const { return graph_running_step > step_; }
-  bool StepEqual(size_t step) const { return step_ == step; }
-  void set_id(int id) { id_ = id; }
-  void set_step(size_t step) { step_ = step; }
-};
-
 // EmbeddingHashMap is used to manage the id -> index mapping of the embedding cache table on the host
 // side. The cache content can be stored on the device or host side.
 class EmbeddingHashMap {
@@ -55,12 +43,16 @@ class EmbeddingHashMap {
         graph_running_index_num_(0),
         graph_running_index_pos_(0),
         expired_element_full_(false) {
-    hash_map_elements_.resize(hash_capacity);
+    // The steps and ids of the slots are kept in two dense arrays instead of one array of structs, because
+    // the insertion position sweep only inspects the steps: scanning a dense step array touches half the
+    // cache lines and the ids are loaded only for the slot that is actually evicted.
+    hash_map_steps_.resize(hash_capacity, INVALID_STEP_VALUE);
+    hash_map_ids_.resize(hash_capacity, INVALID_INDEX_VALUE);
     // In multi-device mode, embedding table are distributed on different devices by id interval,
     // and ids outside the range of local device will use the front and back positions of the table,
     // the positions are reserved for this.
-    hash_map_elements_.front().set_step(SIZE_MAX);
-    hash_map_elements_.back().set_step(SIZE_MAX);
+    hash_map_steps_.front() = SIZE_MAX;
+    hash_map_steps_.back() = SIZE_MAX;
     graph_running_index_ = std::make_unique<int[]>(hash_capacity);
   }
 
@@ -72,11 +64,9 @@ class EmbeddingHashMap {
                 const size_t graph_running_step, size_t *const swap_out_size, bool *const need_wait_graph);
 
   // Get the global step of a element in hash map.
-  size_t hash_step(const int hash_index) const { return hash_map_elements_[IntToSize(hash_index)].step_; }
+  size_t hash_step(const int hash_index) const { return hash_map_steps_[IntToSize(hash_index)]; }
   // Set the global step of a element in hash map.
-  void set_hash_step(const int hash_index, const size_t step) {
-    hash_map_elements_[IntToSize(hash_index)].set_step(step);
-  }
+  void set_hash_step(const int hash_index, const size_t step) { hash_map_steps_[IntToSize(hash_index)] = step; }
 
   // Get the id -> index mapping.
   const mindspore::HashMap<int, int> &hash_id_to_index() const { return hash_id_to_index_; }
@@ -100,8 +90,11 @@ class EmbeddingHashMap {
   // The hash map capacity.
   size_t hash_capacity_;
 
-  // Record all elements in this hash map.
-  std::vector<HashMapElement> hash_map_elements_;
+  // The global step of each slot, scanned densely by FindInsertionPos; INVALID_STEP_VALUE marks an empty slot.
+  std::vector<size_t> hash_map_steps_;
+
+  // The id cached in each slot, only read for a slot picked for eviction.
+  std::vector<int> hash_map_ids_;
 
   // The id -> index mapping.
   mindspore::HashMap<int, int> hash_id_to_index_;
@@ -19,6 +19,8 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <string>
 #include <thread>
@@ -79,6 +81,16 @@ class PersistentData : public Data<T> {
   // In disaster recovery mode, memory of tensor need to be saved into disk file periodically.
   void Persist(const storage::DirtyInfo &dirty_info) const;
 
+  // Record that the slice on the first dimension indexed by dirty_value has been modified in memory.
+  // The marked slices are accumulated in ascending order without duplicates and flushed together by the
+  // no-argument Persist overload.
+  void MarkDirty(int dirty_value);
+
+  // Persist only the slices marked dirty through MarkDirty since the last persistence, then clear the marks.
+  // Only the block files containing dirty slices are rewritten, so the persistence I/O is proportional to
+  // the modified part of the tensor rather than its whole size.
+  void Persist() const;
+
   // In disaster recovery mode, server node or worker node need to restore persistent data when restart.
   void Restore() const;
 
@@ -89,6 +101,14 @@ class PersistentData : public Data<T> {
 
   // The file storage handle used to persist data.
   std::shared_ptr<storage::StorageBase> storage_;
+
+  // The slices marked dirty since the last persistence, kept ordered because the storage module requires
+  // ascending dirty info when mapping it to block files.
+  mutable std::set<int> dirty_slices_;
+
+  // Used to guarantee the mutual exclusion of marking dirty slices and flushing them, because the persistence
+  // task usually runs in a separate thread from the update of the tensor.
+  mutable std::mutex dirty_slices_mutex_;
 };
 
 template <typename T>
@@ -103,6 +123,23 @@ void PersistentData<T>::Persist(const storage::DirtyInfo &dirty_info) const {
   storage_->Write(input, dirty_info);
 }
 
+template <typename T>
+void PersistentData<T>::MarkDirty(int dirty_value) {
+  std::lock_guard<std::mutex> lock(dirty_slices_mutex_);
+  (void)dirty_slices_.insert(dirty_value);
+}
+
+template <typename T>
+void PersistentData<T>::Persist() const {
+  storage::DirtyInfo dirty_info;
+  {
+    std::lock_guard<std::mutex> lock(dirty_slices_mutex_);
+    dirty_info.assign(dirty_slices_.begin(), dirty_slices_.end());
+    dirty_slices_.clear();
+  }
+  Persist(dirty_info);
+}
+
 template <typename T>
 void PersistentData<T>::Restore() const {
   storage::OutputData output = std::make_pair(Data<T>::data(), Data<T>::size() * sizeof(T));
@@ -51,7 +51,7 @@ void SocketEventHandler(int fd, uint32_t events, void *context) {
   }
   // Handle write event.
   if (events & EPOLLOUT) {
-    (void)conn->recv_event_loop->UpdateEpollEvent(fd, EPOLLIN | EPOLLHUP | EPOLLERR);
+    (void)conn->recv_event_loop->UpdateEpollEvent(fd, EPOLLIN | EPOLLET | EPOLLHUP | EPOLLERR);
     if (conn->write_callback != nullptr) {
       conn->write_callback(conn);
     }
@@ -99,7 +99,10 @@ void NewConnectEventHandler(int fd, uint32_t events, void *context) {
     return;
   }
 
-  retval = conn->recv_event_loop->SetEventHandler(conn->socket_fd, EPOLLIN | EPOLLHUP | EPOLLRDHUP | EPOLLERR,
+  // The data socket is registered edge-triggered: with thousands of connections, level-triggered epoll
+  // wakes the comm thread once per readable connection per loop even if the handler could not keep up.
+  // The socket is non-blocking and the read callback drains it until EAGAIN, so no events are lost.
+  retval = conn->recv_event_loop->SetEventHandler(conn->socket_fd, EPOLLIN | EPOLLET | EPOLLHUP | EPOLLRDHUP | EPOLLERR,
                                                   SocketEventHandler, reinterpret_cast<void *>(conn));
   if (retval != RPC_OK) {
     MS_LOG(ERROR) << "Failed to add socket event handler for fd: " << fd << ", events: " << events;
@@ -199,8 +202,9 @@ bool Connection::ReconnectSourceSocket(int fd, uint32_t events, int *soError, ui
   if (*soError || error) {
     return false;
   }
-  retval = recv_event_loop->SetEventHandler(socket_fd, EPOLLIN | EPOLLHUP | EPOLLRDHUP | EPOLLERR, SocketEventHandler,
-                                            reinterpret_cast<void *>(this));
+  // Edge-triggered, see NewConnectEventHandler: the socket is non-blocking and drained until EAGAIN.
+  retval = recv_event_loop->SetEventHandler(socket_fd, EPOLLIN | EPOLLET | EPOLLHUP | EPOLLRDHUP | EPOLLERR,
+                                            SocketEventHandler, reinterpret_cast<void *>(this));
   if (retval != RPC_OK) {
     MS_LOG(ERROR) << "Failed to add socket event handler for fd: " << fd << ", events: " << events;
     return false;
@@ -436,10 +440,61 @@ void Connection::FillRecvMessage() {
 
 int Connection::Flush() {
   int total_send_bytes = 0;
+  // The batch message count must survive the retry iterations after EAGAIN, otherwise the already batched messages
+  // would neither be accounted nor released when the send completes.
+  size_t batch_msg_count = 0;
   while (!send_message_queue.empty() || total_send_len != 0) {
     if (total_send_len == 0) {
       FillSendMessage(send_message_queue.front(), source, false);
       send_message_queue.pop();
+
+      // Coalesce several queued messages into the same scatter-gather send as the current one, so that links
+      // carrying many small messages pay one sendmsg syscall per batch instead of one per message. Only a freshly
+      // filled kernel message can be batched: a partially sent one already has an adjusted io vector.
+      if (send_kernel_msg.msg_iovlen == SEND_MSG_IO_VEC_LEN) {
+        size_t batch_iov_count = 0;
+        for (size_t i = 0; i < SEND_MSG_IO_VEC_LEN; ++i) {
+          batch_io_vec[batch_iov_count++] = send_io_vec[i];
+        }
+        while (batch_msg_count < SEND_MSG_BATCH_LEN && !send_message_queue.empty() &&
+               send_message_queue.front()->type == MessageBase::Type::KMSG) {
+          MessageBase *msg = send_message_queue.front();
+          send_message_queue.pop();
+          size_t slot = batch_msg_count;
+          batch_send_to[slot] = msg->to;
+          batch_send_from[slot] = msg->from;
+          FillMessageHeader(*msg, &batch_msg_headers[slot]);
+
+          batch_io_vec[batch_iov_count].iov_base = &batch_msg_headers[slot];
+          batch_io_vec[batch_iov_count].iov_len = sizeof(MessageHeader);
+          ++batch_iov_count;
+          batch_io_vec[batch_iov_count].iov_base = const_cast<char *>(msg->name.data());
+          batch_io_vec[batch_iov_count].iov_len = msg->name.size();
+          ++batch_iov_count;
+          batch_io_vec[batch_iov_count].iov_base = const_cast<char *>(batch_send_to[slot].data());
+          batch_io_vec[batch_iov_count].iov_len = batch_send_to[slot].size();
+          ++batch_iov_count;
+          batch_io_vec[batch_iov_count].iov_base = const_cast<char *>(batch_send_from[slot].data());
+          batch_io_vec[batch_iov_count].iov_len = batch_send_from[slot].size();
+          ++batch_iov_count;
+          batch_io_vec[batch_iov_count].iov_base = const_cast<char *>(msg->body.data());
+          batch_io_vec[batch_iov_count].iov_len = msg->body.size();
+          ++batch_iov_count;
+
+          total_send_len += UlongToUint(sizeof(MessageHeader)) + msg->name.size() + batch_send_to[slot].size() +
+                            batch_send_from[slot].size() + msg->body.size();
+          batch_messages[slot] = msg;
+          ++batch_msg_count;
+
+          // update metrics
+          send_metrics->UpdateMax(msg->body.size());
+          send_metrics->last_send_msg_name = msg->name;
+        }
+        if (batch_msg_count > 0) {
+          send_kernel_msg.msg_iov = batch_io_vec;
+          send_kernel_msg.msg_iovlen = batch_iov_count;
+        }
+      }
     }
     size_t sendLen = 0;
     int retval = socket_operation->SendMessage(this, &send_kernel_msg, total_send_len, &sendLen);
@@ -453,12 +508,18 @@ int Connection::Flush() {
         total_send_bytes += send_message->body.size();
         delete send_message;
         send_message = nullptr;
+        for (size_t slot = 0; slot < batch_msg_count; ++slot) {
+          output_buffer_size -= batch_messages[slot]->body.size();
+          total_send_bytes += batch_messages[slot]->body.size();
+          delete batch_messages[slot];
+          batch_messages[slot] = nullptr;
+        }
         break;
       }
     } else if (retval == IO_RW_OK && sendLen == 0) {
       // EAGAIN
       MS_LOG(ERROR) << "Failed to send message and update the epoll event";
-      (void)recv_event_loop->UpdateEpollEvent(socket_fd, EPOLLOUT | EPOLLIN | EPOLLHUP | EPOLLERR);
+      (void)recv_event_loop->UpdateEpollEvent(socket_fd, EPOLLOUT | EPOLLIN | EPOLLET | EPOLLHUP | EPOLLERR);
       continue;
     } else {
       // update metrics
@@ -25,6 +25,7 @@
 #include "actor/msg.h"
 #include "distributed/rpc/tcp/constants.h"
 #include "distributed/rpc/tcp/event_loop.h"
+#include "distributed/rpc/tcp/shm_ring_buffer.h"
 #include "distributed/rpc/tcp/socket_operation.h"
 
 namespace mindspore {
@@ -180,6 +181,14 @@ struct Connection {
   struct iovec recv_io_vec[RECV_MSG_IO_VEC_LEN];
   struct iovec send_io_vec[SEND_MSG_IO_VEC_LEN];
 
+  // State of the coalesced send in Flush: the io vector spanning the current message and the extra batched ones,
+  // and the headers and AID string copies of the batched messages, which must stay alive until they are sent.
+  struct iovec batch_io_vec[SEND_MSG_IO_VEC_LEN * (SEND_MSG_BATCH_LEN + 1)];
+  MessageBase *batch_messages[SEND_MSG_BATCH_LEN];
+  MessageHeader batch_msg_headers[SEND_MSG_BATCH_LEN];
+  std::string batch_send_to[SEND_MSG_BATCH_LEN];
+  std::string batch_send_from[SEND_MSG_BATCH_LEN];
+
   ParseType recv_message_type{kTcpMsg};
 
   // Callbacks for io events
@@ -194,6 +203,15 @@ struct Connection {
   // Buffer for messages to be sent.
   std::queue<MessageBase *> send_message_queue;
 
+  // Whether a deferred flush task for the aggregated small messages is already queued on the send event loop,
+  // see TCPComm::ScheduleDeferredFlush.
+  bool deferred_flush_scheduled{false};
+
+  // Shared memory rings negotiated for the intra-node transport. The send ring is created by this side and written
+  // when sending, the recv ring is attached when the negotiate message of the peer arrives.
+  std::shared_ptr<ShmRingBuffer> shm_send_ring;
+  std::shared_ptr<ShmRingBuffer> shm_recv_ring;
+
   uint64_t output_buffer_size;
 
   // The error code when sending or receiving messages.
@@ -36,6 +36,8 @@ using ConnectionCallBack = std::function<void(void *connection)>;
 
 constexpr int SEND_MSG_IO_VEC_LEN = 5;
 constexpr int RECV_MSG_IO_VEC_LEN = 4;
+// Maximum number of extra queued messages coalesced into one scatter-gather send with the current message.
+constexpr int SEND_MSG_BATCH_LEN = 8;
 
 constexpr unsigned int BUSMAGIC_LEN = 4;
 constexpr int SENDMSG_QUEUELEN = 1024;
@@ -75,6 +77,23 @@ static const int SOCKET_KEEPINTERVAL = 5;
 static const int SOCKET_KEEPCOUNT = 3;
 
 static const char RPC_MAGICID[] = "BUS0";
+
+// Names of the internal control messages used by the shared memory transport. The negotiate message carries the
+// name of the shared memory ring, the doorbell message tells the peer that one message is ready in the ring.
+static const char SHM_NEGOTIATE_MSG_NAME[] = "_shm_negotiate";
+static const char SHM_DOORBELL_MSG_NAME[] = "_shm_doorbell";
+
+// Name prefix of the internal chunk messages of the multi-NIC channel bonding. The name of a chunk message is
+// <prefix><sequence>:<index>:<count>:<original name> and its body is one stripe of the original message body.
+static const char BOND_CHUNK_MSG_NAME_PREFIX[] = "_bond_chunk:";
+
+// A message whose body is not larger than this is a small control message which the sender may hold back
+// briefly to coalesce with the following ones, see TCPComm::Send.
+constexpr size_t SMALL_MSG_AGGREGATION_MAX_BODY_SIZE = 1024;
+
+// Message bodies of at least this size are striped across the bonded channels.
+constexpr size_t BOND_MIN_BODY_SIZE = 1 << 20;
+
 static const char URL_PROTOCOL_IP_SEPARATOR[] = "://";
 static const char URL_IP_PORT_SEPARATOR[] = ":";
 static const char TCP_RECV_EVLOOP_THREADNAME[] = "RECV_EVENT_LOOP";
@@ -0,0 +1,202 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/rpc/tcp/shm_ring_buffer.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+namespace {
+constexpr uint64_t SHM_RING_MAGIC = 0x4D53525043534D52ULL;
+}  // namespace
+
+ShmRingBuffer::~ShmRingBuffer() {
+  if (control_ != nullptr) {
+    (void)munmap(control_, sizeof(ControlBlock) + capacity_);
+    control_ = nullptr;
+    data_ = nullptr;
+  }
+  if (is_creator_ && !name_.empty()) {
+    (void)shm_unlink(name_.c_str());
+  }
+}
+
+bool ShmRingBuffer::Create(const std::string &name, size_t capacity) {
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Failed to create shared memory segment " << name << ", errno: " << errno;
+    return false;
+  }
+  size_t total_size = sizeof(ControlBlock) + capacity;
+  if (ftruncate(fd, static_cast<off_t>(total_size)) != 0) {
+    MS_LOG(ERROR) << "Failed to resize shared memory segment " << name << ", errno: " << errno;
+    (void)close(fd);
+    (void)shm_unlink(name.c_str());
+    return false;
+  }
+  void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  (void)close(fd);
+  if (addr == MAP_FAILED) {
+    MS_LOG(ERROR) << "Failed to map shared memory segment " << name << ", errno: " << errno;
+    (void)shm_unlink(name.c_str());
+    return false;
+  }
+
+  control_ = static_cast<ControlBlock *>(addr);
+  data_ = reinterpret_cast<uint8_t *>(control_ + 1);
+  capacity_ = capacity;
+  control_->capacity = capacity;
+  control_->head.store(0, std::memory_order_relaxed);
+  control_->tail.store(0, std::memory_order_relaxed);
+  control_->magic = SHM_RING_MAGIC;
+  name_ = name;
+  is_creator_ = true;
+  return true;
+}
+
+bool ShmRingBuffer::Attach(const std::string &name) {
+  int fd = shm_open(name.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Failed to open shared memory segment " << name << ", errno: " << errno;
+    return false;
+  }
+  struct stat segment_stat;
+  if (fstat(fd, &segment_stat) != 0 || static_cast<size_t>(segment_stat.st_size) <= sizeof(ControlBlock)) {
+    MS_LOG(ERROR) << "Invalid shared memory segment size for " << name;
+    (void)close(fd);
+    return false;
+  }
+  size_t total_size = static_cast<size_t>(segment_stat.st_size);
+  void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  (void)close(fd);
+  if (addr == MAP_FAILED) {
+    MS_LOG(ERROR) << "Failed to map shared memory segment " << name << ", errno: " << errno;
+    return false;
+  }
+
+  auto *control = static_cast<ControlBlock *>(addr);
+  if (control->magic != SHM_RING_MAGIC || control->capacity != total_size - sizeof(ControlBlock)) {
+    MS_LOG(ERROR) << "Invalid control block in shared memory segment " << name;
+    (void)munmap(addr, total_size);
+    return false;
+  }
+  control_ = control;
+  data_ = reinterpret_cast<uint8_t *>(control_ + 1);
+  capacity_ = control_->capacity;
+  name_ = name;
+  return true;
+}
+
+void ShmRingBuffer::CopyIn(const void *src, size_t size, uint64_t *pos) {
+  size_t offset = *pos % capacity_;
+  size_t first = std::min(size, capacity_ - offset);
+  (void)memcpy(data_ + offset, src, first);
+  if (size > first) {
+    (void)memcpy(data_, static_cast<const uint8_t *>(src) + first, size - first);
+  }
+  *pos += size;
+}
+
+void ShmRingBuffer::CopyOut(void *dst, size_t size, uint64_t *pos) const {
+  size_t offset = *pos % capacity_;
+  size_t first = std::min(size, capacity_ - offset);
+  (void)memcpy(dst, data_ + offset, first);
+  if (size > first) {
+    (void)memcpy(static_cast<uint8_t *>(dst) + first, data_, size - first);
+  }
+  *pos += size;
+}
+
+bool ShmRingBuffer::WriteMessage(const MessageBase &msg) {
+  if (control_ == nullptr) {
+    return false;
+  }
+  std::string from = msg.from;
+  std::string to = msg.to;
+  uint32_t lens[3] = {static_cast<uint32_t>(msg.name.size()), static_cast<uint32_t>(from.size()),
+                      static_cast<uint32_t>(to.size())};
+  uint64_t body_len = msg.body.size();
+  size_t total = sizeof(lens) + sizeof(body_len) + msg.name.size() + from.size() + to.size() + msg.body.size();
+
+  uint64_t head = control_->head.load(std::memory_order_acquire);
+  uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+  if (total > capacity_ - (tail - head)) {
+    return false;
+  }
+  uint64_t pos = tail;
+  CopyIn(lens, sizeof(lens), &pos);
+  CopyIn(&body_len, sizeof(body_len), &pos);
+  CopyIn(msg.name.data(), msg.name.size(), &pos);
+  CopyIn(from.data(), from.size(), &pos);
+  CopyIn(to.data(), to.size(), &pos);
+  CopyIn(msg.body.data(), msg.body.size(), &pos);
+  control_->tail.store(pos, std::memory_order_release);
+  return true;
+}
+
+MessageBase *ShmRingBuffer::ReadMessage() {
+  if (control_ == nullptr) {
+    return nullptr;
+  }
+  uint64_t tail = control_->tail.load(std::memory_order_acquire);
+  uint64_t head = control_->head.load(std::memory_order_relaxed);
+  if (head == tail) {
+    return nullptr;
+  }
+  uint64_t pos = head;
+  uint32_t lens[3] = {0, 0, 0};
+  uint64_t body_len = 0;
+  CopyOut(lens, sizeof(lens), &pos);
+  CopyOut(&body_len, sizeof(body_len), &pos);
+  if (lens[0] > MAX_KMSG_NAME_LEN || lens[1] > MAX_KMSG_FROM_LEN || lens[2] > MAX_KMSG_TO_LEN ||
+      body_len > MAX_KMSG_BODY_LEN) {
+    MS_LOG(ERROR) << "Corrupted message header in shared memory ring " << name_;
+    return nullptr;
+  }
+
+  std::string name(lens[0], '\0');
+  std::string from(lens[1], '\0');
+  std::string to(lens[2], '\0');
+  std::string body(body_len, '\0');
+  CopyOut(name.data(), name.size(), &pos);
+  CopyOut(from.data(), from.size(), &pos);
+  CopyOut(to.data(), to.size(), &pos);
+  CopyOut(body.data(), body.size(), &pos);
+
+  MessageBase *msg = new (std::nothrow) MessageBase();
+  if (msg == nullptr) {
+    MS_LOG(ERROR) << "Failed to create message read from shared memory ring " << name_;
+    return nullptr;
+  }
+  msg->name = std::move(name);
+  msg->from = AID(from);
+  msg->to = AID(to);
+  msg->body = std::move(body);
+  control_->head.store(pos, std::memory_order_release);
+  return msg;
+}
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
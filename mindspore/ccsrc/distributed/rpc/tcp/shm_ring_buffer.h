@@ -0,0 +1,87 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_RPC_TCP_SHM_RING_BUFFER_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_RPC_TCP_SHM_RING_BUFFER_H_
+
+#include <atomic>
+#include <string>
+
+#include "actor/msg.h"
+#include "distributed/rpc/tcp/constants.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+// Default capacity in bytes of the payload area of one shared memory ring.
+constexpr size_t SHM_RING_BUFFER_CAPACITY = 1 << 24;
+
+/*
+ * A single-producer single-consumer ring buffer placed in a POSIX shared memory segment. It is used as the
+ * intra-node transport for rpc messages: the sending side copies the serialized message into the ring and the
+ * receiving side reads it out directly, instead of going through the loopback tcp path.
+ */
+class ShmRingBuffer {
+ public:
+  ShmRingBuffer() = default;
+  ~ShmRingBuffer();
+
+  ShmRingBuffer(const ShmRingBuffer &) = delete;
+  ShmRingBuffer &operator=(const ShmRingBuffer &) = delete;
+
+  // Create the shared memory segment and initialize the control block. Called by the sending side.
+  bool Create(const std::string &name, size_t capacity = SHM_RING_BUFFER_CAPACITY);
+
+  // Attach to an existing segment created by the peer. Called by the receiving side.
+  bool Attach(const std::string &name);
+
+  // Copy the serialized message into the ring. Returns false if the free space is insufficient and the caller
+  // should fall back to the tcp path.
+  bool WriteMessage(const MessageBase &msg);
+
+  // Read the next serialized message out of the ring. Returns nullptr if the ring is empty or corrupted.
+  MessageBase *ReadMessage();
+
+  const std::string &name() const { return name_; }
+
+ private:
+  // The control block lives at the head of the shared memory segment, the payload area follows it directly.
+  struct ControlBlock {
+    uint64_t magic;
+    uint64_t capacity;
+    // Both counters grow monotonically, the ring offset is the counter modulo the capacity. The head is only
+    // advanced by the consumer and the tail only by the producer.
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+  };
+
+  // Copy bytes into/out of the payload area handling the wrap around, advancing the given position.
+  void CopyIn(const void *src, size_t size, uint64_t *pos);
+  void CopyOut(void *dst, size_t size, uint64_t *pos) const;
+
+  ControlBlock *control_{nullptr};
+  uint8_t *data_{nullptr};
+  size_t capacity_{0};
+  std::string name_;
+
+  // Only the creating side unlinks the segment on destruction.
+  bool is_creator_{false};
+};
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif
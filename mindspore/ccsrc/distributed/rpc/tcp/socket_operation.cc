@@ -23,9 +23,11 @@
 #include <securec.h>
 #include <netinet/tcp.h>
 #include <unistd.h>
+#include <cstdlib>
 #include <system_error>
 
 #include "actor/log.h"
+#include "utils/ms_utils.h"
 #include "distributed/rpc/tcp/constants.h"
 
 namespace mindspore {
@@ -85,6 +87,21 @@ int SocketOperation::SetSocketOptions(int sock_fd) {
     return -1;
   }
 
+  // Enlarge the kernel socket buffers when requested (the env MS_RPC_SOCKET_BUF_SIZE in bytes), so that one
+  // connection can fill a link with a large bandwidth-delay product; the kernel default is tuned for much
+  // slower NICs and caps the throughput of bulk tensor transfers.
+  static const int buf_size = std::atoi(common::GetEnv("MS_RPC_SOCKET_BUF_SIZE").c_str());
+  if (buf_size > 0) {
+    ret = setsockopt(sock_fd, SOL_SOCKET, SO_SNDBUF, &buf_size, sizeof(buf_size));
+    if (ret) {
+      MS_LOG(WARNING) << "Failed to call setsockopt SO_SNDBUF, fd: " << sock_fd << ", errno:" << errno;
+    }
+    ret = setsockopt(sock_fd, SOL_SOCKET, SO_RCVBUF, &buf_size, sizeof(buf_size));
+    if (ret) {
+      MS_LOG(WARNING) << "Failed to call setsockopt SO_RCVBUF, fd: " << sock_fd << ", errno:" << errno;
+    }
+  }
+
   ret = SetSocketKeepAlive(sock_fd, SOCKET_KEEPALIVE, SOCKET_KEEPIDLE, SOCKET_KEEPINTERVAL, SOCKET_KEEPCOUNT);
   if (ret) {
     MS_LOG(WARNING) << "Failed to call setsockopt keep alive, fd: " << sock_fd;
@@ -92,6 +109,17 @@ int SocketOperation::SetSocketOptions(int sock_fd) {
   return 0;
 }
 
+int SocketOperation::BindToDevice(int sock_fd, const std::string &dev_name) {
+  int ret = setsockopt(sock_fd, SOL_SOCKET, SO_BINDTODEVICE, dev_name.c_str(),
+                       static_cast<socklen_t>(dev_name.size() + 1));
+  if (ret < 0) {
+    MS_LOG(ERROR) << "Failed to call setsockopt SO_BINDTODEVICE, fd: " << sock_fd << ", device: " << dev_name
+                  << ", errno:" << errno;
+    return -1;
+  }
+  return 0;
+}
+
 int SocketOperation::CreateSocket(sa_family_t family) {
   int ret = 0;
   int fd = 0;
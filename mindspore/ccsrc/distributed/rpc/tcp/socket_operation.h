@@ -60,6 +60,9 @@ class SocketOperation {
   static int SetSocketOptions(int sock_fd);
   static int SetSocketKeepAlive(int fd, int keepalive, int keepidle, int keepinterval, int keepcount);
 
+  // Bind the socket to a network device(eg. eth1), so that its traffic goes through that NIC.
+  static int BindToDevice(int sock_fd, const std::string &dev_name);
+
   // Connect to the Socket sock_fd.
   static int Connect(int sock_fd, const struct sockaddr *sa, socklen_t saLen, uint16_t *boundPort);
 
@@ -31,6 +31,13 @@ bool TCPClient::Initialize() {
 
     // This message handler is used to accept and maintain the received message from the tcp server.
     tcp_comm_->SetMessageHandler([this](MessageBase *const message) -> MessageBase *const {
+      // Consume ack messages directly: they must not occupy the `received_message_` slot reserved for
+      // `ReceiveSync`, otherwise an unconsumed ack would block this receiving thread forever.
+      if (message != nullptr && ack_msg_handler_ != nullptr && message->name == ack_msg_name_) {
+        ack_msg_handler_(*message);
+        delete message;
+        return NULL_MSG;
+      }
       // Wait for the previous received message has been handled.
       const int sleep_time = 10;
       while (received_message_ != nullptr) {
@@ -119,6 +126,12 @@ MessageBase *TCPClient::ReceiveSync(std::unique_ptr<MessageBase> &&msg, uint32_t
 }
 
 bool TCPClient::Flush(const std::string &dst_url) { return tcp_comm_->Flush(dst_url); }
+
+void TCPClient::SetAckMessageHandler(const std::string &ack_msg_name,
+                                     const std::function<void(const MessageBase &)> &handler) {
+  ack_msg_name_ = ack_msg_name;
+  ack_msg_handler_ = handler;
+}
 }  // namespace rpc
 }  // namespace distributed
 }  // namespace mindspore
@@ -20,6 +20,7 @@
 #include <string>
 #include <memory>
 #include <mutex>
+#include <functional>
 #include <condition_variable>
 
 #include "distributed/rpc/tcp/tcp_comm.h"
@@ -59,6 +60,11 @@ class TCPClient {
   // Force the data in the send buffer to be sent out.
   bool Flush(const std::string &dst_url);
 
+  // Set the handler for ack messages pushed back by the server on this connection. A received message
+  // whose name equals ack_msg_name is consumed by this handler instead of being kept for ReceiveSync.
+  // Must be called before any message could be received, i.e. right after Initialize.
+  void SetAckMessageHandler(const std::string &ack_msg_name, const std::function<void(const MessageBase &)> &handler);
+
  private:
   // The basic TCP communication component used by the client.
   std::unique_ptr<TCPComm> tcp_comm_;
@@ -71,6 +77,10 @@ class TCPClient {
   // The received message from the meta server by calling the method `ReceiveSync`.
   MessageBase *received_message_{nullptr};
 
+  // The name and handler of ack messages consumed directly in the receiving path, see `SetAckMessageHandler`.
+  std::string ack_msg_name_;
+  std::function<void(const MessageBase &)> ack_msg_handler_{nullptr};
+
   bool enable_ssl_;
 
   DISABLE_COPY_AND_ASSIGN(TCPClient);
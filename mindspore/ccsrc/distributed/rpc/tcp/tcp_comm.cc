@@ -16,17 +16,27 @@
 
 #include "distributed/rpc/tcp/tcp_comm.h"
 
+#include <algorithm>
 #include <mutex>
 #include <utility>
 #include <memory>
 
 #include "actor/aid.h"
+#include "utils/ms_utils.h"
 #include "distributed/rpc/tcp/constants.h"
+#include "distributed/rpc/tcp/shm_ring_buffer.h"
 #include "distributed/rpc/tcp/tcp_socket_operation.h"
 
 namespace mindspore {
 namespace distributed {
 namespace rpc {
+namespace {
+// Key of the i-th bonded channel to a destination in the connection pool.
+std::string BondChannelUrl(const std::string &dst_url, size_t index) {
+  return dst_url + "#bond" + std::to_string(index);
+}
+}  // namespace
+
 void DoDisconnect(int fd, Connection *conn, uint32_t error, int soError) {
   if (LOG_CHECK_EVERY_N()) {
     MS_LOG(INFO) << "Failed to call connect, fd: " << fd << ", to: " << conn->destination.c_str()
@@ -112,7 +122,7 @@ void OnAccept(int server, uint32_t events, void *arg) {
   conn->send_event_loop = tcpmgr->send_event_loop_;
 
   conn->conn_mutex = tcpmgr->conn_mutex_;
-  conn->message_handler = tcpmgr->message_handler_;
+  conn->message_handler = tcpmgr->WrapMessageHandler(conn);
 
   conn->event_callback = std::bind(&TCPComm::EventCallBack, tcpmgr, std::placeholders::_1);
   conn->write_callback = std::bind(&TCPComm::WriteCallBack, tcpmgr, std::placeholders::_1);
@@ -173,6 +183,23 @@ bool TCPComm::Initialize() {
     return false;
   }
 
+  // The devices of the multi-NIC channel bonding(eg. "eth1,eth2,eth3"). Large message bodies are striped across
+  // one extra connection per device, each bound to its device, to aggregate the bandwidth of several NICs.
+  std::string bonding_devs = common::GetEnv("MS_RPC_BONDING_DEVICES");
+  if (!bonding_devs.empty() && !enable_ssl_) {
+    size_t start = 0;
+    while (start < bonding_devs.size()) {
+      auto end = bonding_devs.find(',', start);
+      if (end == std::string::npos) {
+        end = bonding_devs.size();
+      }
+      if (end > start) {
+        (void)bonding_devices_.emplace_back(bonding_devs.substr(start, end - start));
+      }
+      start = end + 1;
+    }
+  }
+
   return true;
 }
 
@@ -209,14 +236,13 @@ bool TCPComm::StartServerSocket() {
 int TCPComm::GetServerFd() const { return server_fd_; }
 
 void TCPComm::ReadCallBack(void *connection) {
-  const int max_recv_count = 3;
   Connection *conn = reinterpret_cast<Connection *>(connection);
-  int count = 0;
   int retval = 0;
+  // The data socket is registered edge-triggered, so keep parsing until no complete message is left
+  // (the receive loops stop at EAGAIN). Bytes left behind would not trigger another wakeup.
   do {
     retval = ReceiveMessage(conn);
-    ++count;
-  } while (retval > 0 && count < max_recv_count);
+  } while (retval > 0);
 
   return;
 }
@@ -301,7 +327,7 @@ void TCPComm::DropMessage(MessageBase *msg) {
 }
 
 ssize_t TCPComm::Send(MessageBase *msg, bool sync) {
-  auto task = [msg, this] {
+  auto task = [msg, sync, this]() mutable {
     std::lock_guard<std::mutex> lock(*conn_mutex_);
     // Search connection by the target address
     std::string destination = msg->to.Url();
@@ -332,11 +358,31 @@ ssize_t TCPComm::Send(MessageBase *msg, bool sync) {
       return error_no;
     }
 
-    if (conn->total_send_len == 0) {
+    // A fat payload is striped across the bonded channels first, so that it is not limited by the bandwidth of
+    // one NIC. Otherwise, for a same-host connection the payload goes through the shared memory ring and only a
+    // doorbell message is sent through the socket.
+    if (!SendViaBonding(&msg)) {
+      (void)SendViaShm(conn, &msg);
+    }
+
+    // Nagle-like aggregation of the small control messages: instead of writing a sub-KB message out at once,
+    // queue it and defer the flush to a follow-up task on the send event loop. The Send tasks already queued
+    // behind this one enqueue their messages before the flush runs, so a burst of control messages goes out
+    // in one coalesced send (see Connection::Flush) instead of one packet each. Synchronous sends, the
+    // internal control messages (the '_' prefixed names, eg. the shm doorbells) and fat payloads are latency
+    // critical and keep the immediate flush.
+    bool defer_flush = !sync && msg->body.size() <= SMALL_MSG_AGGREGATION_MAX_BODY_SIZE &&
+                       msg->name.compare(0, 1, "_") != 0 &&
+                       conn->send_message_queue.size() + 1 < static_cast<size_t>(SEND_MSG_BATCH_LEN);
+    if (conn->total_send_len == 0 && conn->send_message_queue.empty() && !defer_flush) {
       conn->FillSendMessage(msg, url_, false);
     } else {
       (void)conn->send_message_queue.emplace(msg);
     }
+    if (defer_flush) {
+      ScheduleDeferredFlush(conn);
+      return 0;
+    }
     return conn->Flush();
   };
   if (sync) {
@@ -347,6 +393,28 @@ ssize_t TCPComm::Send(MessageBase *msg, bool sync) {
   }
 }
 
+void TCPComm::ScheduleDeferredFlush(Connection *conn) {
+  if (conn->deferred_flush_scheduled) {
+    return;
+  }
+  conn->deferred_flush_scheduled = true;
+  // The task looks the connection up again by destination, because the connection may be deleted before the
+  // send event loop gets to the task.
+  std::string destination = conn->destination;
+  send_event_loop_->AddTask([destination, this]() {
+    std::lock_guard<std::mutex> lock(*conn_mutex_);
+    Connection *deferred_conn = conn_pool_->FindConnection(destination);
+    if (deferred_conn == nullptr) {
+      return RPC_ERROR;
+    }
+    deferred_conn->deferred_flush_scheduled = false;
+    if (deferred_conn->state != ConnectionState::kConnected) {
+      return RPC_ERROR;
+    }
+    return deferred_conn->Flush();
+  });
+}
+
 bool TCPComm::Flush(const std::string &dst_url) {
   Connection *conn = conn_pool_->FindConnection(dst_url);
   if (conn == nullptr) {
@@ -375,7 +443,7 @@ bool TCPComm::Connect(const std::string &dst_url) {
     conn->recv_event_loop = this->recv_event_loop_;
     conn->send_event_loop = this->send_event_loop_;
     conn->conn_mutex = conn_mutex_;
-    conn->message_handler = message_handler_;
+    conn->message_handler = WrapMessageHandler(conn);
     conn->InitSocketOperation();
 
     // Create the client socket.
@@ -419,6 +487,8 @@ bool TCPComm::Connect(const std::string &dst_url) {
       return false;
     }
     conn_pool_->AddConnection(conn);
+    NegotiateShmTransport(conn);
+    EstablishBondingChannels(dst_url);
   }
   conn_pool_->AddConnInfo(conn->socket_fd, dst_url, nullptr);
   MS_LOG(INFO) << "Connected to destination: " << dst_url;
@@ -447,6 +517,9 @@ bool TCPComm::Disconnect(const std::string &dst_url) {
   }
   std::lock_guard<std::mutex> lock(*conn_mutex_);
   conn_pool_->DeleteConnection(dst_url);
+  for (size_t i = 0; i < bonding_devices_.size(); ++i) {
+    conn_pool_->DeleteConnection(BondChannelUrl(dst_url, i));
+  }
   return true;
 }
 
@@ -462,11 +535,295 @@ Connection *TCPComm::CreateDefaultConn(const std::string &to) {
   conn->recv_event_loop = this->recv_event_loop_;
   conn->send_event_loop = this->send_event_loop_;
   conn->conn_mutex = conn_mutex_;
-  conn->message_handler = message_handler_;
+  conn->message_handler = WrapMessageHandler(conn);
   conn->InitSocketOperation();
   return conn;
 }
 
+MessageHandler TCPComm::WrapMessageHandler(Connection *conn) {
+  return [this, conn](MessageBase *const msg) -> MessageBase *const {
+    if (msg->name == SHM_NEGOTIATE_MSG_NAME) {
+      auto ring = std::make_shared<ShmRingBuffer>();
+      if (ring->Attach(msg->body)) {
+        conn->shm_recv_ring = ring;
+        MS_LOG(INFO) << "Attached shared memory ring " << msg->body << " for connection from " << conn->destination;
+      } else {
+        MS_LOG(WARNING) << "Failed to attach shared memory ring " << msg->body << ", keep the tcp path from "
+                        << conn->destination;
+      }
+      DropMessage(msg);
+      return NULL_MSG;
+    }
+    if (msg->name == SHM_DOORBELL_MSG_NAME) {
+      DropMessage(msg);
+      if (conn->shm_recv_ring == nullptr) {
+        MS_LOG(WARNING) << "Received a doorbell message without an attached shared memory ring from "
+                        << conn->destination;
+        return NULL_MSG;
+      }
+      // The sender writes one ring message per doorbell, so reading exactly one here keeps the message order
+      // consistent with messages which fell back to the tcp path.
+      MessageBase *shm_msg = conn->shm_recv_ring->ReadMessage();
+      if (shm_msg == nullptr) {
+        MS_LOG(WARNING) << "Failed to read the message from shared memory ring " << conn->shm_recv_ring->name();
+        return NULL_MSG;
+      }
+      return message_handler_ ? message_handler_(shm_msg) : NULL_MSG;
+    }
+    if (msg->name.compare(0, sizeof(BOND_CHUNK_MSG_NAME_PREFIX) - 1, BOND_CHUNK_MSG_NAME_PREFIX) == 0) {
+      return ReassembleBondChunk(msg);
+    }
+    if (!message_handler_) {
+      MS_LOG(INFO) << "Message handler was not found";
+      return NULL_MSG;
+    }
+    return message_handler_(msg);
+  };
+}
+
+void TCPComm::NegotiateShmTransport(Connection *conn) {
+  static const bool enable_shm = common::GetEnv("MS_DEV_ENABLE_RPC_SHM") == "1";
+  if (!enable_shm || enable_ssl_) {
+    return;
+  }
+  // Only a peer on the same host can map the shared memory segment.
+  auto ip_end = conn->destination.find(URL_IP_PORT_SEPARATOR);
+  std::string dst_ip = conn->destination.substr(0, ip_end);
+  if (dst_ip != SocketOperation::GetLocalIP() && dst_ip != "127.0.0.1") {
+    return;
+  }
+  auto ring = std::make_shared<ShmRingBuffer>();
+  std::string shm_name = "/ms_rpc_" + std::to_string(getpid()) + "_" + std::to_string(conn->socket_fd);
+  if (!ring->Create(shm_name)) {
+    MS_LOG(WARNING) << "Failed to create shared memory ring " << shm_name << ", keep the tcp path to "
+                    << conn->destination;
+    return;
+  }
+
+  // Tell the peer the ring name through the socket. The socket ordering guarantees that the peer attaches the ring
+  // before the first doorbell message arrives.
+  auto *msg = new (std::nothrow) MessageBase(AID("", url_), AID("", conn->destination), SHM_NEGOTIATE_MSG_NAME);
+  if (msg == nullptr) {
+    MS_LOG(ERROR) << "Failed to create the negotiate message to " << conn->destination;
+    return;
+  }
+  msg->body = shm_name;
+  if (conn->total_send_len == 0) {
+    conn->FillSendMessage(msg, url_, false);
+  } else {
+    (void)conn->send_message_queue.emplace(msg);
+  }
+  (void)conn->Flush();
+  conn->shm_send_ring = ring;
+  MS_LOG(INFO) << "Negotiated shared memory transport to " << conn->destination << ", ring: " << shm_name;
+}
+
+void TCPComm::EstablishBondingChannels(const std::string &dst_url) {
+  for (size_t i = 0; i < bonding_devices_.size(); ++i) {
+    std::string channel_url = BondChannelUrl(dst_url, i);
+    if (conn_pool_->FindConnection(channel_url) != nullptr) {
+      continue;
+    }
+    Connection *conn = new (std::nothrow) Connection();
+    if (conn == nullptr) {
+      MS_LOG(ERROR) << "Failed to create the bonded channel connection to: " << dst_url;
+      return;
+    }
+    conn->enable_ssl = enable_ssl_;
+    conn->recv_event_loop = this->recv_event_loop_;
+    conn->send_event_loop = this->send_event_loop_;
+    conn->conn_mutex = conn_mutex_;
+    conn->message_handler = WrapMessageHandler(conn);
+    conn->InitSocketOperation();
+
+    SocketAddress addr;
+    if (!SocketOperation::GetSockAddr(dst_url, &addr)) {
+      MS_LOG(ERROR) << "Failed to get socket address to dest url " << dst_url;
+      delete conn;
+      return;
+    }
+    int sock_fd = SocketOperation::CreateSocket(addr.sa.sa_family);
+    if (sock_fd < 0) {
+      MS_LOG(ERROR) << "Failed to create the bonded channel socket to dest url " << dst_url;
+      delete conn;
+      return;
+    }
+    if (SocketOperation::BindToDevice(sock_fd, bonding_devices_[i]) != RPC_OK) {
+      MS_LOG(WARNING) << "Failed to bind the bonded channel to device " << bonding_devices_[i]
+                      << ", keep the single channel path to " << dst_url;
+      if (close(sock_fd) != 0) {
+        MS_LOG(ERROR) << "Failed to close fd: " << sock_fd;
+      }
+      delete conn;
+      return;
+    }
+
+    conn->socket_fd = sock_fd;
+    conn->event_callback = std::bind(&TCPComm::EventCallBack, this, std::placeholders::_1);
+    conn->write_callback = std::bind(&TCPComm::WriteCallBack, this, std::placeholders::_1);
+    conn->read_callback = std::bind(&TCPComm::ReadCallBack, this, std::placeholders::_1);
+
+    int ret = TCPComm::DoConnect(conn, (struct sockaddr *)&addr, sizeof(addr));
+    if (ret < 0) {
+      MS_LOG(ERROR) << "Failed to connect the bonded channel on device " << bonding_devices_[i]
+                    << " to destination: " << dst_url;
+      if (conn->socket_operation != nullptr) {
+        delete conn->socket_operation;
+        conn->socket_operation = nullptr;
+      }
+      delete conn;
+      return;
+    }
+    conn->source = SocketOperation::GetLocalIP() + ":" + std::to_string(SocketOperation::GetPort(sock_fd));
+    conn->destination = channel_url;
+
+    uint32_t interval = 3;
+    size_t retry = 3;
+    while (conn->state < ConnectionState::kConnected && retry-- > 0) {
+      MS_LOG(WARNING) << "Waiting for the state of the bonded channel to " << dst_url << " to be connected...";
+      sleep(interval);
+    }
+    if (conn->state != ConnectionState::kConnected) {
+      return;
+    }
+    conn_pool_->AddConnection(conn);
+    MS_LOG(INFO) << "Established the bonded channel on device " << bonding_devices_[i]
+                 << " to destination: " << dst_url;
+  }
+}
+
+bool TCPComm::SendViaBonding(MessageBase **msg) {
+  if (bonding_devices_.empty() || (*msg)->body.size() < BOND_MIN_BODY_SIZE) {
+    return false;
+  }
+  const std::string destination = (*msg)->to.Url();
+  // One stripe goes through the main connection, one per bonded channel. All the channels must be up,
+  // otherwise the whole message keeps the single channel path.
+  size_t stripe_num = bonding_devices_.size() + 1;
+  std::vector<Connection *> channels;
+  channels.reserve(bonding_devices_.size());
+  for (size_t i = 0; i < bonding_devices_.size(); ++i) {
+    Connection *channel = conn_pool_->FindConnection(BondChannelUrl(destination, i));
+    if (channel == nullptr || channel->state != ConnectionState::kConnected ||
+        channel->send_message_queue.size() >= SENDMSG_QUEUELEN) {
+      return false;
+    }
+    (void)channels.emplace_back(channel);
+  }
+
+  const std::string &body = (*msg)->body;
+  size_t stripe_size = (body.size() + stripe_num - 1) / stripe_num;
+  uint64_t seq = ++bond_send_seq_;
+  std::vector<MessageBase *> chunks(stripe_num, nullptr);
+  for (size_t i = 0; i < stripe_num; ++i) {
+    auto *chunk = new (std::nothrow)
+      MessageBase((*msg)->from, (*msg)->to,
+                  BOND_CHUNK_MSG_NAME_PREFIX + std::to_string(seq) + ":" + std::to_string(i) + ":" +
+                    std::to_string(stripe_num) + ":" + (*msg)->name);
+    if (chunk == nullptr) {
+      MS_LOG(ERROR) << "Failed to create the chunk message to " << destination;
+      for (auto &built : chunks) {
+        delete built;
+      }
+      return false;
+    }
+    size_t offset = std::min(i * stripe_size, body.size());
+    chunk->body = body.substr(offset, std::min(stripe_size, body.size() - offset));
+    chunks[i] = chunk;
+  }
+
+  // Queue the extra stripes on the bonded channels; the first stripe replaces the original message and
+  // follows the ordinary path on the main connection.
+  for (size_t i = 0; i < channels.size(); ++i) {
+    Connection *channel = channels[i];
+    if (channel->total_send_len == 0) {
+      channel->FillSendMessage(chunks[i + 1], url_, false);
+    } else {
+      (void)channel->send_message_queue.emplace(chunks[i + 1]);
+    }
+    (void)channel->Flush();
+  }
+  DropMessage(*msg);
+  *msg = chunks[0];
+  return true;
+}
+
+MessageBase *TCPComm::ReassembleBondChunk(MessageBase *msg) {
+  // The chunk name is <prefix><sequence>:<index>:<count>:<original name>.
+  size_t prefix_len = sizeof(BOND_CHUNK_MSG_NAME_PREFIX) - 1;
+  size_t seq_end = msg->name.find(':', prefix_len);
+  size_t index_end = (seq_end == std::string::npos) ? std::string::npos : msg->name.find(':', seq_end + 1);
+  size_t count_end = (index_end == std::string::npos) ? std::string::npos : msg->name.find(':', index_end + 1);
+  if (count_end == std::string::npos) {
+    MS_LOG(ERROR) << "Invalid chunk message name: " << msg->name;
+    DropMessage(msg);
+    return NULL_MSG;
+  }
+  std::string seq = msg->name.substr(prefix_len, seq_end - prefix_len);
+  size_t index = std::stoul(msg->name.substr(seq_end + 1, index_end - seq_end - 1));
+  size_t count = std::stoul(msg->name.substr(index_end + 1, count_end - index_end - 1));
+  if (count == 0 || index >= count) {
+    MS_LOG(ERROR) << "Invalid chunk message name: " << msg->name;
+    DropMessage(msg);
+    return NULL_MSG;
+  }
+
+  std::string key = msg->from.Url() + ":" + seq;
+  auto &reassembly = bond_reassemblies_[key];
+  if (reassembly.stripes.empty()) {
+    reassembly.name = msg->name.substr(count_end + 1);
+    reassembly.stripes.resize(count);
+  } else if (reassembly.stripes.size() != count) {
+    MS_LOG(ERROR) << "Mismatched stripe count of the chunk message: " << msg->name;
+    (void)bond_reassemblies_.erase(key);
+    DropMessage(msg);
+    return NULL_MSG;
+  }
+  reassembly.stripes[index] = std::move(msg->body);
+  ++reassembly.received;
+  if (reassembly.received < count) {
+    DropMessage(msg);
+    return NULL_MSG;
+  }
+
+  // The last stripe arrived, rebuild the original message and hand it to the user handler.
+  auto *full = new (std::nothrow) MessageBase(msg->from, msg->to, reassembly.name);
+  DropMessage(msg);
+  if (full == nullptr) {
+    MS_LOG(ERROR) << "Failed to create the reassembled message";
+    (void)bond_reassemblies_.erase(key);
+    return NULL_MSG;
+  }
+  size_t total_size = 0;
+  for (const auto &stripe : reassembly.stripes) {
+    total_size += stripe.size();
+  }
+  full->body.reserve(total_size);
+  for (const auto &stripe : reassembly.stripes) {
+    full->body += stripe;
+  }
+  (void)bond_reassemblies_.erase(key);
+  return message_handler_ ? message_handler_(full) : NULL_MSG;
+}
+
+bool TCPComm::SendViaShm(Connection *conn, MessageBase **msg) {
+  if (conn->shm_send_ring == nullptr) {
+    return false;
+  }
+  auto *doorbell = new (std::nothrow) MessageBase((*msg)->from, (*msg)->to, SHM_DOORBELL_MSG_NAME);
+  if (doorbell == nullptr) {
+    return false;
+  }
+  // A full ring or an oversized message falls back to the tcp path for this message only.
+  if (!conn->shm_send_ring->WriteMessage(**msg)) {
+    delete doorbell;
+    return false;
+  }
+  DropMessage(*msg);
+  *msg = doorbell;
+  return true;
+}
+
 void TCPComm::Finalize() {
   if (send_event_loop_ != nullptr) {
     MS_LOG(INFO) << "Delete send event loop";
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_DISTRIBUTED_RPC_TCP_TCP_COMM_H_
 #define MINDSPORE_CCSRC_DISTRIBUTED_RPC_TCP_TCP_COMM_H_
 
+#include <map>
 #include <string>
 #include <memory>
 #include <vector>
@@ -37,6 +38,13 @@ void DoDisconnect(int fd, Connection *conn, uint32_t error, int soError);
 
 void ConnectedEventHandler(int fd, uint32_t events, void *context);
 
+// One large message body being rebuilt from the stripes received on the bonded channels.
+struct BondReassembly {
+  std::string name;
+  std::vector<std::string> stripes;
+  size_t received{0};
+};
+
 class TCPComm {
  public:
   explicit TCPComm(bool enable_ssl = false)
@@ -79,6 +87,34 @@ class TCPComm {
   // Build the connection.
   Connection *CreateDefaultConn(const std::string &to);
 
+  // Wrap the user message handler to intercept the control messages of the shared memory transport.
+  MessageHandler WrapMessageHandler(Connection *conn);
+
+  // Create the shared memory ring for a same-host connection and tell the peer its name.
+  void NegotiateShmTransport(Connection *conn);
+
+  // Try to pass the message through the shared memory ring of the connection. On success the original message is
+  // consumed and replaced by a small doorbell message which keeps the socket ordering.
+  bool SendViaShm(Connection *conn, MessageBase **msg);
+
+  // Create the extra connections of the multi-NIC channel bonding to the destination, one per device in
+  // MS_RPC_BONDING_DEVICES, each bound to its device with SO_BINDTODEVICE.
+  void EstablishBondingChannels(const std::string &dst_url);
+
+  // Try to stripe a large message across the bonded channels of its destination. On success the extra stripes are
+  // queued on the bonded channels and the original message is replaced by the chunk message of the first stripe,
+  // which goes through the main connection like an ordinary message. Striped payloads are matched by the upper
+  // layer on the message name, not on the socket ordering, so bonding only applies to fat payloads.
+  bool SendViaBonding(MessageBase **msg);
+
+  // Collect an arrived chunk message. Returns the handler result of the rebuilt message when the last stripe
+  // arrived, NULL_MSG before that.
+  MessageBase *ReassembleBondChunk(MessageBase *msg);
+
+  // Queue one follow-up flush task for the connection on the send event loop, so that the small messages held
+  // back by the aggregation in Send go out after the Send tasks already queued behind have enqueued theirs.
+  void ScheduleDeferredFlush(Connection *conn);
+
   // Send a message.
   static void SendExitMsg(const std::string &from, const std::string &to);
 
@@ -118,6 +154,15 @@ class TCPComm {
 
   bool enable_ssl_;
 
+  // The devices of the multi-NIC channel bonding, parsed from MS_RPC_BONDING_DEVICES. Empty means no bonding.
+  std::vector<std::string> bonding_devices_;
+
+  // Sequence number of the next striped payload, guarded by conn_mutex_.
+  uint64_t bond_send_seq_{0};
+
+  // The payloads being reassembled, keyed by <source url>:<sequence>, guarded by conn_mutex_.
+  std::map<std::string, BondReassembly> bond_reassemblies_;
+
   friend void OnAccept(int server, uint32_t events, void *arg);
   friend int DoConnect(const std::string &to, Connection *conn, ConnectionCallBack event_callback,
                        ConnectionCallBack write_callback, ConnectionCallBack read_callback);
@@ -78,12 +78,9 @@ bool Executor::HandleModelUpdate(const std::string &param_name, const UploadData
   std::unique_lock<std::mutex> lock(mtx);
   auto &param_aggr = param_aggrs_[param_name];
   MS_ERROR_IF_NULL_W_RET_VAL(param_aggr, false);
-  if (!param_aggr->UpdateData(upload_data)) {
-    MS_LOG(ERROR) << "Updating data for parameter " << param_name << " failed.";
-    return false;
-  }
-  // Different from Push, UpdateModel doesn't need to checkout the aggregation status.
-  if (!param_aggr->LaunchAggregators()) {
+  // Different from Push, UpdateModel doesn't need to checkout the aggregation status. The uploaded data is
+  // accumulated in place from the request payload, without staging a copy into the registered slots.
+  if (!param_aggr->LaunchAggregators(upload_data)) {
     MS_LOG(ERROR) << "Launching aggregators for parameter " << param_name << " failed.";
     return false;
   }
@@ -533,9 +533,7 @@ std::map<std::string, UploadData> UpdateModelKernel::DecodeFeatureMap(
     int8_t *compress_weight_data = const_cast<int8_t *>(fbs_compress_feature_map->Get(i)->compress_data()->data());
     size_t compress_weight_size = fbs_compress_feature_map->Get(i)->compress_data()->size();
     MS_LOG(DEBUG) << "The compress weight size: " << compress_weight_size;
-    for (size_t j = 0; j < compress_weight_size; ++j) {
-      (void)compress_feature_map.compress_data.emplace_back(compress_weight_data[j]);
-    }
+    compress_feature_map.compress_data.assign(compress_weight_data, compress_weight_data + compress_weight_size);
     compress_feature_map.min_val = fbs_compress_feature_map->Get(i)->min_val();
     compress_feature_map.max_val = fbs_compress_feature_map->Get(i)->max_val();
     MS_LOG(DEBUG) << "Min value: " << compress_feature_map.min_val;
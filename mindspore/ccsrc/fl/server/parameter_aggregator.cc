@@ -109,6 +109,47 @@ bool ParameterAggregator::LaunchAggregators() {
   return true;
 }
 
+bool ParameterAggregator::LaunchAggregators(const std::map<std::string, Address> &new_data) {
+  for (auto &aggregator_with_params : aggregation_kernel_parameters_) {
+    KernelParams &params = aggregator_with_params.second;
+    std::shared_ptr<kernel::AggregationKernelMod> aggr_kernel = aggregator_with_params.first;
+    MS_ERROR_IF_NULL_W_RET_VAL(aggr_kernel, false);
+
+    const std::vector<std::string> &input_names = aggr_kernel->input_names();
+    if (input_names.size() != params.inputs.size()) {
+      MS_LOG(ERROR) << "Input number of aggregation kernel is not matched: input_names size is " << input_names.size()
+                    << ", inputs size is " << params.inputs.size();
+      return false;
+    }
+    std::vector<AddressPtr> inputs = params.inputs;
+    for (size_t i = 0; i < input_names.size(); i++) {
+      auto data_iter = new_data.find(input_names[i]);
+      if (data_iter == new_data.end()) {
+        continue;
+      }
+      MS_ERROR_IF_NULL_W_RET_VAL(data_iter->second.addr, false);
+      MS_ERROR_IF_NULL_W_RET_VAL(params.inputs[i], false);
+      if (data_iter->second.size > params.inputs[i]->size) {
+        MS_LOG(ERROR) << "Uploaded data for " << input_names[i] << " is oversized: got " << data_iter->second.size
+                      << ", but the registered size is " << params.inputs[i]->size;
+        return false;
+      }
+      auto upload_addr = std::make_shared<Address>();
+      MS_ERROR_IF_NULL_W_RET_VAL(upload_addr, false);
+      upload_addr->addr = data_iter->second.addr;
+      upload_addr->size = data_iter->second.size;
+      inputs[i] = upload_addr;
+    }
+
+    bool ret = aggr_kernel->Launch(inputs, params.workspace, params.outputs);
+    if (!ret) {
+      MS_LOG(ERROR) << "Launching aggregation kernel " << typeid(aggr_kernel.get()).name() << " failed.";
+      return false;
+    }
+  }
+  return true;
+}
+
 AddressPtr ParameterAggregator::GetWeight() {
   if (memory_register_ == nullptr) {
     MS_LOG(ERROR)
@@ -78,6 +78,12 @@ class ParameterAggregator {
   // Launch aggregators/optimizers of this ParameterAggregator in order.
   bool LaunchAggregators();
 
+  // Launch aggregators with the uploaded data accumulated in place: the kernel inputs named in new_data point
+  // directly at the caller's buffers for this launch instead of being staged into the registered slots with
+  // UpdateData first, so one model update is read exactly once. The caller must keep the buffers valid and
+  // hold the parameter lock until this method returns.
+  bool LaunchAggregators(const std::map<std::string, Address> &new_data);
+
   // Different from the method Pull, this method simply returns the weight of this ParameterAggregator without causing
   // any change of status.
   AddressPtr GetWeight();
@@ -294,11 +294,23 @@ bool SubstitutionList::ApplySubstitutionsToIR(const OptimizerPtr &optimizer, con
 
   bool changes = false;
   bool loop = true;
+  // Every sweep of a substitution is a full-graph traversal, so on the way to the fixed point only sweep
+  // a substitution again if the graph changed after its last sweep: count the changes globally and
+  // remember per substitution which change it has already seen.
+  size_t change_version = 1;
+  std::vector<size_t> last_sweep_version(list_.size(), 0);
   while (loop) {
     loop = false;
     for (size_t i = 0; i < list_.size(); i++) {
       const auto &substitution = list_[i];
+      if (last_sweep_version[i] == change_version) {
+        continue;
+      }
+      last_sweep_version[i] = change_version;
       bool change = ApplySubstitutionToIR(optimizer, func_graph, substitution);
+      if (change) {
+        ++change_version;
+      }
       changes = changes || change;
       loop = loop || change;
 #ifdef ENABLE_DUMP_IR
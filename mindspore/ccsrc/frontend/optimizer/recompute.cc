@@ -15,6 +15,7 @@
  */
 
 #include "frontend/optimizer/recompute.h"
+#include <cstdlib>
 #include <memory>
 #include <queue>
 #include <list>
@@ -22,6 +23,8 @@
 #include <string>
 #include "utils/hash_map.h"
 #include "utils/hash_set.h"
+#include "utils/ms_utils.h"
+#include "utils/convert_utils_base.h"
 #include "ir/func_graph.h"
 #include "mindspore/core/ops/core_ops.h"
 #include "include/common/utils/utils.h"
@@ -30,6 +33,10 @@ namespace mindspore {
 namespace opt {
 namespace {
 constexpr auto kGradientsFlag = "Gradients";
+constexpr auto kAutoRecomputeEnv = "MS_DEV_AUTO_RECOMPUTE";
+constexpr auto kAutoRecomputeThresholdEnv = "MS_DEV_AUTO_RECOMPUTE_THRESHOLD";
+// Activations smaller than the threshold are not worth the duplicated computation by default.
+constexpr size_t kDefaultAutoRecomputeMemThreshold = 1 << 20;
 const int64_t fusion_id_increasement_size = 2000;
 bool CanNotRecomputed(const CNodePtr &node) {
   static mindspore::HashSet<PrimitivePtr> not_recomputed_op_list{
@@ -39,6 +46,70 @@ bool CanNotRecomputed(const CNodePtr &node) {
                      [&node](const PrimitivePtr &prim) { return IsPrimitiveCNode(node, prim); });
 }
 
+// Ops whose recomputation costs much less than keeping their output resident: element-wise arithmetic,
+// activations and casts.
+bool IsCheapToRecompute(const CNodePtr &node) {
+  static const mindspore::HashSet<PrimitivePtr> cheap_recompute_op_list{
+    prim::kPrimRelu,    prim::kPrimGeLU, prim::kPrimSigmoid, prim::kPrimTanh,    prim::kPrimCast,
+    prim::kPrimAdd,     prim::kPrimSub,  prim::kPrimMul,     prim::kPrimRealDiv, prim::kPrimNeg,
+    prim::kPrimExp,     prim::kPrimSqrt, prim::kPrimSquare,  prim::kPrimMaximum, prim::kPrimMinimum,
+    prim::kPrimBiasAdd};
+  return std::any_of(cheap_recompute_op_list.begin(), cheap_recompute_op_list.end(),
+                     [&node](const PrimitivePtr &prim) { return IsPrimitiveCNode(node, prim); });
+}
+
+// The memory held by the output of the node in bytes, or 0 if it can not be inferred statically.
+size_t GetOutputMemSize(const AnfNodePtr &node) {
+  MS_EXCEPTION_IF_NULL(node);
+  const auto &abs = node->abstract();
+  if (abs == nullptr) {
+    return 0;
+  }
+  const auto &base_shape = abs->BuildShape();
+  if (base_shape == nullptr) {
+    return 0;
+  }
+  const auto &shape_ptr = base_shape->cast<abstract::ShapePtr>();
+  if (shape_ptr == nullptr) {
+    return 0;
+  }
+  const auto &type = abs->BuildType();
+  if (type == nullptr || !type->isa<TensorType>()) {
+    return 0;
+  }
+  size_t mem_size = GetTypeByte(type->cast<TensorTypePtr>()->element());
+  for (const auto &dim : shape_ptr->shape()) {
+    if (dim < 0) {
+      // The size of dynamic shape can not be estimated statically.
+      return 0;
+    }
+    mem_size *= LongToSize(dim);
+  }
+  return mem_size;
+}
+
+// Whether the node is selected by the automatic recompute mode enabled by the env MS_DEV_AUTO_RECOMPUTE:
+// ops whose output occupies much memory while the recomputation is cheap are discarded in forward and
+// recomputed in backward without any manual recompute flag. The op category stands in for the op duration
+// and the statically inferred output size for the memory footprint.
+bool IsEligibleForAutoRecompute(const CNodePtr &node) {
+  static const bool auto_recompute = common::GetEnv(kAutoRecomputeEnv) == "1";
+  if (!auto_recompute) {
+    return false;
+  }
+  if (!IsCheapToRecompute(node)) {
+    return false;
+  }
+  static const size_t mem_threshold = []() -> size_t {
+    const auto &env_threshold = common::GetEnv(kAutoRecomputeThresholdEnv);
+    if (env_threshold.empty()) {
+      return kDefaultAutoRecomputeMemThreshold;
+    }
+    return static_cast<size_t>(std::atoll(env_threshold.c_str()));
+  }();
+  return GetOutputMemSize(node) >= mem_threshold;
+}
+
 bool IsBpropNode(const AnfNodePtr &node) {
   MS_EXCEPTION_IF_NULL(node);
   if (!node->isa<CNode>()) {
@@ -309,7 +380,8 @@ void SetRecomputedAttr(const FuncGraphPtr &graph, const std::vector<CNodePtr> &o
     if (prim_recompute_attr != nullptr && prim_recompute_attr->isa<BoolImm>()) {
       prim_recompute_val = static_cast<int>(GetValue<bool>(prim_recompute_attr));
     }
-    if ((SetRecomputedScope(cnode) && prim_recompute_val != 0) || prim_recompute_val == 1) {
+    if ((SetRecomputedScope(cnode) && prim_recompute_val != 0) || prim_recompute_val == 1 ||
+        (prim_recompute_val == -1 && IsEligibleForAutoRecompute(cnode))) {
       cnode->AddAttr(kAttrRecompute, MakeValue(true));
     }
     if (!IsSetRecomputeCNodeAttr(node)) {
@@ -15,14 +15,17 @@
  */
 
 #include "frontend/parallel/allreduce_fusion/allreduce_fusion.h"
+#include <cstdlib>
 #include <memory>
 #include <queue>
 #include <string>
 #include <functional>
 #include <utility>
 #include "utils/hash_set.h"
+#include "utils/ms_utils.h"
 #include "ir/func_graph.h"
 #include "frontend/parallel/costmodel_context.h"
+#include "frontend/parallel/device_manager.h"
 #include "frontend/parallel/graph_util/node_info.h"
 #include "frontend/parallel/status.h"
 #include "frontend/parallel/parameter_manager.h"
@@ -112,6 +115,48 @@ Status AllCommFusion::SetFusionBySizeReduceScatter(const CNodePtr &ret, int64_t
   return SUCCESS;
 }
 
+// On a two-level network the backend executes a fused AllReduce hierarchically: an intra-node ReduceScatter, an
+// inter-node AllReduce on the node shards, and an intra-node AllGather. When the measured link bandwidths are
+// provided (in GB/s, via MS_COMM_FUSION_INTRA_NODE_BANDWIDTH and MS_COMM_FUSION_INTER_NODE_BANDWIDTH, with
+// MS_COMM_FUSION_DEVICES_PER_NODE giving the node size), the fusion boundary is derived from that time model so
+// that each fused group communicates for about the configured tail time, instead of cutting at a flat size.
+int64_t AllCommFusion::CalculateBandwidthAwareThreshold(int64_t threshold) const {
+  static const double intra_bandwidth = std::atof(common::GetEnv("MS_COMM_FUSION_INTRA_NODE_BANDWIDTH").c_str());
+  static const double inter_bandwidth = std::atof(common::GetEnv("MS_COMM_FUSION_INTER_NODE_BANDWIDTH").c_str());
+  if (intra_bandwidth <= 0 || inter_bandwidth <= 0) {
+    return threshold;
+  }
+  const int64_t default_devices_per_node = 8;
+  auto devices_per_node_env = common::GetEnv("MS_COMM_FUSION_DEVICES_PER_NODE");
+  int64_t devices_per_node = devices_per_node_env.empty() ? default_devices_per_node : std::atol(devices_per_node_env.c_str());
+  MS_EXCEPTION_IF_NULL(g_device_manager);
+  int64_t device_num = SizeToLong(g_device_manager->DeviceNum());
+  if (devices_per_node <= 1 || device_num <= devices_per_node || device_num % devices_per_node != 0) {
+    MS_LOG(INFO) << "The device num " << device_num << " is not hierarchical with node size " << devices_per_node
+                 << ", keep the size based fusion threshold.";
+    return threshold;
+  }
+  int64_t node_num = device_num / devices_per_node;
+  // Time per element of fused gradient: two intra-node phases each moving (d-1)/d of the data, plus the inter-node
+  // ring on the 1/d node shard moving 2*(n-1)/n of it. The thresholds in this pass count fp32 elements, matching
+  // DEFAULT_THRESHOLD_MB_TO_BYTE, so the bandwidths are scaled by the element size.
+  const double giga = 1073741824.0;
+  const double element_size = 4.0;
+  double intra_time = 2.0 * element_size * LongToDouble(devices_per_node - 1) / LongToDouble(devices_per_node) /
+                      (intra_bandwidth * giga);
+  double inter_time = 2.0 * element_size * LongToDouble(node_num - 1) / LongToDouble(node_num) /
+                      (LongToDouble(devices_per_node) * inter_bandwidth * giga);
+  double tail_time = CostModelContext::GetInstance()->costmodel_allreduce_fusion_tail_time();
+  int64_t bandwidth_threshold = static_cast<int64_t>(tail_time / (intra_time + inter_time));
+  if (bandwidth_threshold <= 0) {
+    return threshold;
+  }
+  MS_LOG(INFO) << "Hierarchical AllReduce planning: " << node_num << " nodes of " << devices_per_node
+               << " devices, intra-node bandwidth " << intra_bandwidth << " GB/s, inter-node bandwidth "
+               << inter_bandwidth << " GB/s, fusion threshold " << bandwidth_threshold << " elements.";
+  return bandwidth_threshold;
+}
+
 Status AllCommFusion::ProcessCommOpsFusion(const CNodePtr &ret, const std::string &comm_name) {
   if (ret == nullptr) {
     MS_LOG(ERROR) << "ret is nullptr.";
@@ -152,7 +197,7 @@ Status AllCommFusion::ProcessCommOpsFusion(const CNodePtr &ret, const std::strin
     (void)SetFusionBySizeReduceScatter(ret, threshold, prim::kPrimVirtualAssignAdd);
   }
   if (comm_name == ALL_REDUCE) {
-    (void)SetFusionBySize(ret, threshold, prim::kPrimMirror);
+    (void)SetFusionBySize(ret, CalculateBandwidthAwareThreshold(threshold), prim::kPrimMirror);
   }
   if (comm_name == ALL_GATHER) {
     (void)SetFusionBySize(ret, threshold, prim::kPrimMicroStepAllGather);
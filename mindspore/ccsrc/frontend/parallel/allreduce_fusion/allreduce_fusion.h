@@ -53,6 +53,9 @@ class AllCommFusion {
  private:
   Status SetFusionBySize(const CNodePtr &ret, int64_t threshold, const PrimitivePtr &primp);
   Status SetFusionBySizeReduceScatter(const CNodePtr &ret, int64_t threshold, const PrimitivePtr &primp);
+  // Derive the AllReduce fusion boundary from the hierarchical (intra-node/inter-node) bandwidths when they are
+  // configured; falls back to the given size threshold otherwise.
+  int64_t CalculateBandwidthAwareThreshold(int64_t threshold) const;
   AllreduceGraph allreduce_graph_;
   CNodePtr ret_;
   CNodePtr forward_ret_;
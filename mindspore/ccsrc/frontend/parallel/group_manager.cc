@@ -16,6 +16,7 @@
 
 #include "frontend/parallel/group_manager.h"
 #include <algorithm>
+#include <set>
 #include <vector>
 #include <utility>
 #if (!defined(_WIN32) && !defined(__APPLE__) && !(defined(ENABLE_TESTCASES) || defined(ENABLE_TEST)))
@@ -29,6 +30,23 @@
 
 namespace mindspore {
 namespace parallel {
+namespace {
+// Names of the communication groups whose communicators already exist in this process, whether created
+// by the compile-time pass or restored from the group-info checkpoint of a previous run. The restore
+// path (CreateGroups) does not go through GroupManager, so this registry is what lets a later compile
+// of the same job skip the communicator setup for groups that were already created. Group creation is
+// always done on one thread (it must share the thread of the collective initialization), so no lock.
+std::set<std::string> g_created_comm_groups;
+
+bool IsCommGroupCreated(const std::string &group_name) {
+  return g_created_comm_groups.find(group_name) != g_created_comm_groups.end();
+}
+
+void RecordCommGroupCreated(const std::string &group_name) { (void)g_created_comm_groups.insert(group_name); }
+
+void RecordCommGroupDestroyed(const std::string &group_name) { (void)g_created_comm_groups.erase(group_name); }
+}  // namespace
+
 Group::Group() {
   name_.clear();
   devices_.clear();
@@ -73,28 +91,42 @@ GroupManager::GroupManager() { groups_.clear(); }
 #if (!defined(_WIN32) && !defined(__APPLE__) && !(defined(ENABLE_TESTCASES) || defined(ENABLE_TEST)))
 bool GroupManager::CreateGroupByExecutor(const std::string &device_name, const std::string &group_name,
                                          const std::vector<uint32_t> ranks, uint32_t device_id) {
+  if (IsCommGroupCreated(group_name)) {
+    MS_LOG(INFO) << "The communicator of group " << group_name << " already exists, skip creating it.";
+    return true;
+  }
+  bool ret = true;
   // The group operation thread must be same with nccl init thread in the GPU device.
   if (MsContext::GetInstance()->get_param<bool>(MS_CTX_ENABLE_MINDRT) ||
       (MsContext::GetInstance()->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kGPUDevice)) {
-    return CommManager::GetInstance().CreateGroupSync(group_name, ranks);
+    ret = CommManager::GetInstance().CreateGroupSync(group_name, ranks);
   } else {
     auto executor = session::ExecutorManager::Instance().GetExecutor(device_name, device_id);
     MS_EXCEPTION_IF_NULL(executor);
-    return executor->CreateCommGroup(group_name, ranks);
+    ret = executor->CreateCommGroup(group_name, ranks);
+  }
+  if (ret) {
+    RecordCommGroupCreated(group_name);
   }
+  return ret;
 }
 
 bool GroupManager::DestroyGroupByExecutor(const std::string &device_name, const std::string &group_name,
                                           uint32_t device_id) {
+  bool ret = true;
   // The group operation thread must be same with nccl init thread in the GPU device.
   if (MsContext::GetInstance()->get_param<bool>(MS_CTX_ENABLE_MINDRT) ||
       (MsContext::GetInstance()->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kGPUDevice)) {
-    return CommManager::GetInstance().DestroyGroup(group_name);
+    ret = CommManager::GetInstance().DestroyGroup(group_name);
   } else {
     auto executor = session::ExecutorManager::Instance().GetExecutor(device_name, device_id);
     MS_EXCEPTION_IF_NULL(executor);
-    return executor->DestroyCommGroup(group_name);
+    ret = executor->DestroyCommGroup(group_name);
+  }
+  if (ret) {
+    RecordCommGroupDestroyed(group_name);
   }
+  return ret;
 }
 
 Status CreateGroups(const std::vector<std::pair<std::string, std::vector<uint32_t>>> &group_info) {
@@ -106,6 +138,10 @@ Status CreateGroups(const std::vector<std::pair<std::string, std::vector<uint32_
   auto executor = session::ExecutorManager::Instance().GetExecutor(device_name, device_id);
   MS_EXCEPTION_IF_NULL(executor);
   for (auto &group : group_info) {
+    if (IsCommGroupCreated(group.first)) {
+      MS_LOG(INFO) << "The communicator of group " << group.first << " already exists, skip creating it.";
+      continue;
+    }
     bool ret = true;
     // The group operation thread must be same with nccl init thread in the GPU device.
     if (context_ptr->get_param<bool>(MS_CTX_ENABLE_MINDRT) ||
@@ -118,6 +154,7 @@ Status CreateGroups(const std::vector<std::pair<std::string, std::vector<uint32_
       MS_LOG(ERROR) << "Create group failed, group name is " << group.first << ", ranks is " << group.second;
       return FAILED;
     }
+    RecordCommGroupCreated(group.first);
     MS_LOG(INFO) << "Create group success, group name is " << group.first << ", ranks is " << group.second;
   }
 
@@ -149,11 +186,16 @@ Status CreateGroups(const std::vector<std::pair<std::string, std::vector<uint32_
   auto executor = parallel::ExecutorManager::Instance().GetExecutor(device_name, device_id);
   MS_EXCEPTION_IF_NULL(executor);
   for (auto &group : group_info) {
+    if (IsCommGroupCreated(group.first)) {
+      MS_LOG(INFO) << "The communicator of group " << group.first << " already exists, skip creating it.";
+      continue;
+    }
     bool ret = executor->CreateCommGroup(group.first, group.second);
     if (!ret) {
       MS_LOG(ERROR) << "Create group failed, group name is " << group.first << ", ranks is " << group.second;
       return FAILED;
     }
+    RecordCommGroupCreated(group.first);
     MS_LOG(INFO) << "Create group success, group name is " << group.first << ", ranks is " << group.second;
   }
 
@@ -22,7 +22,9 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -37,6 +39,7 @@
 #include "frontend/parallel/auto_parallel/rec_core/rec_generate_strategy.h"
 #include "frontend/parallel/auto_parallel/rec_core/rec_parse_graph.h"
 #include "frontend/parallel/auto_parallel/rec_core/rec_partition.h"
+#include "include/common/thread_pool.h"
 #include "include/common/utils/parallel_context.h"
 #include "frontend/parallel/graph_util/node_info.h"
 #include "frontend/parallel/graph_util/graph_info.h"
@@ -48,6 +51,7 @@
 #include "ir/anf.h"
 #include "ir/param_info.h"
 #include "ir/tensor.h"
+#include "utils/ms_utils.h"
 #ifdef WITH_BACKEND
 #include "ps/util.h"
 #endif
@@ -197,6 +201,17 @@ bool IsOperatorsInTwoSeparateLoops(const CNodePtr &a_cnode, const CNodePtr &b_cn
 // 'configured_stra_ops_' includes all operators that are configured sharding strategies.
 std::map<OperatorInfoPtr, StrategyPtr, OpsPtrCompare> configured_stra_ops_;
 std::set<OperatorInfoPtr> ignore_candidate_;
+// The operators whose candidate strategies are still to be generated, paired with a signature summarizing the
+// primitive, shapes, parameter flags and type lengths. Their generation is deferred until all the cost graph nodes
+// are created, so that operators sharing one signature (e.g. the experts of a MoE block) are generated only once
+// and the distinct signatures are searched concurrently over the host cores.
+std::vector<std::pair<std::string, OperatorInfoPtr>> pending_stra_gen_ops_;
+
+bool DeferredStrategyGenEnabled() {
+  static const bool enable_deferred_stra_gen = common::GetEnv("MS_DEV_PARALLEL_STRATEGY_SEARCH") == "1";
+  return enable_deferred_stra_gen;
+}
+
 void InitCostGraph() {
   if (entire_costgraph == nullptr) {
     entire_costgraph = std::make_shared<CostGraph>();
@@ -206,6 +221,7 @@ void InitCostGraph() {
   entire_costgraph->Init();
   configured_stra_ops_.clear();
   ignore_candidate_.clear();
+  pending_stra_gen_ops_.clear();
 }
 
 void SetStrategyToOperator(const OperatorInfoPtr &operator_info, const PrimitivePtr &prim,
@@ -269,6 +285,79 @@ void AddOperatorToIgnoreCandidates(const PrimitivePtr &prim, const OperatorInfoP
   }
 }
 
+// Build the signature deciding the result of strategy generation: two operators with the same primitive, attrs,
+// shapes, input values, parameter flags and type lengths generate the same candidate strategies and costs.
+std::string BuildStrategyGenSignature(const PrimitivePtr &prim, const std::vector<Shapes> &shape_list,
+                                      const std::vector<ValuePtr> &input_value,
+                                      const std::vector<bool> &parameter_info,
+                                      const std::vector<size_t> &inputs_type_length,
+                                      const std::vector<size_t> &outputs_type_length) {
+  std::ostringstream oss;
+  oss << prim->name();
+  // The attrs are sorted so that the signature does not depend on the hash map's traversal order.
+  std::map<std::string, ValuePtr> sorted_attrs(prim->attrs().begin(), prim->attrs().end());
+  for (const auto &attr : sorted_attrs) {
+    oss << "/" << attr.first << ":" << (attr.second == nullptr ? "null" : attr.second->ToString());
+  }
+  for (const auto &shapes : shape_list) {
+    for (const auto &shape : shapes) {
+      oss << "/" << ShapeToString(shape);
+    }
+  }
+  for (const auto &value : input_value) {
+    oss << "/" << (value == nullptr ? "-" : value->ToString());
+  }
+  oss << "/";
+  for (const auto is_parameter : parameter_info) {
+    oss << (is_parameter ? "1" : "0");
+  }
+  for (const auto length : inputs_type_length) {
+    oss << "/" << length;
+  }
+  for (const auto length : outputs_type_length) {
+    oss << "/" << length;
+  }
+  return oss.str();
+}
+
+// Let 'to' inherit the generated strategies and costs of 'from', which has the same signature. The strategies and
+// the Cost objects are deep copied since both can be mutated per operator afterwards (e.g. by the approximation
+// and the memory cost calculation); only the TensorInfo vectors are copied by value.
+void CopyStrategyCosts(const OperatorInfoPtr &from, const OperatorInfoPtr &to) {
+  std::vector<std::shared_ptr<StrategyWithCost>> cloned_costs;
+  const auto &src_costs = from->GetStrategyCost();
+  cloned_costs.reserve(src_costs.size());
+  for (const auto &swc : src_costs) {
+    MS_EXCEPTION_IF_NULL(swc);
+    MS_EXCEPTION_IF_NULL(swc->strategy_ptr);
+    auto cloned = std::make_shared<StrategyWithCost>(std::make_shared<Strategy>(*(swc->strategy_ptr)),
+                                                     swc->inputs_ptr, swc->outputs_ptr);
+    cloned->cost_list.reserve(swc->cost_list.size());
+    for (const auto &cost : swc->cost_list) {
+      MS_EXCEPTION_IF_NULL(cost);
+      (void)cloned->cost_list.emplace_back(std::make_shared<Cost>(*cost));
+    }
+    (void)cloned_costs.emplace_back(std::move(cloned));
+  }
+  to->SetStrategyCost(cloned_costs);
+}
+
+void HandlePostStrategyGeneration(const OperatorInfoPtr &operator_info) {
+  bool use_sp_and_dataset = ((ParallelContext::GetInstance()->strategy_search_mode() == kShardingPropagation) ||
+                             (ParallelContext::GetInstance()->sharding_propagation())) &&
+                            (operator_info->name().find(VIRTUAL_DATA_SET_INFO) != std::string::npos);
+  if (use_sp_and_dataset) {
+    const auto &swc_vec = operator_info->GetStrategyCost();
+    if (swc_vec.empty()) {
+      MS_LOG(EXCEPTION) << "No available strategy for: " << operator_info->name();
+    }
+    MS_EXCEPTION_IF_NULL(swc_vec[0]->strategy_ptr);
+    (void)configured_stra_ops_.emplace(operator_info, swc_vec[0]->strategy_ptr);
+  }
+  // If 'approximation' is enabled, the 'strategy_cost' of each operator is approximated
+  ApplyApproximationForNode(operator_info);
+}
+
 OperatorInfoPtr CreateTheOperatorInfo(const PrimitivePtr &prim, const CNodePtr &cnode, bool is_last_nodes,
                                       StrategyMap *stra_map) {
   MS_EXCEPTION_IF_NULL(prim);
@@ -345,6 +434,13 @@ OperatorInfoPtr CreateTheOperatorInfo(const PrimitivePtr &prim, const CNodePtr &
     retGenStra = operator_info->SetCostUnderStrategy(strategyPtr);
     attrs = prim->attrs();
     operator_info->addAttr(IN_STRATEGY, attrs[GEN_STRATEGY]);  // for d-rec
+  } else if (DeferredStrategyGenEnabled()) {
+    // The generation is deferred and batched after all the cost graph nodes are created, so that operators sharing
+    // one signature are generated only once and the distinct signatures are searched in parallel.
+    (void)pending_stra_gen_ops_.emplace_back(
+      BuildStrategyGenSignature(prim, shape_list, input_value, parameter_info, inputs_type_length, outputs_type_length),
+      operator_info);
+    return operator_info;
   } else {
     MS_LOG(INFO) << "auto-searching strategy...";
     retGenStra = operator_info->GenerateStrategies(0);
@@ -355,20 +451,64 @@ OperatorInfoPtr CreateTheOperatorInfo(const PrimitivePtr &prim, const CNodePtr &
     return nullptr;
   }
 
-  bool use_sp_and_dataset = ((ParallelContext::GetInstance()->strategy_search_mode() == kShardingPropagation) ||
-                             (ParallelContext::GetInstance()->sharding_propagation())) &&
-                            (operator_info->name().find(VIRTUAL_DATA_SET_INFO) != std::string::npos);
-  if (use_sp_and_dataset) {
-    const auto &swc_vec = operator_info->GetStrategyCost();
-    if (swc_vec.empty()) {
-      MS_LOG(EXCEPTION) << "No available strategy for: " << operator_info->name();
+  HandlePostStrategyGeneration(operator_info);
+  return operator_info;
+}
+
+// Run the strategy generation deferred by CreateTheOperatorInfo. Only the first operator of each signature runs the
+// generation, using all the host cores for the distinct signatures, and the other operators inherit a copy of its
+// result. The post steps touching shared state (configured_stra_ops_ and the approximation) stay sequential.
+Status GenerateStrategiesForDeferredOperators() {
+  if (pending_stra_gen_ops_.empty()) {
+    return SUCCESS;
+  }
+  std::unordered_map<std::string, std::vector<OperatorInfoPtr>> signature_groups;
+  std::vector<OperatorInfoPtr> representatives;
+  for (const auto &pending : pending_stra_gen_ops_) {
+    auto &group = signature_groups[pending.first];
+    if (group.empty()) {
+      representatives.push_back(pending.second);
+    }
+    group.push_back(pending.second);
+  }
+  MS_LOG(INFO) << "Generating strategies for " << pending_stra_gen_ops_.size() << " operators with "
+               << representatives.size() << " distinct signatures.";
+  std::vector<Status> statuses(representatives.size(), SUCCESS);
+  size_t thread_num = common::ThreadPool::GetInstance().GetSyncRunThreadNum();
+  if (representatives.size() > 1 && thread_num > 1) {
+    std::vector<common::Task> tasks;
+    tasks.reserve(representatives.size());
+    for (size_t i = 0; i < representatives.size(); ++i) {
+      auto operator_info = representatives[i];
+      auto task = [&statuses, i, operator_info]() {
+        statuses[i] = operator_info->GenerateStrategies(0);
+        return statuses[i] == SUCCESS ? common::SUCCESS : common::FAIL;
+      };
+      (void)tasks.emplace_back(task);
+    }
+    (void)common::ThreadPool::GetInstance().SyncRun(tasks);
+  } else {
+    for (size_t i = 0; i < representatives.size(); ++i) {
+      statuses[i] = representatives[i]->GenerateStrategies(0);
     }
-    MS_EXCEPTION_IF_NULL(swc_vec[0]->strategy_ptr);
-    (void)configured_stra_ops_.emplace(operator_info, swc_vec[0]->strategy_ptr);
   }
-  // If 'approximation' is enabled, the 'strategy_cost' of each operator is approximated
-  ApplyApproximationForNode(operator_info);
-  return operator_info;
+  for (size_t i = 0; i < representatives.size(); ++i) {
+    if (statuses[i] != SUCCESS) {
+      MS_LOG(ERROR) << "Strategy search for Operator " << representatives[i]->name() << " failed.";
+      return FAILED;
+    }
+  }
+  for (const auto &group : signature_groups) {
+    const auto &generated = group.second.front();
+    for (size_t i = 1; i < group.second.size(); ++i) {
+      CopyStrategyCosts(generated, group.second[i]);
+    }
+  }
+  for (const auto &pending : pending_stra_gen_ops_) {
+    HandlePostStrategyGeneration(pending.second);
+  }
+  pending_stra_gen_ops_.clear();
+  return SUCCESS;
 }
 
 bool IsFindWrong(const OperatorInfoPtr current_op_ptr, const std::string &prim_name) {
@@ -1001,6 +1141,9 @@ Status ParallelStrategySearch(const std::vector<AnfNodePtr> &all_nodes, const Fu
       MS_LOG(EXCEPTION) << "Constructing nodes for cost graph failed.";
     }
   }
+  if (GenerateStrategiesForDeferredOperators() != SUCCESS) {
+    MS_LOG(EXCEPTION) << "Generating strategies for the cost graph operators failed.";
+  }
   // Step 1.1
   ReshapeCostCompute(all_nodes);
   // Step 2
@@ -1152,6 +1295,9 @@ Status ParallelStrategyRecSearch(const std::vector<AnfNodePtr> &all_nodes, const
       MS_LOG(EXCEPTION) << "Constructing nodes for cost graph failed.";
     }
   }
+  if (GenerateStrategiesForDeferredOperators() != SUCCESS) {
+    MS_LOG(EXCEPTION) << "Generating strategies for the cost graph operators failed.";
+  }
   ReshapeCostCompute(all_nodes);
   ConstructCostGraphEdges(all_nodes);
 
@@ -0,0 +1,91 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_INCLUDE_COMMON_DEBUG_ALLOC_COUNTER_H_
+#define MINDSPORE_CCSRC_INCLUDE_COMMON_DEBUG_ALLOC_COUNTER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "include/common/visible.h"
+
+namespace mindspore {
+// Host allocation statistics of one audited scope, updated lock free from the interposed operator new/delete.
+struct AllocCounterStat {
+  std::atomic<uint64_t> alloc_calls{0};
+  std::atomic<uint64_t> alloc_bytes{0};
+  std::atomic<uint64_t> free_calls{0};
+  std::atomic<int64_t> live_bytes{0};
+  std::atomic<int64_t> peak_live_bytes{0};
+};
+
+// Aggregates host allocations by call site. When built with the ENABLE_ALLOC_AUDIT option, the global
+// operator new/delete are interposed and every allocation is charged to the innermost AllocCounterScope of
+// the calling thread; allocations outside any scope fall into the builtin "untagged" entry. The per-scope
+// report is exported through the rdr subsystem, so malloc contention can be attributed in production
+// without external tooling.
+class COMMON_EXPORT AllocCounter {
+ public:
+  static AllocCounter &GetInstance();
+
+  // Fetch the stat slot of the given scope name, creating it on first use.
+  AllocCounterStat *RegisterScope(const std::string &name);
+
+  // Charge one allocation/deallocation to the current scope of this thread.
+  void OnAlloc(std::size_t size) noexcept;
+  void OnFree(std::size_t size) noexcept;
+
+  std::string DumpToString() const;
+
+  // The innermost audited scope of this thread, maintained by AllocCounterScope.
+  static AllocCounterStat *&CurrentStat() noexcept;
+
+ private:
+  AllocCounter();
+  ~AllocCounter() = default;
+  AllocCounter(const AllocCounter &) = delete;
+  AllocCounter &operator=(const AllocCounter &) = delete;
+
+  std::map<std::string, std::unique_ptr<AllocCounterStat>> stats_;
+  AllocCounterStat *untagged_;
+  mutable std::mutex mtx_;
+};
+
+// Tag the host allocations of the enclosing dynamic extent, e.g. AllocCounterScope scope("KernelActor::Run");
+// Nested scopes restore the outer tag on destruction. The name must be a literal so that tagging itself does
+// not allocate. Without ENABLE_ALLOC_AUDIT the scope is an empty object and the call sites cost nothing.
+class COMMON_EXPORT AllocCounterScope {
+ public:
+#ifdef ENABLE_ALLOC_AUDIT
+  explicit AllocCounterScope(const char *name);
+  ~AllocCounterScope();
+#else
+  explicit AllocCounterScope(const char *) {}
+  ~AllocCounterScope() = default;
+#endif
+  AllocCounterScope(const AllocCounterScope &) = delete;
+  AllocCounterScope &operator=(const AllocCounterScope &) = delete;
+
+ private:
+#ifdef ENABLE_ALLOC_AUDIT
+  AllocCounterStat *previous_{nullptr};
+#endif
+};
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_INCLUDE_COMMON_DEBUG_ALLOC_COUNTER_H_
@@ -62,6 +62,71 @@ class COMMON_EXPORT PhiloxGenerator {
   static constexpr std::array<uint32_t, kResultNum> keyConstant = {0xD2511F53, 0x9E3779B9, 0xCD9E8D57, 0xBB67AE85};
 };
 
+// Reinterpret the low 23 bits of input as the mantissa of a float in [1.0, 2.0) and shift it
+// down to [0.0, 1.0).
+inline bool UInt32ToFloat32(uint32_t input, float *output) {
+  const uint32_t temp_value = input & 0x7fffffu;
+  const uint32_t exp = static_cast<uint32_t>(127);
+  const uint32_t val = (exp << 23) | temp_value;
+  errno_t mem_ret = memcpy_s(output, sizeof(float), &val, sizeof(uint32_t));
+  if (mem_ret != EOK) {
+    MS_LOG(ERROR) << "UInt32ToFloat32 memcpy is failed";
+    return false;
+  }
+  *output = *output - 1.0f;
+  return true;
+}
+
+template <class T, typename vartype>
+class NormalDistribution;
+template <class T>
+class NormalDistribution<T, float> {
+ public:
+  std::array<float, kResultNum> operator()(T *generator) {
+    std::array<uint32_t, 4> generate_value = (*generator)();
+    const float PI = 3.14;
+    for (uint32_t i = 0; i < kResultNum; i += 2) {
+      float temp[2];
+      UInt32ToFloat32(generate_value[i], &temp[0]);
+      UInt32ToFloat32(generate_value[i + 1], &temp[1]);
+      const float threshold = 1.0e-7f;
+      temp[0] = temp[0] < threshold ? threshold : temp[0];
+      temp[1] = temp[1] < threshold ? threshold : temp[1];
+      result_[i] = sqrt(-2.0 * log(temp[0])) * sin(2 * PI * temp[1]);
+      result_[i + 1] = sqrt(-2.0 * log(temp[0])) * cos(2 * PI * temp[1]);
+    }
+    return result_;
+  }
+
+ private:
+  std::array<float, kResultNum> result_;
+};
+
+template <class T, typename vartype>
+class UniformDistribution;
+template <class T>
+class UniformDistribution<T, float> {
+ public:
+  std::array<float, kResultNum> operator()(T *generator) {
+    std::array<uint32_t, 4> generate_value = (*generator)();
+    std::array<float, kResultNum> result;
+    for (uint32_t i = 0; i < kResultNum; i++) {
+      UInt32ToFloat32(generate_value[i], &result[i]);
+    }
+    return result;
+  }
+};
+
+// Returns the kResultNum random values of counter block `block` of the stream seeded by `seed`.
+// The result only depends on (seed, block), not on which thread asks for it or what was generated
+// before, so kernels which partition an output over ParallelLaunch can map element i to block
+// i / kResultNum and reproduce the same tensor for any thread number and block boundaries.
+inline std::array<uint32_t, kResultNum> PhiloxBlock(uint64_t seed, uint64_t block) {
+  PhiloxGenerator generator(seed);
+  generator.JumpStep(block);
+  return generator();
+}
+
 template <class T>
 bool FillRandoms(PhiloxGenerator generator, float *output, int64_t vet_size, int64_t thread_Id) {
   T distribution;
@@ -511,6 +511,8 @@ constexpr auto kAttrRecordEvent = "record_event";
 constexpr auto kAttrWaitEvent = "wait_event";
 constexpr auto kAttrRecordEventStream = "record_event_stream";
 constexpr auto kAttrWaitEventStream = "wait_event_stream";
+constexpr auto kAttrConcurrentRecordEvents = "concurrent_record_events";
+constexpr auto kAttrConcurrentWaitEvents = "concurrent_wait_events";
 constexpr auto kAttrStream = "stream";
 constexpr auto kAttrIndex = "index";
 constexpr auto kAttrSplitDim = "split_dim";
@@ -20,7 +20,9 @@
 #include <unistd.h>
 
 #include <chrono>
+#include <cstdio>
 #include <algorithm>
+#include <fstream>
 #include <map>
 #include <memory>
 #include <string>
@@ -31,6 +33,7 @@
 #include "ir/dtype.h"
 #include "ir/func_graph.h"
 #include "common/graph_kernel/graph_kernel_flags.h"
+#include "utils/ms_utils.h"
 #include "kernel/common_utils.h"
 #include "kernel/akg/akg_kernel_json_generator.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
@@ -42,6 +45,7 @@ constexpr int32_t MAX_ERROR_LEN = 1024;
 constexpr int32_t PROCESS_NUM = 16;
 constexpr int32_t TIME_OUT = 300;
 constexpr auto kLogLevel = "log_level";
+constexpr auto kSharedCachePathEnv = "MS_AKG_SHARED_KERNEL_CACHE_PATH";
 
 #define ACQUIRE_LOCK LockMng lock(fd_, __func__, __LINE__)
 
@@ -551,6 +555,9 @@ bool AkgKernelBuilder::AkgOpParallelBuild(const std::vector<JsonNodePair> &build
     return false;
   }
 
+  // Publish the kernels compiled in this process, so that other jobs with the same fusions reuse them.
+  SaveToSharedCache(new_build_args);
+
   if (!HandleRepeatNodes()) {
     MS_LOG(ERROR) << "Handle repeat nodes failed.";
     return false;
@@ -559,12 +566,101 @@ bool AkgKernelBuilder::AkgOpParallelBuild(const std::vector<JsonNodePair> &build
   return true;
 }
 
+void AkgKernelBuilder::LoadSharedCache() {
+  auto shared_dir = common::GetEnv(kSharedCachePathEnv);
+  if (shared_dir.empty()) {
+    return;
+  }
+  if (shared_dir.back() != '/') {
+    shared_dir += "/";
+  }
+  auto bin_map = KernelMeta::GetInstance();
+  DIR *dir = opendir(shared_dir.c_str());
+  if (dir == nullptr) {
+    MS_LOG(WARNING) << "The shared kernel cache dir [" << shared_dir << "] is not exist";
+    return;
+  }
+  struct dirent *entry;
+  constexpr size_t SUFFIX_LENS = 5;
+  size_t load_num = 0;
+  while ((entry = readdir(dir)) != nullptr) {
+    std::string kernel_json = entry->d_name;
+    if (kernel_json.length() <= SUFFIX_LENS) {
+      continue;
+    }
+    auto suffix = kernel_json.substr(kernel_json.length() - SUFFIX_LENS);
+    if (suffix != kJsonSuffix) {
+      continue;
+    }
+    auto kernel_name = kernel_json.substr(0, kernel_json.length() - SUFFIX_LENS);
+    (void)bin_map->Insert(kernel_name, shared_dir + kernel_json);
+    ++load_num;
+  }
+  (void)closedir(dir);
+  MS_LOG(INFO) << "Load " << load_num << " kernels from the shared kernel cache dir [" << shared_dir << "]";
+}
+
+void AkgKernelBuilder::SaveToSharedCache(const std::vector<JsonNodePair> &build_args) {
+  auto shared_dir = common::GetEnv(kSharedCachePathEnv);
+  if (shared_dir.empty() || build_args.empty()) {
+    return;
+  }
+  if (shared_dir.back() != '/') {
+    shared_dir += "/";
+  }
+  std::unordered_set<std::string> built_kernel_names;
+  for (const auto &[json_generator, anf_node] : build_args) {
+    MS_EXCEPTION_IF_NULL(anf_node);
+    (void)built_kernel_names.insert(json_generator.kernel_name());
+  }
+
+  auto bin_map = KernelMeta::GetInstance();
+  auto kernel_dir = bin_map->kernel_meta_path();
+  DIR *dir = opendir(kernel_dir.c_str());
+  if (dir == nullptr) {
+    MS_LOG(DEBUG) << "kernel dir [" << kernel_dir << "] not exist";
+    return;
+  }
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    std::string file_name = entry->d_name;
+    auto dot_pos = file_name.rfind('.');
+    if (dot_pos == std::string::npos || built_kernel_names.count(file_name.substr(0, dot_pos)) == 0) {
+      continue;
+    }
+    std::string dst_file = shared_dir + file_name;
+    if (access(dst_file.c_str(), F_OK) == 0) {
+      continue;
+    }
+    std::ifstream src(kernel_dir + file_name, std::ifstream::binary);
+    if (!src.is_open()) {
+      continue;
+    }
+    // Copy through a temporary file and rename it, so that concurrent jobs never read a half-written kernel.
+    std::string tmp_file = dst_file + ".tmp." + std::to_string(getpid());
+    std::ofstream dst(tmp_file, std::ofstream::binary | std::ofstream::trunc);
+    if (!dst.is_open()) {
+      MS_LOG(WARNING) << "Open the shared kernel cache file failed: " << tmp_file;
+      break;
+    }
+    dst << src.rdbuf();
+    dst.close();
+    if (std::rename(tmp_file.c_str(), dst_file.c_str()) != 0) {
+      MS_LOG(WARNING) << "Rename the shared kernel cache file failed: " << dst_file;
+      (void)std::remove(tmp_file.c_str());
+    }
+  }
+  (void)closedir(dir);
+}
+
 void AkgKernelBuilder::LoadCache() {
   static bool has_load = false;
   if (has_load) {
     return;
   }
   auto bin_map = KernelMeta::GetInstance();
+  // Load the shared cache first, so that the kernels in the local kernel meta dir take precedence.
+  LoadSharedCache();
   auto kernel_dir = bin_map->kernel_meta_path();
   DIR *dir = opendir(kernel_dir.c_str());
   if (dir == nullptr) {
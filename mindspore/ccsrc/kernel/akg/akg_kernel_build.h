@@ -53,6 +53,13 @@ class AkgKernelBuilder {
   std::vector<JsonNodePair> GetNotCachedKernels(const std::vector<JsonNodePair> &build_args);
   std::vector<std::string> GetKernelJsonsByHashId(const std::vector<JsonNodePair> &build_args,
                                                   const std::set<size_t> &fetched_ids);
+  // Load the kernels of the host-level shared cache dir (set by the env MS_AKG_SHARED_KERNEL_CACHE_PATH) into
+  // the kernel meta, so that identical fusions compiled by other jobs are reused instead of rebuilt. The kernel
+  // name already contains the hash of the fused graph, so it addresses the cache content directly.
+  void LoadSharedCache();
+  // Publish the kernels compiled in this process into the shared cache dir, copying each file through a
+  // temporary name and renaming it so that concurrent jobs never read a half-written kernel.
+  void SaveToSharedCache(const std::vector<JsonNodePair> &build_args);
   bool InsertToCache(const std::vector<JsonNodePair> &build_args);
   bool HandleRepeatNodes();
   bool AkgOpParallelBuild(const std::vector<JsonNodePair> &build_args);
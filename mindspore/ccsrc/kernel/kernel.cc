@@ -175,9 +175,54 @@ void KernelTensor::SetDeviceShapeAdaptively(const std::vector<int64_t> &device_s
   tensor_info_.device_shape_adaptively = device_shape_adaptively;
 }
 
+bool KernelMod::ShapesEqualToResizeCache(const std::vector<KernelTensorPtr> &inputs,
+                                         const std::vector<KernelTensorPtr> &outputs) const {
+  if (inputs.size() != resize_cache_input_shapes_.size() || outputs.size() != resize_cache_output_shapes_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(inputs[i]);
+    if (inputs[i]->GetShapeVector() != resize_cache_input_shapes_[i]) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(outputs[i]);
+    if (outputs[i]->GetShapeVector() != resize_cache_output_shapes_[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int KernelMod::ResizeWithCache(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+                               const std::vector<KernelTensorPtr> &outputs,
+                               const std::map<uint32_t, tensor::TensorPtr> &inputsOnHost) {
+  // A value depending resize is not a pure function of the shapes, so it can never be skipped.
+  bool cacheable = inputsOnHost.empty() && !is_need_retrieve_output_shape_;
+  if (cacheable && resize_cache_valid_ && ShapesEqualToResizeCache(inputs, outputs)) {
+    return static_cast<int>(KRET_OK);
+  }
+
+  auto ret = Resize(base_operator, inputs, outputs, inputsOnHost);
+  if (cacheable && ret == static_cast<int>(KRET_OK)) {
+    resize_cache_input_shapes_.clear();
+    resize_cache_output_shapes_.clear();
+    (void)std::transform(inputs.begin(), inputs.end(), std::back_inserter(resize_cache_input_shapes_),
+                         [](const KernelTensorPtr &input) { return input->GetShapeVector(); });
+    (void)std::transform(outputs.begin(), outputs.end(), std::back_inserter(resize_cache_output_shapes_),
+                         [](const KernelTensorPtr &output) { return output->GetShapeVector(); });
+    resize_cache_valid_ = true;
+  }
+  return ret;
+}
+
 int KernelMod::Resize(const BaseOperatorPtr & /* base_operator */, const std::vector<KernelTensorPtr> &inputs,
                       const std::vector<KernelTensorPtr> &outputs,
                       const std::map<uint32_t, tensor::TensorPtr> & /* inputsOnHost */) {
+  // Any resize which does not come through ResizeWithCache may change the kernel state, so the cached
+  // shapes are no longer trustworthy. ResizeWithCache revalidates after the call.
+  resize_cache_valid_ = false;
   auto ret = KRET_OK;
   workspace_size_list_.clear();
   input_size_list_.clear();
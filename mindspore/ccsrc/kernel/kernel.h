@@ -271,6 +271,16 @@ class KernelMod {
     const std::vector<KernelTensorPtr> &outputs,
     const std::map<uint32_t, tensor::TensorPtr> &inputsOnHost = std::map<uint32_t, tensor::TensorPtr>());
 
+  // The per-step resize entry for dynamic shape kernels: skip the whole virtual Resize chain when the
+  // shapes are unchanged since the last successful Resize. Skipping is a no-op in that case because the
+  // size lists and the kernel internal state were computed from exactly these shapes. Kernels whose
+  // resize result also depends on input values (non-empty inputsOnHost) or which retrieve their output
+  // shape after launch are never skipped.
+  int ResizeWithCache(
+    const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+    const std::vector<KernelTensorPtr> &outputs,
+    const std::map<uint32_t, tensor::TensorPtr> &inputsOnHost = std::map<uint32_t, tensor::TensorPtr>());
+
   // Some kernels, e.g., Unique, can only get its output shape after its computing finished.
   virtual bool IsNeedRetrieveOutputShape() { return is_need_retrieve_output_shape_; }
   virtual std::vector<KernelTensorPtr> RetrieveOutputShape() {
@@ -315,9 +325,17 @@ class KernelMod {
   bool is_need_retrieve_output_shape_ = false;
 
  private:
+  bool ShapesEqualToResizeCache(const std::vector<KernelTensorPtr> &inputs,
+                                const std::vector<KernelTensorPtr> &outputs) const;
+
   std::vector<AddressPtr> inputs_addr_;
   std::vector<AddressPtr> workspaces_addr_;
   std::vector<AddressPtr> outputs_addr_;
+  // The shapes of the last successful Resize, see ResizeWithCache. A single entry is enough and is the
+  // only sound choice: the internal state of a derived kernel mod always belongs to its last resize.
+  std::vector<ShapeVector> resize_cache_input_shapes_;
+  std::vector<ShapeVector> resize_cache_output_shapes_;
+  bool resize_cache_valid_{false};
 };
 using KernelModPtr = std::shared_ptr<KernelMod>;
 
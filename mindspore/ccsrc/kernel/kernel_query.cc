@@ -16,6 +16,11 @@
 
 #include "kernel/kernel_query.h"
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include "utils/hash_map.h"
 #include "plugin/device/ascend/kernel/aicpu/aicpu_kernel_metadata.h"
 #include "plugin/device/ascend/kernel/host/host_kernel_metadata.h"
 #include "plugin/device/ascend/kernel/rts/rt_kernel_info.h"
@@ -83,6 +88,44 @@ bool SelectAicpuReshapeInTaskSink(const CNodePtr &kernel_node) {
   auto is_task_sink = context_ptr->get_param<bool>(MS_CTX_ENABLE_TASK_SINK);
   return is_task_sink;
 }
+
+// Candidate enumeration walks the tbe/rts/hccl/host metadata for every node of every graph, but the result only
+// depends on the node signature below, so identical nodes (very common in big graphs) can share one query.
+mindspore::HashMap<std::string, std::vector<std::shared_ptr<kernel::KernelBuildInfo>>> kernel_query_cache;
+std::mutex kernel_query_cache_mutex;
+
+std::string KernelQueryCacheKey(const CNodePtr &kernel_node, KernelType kernel_type) {
+  auto prim = common::AnfAlgo::GetCNodePrimitive(kernel_node);
+  if (prim == nullptr) {
+    return "";
+  }
+  std::ostringstream key;
+  key << common::AnfAlgo::GetCNodeName(kernel_node) << "#" << kernel_type;
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  // Task sink switches the Reshape selection path, so it has to be part of the signature.
+  key << "#" << context_ptr->get_param<bool>(MS_CTX_ENABLE_TASK_SINK);
+  size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel_node);
+  for (size_t i = 0; i < input_num; ++i) {
+    key << "/i" << common::AnfAlgo::GetPrevNodeOutputInferDataType(kernel_node, i);
+    for (auto dim : common::AnfAlgo::GetPrevNodeOutputInferShape(kernel_node, i)) {
+      key << "_" << dim;
+    }
+  }
+  size_t output_num = common::AnfAlgo::GetOutputTensorNum(kernel_node);
+  for (size_t i = 0; i < output_num; ++i) {
+    key << "/o" << common::AnfAlgo::GetOutputInferDataType(kernel_node, i);
+    for (auto dim : common::AnfAlgo::GetOutputInferShape(kernel_node, i)) {
+      key << "_" << dim;
+    }
+  }
+  // Attrs are kept in an unordered map, sort them so equal nodes produce equal keys.
+  std::map<std::string, ValuePtr> ordered_attrs(prim->attrs().begin(), prim->attrs().end());
+  for (const auto &attr : ordered_attrs) {
+    key << "/a" << attr.first << "=" << (attr.second == nullptr ? "null" : attr.second->ToString());
+  }
+  return key.str();
+}
 }  // namespace
 
 void CheckKernelInfoListEmpty(const std::vector<std::shared_ptr<kernel::KernelBuildInfo>> *kernel_info_list,
@@ -133,6 +176,22 @@ void KernelQuery(const CNodePtr &kernel_node, std::vector<std::shared_ptr<kernel
     kernel_type = KernelType::AKG_KERNEL;
   }  // use LoadIm2Col only for THOR optimizer
 
+  auto cache_key = KernelQueryCacheKey(kernel_node, kernel_type);
+  if (!cache_key.empty()) {
+    std::lock_guard<std::mutex> lock(kernel_query_cache_mutex);
+    auto iter = kernel_query_cache.find(cache_key);
+    if (iter != kernel_query_cache.end()) {
+      // Return copies: the selected build info is attached to the node and may be rewritten in place
+      // by later passes, so cached candidates must not be shared between nodes.
+      kernel_info_list->clear();
+      (void)std::transform(iter->second.begin(), iter->second.end(), std::back_inserter(*kernel_info_list),
+                           [](const std::shared_ptr<kernel::KernelBuildInfo> &info) {
+                             return std::make_shared<kernel::KernelBuildInfo>(*info);
+                           });
+      return;
+    }
+  }
+
   switch (kernel_type) {
     case KernelType::AKG_KERNEL:
       AkgMetadataInfo(kernel_node, kernel_info_list);
@@ -143,6 +202,16 @@ void KernelQuery(const CNodePtr &kernel_node, std::vector<std::shared_ptr<kernel
   }
   // check output
   FilterInvalidKernelInfo(kernel_node, kernel_info_list);
+
+  if (!cache_key.empty()) {
+    std::vector<std::shared_ptr<kernel::KernelBuildInfo>> cached_list;
+    (void)std::transform(kernel_info_list->begin(), kernel_info_list->end(), std::back_inserter(cached_list),
+                         [](const std::shared_ptr<kernel::KernelBuildInfo> &info) {
+                           return std::make_shared<kernel::KernelBuildInfo>(*info);
+                         });
+    std::lock_guard<std::mutex> lock(kernel_query_cache_mutex);
+    kernel_query_cache[cache_key] = std::move(cached_list);
+  }
 }
 
 void AICPUQuery(const CNodePtr &kernel_node, std::vector<std::shared_ptr<kernel::KernelBuildInfo>> *kernel_info_list) {
@@ -65,6 +65,28 @@ Status Iterator::GetNextRow(MSTensorVec *row) {
   return Status::OK();
 }
 
+// Get up to num_rows rows from the data pipeline in one call.
+Status Iterator::GetRows(int32_t num_rows, std::vector<MSTensorVec> *const rows) {
+  RETURN_UNEXPECTED_IF_NULL(rows);
+  rows->clear();
+  CHECK_FAIL_RETURN_UNEXPECTED(consumer_ != nullptr, "consumer_ is null, pls launch iterator first.");
+  std::vector<std::vector<std::shared_ptr<dataset::Tensor>>> md_rows;
+  Status rc = consumer_->GetNextRows(num_rows, &md_rows);
+  if (rc.IsError()) {
+    rows->clear();
+    return rc;
+  }
+  rows->reserve(md_rows.size());
+  for (auto &md_row : md_rows) {
+    MSTensorVec row;
+    row.reserve(md_row.size());
+    std::transform(md_row.begin(), md_row.end(), std::back_inserter(row),
+                   [](auto t) { return mindspore::MSTensor(std::make_shared<DETensor>(t)); });
+    (void)rows->emplace_back(std::move(row));
+  }
+  return Status::OK();
+}
+
 // Shut down the data pipeline.
 void Iterator::Stop() {
   if (runtime_context_ != nullptr) {
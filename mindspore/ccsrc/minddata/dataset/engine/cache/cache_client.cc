@@ -127,13 +127,28 @@ Status CacheClient::AsyncWriteRow(const TensorRow &row) {
 
 Status CacheClient::GetRows(const std::vector<row_id_type> &row_id, TensorTable *out) const {
   RETURN_UNEXPECTED_IF_NULL(out);
-  auto rq = std::make_shared<BatchFetchRequest>(this, row_id);
-  RETURN_IF_NOT_OK(PushRequest(rq));
-  RETURN_IF_NOT_OK(rq->Wait());
+  // For a local client, lend the server one of our reusable shared memory blocks to write the result
+  // into, so the fetch carries no protobuf data and needs no per-fetch allocation or free request.
+  int64_t staging_addr = SupportLocalClient() ? AcquireFetchBlock() : -1;
+  auto rq = std::make_shared<BatchFetchRequest>(this, row_id, staging_addr, staging_addr >= 0 ? kFetchBlockSize : 0);
+  Status rc = PushRequest(rq);
+  if (rc.IsOk()) {
+    rc = rq->Wait();
+  }
+  if (rc.IsError()) {
+    if (staging_addr != -1) {
+      ReleaseFetchBlock(staging_addr);
+    }
+    return rc;
+  }
   int64_t mem_addr;
-  Status rc = rq->RestoreRows(out, comm_->SharedMemoryBaseAddr(), &mem_addr);
-  // Free the memory by sending a request back to the server.
-  if (mem_addr != -1) {
+  rc = rq->RestoreRows(out, comm_->SharedMemoryBaseAddr(), &mem_addr);
+  if (staging_addr != -1) {
+    // RestoreRows copied the data out, so the block can be recycled right away.
+    ReleaseFetchBlock(staging_addr);
+  }
+  // If the server did not use our block, free the memory by sending a request back to the server.
+  if (mem_addr != -1 && mem_addr != staging_addr) {
     auto mfree_req = std::make_shared<FreeSharedBlockRequest>(server_connection_id_, client_id_, mem_addr);
     Status rc2 = PushRequest(mfree_req);
     // But we won't wait for the result for the sake of performance.
@@ -144,6 +159,38 @@ Status CacheClient::GetRows(const std::vector<row_id_type> &row_id, TensorTable
   return rc;
 }
 
+int64_t CacheClient::AcquireFetchBlock() const {
+  {
+    std::unique_lock<std::mutex> lck(fetch_blk_mux_);
+    if (!free_fetch_blks_.empty()) {
+      auto addr = free_fetch_blks_.back();
+      free_fetch_blks_.pop_back();
+      return addr;
+    }
+    if (num_fetch_blks_ >= kNumFetchBlocks) {
+      return -1;
+    }
+    // Reserve the slot before dropping the lock so concurrent callers can't over-allocate.
+    ++num_fetch_blks_;
+  }
+  auto mem_rq = std::make_shared<AllocateSharedBlockRequest>(server_connection_id_, client_id_, kFetchBlockSize);
+  Status rc = PushRequest(mem_rq);
+  if (rc.IsOk()) {
+    rc = mem_rq->Wait();
+  }
+  if (rc.IsError()) {
+    std::unique_lock<std::mutex> lck(fetch_blk_mux_);
+    --num_fetch_blks_;
+    return -1;
+  }
+  return mem_rq->GetAddr();
+}
+
+void CacheClient::ReleaseFetchBlock(int64_t addr) const {
+  std::unique_lock<std::mutex> lck(fetch_blk_mux_);
+  free_fetch_blks_.push_back(addr);
+}
+
 Status CacheClient::CreateCache(uint32_t tree_crc, bool generate_id) {
   UniqueLock lck(&mux_);
   // To create a cache, we identify ourself at the client by:
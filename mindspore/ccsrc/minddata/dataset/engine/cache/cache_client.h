@@ -354,6 +354,24 @@ class CacheClient {
     int32_t cur_;
   };
   std::shared_ptr<AsyncBufferStream> async_buffer_stream_;
+
+  /// For a local client, GetRows lends the server a pre-allocated shared memory block to write the result
+  /// into. The blocks are allocated lazily, recycled across fetches, and shared by all prefetcher threads,
+  /// so the hot path carries no protobuf data, no per-fetch shared memory allocation, and no free request
+  /// back to the server. The server reclaims the blocks when the cache is destroyed.
+  constexpr static int64_t kFetchBlockSize = 4 * 1048576L;  // 4M
+  constexpr static int32_t kNumFetchBlocks = 8;
+
+  /// \brief Take a reusable shared memory fetch block, allocating lazily up to kNumFetchBlocks.
+  /// \return Relative address of the block, or -1 if none is available
+  int64_t AcquireFetchBlock() const;
+
+  /// \brief Return a fetch block taken by AcquireFetchBlock
+  void ReleaseFetchBlock(int64_t addr) const;
+
+  mutable std::mutex fetch_blk_mux_;
+  mutable std::vector<int64_t> free_fetch_blks_;
+  mutable int32_t num_fetch_blks_ = 0;
 };
 }  // namespace dataset
 }  // namespace mindspore
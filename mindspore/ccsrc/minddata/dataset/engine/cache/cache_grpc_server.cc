@@ -146,7 +146,8 @@ Status CacheServerRequest::operator()(CacheServerGreeter::AsyncService *svc, grp
     type_ = static_cast<RequestType>(rq_.type());
     // Now we pass the address of this instance to CacheServer's main loop.
     MS_LOG(DEBUG) << "Handle request " << *this;
-    // We will distribute the request evenly (or randomly) over all the numa nodes.
+    // We will distribute the request over the numa node local to the requesting client (or randomly when
+    // numa affinity is off), so a row is cached on and served from the socket of its dominant reader.
     // The exception is BatchFetch and BatchCache which we need to pre-process here.
     // Also some requests are urgent that we want to process them here too.
     if (type_ == BaseRequest::RequestType::kBatchFetchRows || type_ == BaseRequest::RequestType::kBatchCacheRows ||
@@ -156,7 +157,7 @@ Status CacheServerRequest::operator()(CacheServerGreeter::AsyncService *svc, grp
       // WARNING. After we call ProcessRequest, the memory of 'this' is being recycled by ReturnRequestTag
       // asynchronously. Further access of 'this' is unpredictable.
     } else {
-      RETURN_IF_NOT_OK(cs.PushRequest(cs.GetRandomWorker(), this));
+      RETURN_IF_NOT_OK(cs.PushRequest(cs.GetWorkerForClient(rq_.client_id()), this));
     }
   } else if (st_ == STATE::FINISH) {
     // We don't have logic here but moved to the caller.
@@ -174,6 +175,24 @@ void CacheServerRequest::Print(std::ostream &out) const {
   BaseRequest::Print(out);
 }
 
+void CacheServerRequest::Reset() {
+  type_ = RequestType::kRequestUnknown;
+  rc_ = Status::OK();
+  st_ = STATE::CREATE;
+  // Clear() keeps the storage the repeated and string fields grew to, so the reused tag parses
+  // the next request without the per field allocations of a fresh message.
+  rq_.Clear();
+  rq_.set_type(static_cast<int16_t>(type_));
+  rq_.set_client_id(-1);
+  rq_.set_flag(0);
+  reply_.Clear();
+  // A grpc server context and responder cannot serve more than one call; rebuild them in place.
+  responder_.~ServerAsyncResponseWriter();
+  ctx_.~ServerContext();
+  new (&ctx_) grpc::ServerContext();
+  new (&responder_) grpc::ServerAsyncResponseWriter<CacheReply>(&ctx_);
+}
+
 Status CacheServerGreeterImpl::MonitorUnixSocket() {
   TaskManager::FindMe()->Post();
 #ifdef CACHE_LOCAL_CLIENT
@@ -56,6 +56,10 @@ class CacheServerRequest : public BaseRequest {
   /// \param out
   void Print(std::ostream &out) const override;
 
+  /// \brief Make the tag ready for the next incoming request, keeping the capacity of the
+  /// protobuf messages so the next parse does not redo the per field allocations.
+  void Reset();
+
  private:
   Status rc_;
   STATE st_;
@@ -14,6 +14,7 @@
  * limitations under the License.
 */
 #include "minddata/dataset/engine/cache/cache_ipc.h"
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 namespace mindspore {
@@ -108,6 +109,7 @@ Status SharedMemory::Create(int64_t sz) {
     if (shmat_addr_ == reinterpret_cast<void *>(-1)) {
       RETURN_STATUS_UNEXPECTED("Shared memory attach failed. Errno " + std::to_string(errno));
     }
+    AdviseHugePages(sz);
   }
   return Status::OK();
 }
@@ -121,9 +123,31 @@ Status SharedMemory::Attach() {
   if (shmat_addr_ == reinterpret_cast<void *>(-1)) {
     RETURN_STATUS_UNEXPECTED("Shared memory attach failed. Errno " + std::to_string(errno));
   }
+  // The advice is per mapping, so each attaching process needs to repeat it.
+  struct shmid_ds ds {};
+  if (shmctl(shm_id_, IPC_STAT, &ds) == 0) {
+    AdviseHugePages(ds.shm_segsz);
+  }
   return Status::OK();
 }
 
+void SharedMemory::AdviseHugePages(int64_t sz) const {
+#ifdef MADV_HUGEPAGE
+  // Ask for transparent 2M pages. This is best effort: the kernel may have THP disabled or may not be
+  // able to assemble huge pages, and the region works the same either way, just with more dTLB misses.
+  auto err = madvise(shmat_addr_, sz, MADV_HUGEPAGE);
+  if (err == -1) {
+    MS_LOG(INFO) << "Transparent huge pages not available for shared memory of size " << sz
+                 << ". Errno = " << std::to_string(errno);
+  } else {
+    MS_LOG(INFO) << "Advised transparent huge pages for shared memory of size " << sz
+                 << ". Check AnonHugePages in /proc/self/smaps for actual utilization.";
+  }
+#else
+  (void)sz;
+#endif
+}
+
 Status SharedMemory::Detach() {
   if (shmat_addr_) {
     auto err = shmdt(shmat_addr_);
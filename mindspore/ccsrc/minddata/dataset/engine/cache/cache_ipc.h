@@ -195,6 +195,10 @@ class SharedMemory : public BaseIPC {
   shm_id_t shm_id_;
   shm_key_t shm_key_;
   void *shmat_addr_;
+
+  /// \brief Ask the kernel to back the attached region with transparent huge pages.
+  /// \note Advisory only. Large caches are scanned sequentially and 4K pages thrash the dTLB.
+  void AdviseHugePages(int64_t sz) const;
 };
 
 /// \brief Generate a shared memory key using the tcp/ip port.
@@ -22,7 +22,7 @@
 namespace mindspore {
 namespace dataset {
 CachePool::CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root)
-    : mp_(std::move(mp)), root_(root), subfolder_(Services::GetUniqueID()), sm_(nullptr), tree_(nullptr) {
+    : mp_(std::move(mp)), root_(root), subfolder_(Services::GetUniqueID()), sm_(nullptr), num_shards_(1) {
   // Initialize soft memory cap to the current available memory on the machine.
   soft_mem_limit_ = CacheServerHW::GetAvailableMemory();
   temp_mem_usage_ = 0;
@@ -30,7 +30,13 @@ CachePool::CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root
 }
 
 Status CachePool::DoServiceStart() {
-  tree_ = std::make_shared<data_index>();
+  // One index shard per numa node. Keys are spread over the shards by modulo, so lookups from the service
+  // threads (which are pinned per node) contend on the lock of their own shard only.
+  num_shards_ = std::max<size_t>(1, mp_->GetAvailableNodes().size());
+  tree_shards_.reserve(num_shards_);
+  for (size_t i = 0; i < num_shards_; ++i) {
+    (void)tree_shards_.emplace_back(std::make_shared<data_index>());
+  }
   // If we are given a disk path, set up the StorageManager
   if (!root_.ToString().empty()) {
     Path spill = GetSpillPath();
@@ -59,7 +65,7 @@ Status CachePool::DoServiceStop() {
   // skip this and release the whole NumaMemoryPool instead. Otherwise
   // release each buffer in the DataLocator one by one.
 
-  tree_.reset();
+  tree_shards_.clear();
   if (!root_.ToString().empty()) {
     Path spill = GetSpillPath();
     auto it = Path::DirIterator::OpenDirectory(&spill);
@@ -144,7 +150,7 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
   }
   // Insert into the B+ tree. We may still get out of memory error. So need to catch it.
   try {
-    rc = tree_->DoInsert(key, bl);
+    rc = ShardOfKey(key)->DoInsert(key, bl);
   } catch (const std::bad_alloc &e) {
     rc = STATUS_ERROR(StatusCode::kMDOutOfMemory, "Out of memory.");
   }
@@ -159,7 +165,7 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
 
 Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *bytesRead) const {
   RETURN_UNEXPECTED_IF_NULL(dest);
-  auto r = tree_->Search(key);
+  auto r = ShardOfKey(key)->Search(key);
   if (r.second) {
     auto &it = r.first;
     if (it->ptr != nullptr) {
@@ -189,13 +195,15 @@ Path CachePool::GetSpillPath() const {
 }
 
 CachePool::CacheStat CachePool::GetStat(bool GetMissingKeys) const {
-  tree_->LockShared();  // Prevent any node split while we search.
   CacheStat cs{-1, -1, 0, 0, 0, 0};
   int64_t total_sz = 0;
-  if (tree_->begin() != tree_->end()) {
-    cs.min_key = tree_->begin().key();
-    cs.max_key = cs.min_key;  // will adjust later.
-    for (auto it = tree_->begin(); it != tree_->end(); ++it) {
+  // The keys are spread over the shards by modulo, so a per-shard scan is not globally ordered. Collect
+  // all the keys when the gaps are requested and sort them afterwards. This path is called once and the
+  // result is cached by the service, so the extra sort does not matter.
+  std::vector<key_type> all_keys;
+  for (const auto &shard : tree_shards_) {
+    shard->LockShared();  // Prevent any node split while we search.
+    for (auto it = shard->begin(); it != shard->end(); ++it) {
       it.LockShared();
       total_sz += it.value().sz;
       if (it.value().ptr != nullptr) {
@@ -207,14 +215,28 @@ CachePool::CacheStat CachePool::GetStat(bool GetMissingKeys) const {
         ++cs.num_numa_hit;
       }
       auto cur_key = it.key();
+      if (cs.min_key < 0 || cur_key < cs.min_key) {
+        cs.min_key = cur_key;
+      }
+      if (cur_key > cs.max_key) {
+        cs.max_key = cur_key;
+      }
       if (GetMissingKeys) {
-        for (auto i = cs.max_key + 1; i < cur_key; ++i) {
-          cs.gap.push_back((i));
-        }
+        all_keys.push_back(cur_key);
       }
-      cs.max_key = cur_key;
       it.Unlock();
     }
+    shard->Unlock();
+  }
+  if (GetMissingKeys && !all_keys.empty()) {
+    std::sort(all_keys.begin(), all_keys.end());
+    auto prev_key = all_keys.front();
+    for (auto cur_key : all_keys) {
+      for (auto i = prev_key + 1; i < cur_key; ++i) {
+        cs.gap.push_back((i));
+      }
+      prev_key = cur_key;
+    }
   }
   if (total_sz > 0) {
     // integer arithmetic. NO need to cast to float or double.
@@ -223,14 +245,13 @@ CachePool::CacheStat CachePool::GetStat(bool GetMissingKeys) const {
       cs.average_cache_sz = 1;
     }
   }
-  tree_->Unlock();
   return cs;
 }
 
 Status CachePool::GetDataLocator(key_type key, const std::shared_ptr<flatbuffers::FlatBufferBuilder> &fbb,
                                  flatbuffers::Offset<DataLocatorMsg> *out) const {
   RETURN_UNEXPECTED_IF_NULL(out);
-  auto r = tree_->Search(key);
+  auto r = ShardOfKey(key)->Search(key);
   if (r.second) {
     auto &it = r.first;
     DataLocatorMsgBuilder bld(*fbb);
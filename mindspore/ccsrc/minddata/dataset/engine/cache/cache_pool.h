@@ -141,19 +141,29 @@ class CachePool : public Service {
 
   /// \brief Toggle locking
   /// \note Once locking is off. It is user's responsibility to ensure concurrency
-  void SetLocking(bool on_off) { tree_->SetLocking(on_off); }
+  void SetLocking(bool on_off) {
+    for (auto &shard : tree_shards_) {
+      shard->SetLocking(on_off);
+    }
+  }
 
  private:
   std::shared_ptr<NumaMemoryPool> mp_;
   Path root_;
   const std::string subfolder_;
   std::shared_ptr<StorageManager> sm_;
-  std::shared_ptr<data_index> tree_;
+  /// The index is sharded into one B+ tree per numa node so concurrent lookups from many client threads
+  /// spread over independent reader-writer locks instead of contending on a single tree.
+  std::vector<std::shared_ptr<data_index>> tree_shards_;
+  size_t num_shards_;
   std::atomic<uint64_t> soft_mem_limit_;  // the available memory in the machine
   std::atomic<uint64_t> temp_mem_usage_;  // temporary count on the amount of memory usage by cache every 100Mb (because
                                           // we will adjust soft_mem_limit_ every 100Mb based on this parameter)
   uint64_t min_avail_mem_;                // lower bound of the available memory
   const int kMemoryCapAdjustInterval = 104857600;
+
+  /// \brief Return the index shard a given key belongs to.
+  data_index *ShardOfKey(key_type key) const { return tree_shards_[static_cast<size_t>(key) % num_shards_].get(); }
 };
 }  // namespace dataset
 }  // namespace mindspore
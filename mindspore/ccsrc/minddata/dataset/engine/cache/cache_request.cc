@@ -137,7 +137,8 @@ CacheRowRequest::CacheRowRequest(const CacheClient *cc)
   rq_.add_buf_data(cc->cookie_);
 }
 
-BatchFetchRequest::BatchFetchRequest(const CacheClient *cc, const std::vector<row_id_type> &row_id)
+BatchFetchRequest::BatchFetchRequest(const CacheClient *cc, const std::vector<row_id_type> &row_id,
+                                     int64_t staging_addr, int64_t staging_sz)
     : BaseRequest(RequestType::kBatchFetchRows), support_local_bypass_(cc->local_bypass_), row_id_(row_id) {
   rq_.set_connection_id(cc->server_connection_id_);
   rq_.set_client_id(cc->client_id_);
@@ -150,6 +151,12 @@ BatchFetchRequest::BatchFetchRequest(const CacheClient *cc, const std::vector<ro
   auto off = bld.Finish();
   fbb.Finish(off);
   rq_.add_buf_data(fbb.GetBufferPointer(), fbb.GetSize());
+  // A local client can lend the server a pre-allocated shared memory block to write the result into, so
+  // the hot path skips the per-fetch shared memory allocation and the free request that follows it.
+  if (support_local_bypass_ && staging_addr >= 0) {
+    rq_.add_buf_data(std::to_string(staging_addr));
+    rq_.add_buf_data(std::to_string(staging_sz));
+  }
 }
 
 Status BatchFetchRequest::RestoreRows(TensorTable *out, const void *baseAddr, int64_t *out_addr) {
@@ -231,7 +231,12 @@ class BatchFetchRequest : public BaseRequest {
  public:
   friend class CacheServer;
   friend class CacheService;
-  BatchFetchRequest(const CacheClient *cc, const std::vector<row_id_type> &row_id);
+  /// \brief Constructor
+  /// \param staging_addr Optional relative address of a client owned shared memory block the server can
+  /// write the result into. -1 if the client does not lend one.
+  /// \param staging_sz Size of the lent block. Ignored when staging_addr is -1.
+  BatchFetchRequest(const CacheClient *cc, const std::vector<row_id_type> &row_id, int64_t staging_addr = -1,
+                    int64_t staging_sz = 0);
   ~BatchFetchRequest() override = default;
   Status RestoreRows(TensorTable *out, const void *baseAddr, int64_t *out_addr);
 
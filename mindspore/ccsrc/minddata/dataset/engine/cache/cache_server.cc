@@ -33,6 +33,8 @@ namespace mindspore {
 namespace dataset {
 CacheServer *CacheServer::instance_ = nullptr;
 std::once_flag CacheServer::init_instance_flag_;
+std::mutex CacheServer::free_tag_mux_;
+std::vector<CacheServerRequest *> CacheServer::free_tag_list_;
 Status CacheServer::DoServiceStart() {
 #ifdef CACHE_LOCAL_CLIENT
   // We need to destroy the shared memory if user hits Control-C
@@ -492,8 +494,11 @@ Status CacheServer::BatchFetchRows(CacheRequest *rq, CacheReply *reply) {
     std::string errMsg = "Cache id " + std::to_string(connection_id) + " not found";
     RETURN_STATUS_UNEXPECTED(errMsg);
   } else {
+    // First one is the row ids, optionally followed by the address and size of a client owned shared
+    // memory block the server may write the result into.
+    enum BufDataIndex : uint8_t { kRowIds = 0, kStagingAddr = 1, kStagingSz = 2 };
     CHECK_FAIL_RETURN_UNEXPECTED(!rq->buf_data().empty(), "Missing row id");
-    auto &row_id_buf = rq->buf_data(0);
+    auto &row_id_buf = rq->buf_data(BufDataIndex::kRowIds);
     auto p = flatbuffers::GetRoot<TensorRowIds>(row_id_buf.data());
     std::vector<row_id_type> row_id;
     auto sz = p->row_id()->size();
@@ -519,6 +524,21 @@ Status CacheServer::BatchFetchRows(CacheRequest *rq, CacheReply *reply) {
     }
     auto client_flag = rq->flag();
     bool local_client = BitTest(client_flag, kLocalClientSupport);
+    if (local_client && rq->buf_data_size() > BufDataIndex::kStagingSz) {
+      // The client lent us a pre-allocated shared memory block. Use it whenever it is big enough,
+      // regardless of the bypass threshold: serving from shared memory keeps protobuf out of the hot
+      // path, and the client recycles the block instead of sending a free request back.
+      auto staging_addr = strtoll(rq->buf_data(BufDataIndex::kStagingAddr).data(), nullptr, kDecimal);
+      auto staging_sz = strtoll(rq->buf_data(BufDataIndex::kStagingSz).data(), nullptr, kDecimal);
+      if (staging_addr >= 0 && staging_sz >= mem_sz) {
+        auto *base = SharedMemoryBaseAddr();
+        WritableSlice dest(reinterpret_cast<void *>(reinterpret_cast<int64_t>(base) + staging_addr), mem_sz);
+        RETURN_IF_NOT_OK(BatchFetch(fbb, &dest));
+        reply->set_flag(kDataIsInSharedMemory);
+        reply->set_result(std::to_string(staging_addr));
+        return Status::OK();
+      }
+    }
     // For large amount data to be sent back, we will use shared memory provided it is a local
     // client that has local bypass support
     bool local_bypass = local_client ? (mem_sz >= kLocalByPassThreshold) : false;
@@ -789,7 +809,9 @@ Status CacheServer::BatchCacheRows(CacheRequest *rq) {
       cache_rq->rq_.add_buf_data(std::to_string(start - reinterpret_cast<int64_t>(base)));
       cache_rq->rq_.add_buf_data(std::to_string(reinterpret_cast<int64_t>(p - start)));
       cache_rq->rq_.add_buf_data(std::to_string(reinterpret_cast<int64_t>(batch_wait.get())));
-      RETURN_IF_NOT_OK(PushRequest(GetRandomWorker(), cache_rq));
+      // Cache the row on the numa node of the requesting client, so the memory is local to the pipeline
+      // that is going to read it back.
+      RETURN_IF_NOT_OK(PushRequest(GetWorkerForClient(client_id), cache_rq));
     }
     // Now wait for all of them to come back.
     RETURN_IF_NOT_OK(batch_wait->Wait());
@@ -1043,6 +1065,14 @@ Status CacheServer::Run(int msg_qid) {
 
 Status CacheServer::GetFreeRequestTag(CacheServerRequest **q) {
   RETURN_UNEXPECTED_IF_NULL(q);
+  {
+    std::unique_lock<std::mutex> lck(free_tag_mux_);
+    if (!free_tag_list_.empty()) {
+      *q = free_tag_list_.back();
+      free_tag_list_.pop_back();
+      return Status::OK();
+    }
+  }
   auto *p = new (std::nothrow) CacheServerRequest();
   if (p == nullptr) {
     RETURN_STATUS_OOM("Out of memory.");
@@ -1053,7 +1083,13 @@ Status CacheServer::GetFreeRequestTag(CacheServerRequest **q) {
 
 Status CacheServer::ReturnRequestTag(CacheServerRequest *p) {
   RETURN_UNEXPECTED_IF_NULL(p);
-  delete p;
+  p->Reset();
+  std::unique_lock<std::mutex> lck(free_tag_mux_);
+  if (free_tag_list_.size() < kRequestTagPoolCap) {
+    free_tag_list_.push_back(p);
+  } else {
+    delete p;
+  }
   return Status::OK();
 }
 
@@ -1211,6 +1247,13 @@ worker_id_t CacheServer::GetRandomWorker() const {
   return dist(gen);
 }
 
+worker_id_t CacheServer::GetWorkerForClient(int32_t client_id) const {
+  if (!IsNumaAffinityOn() || client_id < 0) {
+    return GetRandomWorker();
+  }
+  return GetWorkerByNumaId(client_id % GetNumaNodeCount());
+}
+
 Status CacheServer::AllocateSharedMemory(int32_t client_id, size_t sz, void **p) {
   return shm_->AllocateSharedMemory(client_id, sz, p);
 }
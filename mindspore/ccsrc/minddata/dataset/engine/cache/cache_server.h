@@ -170,7 +170,14 @@ class CacheServer : public Service {
   CacheServer &operator=(CacheServer &) = delete;
   Status DoServiceStart() override;
   Status DoServiceStop() override;
-  ~CacheServer() override { (void)ServiceStop(); }
+  ~CacheServer() override {
+    (void)ServiceStop();
+    std::unique_lock<std::mutex> lck(free_tag_mux_);
+    for (auto *p : free_tag_list_) {
+      delete p;
+    }
+    free_tag_list_.clear();
+  }
 
   static Status CreateInstance(const std::string &spill_path, int32_t num_workers, int32_t port,
                                int32_t shared_memory_sz, float memory_cap_ratio, int8_t log_level,
@@ -231,6 +238,13 @@ class CacheServer : public Service {
   /// \return worker id
   worker_id_t GetRandomWorker() const;
 
+  /// \brief Pick a worker on the numa node of the given client. A client is pinned to the node
+  /// client_id % number of numa nodes (see CreateService where we hand out its cpu list), so rows it caches
+  /// are allocated on, and later fetched from, its local node. Falls back to a random worker when numa
+  /// affinity is off or the client id is not set.
+  /// \return worker id
+  worker_id_t GetWorkerForClient(int32_t client_id) const;
+
   /// \brief Check if we bind threads to numa cores
   bool IsNumaAffinityOn() const { return numa_affinity_; }
 
@@ -278,6 +292,12 @@ class CacheServer : public Service {
  private:
   static std::once_flag init_instance_flag_;
   static CacheServer *instance_;
+  // Pool of finished grpc request tags. Reusing a tag keeps the capacity its protobuf messages
+  // grew to, so steady state request handling does not redo the per field allocations of a
+  // freshly constructed CacheRequest/CacheReply pair.
+  static constexpr size_t kRequestTagPoolCap = 1024;
+  static std::mutex free_tag_mux_;
+  static std::vector<CacheServerRequest *> free_tag_list_;
   mutable RWLock rwLock_;
   mutable RWLock sessions_lock_;
   std::string top_;
@@ -16,6 +16,9 @@
 #include "minddata/dataset/engine/cache/storage_container.h"
 
 #include <unistd.h>
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/uio.h>
+#endif
 #include <vector>
 #include "utils/ms_utils.h"
 #include "minddata/dataset/util/log_adapter.h"
@@ -125,6 +128,39 @@ Status StorageContainer::Insert(const std::vector<ReadableSlice> &buf, off64_t *
   addr_t addr = 0;
   RETURN_IF_NOT_OK(bs_->Alloc(sz, &bspd, &addr));
   *offset = static_cast<off64_t>(addr);
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
+  // Write the pieces with one vectored syscall. Spilled rows are large, so staging them through an
+  // intermediate buffer first would double the memory traffic of the spill path.
+  std::vector<struct iovec> iov;
+  iov.reserve(buf.size());
+  for (auto &v : buf) {
+    iov.push_back({const_cast<void *>(v.GetPointer()), v.GetSize()});
+  }
+  size_t cur = 0;
+  off64_t cur_offset = static_cast<off64_t>(addr);
+  while (cur < iov.size()) {
+    auto w_sz = pwritev(fd_, iov.data() + cur, iov.size() - cur, cur_offset);
+    if (w_sz <= 0) {
+      errno_t err = (w_sz == 0) ? EOF : errno;
+      if (errno == ENOSPC) {
+        RETURN_STATUS_ERROR(StatusCode::kMDNoSpace, "no space left.");
+      } else {
+        RETURN_STATUS_UNEXPECTED(strerror(err));
+      }
+    }
+    cur_offset += w_sz;
+    // Skip the fully written pieces and trim the partially written one, then retry the rest.
+    auto remaining = static_cast<size_t>(w_sz);
+    while (cur < iov.size() && remaining >= iov[cur].iov_len) {
+      remaining -= iov[cur].iov_len;
+      ++cur;
+    }
+    if (cur < iov.size() && remaining > 0) {
+      iov[cur].iov_base = static_cast<char *>(iov[cur].iov_base) + remaining;
+      iov[cur].iov_len -= remaining;
+    }
+  }
+#else
   // We will do piecewise copy of the data to a large buffer
   std::string mem;
   try {
@@ -142,6 +178,7 @@ Status StorageContainer::Insert(const std::vector<ReadableSlice> &buf, off64_t *
   }
   // Write all data to disk at once
   RETURN_IF_NOT_OK(Write(all, addr));
+#endif
   return Status::OK();
 }
 
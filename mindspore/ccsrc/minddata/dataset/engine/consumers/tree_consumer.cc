@@ -206,6 +206,47 @@ Status IteratorConsumer::GetNextAsVector(std::vector<TensorPtr> *out) {
   return Status::OK();
 }
 
+Status IteratorConsumer::GetNextRows(int64_t num_rows, std::vector<std::vector<TensorPtr>> *const out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  out->clear();
+  CHECK_FAIL_RETURN_UNEXPECTED(num_rows > 0, "num_rows must be greater than 0.");
+  out->reserve(static_cast<size_t>(num_rows));
+
+  // Filter meta column once for the whole call
+  std::vector<size_t> to_keep_indices;
+  for (const auto &colMap : tree_adapter_->GetColumnNameMap()) {
+    std::string column_name = colMap.first;
+    // Need to filter meta column start with kDftMetaColumnPrefix
+    size_t pos = column_name.find(kDftMetaColumnPrefix);
+    if (pos != std::string::npos && pos == 0) {
+      continue;
+    }
+    to_keep_indices.push_back(colMap.second);
+  }
+  if (to_keep_indices.size() == 0) {
+    std::string err_msg = "No effective column found, maybe all columns are meta column and will be filtered. ";
+    err_msg += "If you want to output meta column please rename column name to a new one which is not start with ";
+    err_msg += "\"" + std::string(kDftMetaColumnPrefix) + "\"";
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  std::sort(to_keep_indices.begin(), to_keep_indices.end());
+
+  for (int64_t i = 0; i < num_rows; ++i) {
+    TensorRow res;
+    RETURN_IF_NOT_OK(tree_adapter_->GetNext(&res));
+    // Stop at the end of the epoch and return the rows fetched so far
+    if (res.empty()) {
+      break;
+    }
+    std::vector<TensorPtr> row;
+    row.reserve(to_keep_indices.size());
+    (void)std::transform(to_keep_indices.begin(), to_keep_indices.end(), std::back_inserter(row),
+                         [&res](const auto &it) { return std::move(res[it]); });
+    (void)out->emplace_back(std::move(row));
+  }
+  return Status::OK();
+}
+
 Status IteratorConsumer::GetNextAsMap(std::unordered_map<std::string, TensorPtr> *const out_map) {
   RETURN_UNEXPECTED_IF_NULL(out_map);
   out_map->clear();
@@ -112,6 +112,16 @@ class IteratorConsumer : public TreeConsumer {
   /// \return Status error code
   Status GetNextAsVector(std::vector<TensorPtr> *out);
 
+  /// Returns up to num_rows rows in one call, each in vector format. Bulk endpoint for C++
+  /// services that today wrap the per-row iterator in their own batching layer: the per-call
+  /// overhead and the meta column filtering are paid once per call instead of once per row,
+  /// while the pipeline workers keep assembling the following rows. Returns fewer rows
+  /// (possibly zero) when the epoch ends.
+  /// \param[in] num_rows maximum number of rows to fetch
+  /// \param[out] out one entry per fetched row, each a std::vector of Tensors
+  /// \return Status error code
+  Status GetNextRows(int64_t num_rows, std::vector<std::vector<TensorPtr>> *const out);
+
   /// Returns the next row in as a map
   /// \param[out] out std::map of string to Tensor
   /// \return Status error code
@@ -163,6 +163,81 @@ std::unordered_map<std::string, int32_t> DatasetIterator::GetColumnNameMap() con
   return root_->column_name_id_map();
 }
 
+// Constructor of the AsyncDatasetIterator
+AsyncDatasetIterator::AsyncDatasetIterator(std::shared_ptr<ExecutionTree> exe_tree, int32_t in_flight_rows)
+    : iterator_(std::move(exe_tree)),
+      max_in_flight_(in_flight_rows > 0 ? static_cast<size_t>(in_flight_rows) : 1),
+      producer_done_(false),
+      shutdown_(false) {
+  producer_ = std::thread(&AsyncDatasetIterator::ProducerEntry, this);
+}
+
+AsyncDatasetIterator::~AsyncDatasetIterator() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  producer_cv_.notify_all();
+  if (producer_.joinable()) {
+    producer_.join();
+  }
+}
+
+void AsyncDatasetIterator::ProducerEntry() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      producer_cv_.wait(
+        lock, [this]() { return shutdown_ || !pending_promises_.empty() || ready_rows_.size() < max_in_flight_; });
+      if (shutdown_) {
+        break;
+      }
+    }
+
+    // Fetch outside the lock so waiting consumers can queue up futures meanwhile.
+    TensorRow row;
+    Status rc = iterator_.FetchNextTensorRow(&row);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (rc.IsError()) {
+      // Terminal: record the error, resolve everything already handed out with empty rows and let
+      // FetchNextTensorRowAsync surface the status from now on.
+      producer_status_ = rc;
+      producer_done_ = true;
+      while (!pending_promises_.empty()) {
+        pending_promises_.front().set_value(TensorRow());
+        pending_promises_.pop_front();
+      }
+      break;
+    }
+    if (!pending_promises_.empty()) {
+      pending_promises_.front().set_value(std::move(row));
+      pending_promises_.pop_front();
+    } else {
+      ready_rows_.push_back(std::move(row));
+    }
+  }
+}
+
+Status AsyncDatasetIterator::FetchNextTensorRowAsync(std::future<TensorRow> *out_future) {
+  RETURN_UNEXPECTED_IF_NULL(out_future);
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::promise<TensorRow> promise;
+  *out_future = promise.get_future();
+  if (!ready_rows_.empty()) {
+    promise.set_value(std::move(ready_rows_.front()));
+    ready_rows_.pop_front();
+    producer_cv_.notify_one();
+    return Status::OK();
+  }
+  if (producer_done_) {
+    return producer_status_;
+  }
+  pending_promises_.push_back(std::move(promise));
+  producer_cv_.notify_one();
+  return Status::OK();
+}
+
 // Constructor of the ChildIterator
 ChildIterator::ChildIterator(DatasetOp *current_op, int32_t worker_id, int32_t child_idx)
     : current_op_(current_op), child_idx_(child_idx), worker_id_(worker_id), end_epoch_(false), eof_handled_(false) {}
@@ -16,8 +16,13 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASET_ITERATOR_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASET_ITERATOR_H_
 
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -80,6 +85,52 @@ class DatasetIterator {
   std::vector<std::pair<std::string, int32_t>> column_order_;  // key: column name, val: column id
 };
 
+// The AsyncDatasetIterator decouples fetching from consuming. A producer thread pulls rows from a
+// wrapped DatasetIterator into a bounded buffer, so the pipeline keeps producing while the caller
+// processes the previous rows, without the caller hand-writing the threading.
+class AsyncDatasetIterator {
+ public:
+  // With one row buffered ahead and one row at the consumer, fetch and processing overlap in the
+  // steady state (double buffering).
+  static constexpr int32_t kDefaultInFlightRows = 2;
+
+  // Constructor of the AsyncDatasetIterator
+  // @param exe_tree The execution tree we want to pull/iterate the data from using it's root node.
+  // @param in_flight_rows The maximum number of fetched rows buffered ahead of the consumer.
+  explicit AsyncDatasetIterator(std::shared_ptr<ExecutionTree> exe_tree,
+                                int32_t in_flight_rows = kDefaultInFlightRows);
+
+  // Destructor. Stops the producer thread.
+  ~AsyncDatasetIterator();
+
+  // Hands out a future for the next row; futures resolve in fetch order. Like FetchNextTensorRow,
+  // an empty row signals the end of an epoch. When the producer hits an error (including the end
+  // of the last epoch), outstanding futures resolve with empty rows and the error is returned by
+  // this call from then on.
+  // @param out_future - The future which will hold the next TensorRow.
+  // @return Status The status code returned
+  Status FetchNextTensorRowAsync(std::future<TensorRow> *out_future);
+
+  // Getter
+  // @return The string to column id mapping.
+  std::unordered_map<std::string, int32_t> GetColumnNameMap() const { return iterator_.GetColumnNameMap(); }
+
+ private:
+  // Entry point of the producer thread.
+  void ProducerEntry();
+
+  DatasetIterator iterator_;
+  size_t max_in_flight_;
+  std::thread producer_;
+  std::mutex mutex_;
+  std::condition_variable producer_cv_;
+  std::deque<TensorRow> ready_rows_;                     // rows fetched ahead of the consumer
+  std::deque<std::promise<TensorRow>> pending_promises_;  // consumers waiting for a row
+  Status producer_status_;  // terminal status of the producer, OK while it is still running
+  bool producer_done_;
+  bool shutdown_;
+};
+
 // The ChildIterator derived class is for fetching rows from intermediate nodes of execution tree.
 // This one should only be used by internal Dataset operators, rather than an end-user.
 class ChildIterator {
@@ -15,6 +15,7 @@
  */
 #include "minddata/dataset/engine/datasetops/batch_op.h"
 
+#include <thread>
 #include <utility>
 
 #include "utils/ms_utils.h"
@@ -24,9 +25,14 @@
 
 #include "minddata/dataset/kernels/data/data_utils.h"
 #include "minddata/dataset/util/status.h"
+#include "./securec.h"
 
 namespace mindspore {
 namespace dataset {
+// The minimum bytes each copy thread should handle when assembling a batch in parallel; below this the
+// thread launch overhead outweighs the copy.
+constexpr size_t kParallelCopyMinBytesPerThread = 16 << 20;
+
 BatchOp::Builder::Builder(int32_t batch_size) : builder_drop_(false), builder_pad_(false), builder_pad_map_({}) {
   builder_batch_size_ = batch_size;
   std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
@@ -105,7 +111,8 @@ Status BatchOp::operator()() {
         total_step++;
         RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
       }
-      table->emplace_back(new_row);
+      // Move the row into the table to avoid the shared_ptr copies per column, the row is re-fetched below.
+      table->emplace_back(std::move(new_row));
       // if # of rows is enough to make 1 batch, send it to worker_queue
       if (table->size() == static_cast<size_t>(cur_batch_size)) {
         RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->EmplaceBack(
@@ -195,12 +202,24 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *d
     std::shared_ptr<Tensor> new_tensor;
     if (first_type.IsNumeric()) {  // numeric tensor
       RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
-      dsize_t j = 0;
-      for (auto row : **src) {
-        std::shared_ptr<Tensor> old_tensor = row.at(i);  // row j, column i
-        if (old_tensor->shape() == first_shape) {        // check the newly popped rows have the same dim as the first
-          if (new_shape.NumOfElements() != 0) {
-            RETURN_IF_NOT_OK(new_tensor->InsertTensor({j++}, old_tensor));
+      // Assemble the rows directly into the preallocated batch buffer by the contiguous offsets. The shape and type
+      // are validated per row below, so the per-row index and shape bookkeeping of InsertTensor is not needed.
+      const dsize_t row_bytes = first_tensor->SizeInBytes();
+      unsigned char *batch_buffer = new_tensor->GetMutableBuffer();
+      // Validate the shapes and gather the source buffers before copying, so the copy loop below is a pure
+      // memcpy sequence which can be partitioned across threads.
+      std::vector<const unsigned char *> row_buffers;
+      row_buffers.reserve(batch_size);
+      for (const auto &row : **src) {
+        const std::shared_ptr<Tensor> &old_tensor = row.at(i);  // row j, column i
+        CHECK_FAIL_RETURN_UNEXPECTED(old_tensor->type() == first_type,
+                                     "Inconsistent batch types, batch operation expect same type for each data row, "
+                                     "but got inconsistent type in column " +
+                                       std::to_string(i) + ", expected type for this column is:" + first_type.ToString() +
+                                       ", got type:" + old_tensor->type().ToString());
+        if (old_tensor->shape() == first_shape) {  // check the newly popped rows have the same dim as the first
+          if (new_shape.NumOfElements() != 0 && row_bytes != 0) {
+            row_buffers.push_back(old_tensor->GetBuffer());
           }
           // Don't do anything if the tensor has no data
         } else {
@@ -213,6 +232,41 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *d
             std::to_string(i) + ", expected shape for this column is:" + shape1.str() + ", got shape:" + shape2.str());
         }
       }
+      auto copy_rows = [batch_buffer, row_bytes, &row_buffers](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+          if (memcpy_s(batch_buffer + j * row_bytes, row_bytes, row_buffers[j], row_bytes) != 0) {
+            return false;
+          }
+        }
+        return true;
+      };
+      const size_t num_rows = row_buffers.size();
+      const size_t total_bytes = num_rows * static_cast<size_t>(row_bytes);
+      // A single core cannot saturate the memory bandwidth on a large batch, so spread the rows across a few
+      // threads writing disjoint slices of the batch buffer. Small batches stay on the worker thread since the
+      // thread launch would cost more than the copy.
+      size_t thread_num = std::min(total_bytes / kParallelCopyMinBytesPerThread,
+                                   static_cast<size_t>(std::max(1U, std::thread::hardware_concurrency() / 2)));
+      thread_num = std::min(thread_num, num_rows);
+      if (thread_num > 1) {
+        std::vector<std::thread> copy_threads;
+        std::vector<uint8_t> copy_ok(thread_num, 1);
+        const size_t rows_per_thread = (num_rows + thread_num - 1) / thread_num;
+        for (size_t t = 0; t < thread_num; ++t) {
+          size_t begin = t * rows_per_thread;
+          size_t end = std::min(begin + rows_per_thread, num_rows);
+          copy_threads.emplace_back(
+            [&copy_rows, &copy_ok, t, begin, end]() { copy_ok[t] = copy_rows(begin, end) ? 1 : 0; });
+        }
+        for (auto &thread : copy_threads) {
+          thread.join();
+        }
+        CHECK_FAIL_RETURN_UNEXPECTED(std::all_of(copy_ok.begin(), copy_ok.end(), [](uint8_t ok) { return ok == 1; }),
+                                     "[Internal ERROR] Failed to copy tensor to the batch buffer.");
+      } else {
+        CHECK_FAIL_RETURN_UNEXPECTED(copy_rows(0, num_rows),
+                                     "[Internal ERROR] Failed to copy tensor to the batch buffer.");
+      }
     } else {  // handle string column differently
       std::vector<std::string> strings;
       for (dsize_t j = 0; j < batch_size; j++) {
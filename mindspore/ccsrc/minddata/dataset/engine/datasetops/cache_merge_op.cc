@@ -157,15 +157,11 @@ Status CacheMergeOp::CacheMissWorkerEntry(int32_t workerId) {
         TensorRowCacheRequest *rq;
         RETURN_IF_NOT_OK(GetRq(row_id, &rq));
         if (rq->GetState() == TensorRowCacheRequest::State::kEmpty) {
-          // We will send the request async. But any error we most
-          // likely ignore and continue.
-          Status rc = rq->AsyncSendCacheRequest(cache_client_, new_row);
-          if (rc.IsOk()) {
-            RETURN_IF_NOT_OK(io_que_->EmplaceBack(row_id));
-          } else if (rc == StatusCode::kMDOutOfMemory || rc == kMDNoSpace) {
-            cache_missing_rows_ = false;
-            cache_client_->ServerRunningOutOfResources();
-          }
+          // Write-behind. Stage a shallow copy for the cleaner and let the row flow downstream right away.
+          // The cleaner will serialize and send it to the server in the background, batching into the async
+          // write buffer when the server is local.
+          rq->StageRowForWrite(new_row);
+          RETURN_IF_NOT_OK(io_que_->EmplaceBack(row_id));
         }
       }
       RETURN_IF_NOT_OK(cache_miss_.Add(row_id, std::move(new_row)));
@@ -190,7 +186,21 @@ Status CacheMergeOp::Cleaner() {
     if (rq->GetState() == TensorRowCacheRequest::State::kClean) {
       continue;
     }
-    Status rc = rq->CheckCacheResult();
+    // Serialize and send the staged row first. Like the old inline send, any error we most likely
+    // ignore and continue.
+    Status rc = rq->SendStagedRow(cache_client_);
+    if (rc.IsError()) {
+      if (rc == StatusCode::kMDInterrupted) {
+        return Status::OK();
+      } else if (rc == StatusCode::kMDOutOfMemory || rc == kMDNoSpace) {
+        cache_missing_rows_ = false;
+        cache_client_->ServerRunningOutOfResources();
+        continue;
+      }
+      MS_LOG(INFO) << "Cache row not successful: " << rc.ToString();
+      continue;
+    }
+    rc = rq->CheckCacheResult();
     if (rc.IsError()) {
       // If interrupt, time to quit.
       if (rc == StatusCode::kMDInterrupted) {
@@ -278,6 +288,25 @@ Status CacheMergeOp::GetRq(row_id_type row_id, CacheMergeOp::TensorRowCacheReque
   return Status::OK();
 }
 
+void CacheMergeOp::TensorRowCacheRequest::StageRowForWrite(const TensorRow &row) {
+  std::unique_lock<std::mutex> lock(staged_mux_);
+  // A shallow copy only bumps the tensor reference counts, the original row flows downstream untouched.
+  staged_row_ = row;
+}
+
+Status CacheMergeOp::TensorRowCacheRequest::SendStagedRow(const std::shared_ptr<CacheClient> &cc) {
+  TensorRow row;
+  {
+    std::unique_lock<std::mutex> lock(staged_mux_);
+    row = std::move(staged_row_);
+  }
+  if (row.empty()) {
+    // Another cleaner has picked it up already.
+    return Status::OK();
+  }
+  return AsyncSendCacheRequest(cc, row);
+}
+
 Status CacheMergeOp::TensorRowCacheRequest::AsyncSendCacheRequest(const std::shared_ptr<CacheClient> &cc,
                                                                   const TensorRow &row) {
   auto expected = State::kEmpty;
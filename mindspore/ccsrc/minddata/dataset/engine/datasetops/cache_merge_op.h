@@ -58,6 +58,19 @@ class CacheMergeOp : public ParallelOp<TensorRow, TensorRow> {
     /// \note Thread safe
     Status AsyncSendCacheRequest(const std::shared_ptr<CacheClient> &cc, const TensorRow &row);
 
+    /// \brief Stage a shallow copy of the row for write-behind. The cache miss worker stages the row and
+    /// moves on, so the missed row flows downstream without waiting for the cache write.
+    /// \param row TensorRow to be written to the server by the cleaner
+    /// \note Thread safe
+    void StageRowForWrite(const TensorRow &row);
+
+    /// \brief Serialize and send the staged row to the server async. Called by the cleaner so the
+    /// serialization cost stays off the pipeline hot path.
+    /// \param cc Cache client of the CacheMergeOp
+    /// \return Status object
+    /// \note Thread safe
+    Status SendStagedRow(const std::shared_ptr<CacheClient> &cc);
+
     /// \brief We send the row to the server async so the CacheMissWorkerEntry can continue.
     /// It is the cleaner that will check the result.
     /// \return Status object
@@ -66,6 +79,8 @@ class CacheMergeOp : public ParallelOp<TensorRow, TensorRow> {
    private:
     std::atomic<State> st_;
     std::shared_ptr<CacheRowRequest> cleaner_copy_;
+    std::mutex staged_mux_;
+    TensorRow staged_row_;
   };
 
   constexpr static int kNumChildren = 2;        // CacheMergeOp has 2 children
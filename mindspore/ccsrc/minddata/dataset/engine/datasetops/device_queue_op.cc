@@ -19,11 +19,13 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <unordered_map>
 
 #include "minddata/dataset/engine/dataset_iterator.h"
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/util/task_manager.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace dataset {
@@ -44,6 +46,22 @@ DeviceQueueOp::DeviceQueueOp(std::string channel_name, DeviceType device_type, i
   std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
   dynamic_shape_ = cfg->dynamic_shape();
 
+  // Optional single host multi card fan-out: instead of one duplicated pipeline per device, one
+  // shared pipeline demultiplexes its batches round robin over several device channels, so the
+  // decode work is paid once. The extra channel names come from MS_DEV_DEVICE_QUEUE_FANOUT
+  // (comma separated). Only the GPU queue supports this mode for now.
+  fanout_channel_names_.push_back(channel_name_);
+  std::string fanout_channels = common::GetEnv("MS_DEV_DEVICE_QUEUE_FANOUT");
+  if (!fanout_channels.empty()) {
+    std::stringstream fanout_stream(fanout_channels);
+    std::string fanout_name;
+    while (std::getline(fanout_stream, fanout_name, ',')) {
+      if (!fanout_name.empty() && fanout_name != channel_name_) {
+        fanout_channel_names_.push_back(fanout_name);
+      }
+    }
+  }
+
 #ifdef ENABLE_GPUQUE
   // Get the total device num of current machine
   int32_t device_count = 0;
@@ -411,7 +429,9 @@ Status DeviceQueueOp::LaunchParallelCopyThread() {
   // CircularPool may not safe under multi-threads scenario, so one worker with one pool
   for (int i = 0; i < num_workers_; i++) {
     std::shared_ptr<MemoryPool> pool;
-    RETURN_IF_NOT_OK(CircularPool::CreateCircularPool(&pool, -1, kDeviceQueGpuThreadMemory, false, true));
+    // Create the first pinned arena eagerly so the expensive cudaHostAlloc happens here instead of inside the
+    // first batch, the arena is recycled for the staging buffers of all the following batches.
+    RETURN_IF_NOT_OK(CircularPool::CreateCircularPool(&pool, -1, kDeviceQueGpuThreadMemory, true, true));
     pool_.push_back(pool);
   }
   gpu_connector_ = std::make_unique<GpuConnector>(num_workers_, 1, queue_capacity_);
@@ -457,14 +477,16 @@ Status DeviceQueueOp::PushDataToGPU() {
   bool eoe_flag = item.eoe_flag;
   int64_t send_batch = 0;
   auto release_function = std::bind(&DeviceQueueOp::ReleaseData, this, std::placeholders::_1, std::placeholders::_2);
-  BlockQueueStatus_T ret;
-  if (dynamic_shape_) {
-    ret = mindspore::DataQueueHandler::OpenDynamicBufQueue(channel_name_, release_function);
-  } else {
-    ret = mindspore::DataQueueHandler::Open(channel_name_, release_function);
-  }
-  if (ret != BlockQueueStatus_T::SUCCESS) {
-    RETURN_STATUS_UNEXPECTED("[Internal ERROR] Failed to open channel for sending data.");
+  for (const auto &channel_name : fanout_channel_names_) {
+    BlockQueueStatus_T ret;
+    if (dynamic_shape_) {
+      ret = mindspore::DataQueueHandler::OpenDynamicBufQueue(channel_name, release_function);
+    } else {
+      ret = mindspore::DataQueueHandler::Open(channel_name, release_function);
+    }
+    if (ret != BlockQueueStatus_T::SUCCESS) {
+      RETURN_STATUS_UNEXPECTED("[Internal ERROR] Failed to open channel for sending data.");
+    }
   }
 
   while (!(items.empty() && !eoe_flag) && !mindspore::DataQueueHandler::IsClosed()) {
@@ -474,13 +496,17 @@ Status DeviceQueueOp::PushDataToGPU() {
       md_channel_info_->RecordPreprocessBatch(send_batch);
       md_channel_info_->RecordPushStartTime();
 #endif
+      // In the fan-out mode the batches are demultiplexed round robin; each channel still sees its
+      // own batches in pipeline order because this single thread pushes for all the channels.
+      const auto &push_channel =
+        fanout_channel_names_[static_cast<size_t>(send_batch) % fanout_channel_names_.size()];
       // Data prefetch only when PS mode enables cache.
-      if (!ps::PsDataPrefetch::GetInstance().PrefetchData(channel_name_, items[0].data_ptr_, items[0].data_len_,
+      if (!ps::PsDataPrefetch::GetInstance().PrefetchData(push_channel, items[0].data_ptr_, items[0].data_len_,
                                                           items[0].data_type_)) {
         RETURN_STATUS_ERROR(StatusCode::kMDTimeOut,
                             "[Internal ERROR] Failed to prefetch data in current PS mode(cache data when sending).");
       }
-      RETURN_IF_NOT_OK(RetryPushData(items, is_profiling_enable, &push_cost));
+      RETURN_IF_NOT_OK(RetryPushData(push_channel, items, is_profiling_enable, &push_cost));
 #ifndef ENABLE_SECURITY
       ProfilingRecorder(is_profiling_enable, profiling_node, send_batch, push_cost, &batch_start_time, &end_time,
                         gpu_connector_->capacity(), gpu_connector_->size());
@@ -524,7 +550,9 @@ Status DeviceQueueOp::PushDataToGPU() {
   tree_->SetFinished();
   MS_LOG(INFO) << "ExecutionTree finished.  Device queue pushed number of batches: " << send_batch;
 
-  mindspore::DataQueueHandler::Close(channel_name_);
+  for (const auto &channel_name : fanout_channel_names_) {
+    mindspore::DataQueueHandler::Close(channel_name);
+  }
   mindspore::DataQueueHandler::CloseConfirm();
   return Status::OK();
 }
@@ -774,8 +802,8 @@ void DeviceQueueOp::PrintEndInfoWhenFirstBatch(bool *first_push_flag) {
     *first_push_flag = true;
   }
 }
-Status DeviceQueueOp::RetryPushData(const std::vector<DataQueueItem> &items, const bool profiling,
-                                    uint64_t *push_time) {
+Status DeviceQueueOp::RetryPushData(const std::string &channel_name, const std::vector<DataQueueItem> &items,
+                                    const bool profiling, uint64_t *push_time) {
   bool flag_log = false;
 #ifndef ENABLE_SECURITY
   uint64_t start_time = 0;
@@ -784,7 +812,7 @@ Status DeviceQueueOp::RetryPushData(const std::vector<DataQueueItem> &items, con
   }
 #endif
   while (!mindspore::DataQueueHandler::IsClosed() && !TaskManager::FindMe()->Interrupted()) {
-    BlockQueueStatus_T ret = mindspore::DataQueueHandler::Push(channel_name_, items, WAIT_TIME);
+    BlockQueueStatus_T ret = mindspore::DataQueueHandler::Push(channel_name, items, WAIT_TIME);
     if (ret != BlockQueueStatus_T::SUCCESS) {
       if (ret == BlockQueueStatus_T::ERROR_INPUT) {
         return Status(
@@ -847,7 +875,7 @@ Status DeviceQueueOp::SendDataToAscendDynamic() {
         items.push_back(data_item);
       }
 
-      RETURN_IF_NOT_OK(RetryPushData(items, false, &data_queue_cost));
+      RETURN_IF_NOT_OK(RetryPushData(channel_name_, items, false, &data_queue_cost));
       if (create_data_info_queue_) {
         DATA_INFO data_info;
         (void)std::transform(curr_row.begin(), curr_row.end(), std::back_inserter(data_info),
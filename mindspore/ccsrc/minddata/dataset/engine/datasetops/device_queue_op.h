@@ -132,7 +132,8 @@ class DeviceQueueOp : public PipelineOp {
   // Name: PrintEndInfoWhenFirstBatch(bool)
   // Description: Print info when first batch send successful in sink_mode
   void PrintEndInfoWhenFirstBatch(bool *first_push_flag);
-  Status RetryPushData(const std::vector<DataQueueItem> &data, bool profiling, uint64_t *push_time);
+  Status RetryPushData(const std::string &channel_name, const std::vector<DataQueueItem> &data, bool profiling,
+                       uint64_t *push_time);
   bool NoExceptionRaised();
   Status SendDataToAscendDynamic();
 
@@ -181,6 +182,10 @@ class DeviceQueueOp : public PipelineOp {
 
   std::unique_ptr<ChildIterator> child_iterator_;
   std::string channel_name_;
+  // The device channels this op feeds. Normally just channel_name_; in the single host multi card
+  // fan-out mode (MS_DEV_DEVICE_QUEUE_FANOUT) one shared pipeline demultiplexes its batches round
+  // robin over all of them, instead of running a duplicated pipeline per device.
+  std::vector<std::string> fanout_channel_names_;
   DeviceType device_type_;
   const int32_t device_id_;
   const bool send_epoch_end_;
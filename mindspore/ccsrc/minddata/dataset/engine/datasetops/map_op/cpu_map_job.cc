@@ -39,6 +39,12 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
     TensorRow input_row = in[row];
     TensorRow result_row;
     for (size_t i = 0; i < ops_.size(); i++) {
+      result_row = TensorRow();
+      // Intermediate rows are exclusively owned by this job, so an elementwise op that advertises
+      // in-place support may write its result through the input tensors instead of allocating new ones.
+      if (i > 0 && ops_[i]->OneToOne() && ops_[i]->SupportsInplace()) {
+        result_row = input_row;
+      }
       // Call compute function for cpu
       Status rc = ops_[i]->Compute(input_row, &result_row);
       if (rc.IsError()) {
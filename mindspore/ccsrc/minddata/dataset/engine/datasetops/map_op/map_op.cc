@@ -19,6 +19,7 @@
 #include <memory>
 #include <vector>
 
+#include "include/common/debug/alloc_counter.h"
 #include "minddata/dataset/callback/callback_param.h"
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/include/dataset/constants.h"
@@ -176,6 +177,7 @@ Status MapOp::operator()() {
 Status MapOp::WorkerEntry(int32_t worker_id) {
   // Handshake with TaskManager that thread creation is successful.
   TaskManager::FindMe()->Post();
+  AllocCounterScope alloc_scope("MapOp::WorkerEntry");
 
   TensorRow in_row;
   std::vector<std::shared_ptr<MapJob>> job_list;
@@ -107,13 +107,19 @@ class ParallelOp : public DatasetOp {
 
   virtual Status Collector() {
     TaskManager::FindMe()->Post();
+    // Cap of the rows buffered locally before they are forwarded to out_connector_ in one queue operation.
+    constexpr size_t kCollectorBatchSize = 16;
     // num_rows received, including eoe, num_step of current epoch
     int64_t num_rows = 0, ep_step = 0, total_step = 0;
     int32_t current_repeats = 0, current_epochs = 0;
     TensorRow row;
+    std::vector<TensorRow> row_batch;
+    row_batch.reserve(kCollectorBatchSize);
     do {
       RETURN_IF_NOT_OK(worker_out_queues_[num_rows++ % num_workers_]->PopFront(&row));
       if (row.wait()) {
+        // Make the buffered rows visible downstream before handling the pause signals.
+        RETURN_IF_NOT_OK(out_connector_->AddBatch(&row_batch));
         // When collector receives the signal from workere thread, it increments a atomic int
         // If num_worker signals are received, wakes up the main thread
         if (++num_workers_paused_ == num_workers_) {
@@ -138,7 +144,14 @@ class ParallelOp : public DatasetOp {
         ++total_step;
         RETURN_IF_NOT_OK(callback_manager_.StepEnd(CallbackParam(current_epochs + 1, ep_step, total_step)));
       }
-      RETURN_IF_NOT_OK(out_connector_->Add(std::move(row)));
+      (void)row_batch.emplace_back(std::move(row));
+      // Forward the buffered rows with a single lock acquisition and wakeup. The batch is flushed on the
+      // control rows, when it is full, or when the next worker queue has nothing ready yet, so it only grows
+      // while the pipeline is backpressured and adds no latency when rows trickle in one by one.
+      if (row.eoe() || row.eof() || row_batch.size() >= kCollectorBatchSize ||
+          worker_out_queues_[num_rows % num_workers_]->empty()) {
+        RETURN_IF_NOT_OK(out_connector_->AddBatch(&row_batch));
+      }
     } while (!row.eof());
     return Status::OK();
   }
@@ -16,9 +16,12 @@
 #if defined(_WIN32) || defined(_WIN64)
 #include <stdlib.h>
 #endif
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <utility>
 
@@ -27,8 +30,11 @@
 #include "minddata/dataset/engine/dataset_iterator.h"
 
 #include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/path.h"
 #include "minddata/dataset/util/random.h"
+#include "minddata/dataset/util/services.h"
 #include "minddata/dataset/util/status.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace dataset {
@@ -36,6 +42,10 @@ constexpr int32_t ShuffleOp::kShuffleStateInit;
 constexpr int32_t ShuffleOp::kShuffleStateActive;
 constexpr int32_t ShuffleOp::kShuffleStateDrain;
 
+namespace {
+constexpr int32_t kDefaultSpillBucketCount = 64;
+}  // namespace
+
 // Constructor of the ShuffleOp
 ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_connector_size, bool reset_every_epoch)
     : PipelineOp(op_connector_size),
@@ -45,7 +55,19 @@ ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_con
       rng_(shuffle_seed),
       shuffle_buffer_(std::make_unique<TensorTable>()),
       shuffle_last_row_idx_(0),
-      shuffle_buffer_state_(kShuffleStateInit) {}
+      shuffle_buffer_state_(kShuffleStateInit),
+      spill_dir_(common::GetEnv("MS_DATASET_SHUFFLE_SPILL_DIR")),
+      spill_bucket_count_(kDefaultSpillBucketCount) {
+  std::string bucket_env = common::GetEnv("MS_DATASET_SHUFFLE_SPILL_BUCKETS");
+  if (!bucket_env.empty()) {
+    int32_t bucket_count = std::atoi(bucket_env.c_str());
+    if (bucket_count > 0) {
+      spill_bucket_count_ = bucket_count;
+    } else {
+      MS_LOG(WARNING) << "Ignoring invalid MS_DATASET_SHUFFLE_SPILL_BUCKETS value: " << bucket_env;
+    }
+  }
+}
 
 // Private function to re-init the shuffle op for another epoch.  Shuffle op calls this by
 // itself rather than waiting for the reset driven from operators above it in the pipeline.
@@ -116,6 +138,12 @@ Status ShuffleOp::operator()() {
   int32_t child_idx = 0;
   child_iterator_ = std::make_unique<ChildIterator>(this, worker_id, child_idx);
 
+  // When a spill directory is configured, run the bounded-memory external shuffle instead of holding
+  // the whole shuffle buffer in RAM.
+  if (!spill_dir_.empty()) {
+    return ExternalShuffle();
+  }
+
   // Main operator loop
   while (true) {
     // Do an initial populate of the shuffle buffer
@@ -246,6 +274,120 @@ Status ShuffleOp::InitShuffleBuffer() {
   return Status::OK();
 }
 
+// The external shuffle holds at most one bucket (roughly 1/spill_bucket_count_ of the epoch) in memory
+// at any time instead of shuffle_size_ rows. Randomness is near-global: a row's output position is
+// determined by a uniformly random bucket assignment, a random bucket visit order and a full in-memory
+// shuffle of its bucket. Both passes touch the bucket files strictly sequentially.
+Status ShuffleOp::ExternalShuffle() {
+  Path dir(spill_dir_);
+  if (!dir.Exists()) {
+    RETURN_IF_NOT_OK(dir.CreateDirectory());
+  }
+
+  while (true) {
+    TensorRow new_row;
+    RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
+
+    if (child_iterator_->EofHandled()) {
+      MS_LOG(DEBUG) << "Shuffle operator init picked up EOF. No more epochs.";
+      RETURN_IF_NOT_OK(out_connector_->SendEOF());
+      break;
+    }
+    if (new_row.empty()) {
+      RETURN_STATUS_UNEXPECTED("[Internal ERROR] Unable to fetch a single row for shuffle buffer.");
+    }
+
+    // Pass 1: scatter the epoch into the bucket files, each row appended to a uniformly random bucket.
+    std::vector<std::string> bucket_paths;
+    std::vector<std::ofstream> buckets(spill_bucket_count_);
+    bucket_paths.reserve(spill_bucket_count_);
+    const std::string file_prefix = "shuffle_" + Services::GetUniqueID() + "_op" + std::to_string(id());
+    for (int32_t i = 0; i < spill_bucket_count_; ++i) {
+      Path bucket_file = dir / (file_prefix + "_bucket" + std::to_string(i) + ".tmp");
+      bucket_paths.push_back(bucket_file.ToString());
+      buckets[i].open(bucket_paths[i], std::ios::out | std::ios::trunc | std::ios::binary);
+      CHECK_FAIL_RETURN_UNEXPECTED(buckets[i].good(), "Failed to create shuffle spill bucket: " + bucket_paths[i]);
+    }
+    while (!new_row.empty()) {
+      auto slot = static_cast<size_t>(rng_() % static_cast<uint64_t>(spill_bucket_count_));
+      RETURN_IF_NOT_OK(SpillRowToBucket(new_row, &buckets[slot]));
+      RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
+    }
+    for (auto &bucket : buckets) {
+      bucket.close();
+    }
+
+    // Pass 2: visit the buckets in random order and shuffle each one fully in memory before sending.
+    std::vector<int32_t> bucket_order(spill_bucket_count_);
+    std::iota(bucket_order.begin(), bucket_order.end(), 0);
+    std::shuffle(bucket_order.begin(), bucket_order.end(), rng_);
+    for (auto bucket_id : bucket_order) {
+      TensorTable rows;
+      RETURN_IF_NOT_OK(RestoreBucket(bucket_paths[bucket_id], &rows));
+      (void)std::remove(bucket_paths[bucket_id].c_str());
+      for (size_t remaining = rows.size(); remaining > 1; --remaining) {
+        size_t picked = rng_() % remaining;
+        std::swap(rows[picked], rows[remaining - 1]);
+      }
+      for (auto &row : rows) {
+        RETURN_IF_NOT_OK(out_connector_->Add(std::move(row)));
+      }
+    }
+
+    MS_LOG(DEBUG) << "Shuffle operator sending EOE.";
+    RETURN_IF_NOT_OK(out_connector_->SendEOE());
+    RETURN_IF_NOT_OK(this->SelfReset());
+  }
+  return Status::OK();
+}
+
+Status ShuffleOp::SpillRowToBucket(const TensorRow &row, std::ofstream *bucket) const {
+  auto num_tensors = static_cast<uint32_t>(row.size());
+  (void)bucket->write(reinterpret_cast<const char *>(&num_tensors), sizeof(num_tensors));
+  for (const auto &tensor : row) {
+    auto type = static_cast<uint32_t>(tensor->type().value());
+    auto shape = tensor->shape().AsVector();
+    auto rank = static_cast<uint32_t>(shape.size());
+    auto num_bytes = static_cast<uint64_t>(tensor->SizeInBytes());
+    (void)bucket->write(reinterpret_cast<const char *>(&type), sizeof(type));
+    (void)bucket->write(reinterpret_cast<const char *>(&rank), sizeof(rank));
+    (void)bucket->write(reinterpret_cast<const char *>(shape.data()), static_cast<std::streamsize>(rank * sizeof(dsize_t)));
+    (void)bucket->write(reinterpret_cast<const char *>(&num_bytes), sizeof(num_bytes));
+    (void)bucket->write(reinterpret_cast<const char *>(tensor->GetBuffer()), static_cast<std::streamsize>(num_bytes));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(bucket->good(),
+                               "Failed to write row to shuffle spill bucket, check free space under: " + spill_dir_);
+  return Status::OK();
+}
+
+Status ShuffleOp::RestoreBucket(const std::string &bucket_path, TensorTable *rows) const {
+  std::ifstream bucket(bucket_path, std::ios::in | std::ios::binary);
+  CHECK_FAIL_RETURN_UNEXPECTED(bucket.good(), "Failed to open shuffle spill bucket: " + bucket_path);
+  uint32_t num_tensors = 0;
+  while (bucket.read(reinterpret_cast<char *>(&num_tensors), sizeof(num_tensors))) {
+    TensorRow row;
+    for (uint32_t i = 0; i < num_tensors; ++i) {
+      uint32_t type = 0;
+      uint32_t rank = 0;
+      uint64_t num_bytes = 0;
+      (void)bucket.read(reinterpret_cast<char *>(&type), sizeof(type));
+      (void)bucket.read(reinterpret_cast<char *>(&rank), sizeof(rank));
+      std::vector<dsize_t> shape(rank);
+      (void)bucket.read(reinterpret_cast<char *>(shape.data()), static_cast<std::streamsize>(rank * sizeof(dsize_t)));
+      (void)bucket.read(reinterpret_cast<char *>(&num_bytes), sizeof(num_bytes));
+      std::vector<unsigned char> data(num_bytes);
+      (void)bucket.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(num_bytes));
+      CHECK_FAIL_RETURN_UNEXPECTED(bucket.good(), "Corrupted shuffle spill bucket: " + bucket_path);
+      std::shared_ptr<Tensor> tensor;
+      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(TensorShape(shape), DataType(static_cast<DataType::Type>(type)),
+                                                data.data(), static_cast<dsize_t>(num_bytes), &tensor));
+      row.push_back(std::move(tensor));
+    }
+    rows->push_back(std::move(row));
+  }
+  return Status::OK();
+}
+
 Status ShuffleOp::EoeReceived(int32_t worker_id) {
   state_ = OpState::kDeOpIdle;
   return Status::OK();
@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SHUFFLE_OP_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SHUFFLE_OP_H_
 
+#include <fstream>
 #include <map>
 #include <memory>
 #include <queue>
@@ -102,6 +103,19 @@ class ShuffleOp : public PipelineOp {
   // @return Status The status code returned
   Status SelfReset();
 
+  // Main loop of the external (two-pass) shuffle mode: scatter each epoch into on-disk bucket files
+  // with sequential writes, then emit the buckets in random order, each one shuffled in memory.
+  // @return Status The status code returned
+  Status ExternalShuffle();
+
+  // Private function to append one serialized row to a spill bucket file.
+  // @return Status The status code returned
+  Status SpillRowToBucket(const TensorRow &row, std::ofstream *bucket) const;
+
+  // Private function to read all the rows of a spill bucket file back into memory.
+  // @return Status The status code returned
+  Status RestoreBucket(const std::string &bucket_path, TensorTable *rows) const;
+
   int32_t shuffle_size_;  // User config for the size of the shuffle buffer (number of rows)
   uint32_t shuffle_seed_;
   bool reshuffle_each_epoch_;
@@ -115,6 +129,8 @@ class ShuffleOp : public PipelineOp {
   std::unique_ptr<TensorTable> shuffle_buffer_;
   int32_t shuffle_last_row_idx_;  // Internal tracking of the last slot of our shuffle buffer
   int32_t shuffle_buffer_state_;  // State tracking for the shuffle buffer phases of work
+  std::string spill_dir_;         // Non-empty enables the external shuffle mode spilling to this directory
+  int32_t spill_bucket_count_;    // Number of on-disk buckets used by the external shuffle mode
 
   std::unique_ptr<ChildIterator> child_iterator_;  // An iterator for fetching.
 };
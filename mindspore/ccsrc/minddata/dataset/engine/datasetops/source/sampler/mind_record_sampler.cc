@@ -23,7 +23,11 @@
 namespace mindspore {
 namespace dataset {
 MindRecordSamplerRT::MindRecordSamplerRT(mindrecord::ShardReader *shard_reader, int64_t samples_per_tensor)
-    : SamplerRT(0, samples_per_tensor), shard_reader_(shard_reader), sample_ids_(nullptr), next_id_(0) {}
+    : SamplerRT(0, samples_per_tensor),
+      shard_reader_(shard_reader),
+      sample_ids_(nullptr),
+      next_id_(0),
+      first_epoch_skip_count_(0) {}
 
 Status MindRecordSamplerRT::GetNextSample(TensorRow *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
@@ -39,7 +43,7 @@ Status MindRecordSamplerRT::GetNextSample(TensorRow *out) {
     RETURN_IF_NOT_OK(CreateSamplerTensor(&sampleIdsTensor, last_id - next_id_));
     auto id_ptr = sampleIdsTensor->begin<int64_t>();
     for (int64_t i = 0; i < (last_id - next_id_); i++) {
-      *(id_ptr + static_cast<ptrdiff_t>(i)) = (*sample_ids_)[i];
+      *(id_ptr + static_cast<ptrdiff_t>(i)) = (*sample_ids_)[static_cast<size_t>(next_id_ + i)];
     }
     next_id_ = last_id;
 
@@ -60,6 +64,10 @@ Status MindRecordSamplerRT::InitSampler() {
   // Usually, the num samples is given from the user interface. In our case, that data is in mindrecord.
   // Mindrecord already created the sample ids at this point, so the num samples is the size of the sampled id list.
   num_samples_ = sample_ids_->size();
+
+  // A mid-epoch restore starts the first epoch at the row after the restored step, see
+  // SetFirstEpochSkipCount. The ids are already materialized, so this is the whole fast forward.
+  next_id_ = std::min(first_epoch_skip_count_, num_samples_);
   return Status::OK();
 }
 
@@ -48,6 +48,12 @@ class MindRecordSamplerRT : public SamplerRT {
   // @return Status The status code returned
   Status ResetSampler() override;
 
+  // Fast forward the first epoch over the rows a mid-epoch restore already consumed. The shard reader
+  // precomputed the whole id list, so the skip is plain index arithmetic instead of pulling and
+  // discarding the rows through the pipeline. Later epochs are complete: ResetSampler() rewinds to 0.
+  // @param int64_t skip_count - number of ids to skip in the first epoch
+  void SetFirstEpochSkipCount(int64_t skip_count) { first_epoch_skip_count_ = skip_count; }
+
   void SamplerPrint(std::ostream &out, bool show_all) const override;
 
   /// \brief Get the arguments of node
@@ -59,6 +65,7 @@ class MindRecordSamplerRT : public SamplerRT {
   mindrecord::ShardReader *shard_reader_;   // back pointer to the shard reader
   const std::vector<int64_t> *sample_ids_;  // read-only back pointer into mind record sampler ids
   int64_t next_id_;
+  int64_t first_epoch_skip_count_;          // ids to fast forward over in the first epoch (failover restore only)
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -31,7 +31,8 @@ RandomSamplerRT::RandomSamplerRT(bool replacement, int64_t num_samples, bool res
       replacement_(replacement),
       next_id_(0),
       dist(nullptr),
-      reshuffle_each_epoch_(reshuffle_each_epoch) {}
+      reshuffle_each_epoch_(reshuffle_each_epoch),
+      fast_forward_epochs_(0) {}
 
 Status RandomSamplerRT::GetNextSample(TensorRow *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
@@ -97,6 +98,19 @@ Status RandomSamplerRT::InitSampler() {
     dist = std::make_unique<std::uniform_int_distribution<int64_t>>(0, num_rows_ - 1);
   }
 
+  // Replay the per-epoch random state transitions that ResetSampler() performed in the epochs which already
+  // finished before a failover reset, so this sampler reproduces the id order of the restored epoch. The shuffles
+  // are cumulative, so each finished epoch must be replayed instead of jumping to the final seed directly.
+  if (reshuffle_each_epoch_) {
+    for (int64_t i = 0; i < fast_forward_epochs_; i++) {
+      seed_++;
+      rnd_.seed(seed_);
+      if (!replacement_) {
+        std::shuffle(shuffled_ids_.begin(), shuffled_ids_.end(), rnd_);
+      }
+    }
+  }
+
   is_initialized = true;
   return Status::OK();
 }
@@ -52,6 +52,11 @@ class RandomSamplerRT : public SamplerRT {
 
   void SamplerPrint(std::ostream &out, bool show_all) const override;
 
+  /// \brief Sets how many epochs of per-epoch random state InitSampler() should replay, so a sampler rebuilt
+  ///     by a failover reset produces the same id order as the original run did in the restored epoch.
+  /// \param[in] epochs Number of completed epochs to fast forward over
+  void SetEpochFastForward(int64_t epochs) { fast_forward_epochs_ = epochs; }
+
   /// \brief Get the arguments of node
   /// \param[out] out_json JSON string of all attributes
   /// \return Status of the function
@@ -65,6 +70,7 @@ class RandomSamplerRT : public SamplerRT {
   std::mt19937 rnd_;
   std::unique_ptr<std::uniform_int_distribution<int64_t>> dist;
   bool reshuffle_each_epoch_;
+  int64_t fast_forward_epochs_;  // epochs of random state to replay in InitSampler (failover reset only)
 };
 }  // namespace dataset
 }  // namespace mindspore
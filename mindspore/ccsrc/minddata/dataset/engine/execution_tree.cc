@@ -24,6 +24,7 @@
 #endif
 #include "minddata/dataset/util/task_manager.h"
 #include "minddata/dataset/util/service.h"
+#include "mindrt/src/thread/thread_budget.h"
 
 namespace mindspore {
 namespace dataset {
@@ -33,6 +34,7 @@ ExecutionTree::ExecutionTree() : id_count_(0), tree_state_(kDeTStateInit) {
   root_ = nullptr;
   prepare_flags_ = 0;
   unique_id_ = Services::GetUniqueID();
+  budget_acquired_ = 0;
 #if defined(ENABLE_GPUQUE) || defined(ENABLE_TDTQUE)
   std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
   rank_id_ = cfg->rank_id();
@@ -55,6 +57,10 @@ ExecutionTree::~ExecutionTree() {
 #endif
 #endif
   (void)tg_->ServiceStop();
+  if (budget_acquired_ > 0) {
+    ThreadBudget::GetInstance().Release(kThreadBudgetMindData, budget_acquired_);
+    budget_acquired_ = 0;
+  }
 }
 
 // Associates a DatasetOp with this tree. This assigns a valid node id to the operator and
@@ -233,6 +239,11 @@ Status ExecutionTree::LaunchWorkers(int32_t num_workers, std::function<Status(ui
     MS_LOG(WARNING) << name + " is launched with " << std::to_string(num_workers) << " worker threads which exceeds "
                     << std::to_string(num_cpu_threads) << ", the maximum number of threads on this CPU.";
   }
+  // Record the workers in the process-wide thread budget. MindData workers mostly block on I/O or
+  // connectors rather than spin, so they are accounted without clamping: compute pools created
+  // afterwards see the reduced availability and size themselves to the remaining cores.
+  budget_acquired_ += ThreadBudget::GetInstance().Acquire(kThreadBudgetMindData, static_cast<size_t>(num_workers),
+                                                          static_cast<size_t>(num_workers));
   worker_tasks->resize(num_workers);
   for (int32_t i = 0; i < num_workers; ++i) {
     Task *task = nullptr;
@@ -228,6 +228,7 @@ class ExecutionTree {
   uint32_t prepare_flags_;           // Flags used during tree prepare
   TreeState tree_state_;             // Tracking the current tree state
   std::string unique_id_;            // A unique identifier for the tree
+  size_t budget_acquired_;           // Thread tokens drawn from the process-wide ThreadBudget
 
 #if defined(ENABLE_GPUQUE) || defined(ENABLE_TDTQUE)
   // This rank_id is for numa and device_queue, one process work with only one rank_id,
@@ -32,12 +32,15 @@ namespace dataset {
 // (cannot add another output parameter because it has to override base class's function)
 Status MindRecordSamplerObj::SamplerBuild(std::shared_ptr<SamplerRT> *sampler) {
   shard_reader_ = std::make_unique<mindrecord::ShardReader>();
-  *sampler = std::make_shared<MindRecordSamplerRT>(shard_reader_.get());
+  auto mind_record_sampler = std::make_shared<MindRecordSamplerRT>(shard_reader_.get());
+  mind_record_sampler->SetFirstEpochSkipCount(first_epoch_skip_count_);
+  *sampler = std::move(mind_record_sampler);
   return Status::OK();
 }
 
 std::shared_ptr<SamplerObj> MindRecordSamplerObj::SamplerCopy() {
   auto sampler = std::make_shared<MindRecordSamplerObj>();
+  sampler->SetFirstEpochSkipCount(first_epoch_skip_count_);
   return sampler;
 }
 
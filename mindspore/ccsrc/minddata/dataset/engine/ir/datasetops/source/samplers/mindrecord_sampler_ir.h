@@ -56,8 +56,14 @@ class MindRecordSamplerObj : public SamplerObj {
   /// \return The Status code of the function. It returns OK status if acquired a non-empty ShardReader object.
   Status GetShardReader(std::unique_ptr<mindrecord::ShardReader> *shard_reader);
 
+  /// \brief Fast forward the first epoch of the runtime sampler over the rows a mid-epoch restore already
+  ///     consumed, by index arithmetic on the precomputed sample ids. Must be called before SamplerBuild.
+  /// \param[in] skip_count Number of ids to skip in the first epoch
+  void SetFirstEpochSkipCount(int64_t skip_count) { first_epoch_skip_count_ = skip_count; }
+
  private:
   std::unique_ptr<mindrecord::ShardReader> shard_reader_;
+  int64_t first_epoch_skip_count_ = 0;
 };
 #endif
 }  // namespace dataset
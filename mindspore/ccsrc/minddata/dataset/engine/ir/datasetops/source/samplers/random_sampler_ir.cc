@@ -71,7 +71,9 @@ Status RandomSamplerObj::from_json(nlohmann::json json_obj, int64_t num_samples,
 
 Status RandomSamplerObj::SamplerBuild(std::shared_ptr<SamplerRT> *sampler) {
   // runtime sampler object
-  *sampler = std::make_shared<dataset::RandomSamplerRT>(replacement_, num_samples_, reshuffle_each_epoch_);
+  auto random_sampler = std::make_shared<dataset::RandomSamplerRT>(replacement_, num_samples_, reshuffle_each_epoch_);
+  random_sampler->SetEpochFastForward(epochs_already_run_);
+  *sampler = random_sampler;
   Status s = BuildChildren(sampler);
   sampler = s.IsOk() ? sampler : nullptr;
   return s;
@@ -89,6 +91,7 @@ std::shared_ptr<mindrecord::ShardOperator> RandomSamplerObj::BuildForMindDataset
 
 std::shared_ptr<SamplerObj> RandomSamplerObj::SamplerCopy() {
   auto sampler = std::make_shared<RandomSamplerObj>(replacement_, num_samples_, reshuffle_each_epoch_);
+  sampler->SetEpochsAlreadyRun(epochs_already_run_);
   for (const auto &child : children_) {
     Status rc = sampler->AddChildSampler(child);
     if (rc.IsError()) {
@@ -77,6 +77,11 @@ class SamplerObj {
 
   std::vector<std::shared_ptr<SamplerObj>> GetChild() { return children_; }
 
+  /// \brief Records how many epochs already finished before a failover reset recompiled the tree, so the
+  ///     built runtime sampler can fast forward its per-epoch random state to reproduce the original order.
+  /// \param[in] epochs The number of completed epochs to fast forward over
+  void SetEpochsAlreadyRun(int64_t epochs) { epochs_already_run_ = epochs; }
+
 #ifndef ENABLE_ANDROID
   /// \brief Virtual function to convert a SamplerObj class into a runtime mindrecord sampler object,
   ///     only override by SubsetRandomSampler, PkSampler, RandomSampler, SequentialSampler, DistributedSampler
@@ -91,6 +96,10 @@ class SamplerObj {
   Status BuildChildren(std::shared_ptr<SamplerRT> *const sampler);
 
   std::vector<std::shared_ptr<SamplerObj>> children_;
+
+  /// \brief The number of epochs finished before a failover reset, consumed by the samplers with per-epoch
+  ///     random state (e.g. RandomSampler). Zero for a normal (non-reset) compile.
+  int64_t epochs_already_run_ = 0;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -21,6 +21,7 @@
 
 #include "minddata/dataset/engine/ir/datasetops/root_node.h"
 #include "minddata/dataset/engine/ir/datasetops/skip_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/samplers/samplers_ir.h"
 #include "minddata/dataset/engine/ir/datasetops/transfer_node.h"
 #include "minddata/dataset/util/status.h"
 
@@ -60,6 +61,14 @@ Status AddSkipPass::InjectionFinder::Visit(std::shared_ptr<BuildSentenceVocabNod
 }
 #endif
 
+// Collects the mappable source nodes, so RunOnTree can fast forward their samplers over the finished epochs
+Status AddSkipPass::InjectionFinder::Visit(std::shared_ptr<MappableSourceNode> node, bool *const modified) {
+  RETURN_UNEXPECTED_IF_NULL(node);
+  RETURN_UNEXPECTED_IF_NULL(modified);
+  mappable_sources_.push_back(node);
+  return Status::OK();
+}
+
 Status AddSkipPass::InjectionFinder::VisitAfter(std::shared_ptr<TransferNode> node, bool *const modified) {
   RETURN_UNEXPECTED_IF_NULL(node);
   RETURN_UNEXPECTED_IF_NULL(modified);
@@ -100,11 +109,24 @@ Status AddSkipPass::RunOnTree(std::shared_ptr<DatasetNode> root_ir, bool *const
     MS_LOG(ERROR) << err_msg;
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
-  int32_t new_num_epochs = num_epochs - static_cast<int32_t>(step / dataset_size);
+  int64_t epochs_already_run = step / dataset_size;
+  int32_t new_num_epochs = num_epochs - static_cast<int32_t>(epochs_already_run);
   int64_t skip_num = step % dataset_size;
 
   root_ir->SetNumEpochs(new_num_epochs);
 
+  // The finished epochs are not run again, but they advanced the per-epoch random state of the samplers (e.g. the
+  // reshuffle of RandomSampler). Fast forward the samplers over them, so the restored epoch produces the same
+  // order as the original run would have.
+  if (epochs_already_run > 0) {
+    for (const auto &mappable_source : finder.mappable_sources()) {
+      auto sampler = mappable_source->Sampler();
+      if (sampler != nullptr) {
+        sampler->SetEpochsAlreadyRun(epochs_already_run);
+      }
+    }
+  }
+
   auto skip_node = std::make_shared<SkipNode>(skip_num);
   skip_node->SetFirstEpochOnly(true);
   RETURN_IF_NOT_OK(node->InsertAbove(skip_node));
@@ -24,6 +24,7 @@
 namespace mindspore {
 namespace dataset {
 class DatasetOp;
+class MappableSourceNode;
 
 /// \class AddSkipPass
 /// \brief This is a pre pass that drives the injection of any nodes that could not be directly injected from the api
@@ -67,6 +68,12 @@ class AddSkipPass : public IRTreePass {
     /// \return Status The status code returned
     Status VisitAfter(std::shared_ptr<TransferNode> node, bool *const modified) override;
 
+    /// \brief Record the mappable source nodes, so their samplers can be fast forwarded over the finished epochs.
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<MappableSourceNode> node, bool *const modified) override;
+
     /// \brief Getter
     std::shared_ptr<DatasetNode> injection_point() { return injection_point_; }
 
@@ -74,10 +81,15 @@ class AddSkipPass : public IRTreePass {
 
     int32_t GetNumEpochs() { return num_epochs_; }
 
+    /// \brief Getter
+    /// \return All the mappable source nodes found in the tree
+    const std::vector<std::shared_ptr<MappableSourceNode>> &mappable_sources() const { return mappable_sources_; }
+
    private:
     std::shared_ptr<DatasetNode> injection_point_;
     int64_t step_{};
     int32_t num_epochs_{};
+    std::vector<std::shared_ptr<MappableSourceNode>> mappable_sources_;
   };
 
  public:
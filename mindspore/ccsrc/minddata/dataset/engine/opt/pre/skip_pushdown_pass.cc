@@ -23,6 +23,7 @@
 #include "minddata/dataset/engine/ir/datasetops/skip_node.h"
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/engine/ir/datasetops/source/minddata_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/samplers/mindrecord_sampler_ir.h"
 #endif
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/skip_first_epoch_sampler_ir.h"
 
@@ -115,13 +116,22 @@ Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<NonMappableSourceNode>
 }
 
 #ifndef ENABLE_ANDROID
-// Since MindDataset requires its own SkipFirstEpochSampler (which is not implemented) we insert the skip node above it.
+// MindDataset precomputes its sample ids in the shard reader, so the first epoch skip can be pushed into its
+// sampler as index arithmetic instead of pulling and discarding the skipped rows through a skip node. Fall back
+// to a skip node above when the sampler was replaced (e.g. by a cache lookup node).
 Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<MindDataNode> node, bool *const modified) {
   CHECK_FAIL_RETURN_UNEXPECTED(skip_count_ >= 0, "The skip size cannot be negative.");
   if (skip_count_ == 0) return Status::OK();  // no active skip node above. normal flow
 
-  // insert a skip node above
-  insert_skip_above_.emplace_back(node, skip_count_);
+  auto sampler = std::dynamic_pointer_cast<MindRecordSamplerObj>(node->Sampler());
+  if (sampler == nullptr) {
+    // insert a skip node above
+    insert_skip_above_.emplace_back(node, skip_count_);
+    skip_count_ = 0;
+    return Status::OK();
+  }
+  MS_LOG(INFO) << "Pushing the first epoch skip (" << skip_count_ << ") into the MindRecord sampler.";
+  sampler->SetFirstEpochSkipCount(skip_count_);
   skip_count_ = 0;
   return Status::OK();
 }
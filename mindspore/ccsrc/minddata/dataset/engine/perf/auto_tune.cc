@@ -587,6 +587,67 @@ bool AutoTune::SkipOpsCheck(int op_id) {
   return false;
 }
 
+int32_t AutoTune::TotalNumWorkers(const std::map<int32_t, int32_t> &ops_num_workers) {
+  int32_t total_workers = 0;
+  for (const auto &op_id : parallel_ops_ids_) {
+    auto itr = ops_num_workers.find(op_id);
+    if (itr != ops_num_workers.end()) {
+      total_workers += itr->second;
+    }
+  }
+  return total_workers;
+}
+
+Status AutoTune::ReclaimWorkersWithinBudget(int32_t op_id, int32_t *requested_workers,
+                                            std::map<int32_t, int32_t> *ops_num_workers,
+                                            const std::map<int32_t, double> &ops_cpu_util,
+                                            const std::map<int32_t, double> &out_ops_queue_util) {
+  int32_t increment = *requested_workers - (*ops_num_workers)[op_id];
+  int32_t over_budget = TotalNumWorkers(*ops_num_workers) + increment - max_workers_;
+  while (over_budget > 0) {
+    // Pick the donor with the lowest per-worker cpu utilization among the ops whose output queue is
+    // filled; such an op produces faster than its consumer drains and can give a worker back.
+    int32_t donor_id = -1;
+    double donor_cpu = MAP_OP_WORKER_LOW_THRESHOLD;
+    for (const auto &candidate_id : parallel_ops_ids_) {
+      if (candidate_id == op_id || SkipOpsCheck(candidate_id)) {
+        continue;
+      }
+      int32_t candidate_workers = (*ops_num_workers)[candidate_id];
+      if (candidate_workers <= MIN_NUM_WORKERS) {
+        continue;
+      }
+      auto queue_itr = out_ops_queue_util.find(candidate_id);
+      if (queue_itr == out_ops_queue_util.end() || queue_itr->second < WORKER_RECLAIM_QUEUE_THRESHOLD) {
+        continue;
+      }
+      double per_worker_cpu = ops_cpu_util.at(candidate_id) / candidate_workers;
+      if (per_worker_cpu < donor_cpu) {
+        donor_cpu = per_worker_cpu;
+        donor_id = candidate_id;
+      }
+    }
+    if (donor_id == -1) {
+      break;
+    }
+    MS_LOG(INFO) << "Op (" << ops_[donor_id]->NameWithID() << ") is over-provisioned, reclaiming one worker for Op ("
+                 << ops_[op_id]->NameWithID() << ") to stay within the global budget of " << max_workers_
+                 << " workers.";
+    int32_t donor_workers = (*ops_num_workers)[donor_id] + DECREMENT_WORKER;
+    RETURN_IF_NOT_OK(RequestNumWorkerChange(donor_id, (*ops_num_workers)[donor_id], &donor_workers));
+    (*ops_num_workers)[donor_id] = donor_workers;
+    over_budget--;
+  }
+  if (over_budget > 0) {
+    int32_t granted_workers = std::max(*requested_workers - over_budget, (*ops_num_workers)[op_id]);
+    MS_LOG(INFO) << "Global worker budget of " << max_workers_ << " reached and no op can give a worker back, Op ("
+                 << ops_[op_id]->NameWithID() << ") is granted [" << granted_workers << "] instead of ["
+                 << *requested_workers << "] workers.";
+    *requested_workers = granted_workers;
+  }
+  return Status::OK();
+}
+
 Status AutoTune::AnalyseTime() {
   // check for connector queue bottleneck
   bool isBottleneck = false;
@@ -628,12 +689,31 @@ Status AutoTune::AnalyseTime() {
                    << ", output connector utilization=" << output_queue_util << ", diff= " << queue_diff << " > "
                    << INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD << " threshold.";
       requested_workers = num_workers + INCREMENT_WORKER;
-      RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &requested_workers));
+      RETURN_IF_NOT_OK(
+        ReclaimWorkersWithinBudget(op_id, &requested_workers, &ops_num_workers, ops_cpu_util, out_ops_queue_util));
+      if (requested_workers > num_workers) {
+        RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &requested_workers));
+        ops_num_workers[op_id] = requested_workers;
+      }
     } else if ((cpu_util / num_workers) > MAP_OP_WORKER_HIGH_THRESHOLD) {
       MS_LOG(INFO) << "Op (" << ops_[op_id]->NameWithID() << ") getting high average worker cpu utilization "
                    << (cpu_util / num_workers) << "% > " << MAP_OP_WORKER_HIGH_THRESHOLD << "% threshold.";
       requested_workers = num_workers + INCREMENT_WORKER;
+      RETURN_IF_NOT_OK(
+        ReclaimWorkersWithinBudget(op_id, &requested_workers, &ops_num_workers, ops_cpu_util, out_ops_queue_util));
+      if (requested_workers > num_workers) {
+        RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &requested_workers));
+        ops_num_workers[op_id] = requested_workers;
+      }
+    } else if (num_workers > MIN_NUM_WORKERS && output_queue_util > WORKER_RECLAIM_QUEUE_THRESHOLD &&
+               (cpu_util / num_workers) < MAP_OP_WORKER_LOW_THRESHOLD) {
+      MS_LOG(INFO) << "Op (" << ops_[op_id]->NameWithID() << ") is over-provisioned, output connector utilization="
+                   << output_queue_util << " with low average worker cpu utilization " << (cpu_util / num_workers)
+                   << "% < " << MAP_OP_WORKER_LOW_THRESHOLD << "% threshold, releasing one worker.";
+      requested_workers = num_workers + DECREMENT_WORKER;
       RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &requested_workers));
+      ops_num_workers[op_id] = requested_workers;
+      continue;
     }
     if ((cpu_util / num_workers) < MAP_OP_WORKER_LOW_THRESHOLD &&
         ((input_queue_util < INPUT_QUEUE_LOW) || (-1 * queue_diff > INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD))) {
@@ -134,6 +134,8 @@ class AutoTune {
   const int32_t DECREMENT_WORKER = -1;
   // Queue Specifics
   const float_t INPUT_QUEUE_LOW = 0.5;
+  // An output queue this full with low per-worker cpu utilization marks an over-provisioned op
+  const float_t WORKER_RECLAIM_QUEUE_THRESHOLD = 0.9;
 
   // Value to maintain checking for device_queue utlization at.
   const float_t DEVICE_CONNECTOR_UTIL_THRESHOLD = 0.75;
@@ -184,6 +186,25 @@ class AutoTune {
   /// \return bool to skip or not
   bool SkipOpsCheck(int op_id);
 
+  /// Total number of workers currently assigned to the parallel ops
+  /// \param ops_num_workers map from op_id to num_workers
+  /// \return the total worker count
+  int32_t TotalNumWorkers(const std::map<int32_t, int32_t> &ops_num_workers);
+
+  /// Keep a worker grow request within the global worker budget (the number of CPU threads) by reclaiming
+  /// workers from over-provisioned ops (low per-worker CPU utilization with a filled output queue).
+  /// The grow request is clamped when no op can give a worker back.
+  /// \param op_id operator asking for more workers
+  /// \param[in,out] requested_workers the requested number of workers, clamped to respect the budget
+  /// \param[in,out] ops_num_workers map from op_id to num_workers, updated as workers are reclaimed
+  /// \param ops_cpu_util map from op_id to cpu utilization
+  /// \param out_ops_queue_util map from op_id to output queue utilization
+  /// \return Status code
+  Status ReclaimWorkersWithinBudget(int32_t op_id, int32_t *requested_workers,
+                                    std::map<int32_t, int32_t> *ops_num_workers,
+                                    const std::map<int32_t, double> &ops_cpu_util,
+                                    const std::map<int32_t, double> &out_ops_queue_util);
+
   /// Main AutoTune algorithm
   /// \return Status code
   Status AnalyseTime();
@@ -100,6 +100,22 @@ class MS_API Iterator {
   /// \endcode
   virtual Status GetNextRow(MSTensorVec *row);
 
+  /// \brief Function to get up to num_rows rows from the data pipeline in one call.
+  /// \note Bulk endpoint for C++ services consuming the pipeline without python: the per-call
+  ///    overhead is paid once per call instead of once per row. Fewer rows (possibly zero) are
+  ///    returned when the epoch ends.
+  /// \param[in] num_rows Maximum number of rows to fetch.
+  /// \param[out] rows One entry per fetched row, each a vector of tensors (without column name).
+  /// \return Status error code, returns OK if no error encountered.
+  /// \par Example
+  /// \code
+  ///      /* dataset is an instance of Dataset object */
+  ///      std::shared_ptr<Iterator> = dataset->CreateIterator();
+  ///      std::vector<std::vector<mindspore::MSTensor>> rows;
+  ///      iter->GetRows(32, &rows);
+  /// \endcode
+  Status GetRows(int32_t num_rows, std::vector<MSTensorVec> *const rows);
+
   /// \brief Function to shut down the data pipeline.
   void Stop();
 
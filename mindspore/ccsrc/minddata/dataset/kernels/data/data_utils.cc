@@ -250,11 +250,14 @@ Status Fill(const std::shared_ptr<Tensor> input, std::shared_ptr<Tensor> *output
 
 template <typename FROM, typename TO>
 void Cast(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
-  auto in_itr = input->begin<FROM>();
-  auto out_itr = (*output)->begin<TO>();
-  auto out_end = (*output)->end<TO>();
-
-  for (; out_itr != out_end; ++in_itr, ++out_itr) *out_itr = static_cast<TO>(*in_itr);
+  // Index the raw buffers directly; the tight loop with no aliasing between the two tensors lets the
+  // compiler vectorize the conversion.
+  const auto *in_ptr = reinterpret_cast<const FROM *>(input->GetBuffer());
+  auto *out_ptr = reinterpret_cast<TO *>((*output)->GetMutableBuffer());
+  dsize_t num_elements = (*output)->Size();
+  for (dsize_t i = 0; i < num_elements; i++) {
+    out_ptr[i] = static_cast<TO>(in_ptr[i]);
+  }
 }
 
 template <typename T>
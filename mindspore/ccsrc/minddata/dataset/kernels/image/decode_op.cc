@@ -17,6 +17,7 @@
 
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/kernels/image/jpeg_decode_backend.h"
 #else
 #include "minddata/dataset/kernels/image/lite_image_utils.h"
 #endif
@@ -49,6 +50,50 @@ Status DecodeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
   }
 }
 
+Status DecodeOp::Compute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+#ifndef ENABLE_ANDROID
+  std::shared_ptr<JpegDecodeBackend> backend = JpegDecodeBackendRegistry::GetInstance().Get();
+  if (backend != nullptr && is_rgb_format_) {
+    // Hand all the jpeg columns to the hardware backend in one submission, so the decoder queue stays full
+    // and the workers overlap their batches. Undecoded slots and non-jpeg columns go through the CPU path.
+    std::vector<size_t> jpeg_indices;
+    std::vector<std::shared_ptr<Tensor>> jpeg_inputs;
+    for (size_t i = 0; i < input.size(); ++i) {
+      if (input[i]->Rank() == 1 && IsNonEmptyJPEG(input[i])) {
+        (void)jpeg_indices.emplace_back(i);
+        (void)jpeg_inputs.emplace_back(input[i]);
+      }
+    }
+    if (!jpeg_indices.empty()) {
+      std::vector<std::shared_ptr<Tensor>> jpeg_outputs(jpeg_inputs.size(), nullptr);
+      Status rc = backend->DecodeBatch(jpeg_inputs, &jpeg_outputs);
+      if (rc.IsOk()) {
+        output->resize(input.size());
+        for (size_t k = 0; k < jpeg_indices.size(); ++k) {
+          (*output)[jpeg_indices[k]] = jpeg_outputs[k];
+        }
+        for (size_t i = 0; i < input.size(); ++i) {
+          if ((*output)[i] == nullptr) {
+            RETURN_IF_NOT_OK(Compute(input[i], &(*output)[i]));
+          }
+        }
+        return Status::OK();
+      }
+      // A backend wide error is not fatal for the pipeline, the whole row decodes on CPU instead.
+      MS_LOG(WARNING) << "Hardware jpeg decode backend '" << backend->Name()
+                      << "' failed, falling back to CPU decode: " << rc.ToString();
+      output->clear();
+    }
+  }
+#endif
+  output->resize(input.size());
+  for (size_t i = 0; i < input.size(); ++i) {
+    RETURN_IF_NOT_OK(Compute(input[i], &(*output)[i]));
+  }
+  return Status::OK();
+}
+
 Status DecodeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
   outputs.clear();
@@ -37,6 +37,10 @@ class DecodeOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // Submit all the jpeg columns of the row to the registered hardware decode backend in one batch; images
+  // the backend leaves undecoded and the non-jpeg columns fall back to the CPU decode per image.
+  Status Compute(const TensorRow &input, TensorRow *output) override;
+
   Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
   Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
 
@@ -0,0 +1,35 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/jpeg_decode_backend.h"
+
+namespace mindspore {
+namespace dataset {
+JpegDecodeBackendRegistry &JpegDecodeBackendRegistry::GetInstance() {
+  static JpegDecodeBackendRegistry instance;
+  return instance;
+}
+
+void JpegDecodeBackendRegistry::Register(const std::shared_ptr<JpegDecodeBackend> &backend) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  backend_ = backend;
+}
+
+std::shared_ptr<JpegDecodeBackend> JpegDecodeBackendRegistry::Get() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backend_;
+}
+}  // namespace dataset
+}  // namespace mindspore
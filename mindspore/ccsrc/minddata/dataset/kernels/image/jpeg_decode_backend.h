@@ -0,0 +1,72 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_JPEG_DECODE_BACKEND_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_JPEG_DECODE_BACKEND_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief Interface of a hardware jpeg decode backend pluggable under DecodeOp.
+/// A backend receives a batch of encoded jpeg buffers in one submission so it can keep the hardware decoder
+/// queue full and overlap the submissions of the map workers, and it reports per image failures by leaving
+/// the output slot empty, so the caller decodes only those images on CPU.
+class JpegDecodeBackend {
+ public:
+  virtual ~JpegDecodeBackend() = default;
+
+  /// \brief Name of the backend, used in the fallback log.
+  virtual std::string Name() const = 0;
+
+  /// \brief Decode a batch of encoded jpeg buffers into HWC uint8 RGB tensors.
+  /// \param[in] inputs The 1D uint8 tensors holding the encoded jpeg images.
+  /// \param[in, out] outputs Has the size of inputs on entry with every slot null. A slot still null on
+  ///     return means the backend could not decode that image and the caller falls back to the CPU decode
+  ///     for it. Return a bad Status only for backend wide errors, which make the caller fall back entirely.
+  virtual Status DecodeBatch(const std::vector<std::shared_ptr<Tensor>> &inputs,
+                             std::vector<std::shared_ptr<Tensor>> *outputs) = 0;
+};
+
+/// \brief Holder of the hardware jpeg decode backend of the platform, empty by default.
+/// The platform plugin (eg. the dvpp kernels on Ascend hosts) registers its backend during initialization;
+/// DecodeOp stays on the CPU decode path as long as no backend is registered.
+class JpegDecodeBackendRegistry {
+ public:
+  static JpegDecodeBackendRegistry &GetInstance();
+
+  /// \brief Register the hardware backend, replacing any earlier one.
+  void Register(const std::shared_ptr<JpegDecodeBackend> &backend);
+
+  /// \brief Fetch the registered backend, nullptr when none is registered.
+  std::shared_ptr<JpegDecodeBackend> Get() const;
+
+ private:
+  JpegDecodeBackendRegistry() = default;
+  ~JpegDecodeBackendRegistry() = default;
+
+  std::shared_ptr<JpegDecodeBackend> backend_;
+  mutable std::mutex mutex_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_JPEG_DECODE_BACKEND_H_
@@ -32,6 +32,37 @@ NormalizeOp::NormalizeOp(const std::vector<float> &mean, const std::vector<float
 
 Status NormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
+#ifndef ENABLE_ANDROID
+  // The caller presets *output with the input tensor to request the in-place path (see SupportsInplace
+  // and CpuMapJob); a float32 image is normalized through its own buffer without a new allocation.
+  if (*output == input && input->type() == DataType(DataType::DE_FLOAT32) && input->Rank() == kDefaultImageRank) {
+    dsize_t channels = is_hwc_ ? input->shape()[kChannelIndexHWC] : input->shape()[kChannelIndexCHW];
+    std::vector<float> mean = mean_;
+    std::vector<float> std = std_;
+    if (mean.size() == 1 && channels > 1) {
+      mean.resize(static_cast<size_t>(channels), mean[0]);
+      std.resize(static_cast<size_t>(channels), std[0]);
+    }
+    if (static_cast<dsize_t>(mean.size()) == channels) {
+      auto *data = reinterpret_cast<float *>(input->GetMutableBuffer());
+      RETURN_UNEXPECTED_IF_NULL(data);
+      dsize_t num_elements = input->Size();
+      if (is_hwc_) {
+        for (dsize_t i = 0; i < num_elements; i++) {
+          data[i] = (data[i] - mean[static_cast<size_t>(i % channels)]) / std[static_cast<size_t>(i % channels)];
+        }
+      } else {
+        dsize_t plane_size = num_elements / channels;
+        for (dsize_t i = 0; i < num_elements; i++) {
+          data[i] = (data[i] - mean[static_cast<size_t>(i / plane_size)]) / std[static_cast<size_t>(i / plane_size)];
+        }
+      }
+      return Status::OK();
+    }
+    // The mean/std vectors do not match the channels; let the standard path produce the proper error.
+    output->reset();
+  }
+#endif
   // Doing the Normalization
 #ifndef ENABLE_ANDROID
   return Normalize(input, output, mean_, std_, is_hwc_);
@@ -36,6 +36,10 @@ class NormalizeOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // Normalization is elementwise and a float32 image stays float32, so the result can be written
+  // through the input buffer when the caller owns it exclusively.
+  bool SupportsInplace() override { return true; }
+
   std::string Name() const override { return kNormalizeOp; }
 
  private:
@@ -257,6 +257,13 @@ class TensorOp {
   // @return true/false
   bool OneToOne() { return NumInput() == 1 && NumOutput() == 1; }
 
+  // Returns true if this op can write its result through the input tensor's buffer. The caller presets
+  // *output with the input tensor to request it, and only does so when it exclusively owns the tensor,
+  // e.g. for the intermediate rows of a map op chain. Only elementwise one-to-one ops whose output has
+  // the same shape and type as the input should advertise this.
+  // @return true/false
+  virtual bool SupportsInplace() { return false; }
+
   // Returns true oif the TensorOp produces deterministic result.
   // @return true/false
   bool Deterministic() { return is_deterministic_; }
@@ -29,8 +29,12 @@ Status LookupOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
 
   std::vector<WordIdType> word_ids;
   word_ids.reserve(input->Size());
+  // Reuse one scratch string for the vocab probes so that the per-token heap allocation is paid only
+  // when a token is longer than every token seen before.
+  std::string word;
   for (auto itr = input->begin<std::string_view>(); itr != input->end<std::string_view>(); ++itr) {
-    WordIdType word_id = vocab_->TokensToIds(std::string(*itr));
+    word.assign(itr->data(), itr->size());
+    WordIdType word_id = vocab_->TokensToIds(word);
     word_ids.emplace_back(word_id == Vocab::kNoTokenExists ? default_id_ : word_id);
     CHECK_FAIL_RETURN_UNEXPECTED(word_ids.back() != Vocab::kNoTokenExists,
                                  "Lookup: invalid data, token: \"" + std::string(*itr) +
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #include "minddata/dataset/text/kernels/whitespace_tokenizer_op.h"
+#include <cstdint>
+#include <cstring>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -27,8 +29,65 @@ using cppjieba::RuneStrArray;
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Scan the string a machine word at a time, any byte with the high bit set means non-ASCII content.
+bool IsAllAscii(std::string_view str) {
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  uint64_t chunk = 0;
+  size_t i = 0;
+  for (; i + sizeof(chunk) <= str.size(); i += sizeof(chunk)) {
+    std::memcpy(&chunk, str.data() + i, sizeof(chunk));
+    if ((chunk & kHighBits) != 0) {
+      return false;
+    }
+  }
+  for (; i < str.size(); i++) {
+    if ((static_cast<unsigned char>(str[i]) & 0x80) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// For ASCII characters the unicode white space property degenerates to space and '\t' ~ '\r'.
+inline bool IsAsciiWhiteSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+}  // namespace
+
 Status WhitespaceTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
                                        std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+  // Fast path for pure ASCII text: each byte is a rune, so the utf8 decoding can be skipped and the
+  // whitespace classification is done directly on the bytes.
+  if (IsAllAscii(str)) {
+    size_t start = 0;
+    size_t len = 0;
+    for (size_t i = 0; i < str.size(); i++) {
+      if (IsAsciiWhiteSpace(str[i])) {
+        if (len > 0) {
+          offsets_start->push_back(static_cast<uint32_t>(start));
+          offsets_limit->push_back(static_cast<uint32_t>(start + len));
+          (void)splits->emplace_back(str.substr(start, len));
+          len = 0;
+        }
+      } else {
+        if (len == 0) {
+          start = i;
+        }
+        len++;
+      }
+    }
+    if (len > 0) {
+      offsets_start->push_back(static_cast<uint32_t>(start));
+      offsets_limit->push_back(static_cast<uint32_t>(start + len));
+      (void)splits->emplace_back(str.substr(start, len));
+    }
+    if (splits->empty()) {
+      (void)splits->emplace_back("");
+      offsets_start->push_back(0);
+      offsets_limit->push_back(0);
+    }
+    return Status::OK();
+  }
+
   RuneStrArray runes;
   if (!DecodeRunesInString(str.data(), str.size(), runes)) {
     RETURN_STATUS_UNEXPECTED("WhitespaceTokenizer: Decode utf8 string failed.");
@@ -36,7 +36,9 @@ WordIdType Vocab::TokensToIds(const WordType &word) const {
 
 std::vector<WordIdType> Vocab::TokensToIds(const std::vector<WordType> &words) const {
   std::vector<WordIdType> ids;
-  (void)std::transform(words.begin(), words.end(), std::back_inserter(ids), [this](auto w) { return TokensToIds(w); });
+  ids.reserve(words.size());
+  (void)std::transform(words.begin(), words.end(), std::back_inserter(ids),
+                       [this](const auto &w) { return TokensToIds(w); });
   return ids;
 }
 
@@ -117,6 +117,33 @@ class Queue {
     return rc;
   }
 
+  // Producer
+  // Add a batch of elements with a single lock acquisition and a single wakeup, instead of paying the
+  // lock and condvar cost once per element. Blocks while the queue is full. The batch is consumed (moved
+  // out and cleared) on success.
+  Status AddBatch(std::vector<T> *elements) noexcept {
+    if (elements == nullptr || elements->empty()) {
+      return Status::OK();
+    }
+    std::unique_lock<std::mutex> _lock(mux_);
+    for (auto &ele : *elements) {
+      if (size() == capacity()) {
+        // Wake the consumers to drain the elements added so far before waiting for space.
+        empty_cv_.NotifyAll();
+        Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
+        if (rc.IsError()) {
+          empty_cv_.Interrupt();
+          return rc;
+        }
+      }
+      RETURN_IF_NOT_OK(AddWhileHoldingLock(std::move(ele)));
+    }
+    empty_cv_.NotifyAll();
+    _lock.unlock();
+    elements->clear();
+    return Status::OK();
+  }
+
   // Consumer
   Status PopFront(pointer p) {
     std::unique_lock<std::mutex> _lock(mux_);
@@ -83,6 +83,9 @@ class __attribute__((visibility("default"))) ShardColumn {
   /// \brief getter
   std::vector<std::string> GetColumnName() { return column_name_; }
 
+  /// \brief getter
+  std::vector<std::string> GetBlobColumnName() { return blob_column_; }
+
   /// \brief getter
   std::vector<ColumnDataType> GeColumnDataType() { return column_data_type_; }
 
@@ -26,6 +26,7 @@
 #include <utility>
 #include <vector>
 #include "minddata/mindrecord/include/shard_header.h"
+#include "minddata/mindrecord/include/shard_offset_index.h"
 #include "./sqlite3.h"
 
 namespace mindspore {
@@ -105,6 +106,10 @@ class __attribute__((visibility("default"))) ShardIndexGenerator {
   Status AddIndexFieldByRawData(const std::vector<json> &schema_detail,
                                 std::vector<std::tuple<std::string, std::string, std::string>> &row_data);
 
+  /// \brief collect the blob offset triples of the generated rows for the binary offset index
+  static Status CollectRowOffsets(const ROW_DATA &row_data,
+                                  std::vector<std::pair<uint64_t, ShardOffsetIndex::RowOffset>> *row_offsets);
+
   void DatabaseWriter();  // worker thread
 
   std::string file_path_;
@@ -0,0 +1,78 @@
+/**
+ * Copyright 2023 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_OFFSET_INDEX_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_OFFSET_INDEX_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+/// \brief A compact binary row offset index written once by ShardIndexGenerator beside the SQLite meta file.
+///
+/// ShardReader memory maps the index and resolves the blob offsets of all rows with pure pointer arithmetic, so the
+/// common read path does not pay the SQLite query cost at dataset open. The SQLite meta file is still the source of
+/// truth for the category and criteria queries.
+///
+/// File layout (little endian, fixed width):
+///   char[4]  magic "MRIX"
+///   uint32   version
+///   uint64   row count
+///   row count * RowOffset
+class __attribute__((visibility("default"))) ShardOffsetIndex {
+ public:
+  struct RowOffset {
+    uint64_t row_group_id;
+    uint64_t page_offset_blob;
+    uint64_t page_offset_blob_end;
+  };
+
+  ShardOffsetIndex() = default;
+  ~ShardOffsetIndex();
+
+  /// \brief get the offset index file path of one mindrecord shard file
+  static std::string GetIndexFilePath(const std::string &shard_file_path);
+
+  /// \brief write the offset index file of one shard, the rows are in ROW_ID order
+  static Status Write(const std::string &shard_file_path, const std::vector<RowOffset> &rows);
+
+  /// \brief memory map the offset index file of one shard, return error if it does not exist or is invalid
+  Status Open(const std::string &shard_file_path);
+
+  /// \brief release the mapping
+  void Close();
+
+  bool IsOpen() const { return rows_ != nullptr; }
+
+  uint64_t GetRowCount() const { return row_count_; }
+
+  /// \brief the row offsets in ROW_ID order, points into the mapping and is valid until Close
+  const RowOffset *GetRowOffsets() const { return rows_; }
+
+ private:
+  void *mapping_{nullptr};
+  uint64_t mapping_size_{0};
+  const RowOffset *rows_{nullptr};
+  uint64_t row_count_{0};
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_OFFSET_INDEX_H_
@@ -49,6 +49,7 @@
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
+#include "minddata/mindrecord/include/shard_offset_index.h"
 #include "minddata/mindrecord/include/shard_operator.h"
 #include "minddata/mindrecord/include/shard_pk_sample.h"
 #include "minddata/mindrecord/include/shard_reader.h"
@@ -231,6 +232,11 @@ class API_PUBLIC ShardReader {
                             std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                             std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr);
 
+  /// \brief resolve the blob offsets of all rows from the binary offset index without SQLite, return false when any
+  ///        shard has no valid offset index so the caller can fall back to the SQLite path
+  bool TryReadAllRowGroupByOffsetIndex(std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
+                                       std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr);
+
   /// \brief initialize reader
   Status Init(const std::vector<std::string> &file_paths, bool load_dataset);
 
@@ -286,6 +292,10 @@ class API_PUBLIC ShardReader {
   /// \brief read one row by one task
   Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_CONTENT> *task_content_pt);
 
+  /// \brief read the raw blob of one row, load only the byte ranges of the selected blob columns from disk
+  Status ReadBlob(const uint32_t &consumer_id, const uint32_t &shard_id, const uint64_t &file_offset,
+                  const uint64_t &blob_size, std::vector<uint8_t> *blob_ptr);
+
   /// \brief get labels from binary file
   Status GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
                                  const std::vector<std::vector<std::string>> &label_offsets,
@@ -15,6 +15,9 @@
  */
 #include "minddata/mindrecord/include/shard_index_generator.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "utils/file_utils.h"
 #include "utils/ms_utils.h"
 
@@ -392,6 +395,29 @@ Status ShardIndexGenerator::AddBlobPageInfo(std::vector<std::tuple<std::string,
   return Status::OK();
 }
 
+Status ShardIndexGenerator::CollectRowOffsets(
+  const ROW_DATA &row_data, std::vector<std::pair<uint64_t, ShardOffsetIndex::RowOffset>> *row_offsets) {
+  RETURN_UNEXPECTED_IF_NULL_MR(row_offsets);
+  for (const auto &row : row_data) {
+    uint64_t row_id = 0;
+    ShardOffsetIndex::RowOffset offset{};
+    for (const auto &field : row) {
+      const auto &name = std::get<0>(field);
+      if (name == ":ROW_ID") {
+        row_id = std::stoull(std::get<2>(field));
+      } else if (name == ":ROW_GROUP_ID") {
+        offset.row_group_id = std::stoull(std::get<2>(field));
+      } else if (name == ":PAGE_OFFSET_BLOB") {
+        offset.page_offset_blob = std::stoull(std::get<2>(field));
+      } else if (name == ":PAGE_OFFSET_BLOB_END") {
+        offset.page_offset_blob_end = std::stoull(std::get<2>(field));
+      }
+    }
+    (void)row_offsets->emplace_back(row_id, offset);
+  }
+  return Status::OK();
+}
+
 Status ShardIndexGenerator::AddIndexFieldByRawData(
   const std::vector<json> &schema_detail, std::vector<std::tuple<std::string, std::string, std::string>> &row_data) {
   auto index_fields_ptr = std::make_shared<INDEX_FIELDS>();
@@ -512,6 +538,7 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
       shard_address);
   }
   (void)sqlite3_exec(db, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr);
+  std::vector<std::pair<uint64_t, ShardOffsetIndex::RowOffset>> row_offsets;
   for (int raw_page_id : raw_page_ids) {
     std::shared_ptr<std::string> sql_ptr;
     RELEASE_AND_RETURN_IF_NOT_OK_MR(GenerateRawSQL(fields_, &sql_ptr), db, in);
@@ -519,11 +546,22 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
     RELEASE_AND_RETURN_IF_NOT_OK_MR(GenerateRowData(shard_no, blob_id_to_page_id, raw_page_id, in, &row_data_ptr), db,
                                     in);
     RELEASE_AND_RETURN_IF_NOT_OK_MR(BindParameterExecuteSQL(db, *sql_ptr, *row_data_ptr), db, in);
+    RELEASE_AND_RETURN_IF_NOT_OK_MR(CollectRowOffsets(*row_data_ptr, &row_offsets), db, in);
     MS_LOG(INFO) << "Insert " << row_data_ptr->size() << " rows to index db.";
   }
   (void)sqlite3_exec(db, "END TRANSACTION;", nullptr, nullptr, nullptr);
   in.close();
 
+  // Write the binary offset index beside the SQLite meta file in ROW_ID order, so ShardReader can resolve the blob
+  // offsets without touching SQLite at dataset open.
+  std::sort(row_offsets.begin(), row_offsets.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+  std::vector<ShardOffsetIndex::RowOffset> sorted_offsets;
+  sorted_offsets.reserve(row_offsets.size());
+  (void)std::transform(row_offsets.begin(), row_offsets.end(), std::back_inserter(sorted_offsets),
+                       [](const auto &row) { return row.second; });
+  RETURN_IF_NOT_OK_MR(ShardOffsetIndex::Write(shard_address, sorted_offsets));
+
   // Close database
   sqlite3_close(db);
   db = nullptr;
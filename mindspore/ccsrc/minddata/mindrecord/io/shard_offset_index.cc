@@ -0,0 +1,138 @@
+/**
+ * Copyright 2023 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_offset_index.h"
+
+#include <cstring>
+#include <fstream>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "utils/file_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+constexpr char kOffsetIndexMagic[] = "MRIX";
+constexpr uint32_t kOffsetIndexMagicLen = 4;
+constexpr uint32_t kOffsetIndexVersion = 1;
+constexpr uint64_t kOffsetIndexHeaderLen = kOffsetIndexMagicLen + sizeof(uint32_t) + sizeof(uint64_t);
+}  // namespace
+
+ShardOffsetIndex::~ShardOffsetIndex() { Close(); }
+
+std::string ShardOffsetIndex::GetIndexFilePath(const std::string &shard_file_path) {
+  return shard_file_path + ".offsets";
+}
+
+Status ShardOffsetIndex::Write(const std::string &shard_file_path, const std::vector<RowOffset> &rows) {
+  auto index_file = GetIndexFilePath(shard_file_path);
+  std::ofstream out(index_file, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(out.good(),
+                                  "Invalid file, failed to open the offset index file for writing. Please check file "
+                                  "path and permission: " +
+                                    index_file);
+  uint32_t version = kOffsetIndexVersion;
+  uint64_t row_count = rows.size();
+  (void)out.write(kOffsetIndexMagic, kOffsetIndexMagicLen);
+  (void)out.write(reinterpret_cast<const char *>(&version), sizeof(version));
+  (void)out.write(reinterpret_cast<const char *>(&row_count), sizeof(row_count));
+  if (!rows.empty()) {
+    (void)out.write(reinterpret_cast<const char *>(rows.data()), rows.size() * sizeof(RowOffset));
+  }
+  out.close();
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(!out.fail(), "[Internal ERROR] Failed to write the offset index file: " + index_file);
+  return Status::OK();
+}
+
+Status ShardOffsetIndex::Open(const std::string &shard_file_path) {
+  Close();
+  auto index_file = GetIndexFilePath(shard_file_path);
+  auto realpath = FileUtils::GetRealPath(index_file.c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(realpath.has_value(), "The offset index file does not exist: " + index_file);
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(realpath.value().c_str(), O_RDONLY);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fd >= 0, "Invalid file, failed to open the offset index file: " + index_file);
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < kOffsetIndexHeaderLen) {
+    (void)close(fd);
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, the offset index file is truncated: " + index_file);
+  }
+  mapping_size_ = static_cast<uint64_t>(st.st_size);
+  void *addr = mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (addr == MAP_FAILED) {
+    mapping_size_ = 0;
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to mmap the offset index file: " + index_file);
+  }
+  mapping_ = addr;
+#else
+  // No mmap on windows, load the whole index into one buffer which keeps the pointer arithmetic read path.
+  std::ifstream in(realpath.value(), std::ios::in | std::ios::binary | std::ios::ate);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(in.good(), "Invalid file, failed to open the offset index file: " + index_file);
+  auto file_size = static_cast<uint64_t>(in.tellg());
+  if (file_size < kOffsetIndexHeaderLen) {
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, the offset index file is truncated: " + index_file);
+  }
+  mapping_size_ = file_size;
+  mapping_ = new (std::nothrow) char[mapping_size_];
+  if (mapping_ == nullptr) {
+    mapping_size_ = 0;
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to alloc buffer for the offset index file: " + index_file);
+  }
+  (void)in.seekg(0, std::ios::beg);
+  (void)in.read(reinterpret_cast<char *>(mapping_), mapping_size_);
+  if (in.fail()) {
+    Close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read the offset index file: " + index_file);
+  }
+#endif
+  const auto *base = reinterpret_cast<const char *>(mapping_);
+  uint32_t version = 0;
+  uint64_t row_count = 0;
+  (void)memcpy(&version, base + kOffsetIndexMagicLen, sizeof(version));
+  (void)memcpy(&row_count, base + kOffsetIndexMagicLen + sizeof(version), sizeof(row_count));
+  if (memcmp(base, kOffsetIndexMagic, kOffsetIndexMagicLen) != 0 || version != kOffsetIndexVersion ||
+      mapping_size_ < kOffsetIndexHeaderLen + row_count * sizeof(RowOffset)) {
+    Close();
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, the offset index file is corrupted or incompatible: " + index_file);
+  }
+  row_count_ = row_count;
+  rows_ = reinterpret_cast<const RowOffset *>(base + kOffsetIndexHeaderLen);
+  return Status::OK();
+}
+
+void ShardOffsetIndex::Close() {
+  if (mapping_ != nullptr) {
+#if !defined(_WIN32) && !defined(_WIN64)
+    (void)munmap(mapping_, mapping_size_);
+#else
+    delete[] reinterpret_cast<char *>(mapping_);
+#endif
+    mapping_ = nullptr;
+  }
+  mapping_size_ = 0;
+  rows_ = nullptr;
+  row_count_ = 0;
+}
+}  // namespace mindrecord
+}  // namespace mindspore
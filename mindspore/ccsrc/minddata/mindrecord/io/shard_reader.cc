@@ -460,6 +460,34 @@ Status ShardReader::ConvertJsonValue(const std::vector<std::string> &label, cons
   }
   return Status::OK();
 }
+bool ShardReader::TryReadAllRowGroupByOffsetIndex(
+  std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
+  std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
+  for (int shard_id = 0; shard_id < shard_count_; ++shard_id) {
+    ShardOffsetIndex offset_index;
+    if (offset_index.Open(file_paths_[shard_id]).IsError()) {
+      for (int x = 0; x <= shard_id; ++x) {
+        (*offset_ptr)[x].clear();
+        (*col_val_ptr)[x].clear();
+      }
+      return false;
+    }
+    auto row_count = offset_index.GetRowCount();
+    const auto *rows = offset_index.GetRowOffsets();
+    (*offset_ptr)[shard_id].reserve(row_count);
+    (*col_val_ptr)[shard_id].resize(row_count, json{});
+    for (uint64_t i = 0; i < row_count; ++i) {
+      (*offset_ptr)[shard_id].emplace_back(std::vector<uint64_t>{static_cast<uint64_t>(shard_id),
+                                                                 rows[i].row_group_id,
+                                                                 rows[i].page_offset_blob + kInt64Len,
+                                                                 rows[i].page_offset_blob_end});
+    }
+    MS_LOG(INFO) << "Succeed to get " << row_count << " records from shard " << std::to_string(shard_id)
+                 << " offset index.";
+  }
+  return true;
+}
+
 Status ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
                                        std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                                        std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
@@ -560,6 +588,14 @@ Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
     shard_count_, std::vector<std::vector<uint64_t>>{});
   auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
 
+  // When no label column is requested, all row information is the blob offset triple which the binary offset index
+  // provides with pure pointer arithmetic, so the SQLite query can be skipped entirely at dataset open. Fall through
+  // to the SQLite path when the offset index is missing, e.g. for datasets written by old versions.
+  if (all_in_index_ && columns.empty() && TryReadAllRowGroupByOffsetIndex(offset_ptr, col_val_ptr)) {
+    *row_group_ptr = std::make_shared<ROW_GROUPS>(std::move(*offset_ptr), std::move(*col_val_ptr));
+    return Status::OK();
+  }
+
   if (all_in_index_) {
     for (unsigned int i = 0; i < columns.size(); ++i) {
       fields += ',';
@@ -1314,9 +1350,9 @@ Status ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, uint
     RETURN_IF_NOT_OK_MR((*op)(tasks_));
   }
 
-  if (tasks_.permutation_.empty()) {
-    tasks_.MakePerm();
-  }
+  // The identity permutation is no longer materialized here: the sampling operators build
+  // permutation_ on demand and the readers below only consume sample_ids_. For billions of
+  // samples the standing identity vector costs 8 bytes per sample for nothing.
   num_rows_ = tasks_.Size();
   MS_LOG(INFO) << "The total number of samples is " << num_rows_
                << ", the number of samples after sampling is: " << tasks_.sample_ids_.size();
@@ -1376,26 +1412,89 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
   MS_LOG(DEBUG) << "[Internal ERROR] Success to get page by group id: " << group_id;
 
   // Pack image list
-  std::vector<uint8_t> images(blob_end - blob_start);
+  std::vector<uint8_t> images;
   auto file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  RETURN_IF_NOT_OK_MR(ReadBlob(consumer_id, shard_id, file_offset, blob_end - blob_start, &images));
 
-  auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
+  // Deliver batch data to output map
+  std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
+  batch.emplace_back(std::move(images), std::move(var_fields));
+
+  *task_content_ptr = std::make_shared<TASK_CONTENT>(TaskType::kCommonTask, std::move(batch));
+  return Status::OK();
+}
+
+Status ShardReader::ReadBlob(const uint32_t &consumer_id, const uint32_t &shard_id, const uint64_t &file_offset,
+                             const uint64_t &blob_size, std::vector<uint8_t> *blob_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(blob_ptr);
+  auto &file_stream = file_streams_random_[consumer_id][shard_id];
+  auto &io_seekg = file_stream->seekg(file_offset, std::ios::beg);
   if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
+    file_stream->close();
     RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
   }
-  auto &io_read =
-    file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_end - blob_start);
-  if (!io_read.good() || io_read.fail() || io_read.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+
+  // Check whether the data of some blob columns can be skipped: the blob needs to contain multiple columns and the
+  // dataset needs to select a subset of them. The columns of a multi-column blob are laid out as length-prefixed
+  // blocks, so the unselected ones can be skipped without reading their data from disk.
+  auto num_blob_column = shard_column_->GetNumBlobColumn();
+  std::vector<bool> column_selected(num_blob_column, true);
+  bool skip_column = false;
+  if (num_blob_column > 1 && !selected_columns_.empty()) {
+    const auto blob_column_names = shard_column_->GetBlobColumnName();
+    for (uint64_t i = 0; i < num_blob_column; ++i) {
+      column_selected[i] = std::find(selected_columns_.begin(), selected_columns_.end(), blob_column_names[i]) !=
+                           selected_columns_.end();
+      skip_column = skip_column || !column_selected[i];
+    }
   }
 
-  // Deliver batch data to output map
-  std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
-  batch.emplace_back(std::move(images), std::move(var_fields));
+  if (!skip_column) {
+    // Read the whole blob of the row.
+    blob_ptr->resize(blob_size);
+    auto &io_read = file_stream->read(reinterpret_cast<char *>(blob_ptr->data()), blob_size);
+    if (!io_read.good() || io_read.fail() || io_read.bad()) {
+      file_stream->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+    }
+    return Status::OK();
+  }
 
-  *task_content_ptr = std::make_shared<TASK_CONTENT>(TaskType::kCommonTask, std::move(batch));
+  // Read only the byte ranges of the selected blob columns. The data of a skipped column is replaced by an empty
+  // length-prefixed block, which keeps the column address calculation of ShardColumn consistent.
+  blob_ptr->clear();
+  blob_ptr->reserve(blob_size);
+  for (uint64_t i = 0; i < num_blob_column; ++i) {
+    std::vector<uint8_t> size_bytes(kInt64Len);
+    auto &io_read_size = file_stream->read(reinterpret_cast<char *>(size_bytes.data()), kInt64Len);
+    if (!io_read_size.good() || io_read_size.fail() || io_read_size.bad()) {
+      file_stream->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+    }
+    // The column size is stored as big-endian bytes.
+    uint64_t column_size = 0;
+    for (uint64_t j = 0; j < kInt64Len; ++j) {
+      column_size = (column_size << kBitsOfByte) + size_bytes[j];
+    }
+
+    if (column_selected[i]) {
+      (void)blob_ptr->insert(blob_ptr->end(), size_bytes.begin(), size_bytes.end());
+      auto data_begin = blob_ptr->size();
+      blob_ptr->resize(data_begin + column_size);
+      auto &io_read = file_stream->read(reinterpret_cast<char *>(blob_ptr->data() + data_begin), column_size);
+      if (!io_read.good() || io_read.fail() || io_read.bad()) {
+        file_stream->close();
+        RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+      }
+    } else {
+      (void)blob_ptr->insert(blob_ptr->end(), kInt64Len, 0);
+      auto &io_seekg_skip = file_stream->seekg(static_cast<std::streamoff>(column_size), std::ios::cur);
+      if (!io_seekg_skip.good() || io_seekg_skip.fail() || io_seekg_skip.bad()) {
+        file_stream->close();
+        RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+      }
+    }
+  }
   return Status::OK();
 }
 
@@ -1532,9 +1631,6 @@ void ShardReader::ShuffleTask() {
       }
     }
   }
-  if (tasks_.permutation_.empty()) {
-    tasks_.MakePerm();
-  }
 }
 
 const std::vector<int64_t> *ShardReader::GetSampleIds() {
@@ -979,22 +979,29 @@ Status ShardWriter::FlushBlobChunk(const std::shared_ptr<std::fstream> &out,
     blob_row.first <= blob_row.second && blob_row.second <= static_cast<int>(blob_data.size()) && blob_row.first >= 0,
     "[Internal ERROR] 'blob_row': " + std::to_string(blob_row.first) + ", " + std::to_string(blob_row.second) +
       " is invalid.");
+  // Pack the chunk into one buffer so each chunk costs a single large write instead of two small
+  // writes per row, which dominates the flush time on high throughput storage.
+  size_t chunk_size = 0;
   for (int j = blob_row.first; j < blob_row.second; ++j) {
-    // Write the size of blob
+    chunk_size += kInt64Len + blob_data[j].size();
+  }
+  std::vector<char> chunk;
+  chunk.reserve(chunk_size);
+  for (int j = blob_row.first; j < blob_row.second; ++j) {
+    // Pack the size of blob
     uint64_t line_len = blob_data[j].size();
-    auto &io_handle = out->write(reinterpret_cast<char *>(&line_len), kInt64Len);
-    if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
-      out->close();
-      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
-    }
+    auto len_ptr = reinterpret_cast<const char *>(&line_len);
+    (void)chunk.insert(chunk.end(), len_ptr, len_ptr + kInt64Len);
 
-    // Write the data of blob
-    auto line = blob_data[j];
-    auto &io_handle_data = out->write(reinterpret_cast<char *>(&line[0]), line_len);
-    if (!io_handle_data.good() || io_handle_data.fail() || io_handle_data.bad()) {
-      out->close();
-      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
-    }
+    // Pack the data of blob
+    const auto &line = blob_data[j];
+    auto data_ptr = reinterpret_cast<const char *>(line.data());
+    (void)chunk.insert(chunk.end(), data_ptr, data_ptr + line.size());
+  }
+  auto &io_handle = out->write(chunk.data(), chunk.size());
+  if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
+    out->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
   }
   return Status::OK();
 }
@@ -1002,26 +1009,34 @@ Status ShardWriter::FlushBlobChunk(const std::shared_ptr<std::fstream> &out,
 Status ShardWriter::FlushRawChunk(const std::shared_ptr<std::fstream> &out,
                                   const std::vector<std::pair<int, int>> &rows_in_group, const int &chunk_id,
                                   const std::vector<std::vector<uint8_t>> &bin_raw_data) {
+  // Pack the chunk into one buffer so each chunk costs a single large write, as FlushBlobChunk does.
+  size_t chunk_size = 0;
+  for (int i = rows_in_group[chunk_id].first; i < rows_in_group[chunk_id].second; i++) {
+    for (uint32_t j = 0; j < schema_count_; ++j) {
+      chunk_size += kInt64Len + bin_raw_data[i * schema_count_ + j].size();
+    }
+  }
+  std::vector<char> chunk;
+  chunk.reserve(chunk_size);
   for (int i = rows_in_group[chunk_id].first; i < rows_in_group[chunk_id].second; i++) {
-    // Write the size of multi schemas
+    // Pack the size of multi schemas
     for (uint32_t j = 0; j < schema_count_; ++j) {
       uint64_t line_len = bin_raw_data[i * schema_count_ + j].size();
-      auto &io_handle = out->write(reinterpret_cast<char *>(&line_len), kInt64Len);
-      if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
-        out->close();
-        RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
-      }
+      auto len_ptr = reinterpret_cast<const char *>(&line_len);
+      (void)chunk.insert(chunk.end(), len_ptr, len_ptr + kInt64Len);
     }
-    // Write the data of multi schemas
+    // Pack the data of multi schemas
     for (uint32_t j = 0; j < schema_count_; ++j) {
-      auto line = bin_raw_data[i * schema_count_ + j];
-      auto &io_handle = out->write(reinterpret_cast<char *>(&line[0]), line.size());
-      if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
-        out->close();
-        RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
-      }
+      const auto &line = bin_raw_data[i * schema_count_ + j];
+      auto data_ptr = reinterpret_cast<const char *>(line.data());
+      (void)chunk.insert(chunk.end(), data_ptr, data_ptr + line.size());
     }
   }
+  auto &io_handle = out->write(chunk.data(), chunk.size());
+  if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
+    out->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
+  }
   return Status::OK();
 }
 
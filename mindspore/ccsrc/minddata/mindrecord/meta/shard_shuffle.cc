@@ -17,6 +17,7 @@
 #include "minddata/mindrecord/include/shard_shuffle.h"
 
 #include <algorithm>
+#include <random>
 
 namespace mindspore {
 namespace mindrecord {
@@ -164,9 +165,6 @@ Status ShardShuffle::Execute(ShardTaskList &tasks) {
                                   "[Internal ERROR] task categories should be greater than or equal to 1 but got: " +
                                     std::to_string(tasks.categories));
   if (shuffle_type_ == kShuffleSample) {  // shuffle each sample
-    if (tasks.permutation_.empty() == true) {
-      tasks.MakePerm();
-    }
     if (GetShuffleMode() == dataset::ShuffleMode::kGlobal) {
       if (replacement_ == true) {
         ShardTaskList new_tasks;
@@ -182,19 +180,33 @@ Status ShardShuffle::Execute(ShardTaskList &tasks) {
 
         ShardTaskList::TaskListSwap(tasks, new_tasks);
       } else {
-        std::shuffle(tasks.permutation_.begin(), tasks.permutation_.end(), std::default_random_engine(shuffle_seed_));
-        auto total_no = tasks.Size();
-        ShardTaskList new_tasks;
+        // Shuffle the sample ids directly with a partial Fisher-Yates instead of materializing an
+        // identity permutation, shuffling all of it and copying the prefix into a third vector
+        // through AssignTask. Only one id vector is alive besides the source, and a truncated
+        // shuffle (no_of_samples_ < total) only visits the ids which are kept.
+        int64_t total_no = static_cast<int64_t>(tasks.sample_ids_.size());
         int64_t samples_to_assign =
-          (no_of_samples_ > 0 && no_of_samples_ < total_no) ? no_of_samples_ : tasks.sample_ids_.size();
+          (no_of_samples_ > 0 && no_of_samples_ < total_no) ? no_of_samples_ : total_no;
+        ShardTaskList new_tasks;
+        new_tasks.sample_ids_ = tasks.sample_ids_;
+        auto &new_ids = new_tasks.sample_ids_;
+        std::default_random_engine engine(shuffle_seed_);
         for (int64_t i = 0; i < samples_to_assign; ++i) {
-          new_tasks.AssignTask(tasks, tasks.permutation_[i]);
+          std::uniform_int_distribution<int64_t> dis(i, total_no - 1);
+          std::swap(new_ids[i], new_ids[dis(engine)]);
         }
+        new_ids.resize(samples_to_assign);
         ShardTaskList::TaskListSwap(tasks, new_tasks);
       }
     } else if (GetShuffleMode() == dataset::ShuffleMode::kInfile) {
+      if (tasks.permutation_.empty() == true) {
+        tasks.MakePerm();
+      }
       RETURN_IF_NOT_OK_MR(ShuffleInfile(tasks));
     } else if (GetShuffleMode() == dataset::ShuffleMode::kFiles) {
+      if (tasks.permutation_.empty() == true) {
+        tasks.MakePerm();
+      }
       RETURN_IF_NOT_OK_MR(ShuffleFiles(tasks));
     }
   } else {  // shuffle unit like: (a1, b1, c1),(a2, b2, c2),..., (an, bn, cn)
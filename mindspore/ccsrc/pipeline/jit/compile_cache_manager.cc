@@ -26,6 +26,7 @@
 #include "include/common/debug/anf_ir_dump.h"
 #include "include/common/debug/dump_proto.h"
 #include "utils/system/sha256.h"
+#include "include/common/thread_pool.h"
 #include "include/common/utils/utils.h"
 #include "frontend/parallel/step_parallel.h"
 #include "mindspore/core/utils/file_utils.h"
@@ -115,9 +116,28 @@ std::string GetCompileDepFilesHash(const py::list &dep_files) {
     (void)dep_files_path.emplace_back(file_path);
   }
   std::sort(dep_files_path.begin(), dep_files_path.end());
+  // Hash the dependency files in parallel: this gate runs on every compilation with the cache enabled,
+  // and reading and hashing the files one by one dominates it for large projects.
+  std::vector<std::string> file_hashes(dep_files_path.size());
+  size_t thread_num = common::ThreadPool::GetInstance().GetSyncRunThreadNum();
+  if (dep_files_path.size() > 1 && thread_num > 1) {
+    std::vector<common::Task> tasks;
+    tasks.reserve(dep_files_path.size());
+    for (size_t i = 0; i < dep_files_path.size(); ++i) {
+      auto task = [&file_hashes, &dep_files_path, i]() {
+        file_hashes[i] = system::sha256::GetHashFromFile(dep_files_path[i]);
+        return file_hashes[i].empty() ? common::FAIL : common::SUCCESS;
+      };
+      (void)tasks.emplace_back(task);
+    }
+    (void)common::ThreadPool::GetInstance().SyncRun(tasks);
+  } else {
+    for (size_t i = 0; i < dep_files_path.size(); ++i) {
+      file_hashes[i] = system::sha256::GetHashFromFile(dep_files_path[i]);
+    }
+  }
   std::string files_hash;
-  for (const auto &path : dep_files_path) {
-    std::string file_hash = system::sha256::GetHashFromFile(path);
+  for (const auto &file_hash : file_hashes) {
     files_hash += file_hash;
   }
   return files_hash;
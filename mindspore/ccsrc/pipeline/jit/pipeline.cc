@@ -584,6 +584,14 @@ void GraphExecutorPy::DelOneNetRes(const py::handle &py_phase) {
       (void)info_.erase(layout_graph);
     }
     (void)info_.erase(phase);
+    // Invalidate the compile result cache entries which map to the deleted phase.
+    for (auto cache_iter = compiled_phase_cache_.begin(); cache_iter != compiled_phase_cache_.end();) {
+      if (cache_iter->second == phase) {
+        cache_iter = compiled_phase_cache_.erase(cache_iter);
+      } else {
+        ++cache_iter;
+      }
+    }
     MS_LOG(DEBUG) << "Delete phase: " << phase << ", info size: " << info_.size();
   }
 }
@@ -887,6 +895,21 @@ bool GraphExecutorPy::CompileInner(const py::object &source_obj, const py::tuple
     }
     args_abs.push_back(ArgsToAbstract(converted, enable_tuple_broaden_));
   }
+  // Try to reuse the graph compiled before with the same source object and input abstract signature, so repeated
+  // compilations of one function or cell only pay parse/infer/optimize once.
+  const std::string compile_key = GenerateCompilePhaseKey(source_obj, phase, args_abs);
+  const auto &cache_iter = compiled_phase_cache_.find(compile_key);
+  if (cache_iter != compiled_phase_cache_.end()) {
+    const auto &compiled_info_iter = info_.find(cache_iter->second);
+    if (compiled_info_iter != info_.end() && compiled_info_iter->second->func_graph != nullptr) {
+      MS_LOG(INFO) << "Reuse the graph compiled by phase: " << cache_iter->second << " for phase: " << phase;
+      info_[phase] = compiled_info_iter->second;
+      return true;
+    }
+    // The phase which compiled the graph has been deleted.
+    (void)compiled_phase_cache_.erase(cache_iter);
+  }
+
   resource->set_args_abs(args_abs);
   executor_info->arg_list_size = size;
   executor_info->resource = resource;
@@ -904,10 +927,25 @@ bool GraphExecutorPy::CompileInner(const py::object &source_obj, const py::tuple
   ReclaimOptimizer();
   // Clean cache used while compile
   resource->Clean();
+  compiled_phase_cache_[compile_key] = phase;
   MS_LOG(INFO) << "Finish compiling.";
   return true;
 }
 
+std::string GraphExecutorPy::GenerateCompilePhaseKey(const py::object &source_obj, const std::string &phase,
+                                                     const abstract::AbstractBasePtrList &args_abs) const {
+  std::ostringstream buffer;
+  // Graphs can only be reused within one phase prefix, because the pipeline actions executed depend on the prefix.
+  // The hash of a function or cell is identity based, so the reused graph always shares its weight parameters with
+  // the compiled one.
+  buffer << GetPhasePrefix(phase) << "[" << py::hash(source_obj) << "]";
+  for (const auto &abs : args_abs) {
+    MS_EXCEPTION_IF_NULL(abs);
+    buffer << "_" << abs->ToString();
+  }
+  return buffer.str();
+}
+
 std::vector<ActionItem> GraphExecutorPy::FilterActions(const std::vector<ActionItem> &actions,
                                                        const std::string &phase) {
   // filter action after validate when 'export'.
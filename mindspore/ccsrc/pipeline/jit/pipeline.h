@@ -144,7 +144,16 @@ class GraphExecutorPy : public std::enable_shared_from_this<GraphExecutorPy> {
   // If enable compile cache, get the compile cache resource.
   void InitCompileCacheInfo(const ResourcePtr &resource, const std::string &phase);
 
+  // Generate the key of the in-process compile result cache from the source object and the abstracts of actual
+  // arguments. The pipeline actions depend on the phase prefix, so the prefix is part of the key as well.
+  std::string GenerateCompilePhaseKey(const py::object &source_obj, const std::string &phase,
+                                      const abstract::AbstractBasePtrList &args_abs) const;
+
   std::map<std::string, ExecutorInfoPtr> info_;
+  // The in-process compile result cache: map the key generated from the source object and the input abstract
+  // signature to the phase which already compiled the graph, so that repeated compilations of the same function or
+  // cell with an already-seen input signature reuse the compiled graph and skip parse/infer/optimize.
+  std::map<std::string, std::string> compiled_phase_cache_;
   static std::shared_ptr<GraphExecutorPy> executor_;
   static std::mutex instance_lock_;
   std::map<std::string, py::dict> stra_dict_;
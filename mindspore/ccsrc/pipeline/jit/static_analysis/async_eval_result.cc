@@ -25,6 +25,40 @@ namespace mindspore {
 namespace abstract {
 thread_local std::string AnalysisSchedule::thread_id_ = "m";
 
+void AnalysisSchedule::DispatchEvalTask(std::function<void()> &&task) {
+  bool fork_worker = false;
+  {
+    std::lock_guard<std::mutex> lock(eval_task_lock_);
+    (void)eval_task_list_.emplace_back(std::move(task));
+    // Fork a new worker only when the parked workers cannot cover the pending tasks, otherwise a parked one
+    // takes this task. Each parked worker consumes exactly one task per wake up.
+    fork_worker = (eval_task_list_.size() > idle_eval_worker_num_);
+  }
+  if (fork_worker) {
+    auto thread = std::thread([this] { EvalTaskLoop(); });
+    thread.detach();
+  } else {
+    eval_task_cv_.notify_one();
+  }
+}
+
+void AnalysisSchedule::EvalTaskLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(eval_task_lock_);
+      if (eval_task_list_.empty()) {
+        ++idle_eval_worker_num_;
+        eval_task_cv_.wait(lock, [this] { return !eval_task_list_.empty(); });
+        --idle_eval_worker_num_;
+      }
+      task = std::move(eval_task_list_.front());
+      eval_task_list_.pop_front();
+    }
+    task();
+  }
+}
+
 void AnalysisSchedule::Schedule() {
   const auto checkPeriod = std::chrono::seconds(3);
   while (run_ || infer_thread_count_.load() > 0) {
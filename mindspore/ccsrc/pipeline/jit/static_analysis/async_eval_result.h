@@ -59,6 +59,11 @@ class AnalysisSchedule {
   void WaitForRun();
   void Yield(AsyncInferTask *asyncTask);
 
+  // Run an evaluator task on a pooled worker thread. The branch evaluations are cooperative, only one infer
+  // thread runs at a time and the rest stay parked, so a finished worker is reused for the next branch
+  // instead of forking a fresh native thread per switch branch.
+  void DispatchEvalTask(std::function<void()> &&task);
+
   void EnterWaiting() {
     {
       std::lock_guard<std::mutex> activeLock(activate_thread_lock_);
@@ -96,6 +101,7 @@ class AnalysisSchedule {
  private:
   void Schedule();
   void SetNextReady();
+  void EvalTaskLoop();
   void Start() {
     auto thread = std::thread([this] { Schedule(); });
     thread.detach();
@@ -109,6 +115,12 @@ class AnalysisSchedule {
   std::condition_variable activate_thread_cv_;
   std::list<AsyncInferTaskPtr> schedule_list_;
   std::set<std::string> activate_threads_;
+  // The reusable evaluator workers. A new thread is forked only when every worker is busy, so the pool can
+  // never block a task which would unblock the others.
+  std::mutex eval_task_lock_;
+  std::condition_variable eval_task_cv_;
+  std::list<std::function<void()>> eval_task_list_;
+  size_t idle_eval_worker_num_{0};
   const std::string kStateStop = "Stop";
   static thread_local std::string thread_id_;
 };
@@ -1079,6 +1079,13 @@ EvalResultPtr StandardPrimEvaluator::EvalPrim(const AnalysisEnginePtr &engine, c
   if (prim_->prim_type() == PrimType::kPrimTypePyCheck) {
     return EvalPyCheckPrim(engine, args);
   }
+  // Try to get the infer result from the global primitive eval cache. PyNative calls EvalPrim directly for
+  // every op, so without the cache the pure C++ infer path recomputes the same output abstract each call.
+  // The cache key covers the primitive attributes and the input abstracts, dynamic shapes get distinct keys.
+  auto cached_eval_result = eval_cache_->Get(prim_, args);
+  if (cached_eval_result != nullptr) {
+    return ApplyCacheEvalResult(prim_, cached_eval_result);
+  }
   auto context = MsContext::GetInstance();
   MS_EXCEPTION_IF_NULL(context);
   bool need_infer_value = !eval_impl_.in_white_list_;
@@ -1093,6 +1100,8 @@ EvalResultPtr StandardPrimEvaluator::EvalPrim(const AnalysisEnginePtr &engine, c
   }
   AbstractBasePtr abs_base = nullptr;
   ValuePtr value = nullptr;
+  // Snapshot the attributes before infer, the recorded added attrs are not part of the cache key.
+  auto input_attrs = prim_->attrs();
   prim_->BeginRecordAddAttr();
   if (need_infer_value && eval_impl_.infer_value_impl_ != nullptr) {
     value = eval_impl_.infer_value_impl_(prim_, args);
@@ -1100,13 +1109,17 @@ EvalResultPtr StandardPrimEvaluator::EvalPrim(const AnalysisEnginePtr &engine, c
       abs_base = value->ToAbstract();
       prim_->EndRecordAddAttr();
       auto added_attrs = prim_->evaluate_added_attrs();
-      return std::make_shared<EvalResult>(abs_base, std::make_shared<AttrValueMap>(added_attrs));
+      auto eval_result = std::make_shared<EvalResult>(abs_base, std::make_shared<AttrValueMap>(added_attrs));
+      eval_cache_->Put(prim_, std::move(input_attrs), args, eval_result);
+      return eval_result;
     }
   }
   abs_base = eval_impl_.infer_shape_impl_(engine, prim_, args);
   prim_->EndRecordAddAttr();
   const auto &added_attrs = prim_->evaluate_added_attrs();
-  return std::make_shared<EvalResult>(abs_base, std::make_shared<AttrValueMap>(added_attrs));
+  auto eval_result = std::make_shared<EvalResult>(abs_base, std::make_shared<AttrValueMap>(added_attrs));
+  eval_cache_->Put(prim_, std::move(input_attrs), args, eval_result);
+  return eval_result;
 }
 
 EvalResultPtr PythonPrimEvaluator::EvalPrim(const AnalysisEnginePtr &engine, const AbstractBasePtrList &args) {
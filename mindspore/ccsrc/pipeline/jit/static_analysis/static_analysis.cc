@@ -975,10 +975,15 @@ EvalResultPtr AnalysisEngine::ExecuteMultipleEvaluatorsMultiThread(const std::ve
     AsyncInferTaskPtr async_task = AsyncInferTask::MakeShared(control_run_order, thread_id);
     AnalysisSchedule::GetInstance().IncreaseThreadCount();
     MS_LOG(DEBUG) << GetInferThread() << "async : " << evaluator->ToString();
-    auto thread = std::thread(ExecEvaluator, evaluator, shared_from_this(), args_conf_list, out_conf, thread_id,
-                              async_result_branch, async_result_main, async_task, trace::GetCurrentGraphEvalStack(),
-                              trace::GetCNodeDebugStack());
-    thread.detach();
+    // Reuse a parked evaluator worker instead of forking a native thread per branch, the deeply nested
+    // control flows fork hundreds of branch evaluations per compile.
+    AnalysisSchedule::GetInstance().DispatchEvalTask(
+      [evaluator, engine = shared_from_this(), args_conf_list, out_conf, thread_id, async_result_branch,
+       async_result_main, async_task, graph_evals = trace::GetCurrentGraphEvalStack(),
+       trace_c_node_evals = trace::GetCNodeDebugStack()]() {
+        ExecEvaluator(evaluator, engine, args_conf_list, out_conf, thread_id, async_result_branch, async_result_main,
+                      async_task, graph_evals, trace_c_node_evals);
+      });
 
     // Push to list of running loop
     MS_LOG(DEBUG) << " add to schedule: " << async_task.get();
@@ -15,6 +15,8 @@
  */
 #ifndef MINDSPORE_CCSRC_PIPELINE_PYNATIVE_PYNATIVE_ABS_CACHE_H
 #define MINDSPORE_CCSRC_PIPELINE_PYNATIVE_PYNATIVE_ABS_CACHE_H
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -69,5 +71,47 @@ struct PrimSignature {
   mindspore::HashMap<SignatureEnumDType, std::vector<size_t>> type_indexes;
 };
 using ImplicitCastCache = mindspore::HashMap<std::string, PrimSignature>;
+
+// Generation-stamped copy-on-write wrapper for the op dispatch caches. Readers atomically load the current
+// immutable generation and never take a lock, so concurrent eager threads scale on the hot lookup path.
+// Writers copy the current generation, merge their insertions and publish the next one under a mutex; a
+// reader keeps whatever generation it already loaded. Misses get re-inferred, so losing a race only costs
+// one redundant infer. The write path is rare once the caches are warm.
+template <typename MapType>
+class SnapshotCache {
+ public:
+  using MapPtr = std::shared_ptr<const MapType>;
+
+  SnapshotCache() : snapshot_(std::make_shared<const MapType>()) {}
+
+  /// \brief Lock-free read of the current generation.
+  MapPtr Get() const { return std::atomic_load_explicit(&snapshot_, std::memory_order_acquire); }
+
+  /// \brief Apply the update to a copy of the current generation and publish it as the next one.
+  template <typename UpdateFunc>
+  void Update(const UpdateFunc &update) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto next = std::make_shared<MapType>(*Get());
+    update(next.get());
+    (void)generation_.fetch_add(1);
+    std::atomic_store_explicit(&snapshot_, MapPtr(std::move(next)), std::memory_order_release);
+  }
+
+  /// \brief Publish an empty generation.
+  void Clear() {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    (void)generation_.fetch_add(1);
+    std::atomic_store_explicit(&snapshot_, MapPtr(std::make_shared<const MapType>()),
+                               std::memory_order_release);
+  }
+
+  size_t generation() const { return generation_.load(); }
+
+ private:
+  // Accessed only through std::atomic_load/std::atomic_store.
+  MapPtr snapshot_;
+  std::mutex write_mutex_;
+  std::atomic<size_t> generation_{0};
+};
 }  // namespace mindspore::pynative
 #endif  // MINDSPORE_CCSRC_PIPELINE_PYNATIVE_PYNATIVE_ABS_CACHE_H
@@ -26,6 +26,7 @@
 #include "utils/hash_map.h"
 #include "utils/hash_set.h"
 #include "pipeline/jit/debug/trace.h"
+#include "include/common/debug/alloc_counter.h"
 #include "include/common/debug/anf_ir_dump.h"
 #include "include/common/pybind_api/api_register.h"
 #include "pybind_api/pybind_patch.h"
@@ -361,14 +362,15 @@ void PynativeInfer(const PrimitivePyPtr &prim, OpExecInfo *const op_exec_info,
   MS_LOG(DEBUG) << "Prim " << prim->name() << " infer result: " << op_exec_info->abstract->ToString();
 }
 
-void GetValueNodeString(std::ostringstream &buf, const tensor::TensorPtr &tensor) {
+void GetValueNodeString(std::string *buf, const tensor::TensorPtr &tensor) {
+  MS_EXCEPTION_IF_NULL(buf);
   MS_EXCEPTION_IF_NULL(tensor);
   auto dtype = tensor->Dtype();
   MS_EXCEPTION_IF_NULL(dtype);
   size_t data_size = std::min(tensor->DataSize(), kThreshold);
   auto fn = [&buf, data_size](auto addr) {
     for (size_t i = 0; i < data_size; ++i) {
-      buf << *(addr + i);
+      *buf += std::to_string(*(addr + i));
     }
   };
 
@@ -377,9 +379,9 @@ void GetValueNodeString(std::ostringstream &buf, const tensor::TensorPtr &tensor
   } else if (dtype->type_id() == kNumberTypeInt64) {
     fn(reinterpret_cast<int64_t *>(tensor->data_c()));
   } else if (dtype->type_id() == kNumberTypeFloat16) {
-    buf << *reinterpret_cast<float16 *>(tensor->data_c());
+    *buf += std::to_string(static_cast<float>(*reinterpret_cast<float16 *>(tensor->data_c())));
   } else if (dtype->type_id() == kNumberTypeFloat32) {
-    buf << *reinterpret_cast<float *>(tensor->data_c());
+    *buf += std::to_string(*reinterpret_cast<float *>(tensor->data_c()));
   } else {
     MS_LOG(EXCEPTION) << "The dtype of the constant input is not int64 or float32!";
   }
@@ -406,8 +408,11 @@ void GetSingleOpGraphInfo(const OpExecInfoPtr &op_exec_info, const std::vector<t
     MS_LOG(EXCEPTION) << "Input tensors size " << input_tensors.size() << " should be equal to tensors mask size "
                       << tensors_mask.size();
   }
-  std::ostringstream buf;
-  buf << op_exec_info->op_name;
+  // Build the key with plain string appends, a stringstream here shows up in eager-mode op dispatch profiles.
+  std::string buf;
+  constexpr size_t kGraphInfoReserveSize = 256;
+  buf.reserve(kGraphInfoReserveSize);
+  buf += op_exec_info->op_name;
   bool has_const_input = false;
   const auto &op_prim = op_exec_info->py_primitive;
   MS_EXCEPTION_IF_NULL(op_prim);
@@ -416,51 +421,55 @@ void GetSingleOpGraphInfo(const OpExecInfoPtr &op_exec_info, const std::vector<t
     const auto &input_tensor = input_tensors[index];
     MS_EXCEPTION_IF_NULL(input_tensor);
     if (input_tensor->base_shape_ptr() != nullptr) {
-      buf << input_tensor->base_shape_ptr()->ToString();
+      buf += input_tensor->base_shape_ptr()->ToString();
     } else {
-      buf << input_tensor->shape();
+      for (const auto &dim : input_tensor->shape()) {
+        buf += std::to_string(dim);
+        buf += ",";
+      }
     }
-    buf << input_tensor->data_type();
-    buf << input_tensor->padding_type();
+    buf += std::to_string(input_tensor->data_type());
+    buf += input_tensor->padding_type();
     // In the case of the same shape, but dtype and format are inconsistent
     auto tensor_addr = input_tensor->device_address();
     if (tensor_addr != nullptr && !has_hidden_side_effect) {
       auto p_address = std::dynamic_pointer_cast<device::DeviceAddress>(tensor_addr);
       MS_EXCEPTION_IF_NULL(p_address);
-      buf << p_address->type_id();
-      buf << p_address->format();
+      buf += std::to_string(p_address->type_id());
+      buf += p_address->format();
     }
     // For constant input
     if (tensors_mask[index] == kValueNodeTensorMask) {
       has_const_input = true;
-      GetValueNodeString(buf, input_tensor);
+      GetValueNodeString(&buf, input_tensor);
     }
-    buf << "_";
+    buf += "_";
   }
   // The value of the attribute affects the operator selection
   const auto &attr_map = op_prim->attrs();
   (void)std::for_each(attr_map.begin(), attr_map.end(),
-                      [&buf](const auto &element) { buf << element.second->ToString(); });
+                      [&buf](const auto &element) { buf += element.second->ToString(); });
 
   // Constant input affects output, operators like DropoutGenMask whose output is related to values of input when input
   // shapes are the same but values are different
   if (has_const_input) {
-    buf << "_";
+    buf += "_";
     auto abstr = op_exec_info->abstract;
     MS_EXCEPTION_IF_NULL(abstr);
     auto build_shape = abstr->BuildShape();
     MS_EXCEPTION_IF_NULL(build_shape);
-    buf << build_shape->ToString();
+    buf += build_shape->ToString();
     auto build_type = abstr->BuildType();
     MS_EXCEPTION_IF_NULL(build_type);
-    buf << build_type->type_id();
+    buf += std::to_string(build_type->type_id());
   }
 
   // Operator with hidden side effect.
   if (has_hidden_side_effect) {
-    buf << "_" << std::to_string(op_prim->id());
+    buf += "_";
+    buf += std::to_string(op_prim->id());
   }
-  graph_info = buf.str();
+  graph_info = std::move(buf);
 }
 
 py::list FilterTensorArgs(const py::args &args, bool has_sens = false) {
@@ -703,6 +712,10 @@ void ConvertAttrToUnifyMindIR(const OpExecInfoPtr &op_run_info) {
   MS_EXCEPTION_IF_NULL(op_prim);
 
   const auto &op_name = op_run_info->op_name;
+  // Most ops have no registered attr convert, skip copying the attr map for them on every op launch.
+  if (!CheckAndConvertUtils::HasRegisteredAttrConvert(op_name)) {
+    return;
+  }
   auto attrs = op_prim->attrs();
   for (auto attr : attrs) {
     bool converted = CheckAndConvertUtils::ConvertAttrValueToString(op_name, attr.first, &attr.second);
@@ -1103,6 +1116,34 @@ void SaveIdWithDynamicShape(const OpExecInfoPtr &op_exec_info, const std::string
   }
 }
 
+// Ops whose kernels are shape generic: the launch only depends on the element count, or on the rank and the
+// axes carried in the attributes, so one graph compiled with symbolic dims serves every shape of the same rank.
+const mindspore::HashSet<std::string> kShapeGenericOps = {
+  "Add",  "Sub",  "Mul",        "RealDiv", "Div",  "Neg",     "Exp",        "Log",        "Sqrt",     "Rsqrt",
+  "Square", "Abs", "Reciprocal", "ReLU",    "Tanh", "Sigmoid", "ReduceSum",  "ReduceMean", "ReduceMax", "ReduceMin"};
+// The number of distinct concrete shapes an op is compiled for before it is promoted to the shape
+// polymorphic compilation.
+constexpr size_t kShapePolymorphicPromoteThreshold = 3;
+
+// Relax a statically shaped tensor abstract to symbolic dims of the same rank, so the compiled graph and its
+// cache key only depend on the rank. Returns nullptr if the abstract is not a tensor or is already dynamic.
+AbstractBasePtr RelaxToShapePolymorphicAbstract(const AbstractBasePtr &abs) {
+  MS_EXCEPTION_IF_NULL(abs);
+  auto abs_tensor = abs->cast<abstract::AbstractTensorPtr>();
+  if (abs_tensor == nullptr) {
+    return nullptr;
+  }
+  auto build_shape = abs_tensor->BuildShape();
+  MS_EXCEPTION_IF_NULL(build_shape);
+  auto shape = build_shape->cast<abstract::ShapePtr>();
+  if (shape == nullptr || shape->IsDynamic()) {
+    return nullptr;
+  }
+  ShapeVector relaxed_shape(shape->shape().size(), abstract::Shape::SHP_ANY);
+  return std::make_shared<abstract::AbstractTensor>(abs_tensor->element(),
+                                                    std::make_shared<abstract::Shape>(relaxed_shape));
+}
+
 void UpdateInputTensorToDynamicShape(const OpExecInfoPtr &op_exec_info, std::vector<tensor::TensorPtr> *input_tensors) {
   if (!op_exec_info->has_dynamic_input) {
     return;
@@ -1347,6 +1388,7 @@ void TopCellInfo::Clear() {
 void ForwardExecutor::RunOpInner(py::object *ret, const OpExecInfoPtr &op_exec_info) {
   MS_EXCEPTION_IF_NULL(ret);
   MS_EXCEPTION_IF_NULL(op_exec_info);
+  AllocCounterScope alloc_scope("ForwardExecutor::RunOpInner");
   MS_LOG(DEBUG) << "RunOp name: " << op_exec_info->op_name;
   if (kSummaryOperators.count(op_exec_info->op_name) != 0) {
     MS_LOG(DEBUG) << "PyNative not support Operator " << op_exec_info->op_name;
@@ -1364,6 +1406,7 @@ void ForwardExecutor::RunOpInner(py::object *ret, const OpExecInfoPtr &op_exec_i
   // 3.Get inputs abstract
   abstract::AbstractBasePtrList args_spec_list;
   GetInputsArgsSpec(op_exec_info, &args_spec_list);
+  RecordOpShapeSignature(op_exec_info, args_spec_list);
   // 4.Get output abstract
   bool prim_cache_hit = false;
   GetOpOutputAbstract(op_exec_info, args_spec_list, &prim_cache_hit);
@@ -1528,13 +1571,58 @@ void ForwardExecutor::GetInputsArgsSpec(const OpExecInfoPtr &op_exec_info,
       if (shape->IsDynamic()) {
         MS_LOG(DEBUG) << "Input " << i << " get dynamic shape";
         op_exec_info->has_dynamic_input = true;
+        (void)args_spec_list->emplace_back(input_abs);
+      } else if (py::isinstance<tensor::Tensor>(obj) && NeedShapePolymorphicCompile(op_exec_info)) {
+        auto relaxed_abs = RelaxToShapePolymorphicAbstract(input_abs);
+        if (relaxed_abs != nullptr) {
+          MS_LOG(DEBUG) << "Relax input " << i << " of " << op_exec_info->op_name << " to symbolic dims";
+          op_exec_info->has_dynamic_input = true;
+          SaveIdWithDynamicShape(op_exec_info, id, obj, relaxed_abs);
+          (void)args_spec_list->emplace_back(relaxed_abs);
+        } else {
+          (void)args_spec_list->emplace_back(input_abs);
+        }
+      } else {
+        (void)args_spec_list->emplace_back(input_abs);
       }
-      (void)args_spec_list->emplace_back(input_abs);
     }
     MS_LOG(DEBUG) << "Set " << i << "th abs " << args_spec_list->back()->ToString();
   }
 }
 
+bool ForwardExecutor::NeedShapePolymorphicCompile(const OpExecInfoPtr &op_exec_info) const {
+  MS_EXCEPTION_IF_NULL(op_exec_info);
+  return shape_polymorphic_ops_.find(op_exec_info->op_name) != shape_polymorphic_ops_.end();
+}
+
+void ForwardExecutor::RecordOpShapeSignature(const OpExecInfoPtr &op_exec_info,
+                                             const abstract::AbstractBasePtrList &args_spec_list) {
+  MS_EXCEPTION_IF_NULL(op_exec_info);
+  // Already dynamic ops go through the symbolic compilation anyway, nothing to track for them.
+  if (op_exec_info->has_dynamic_input || op_exec_info->has_dynamic_output) {
+    return;
+  }
+  if (kShapeGenericOps.find(op_exec_info->op_name) == kShapeGenericOps.end()) {
+    return;
+  }
+  std::string signature;
+  for (const auto &abs : args_spec_list) {
+    MS_EXCEPTION_IF_NULL(abs);
+    auto build_shape = abs->BuildShape();
+    MS_EXCEPTION_IF_NULL(build_shape);
+    signature += build_shape->ToString();
+    signature += "_";
+  }
+  auto &observed_shapes = op_shape_signatures_[op_exec_info->op_name];
+  (void)observed_shapes.insert(std::move(signature));
+  if (observed_shapes.size() > kShapePolymorphicPromoteThreshold &&
+      shape_polymorphic_ops_.find(op_exec_info->op_name) == shape_polymorphic_ops_.end()) {
+    MS_LOG(INFO) << "Op " << op_exec_info->op_name << " has been compiled for " << observed_shapes.size()
+                 << " distinct shapes, the following launches compile one graph with symbolic dims.";
+    (void)shape_polymorphic_ops_.insert(op_exec_info->op_name);
+  }
+}
+
 AnfNodePtr ForwardExecutor::GetRealInputNodeBySkipHook(const AnfNodePtr &input_node) const {
   if (input_node == nullptr) {
     MS_LOG(DEBUG) << "The input node is nullptr.";
@@ -1629,8 +1717,9 @@ void ForwardExecutor::GetOpOutputAbstract(const OpExecInfoPtr &op_exec_info,
   MS_EXCEPTION_IF_NULL(prim);
 
   AbsCacheKey key{prim->name(), prim->Hash(), prim->attrs()};
-  auto temp = prim_abs_list_.find(key);
-  if (temp != prim_abs_list_.end()) {
+  const auto &prim_abs_snapshot = prim_abs_list_.Get();
+  auto temp = prim_abs_snapshot->find(key);
+  if (temp != prim_abs_snapshot->end()) {
     MS_LOG(DEBUG) << "Match prim input args " << op_name << mindspore::ToString(args_spec_list);
     auto iter = temp->second.find(args_spec_list);
     if (iter != temp->second.end()) {
@@ -1697,9 +1786,11 @@ void ForwardExecutor::GetOpOutput(const OpExecInfoPtr &op_exec_info,
   // Add output abstract info into cache, the const value needs to infer evert step
   if (grad()->enable_op_cache() && !prim_cache_hit && !IsDynamicShape(op_exec_info)) {
     AbsCacheKey key{prim->name(), prim->Hash(), prim->attrs()};
-    auto &out = prim_abs_list_[key];
-    out[args_spec_list].abs = op_exec_info->abstract;
-    out[args_spec_list].attrs = prim->evaluate_added_attrs();
+    prim_abs_list_.Update([&key, &args_spec_list, &op_exec_info, &prim](PrimAbsCache *cache) {
+      auto &out = (*cache)[key];
+      out[args_spec_list].abs = op_exec_info->abstract;
+      out[args_spec_list].attrs = prim->evaluate_added_attrs();
+    });
   }
 
   // Run op with selected backend, nop is no need run backend
@@ -1914,8 +2005,9 @@ void ForwardExecutor::SetImplicitCast(const OpExecInfoPtr &op_exec_info) {
   MS_EXCEPTION_IF_NULL(op_exec_info);
   const auto &prim = op_exec_info->py_primitive;
   MS_EXCEPTION_IF_NULL(prim);
-  const auto &it = implicit_cast_map_.find(prim->name());
-  if (it == implicit_cast_map_.end()) {
+  const auto &implicit_cast_snapshot = implicit_cast_map_.Get();
+  const auto &it = implicit_cast_snapshot->find(prim->name());
+  if (it == implicit_cast_snapshot->end()) {
     MS_LOG(DEBUG) << "Do signature for " << op_exec_info->op_name << " first";
     const auto &signature = prim->signatures();
     auto sig_size = signature.size();
@@ -1940,7 +2032,8 @@ void ForwardExecutor::SetImplicitCast(const OpExecInfoPtr &op_exec_info) {
       DoSignatureCast(op_exec_info->py_primitive, dst_type, dtypes, op_exec_info);
     }
     PrimSignature sig_value{has_dtype_sig, dtypes, type_indexes};
-    implicit_cast_map_[prim->name()] = sig_value;
+    implicit_cast_map_.Update(
+      [&prim, &sig_value](ImplicitCastCache *cache) { (*cache)[prim->name()] = sig_value; });
   } else {
     if (!it->second.has_dtype_sig) {
       MS_LOG(DEBUG) << op_exec_info->op_name << " have no dtype sig";
@@ -2785,9 +2878,11 @@ void ForwardExecutor::ClearRes() {
   MS_LOG(DEBUG) << "Clear forward res";
   lazy_build_ = false;
   cell_depth_ = 0;
-  implicit_cast_map_.clear();
-  prim_abs_list_.clear();
+  implicit_cast_map_.Clear();
+  prim_abs_list_.Clear();
   node_abs_map_.clear();
+  op_shape_signatures_.clear();
+  shape_polymorphic_ops_.clear();
   dynamic_shape_info_ptr()->reset();
 }
 
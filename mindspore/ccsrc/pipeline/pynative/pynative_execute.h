@@ -466,16 +466,25 @@ class ForwardExecutor {
   void CheckIfNeedSyncForHeterogeneous(const std::string &cur_target);
   void SaveOutputDynamicShape(const OpExecInfoPtr &op_exec_info, const AbstractBasePtr &real_abs,
                               const py::object &obj);
+  // Whether the op should be compiled once with symbolic dims instead of once per concrete shape.
+  bool NeedShapePolymorphicCompile(const OpExecInfoPtr &op_exec_info) const;
+  // Track the concrete shapes a shape generic op is launched with. When the shapes keep changing, the op is
+  // promoted to the shape polymorphic compilation, so the following launches reuse one compiled graph whose
+  // kernels read the actual sizes on launch, instead of recompiling per shape.
+  void RecordOpShapeSignature(const OpExecInfoPtr &op_exec_info, const abstract::AbstractBasePtrList &args_spec_list);
 
  private:
   uint32_t cell_depth_{0};
   GradExecutorWeakPtr grad_executor_;
-  PrimAbsCache prim_abs_list_;
-  ImplicitCastCache implicit_cast_map_;
+  SnapshotCache<PrimAbsCache> prim_abs_list_;
+  SnapshotCache<ImplicitCastCache> implicit_cast_map_;
   mindspore::HashMap<std::string, abstract::AbstractBasePtr> node_abs_map_;
   bool lazy_build_{false};
   std::string last_target_{"Unknown"};
   DynamicShapeInfoPtr dynamic_shape_info_ptr_{nullptr};
+  // Observed shape signatures per shape generic op and the ops promoted to shape polymorphic compilation.
+  mindspore::HashMap<std::string, mindspore::HashSet<std::string>> op_shape_signatures_;
+  mindspore::HashSet<std::string> shape_polymorphic_ops_;
 };
 
 class PynativeExecutor : public std::enable_shared_from_this<PynativeExecutor> {
@@ -962,7 +962,7 @@ bool AscendKernelRuntime::RunDynamicKernelAsync(const session::KernelGraph &grap
     if (common::AnfAlgo::IsDynamicShape(kernel)) {
       opt::dynamic_shape::InferOp(kernel);
       auto args = kernel->user_data<kernel::KernelArgs>();
-      (void)kernel_mod->Resize(args->op, args->inputs, args->outputs, args->depend_tensor_map);
+      (void)kernel_mod->ResizeWithCache(args->op, args->inputs, args->outputs, args->depend_tensor_map);
     }
     KernelLaunchInfo kernel_launch_info;
     device::KernelRuntime::GenLaunchArgs(*kernel_mod, kernel, &kernel_launch_info);
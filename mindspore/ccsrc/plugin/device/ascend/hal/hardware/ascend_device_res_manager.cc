@@ -15,6 +15,7 @@
  */
 
 #include "plugin/device/ascend/hal/hardware/ascend_device_res_manager.h"
+#include "plugin/device/ascend/hal/device/ascend_memory_pool.h"
 #include "runtime/data_queue/data_queue_mgr.h"
 #include "runtime/rt.h"
 
@@ -139,11 +140,18 @@ bool AscendDeviceResManager::SyncStream(size_t stream_id) const {
       MS_LOG(ERROR) << "Failed to synchronize ascend stream, ret[" << ret << "]";
       return false;
     }
+    AscendMemoryPool::GetInstance().SyncFreeStreamTags();
     return true;
   }
 
   MS_EXCEPTION_IF_NULL(runtime_instance_);
-  return runtime_instance_->SyncStream();
+  if (!runtime_instance_->SyncStream()) {
+    return false;
+  }
+  // All the in-flight frees are now ordered before future work, the idle bufs of the pool become reusable
+  // by every stream.
+  AscendMemoryPool::GetInstance().SyncFreeStreamTags();
+  return true;
 }
 
 bool AscendDeviceResManager::CreateStream(void **stream) const {
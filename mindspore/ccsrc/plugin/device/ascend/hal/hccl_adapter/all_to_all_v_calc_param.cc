@@ -47,6 +47,11 @@ void AllToAllvCalcParam::CalcOpParam() {
   CNodePtr cnode = node_.lock();
   MS_EXCEPTION_IF_NULL(cnode);
   size_t input_num = common::AnfAlgo::GetInputTensorNum(cnode);
+  size_t output_tensor_num = common::AnfAlgo::GetOutputTensorNum(cnode);
+  if (input_num == 1 && output_tensor_num == 1 && common::AnfAlgo::HasNodeAttr(kAttrSplitCount, cnode)) {
+    CalcFlattenOpParam();
+    return;
+  }
   // ignore send empty input
   if (common::AnfAlgo::HasNodeAttr(kAttrNeedDropInput, cnode)) {
     bool need_drop_input = common::AnfAlgo::GetNodeAttr<bool>(cnode, kAttrNeedDropInput);
@@ -85,6 +90,29 @@ void AllToAllvCalcParam::CalcOpParam() {
   CalcMemOffset(output_aligned_mem_size, output_real_mem_size, kAttrRecvRankIds, &recv_counts_, &rdispls_);
 }
 
+void AllToAllvCalcParam::CalcFlattenOpParam() {
+  CNodePtr cnode = node_.lock();
+  MS_EXCEPTION_IF_NULL(cnode);
+  auto split_count = common::AnfAlgo::GetNodeAttr<int64_t>(cnode, kAttrSplitCount);
+  if (split_count != static_cast<int64_t>(rank_size_)) {
+    MS_LOG(EXCEPTION) << "Invalid split count " << split_count << " must be equal to rank size " << rank_size_
+                      << " of node: " << cnode->fullname_with_scope();
+  }
+  auto ms_shape = AnfAlgo::GetInputDeviceShape(cnode, 0);
+  size_t total_size = SizeOf(ms_shape);
+  if (split_count == 0 || total_size % LongToSize(split_count) != 0) {
+    MS_LOG(EXCEPTION) << "Invalid element count " << total_size << " cannot be divisible by split count "
+                      << split_count << " of node: " << cnode->fullname_with_scope();
+  }
+  size_t chunk_size = total_size / LongToSize(split_count);
+  for (uint32_t i = 0; i < rank_size_; ++i) {
+    send_counts_[i] = SizeToLong(chunk_size);
+    sdispls_[i] = SizeToLong(i * chunk_size);
+    recv_counts_[i] = SizeToLong(chunk_size);
+    rdispls_[i] = SizeToLong(i * chunk_size);
+  }
+}
+
 void AllToAllvCalcParam::CalcMemOffset(const std::vector<size_t> &mem_sizes, const std::vector<size_t> &real_sizes,
                                        const std::string &rank_ids_attr, std::vector<int64_t> *counts,
                                        std::vector<int64_t> *displs) {
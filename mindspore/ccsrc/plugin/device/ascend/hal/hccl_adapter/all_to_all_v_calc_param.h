@@ -36,6 +36,9 @@ class AllToAllvCalcParam {
  private:
   void CalcMemOffset(const std::vector<size_t> &mem_sizes, const std::vector<size_t> &real_sizes,
                      const std::string &rank_ids_attr, std::vector<int64_t> *counts, std::vector<int64_t> *displs);
+  // Counts and displacements for the flattened single buffer form created by AllToAllUnifyMindIR: one input
+  // and one output tensor exchanged evenly along the outermost dim, without the SplitV/Concat kernels.
+  void CalcFlattenOpParam();
   CNodeWeakPtr node_;
   uint32_t rank_size_;
   std::vector<int64_t> send_counts_;
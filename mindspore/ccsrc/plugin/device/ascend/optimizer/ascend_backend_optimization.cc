@@ -110,6 +110,7 @@
 #include "plugin/device/ascend/optimizer/format_type/remove_host_kernel.h"
 #include "plugin/device/ascend/optimizer/format_type/check_consistency.h"
 #include "plugin/device/ascend/optimizer/format_type/eliminate_graph_output_transdata.h"
+#include "plugin/device/ascend/optimizer/format_type/layout_propagation.h"
 #include "plugin/device/ascend/optimizer/buffer_fusion/ub_pattern_fusion.h"
 #include "plugin/device/ascend/optimizer/buffer_fusion/eltwise_fusion_pass.h"
 #include "plugin/device/ascend/optimizer/buffer_fusion/multi_output_fusion_pass.h"
@@ -299,6 +300,7 @@ void AscendDataLayout(const std::shared_ptr<session::KernelGraph> &kernel_graph)
   data_layout_pm->AddPass(std::make_shared<EraseVisitAttr>());
   data_layout_pm->AddPass(std::make_shared<AddIoFormatAttrFor3DGraph>());
   data_layout_pm->AddPass(std::make_shared<CommonSubexpressionElimination>());
+  data_layout_pm->AddPass(std::make_shared<LayoutPropagation>());
   data_layout_pm->AddPass(std::make_shared<RemoveReshapePair>());
   data_layout_pm->AddPass(std::make_shared<EliminateRedundantOp>());
   if (kernel_graph->has_flag(kFlagPyNativeRunInGraph)) {
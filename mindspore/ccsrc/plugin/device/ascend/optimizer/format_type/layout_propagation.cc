@@ -0,0 +1,149 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/ascend/optimizer/format_type/layout_propagation.h"
+
+#include <set>
+#include <string>
+#include <vector>
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "include/common/utils/anfalgo.h"
+#include "include/common/utils/utils.h"
+#include "kernel/common_utils.h"
+#include "mindspore/core/ops/core_ops.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+// The single input elementwise ops which compute the same value in any device format, so a layout can be moved
+// across them freely.
+const std::set<std::string> kFormatAgnosticOps = {
+  prim::kPrimRelu->name(),       prim::kPrimRelu6->name(),   prim::kPrimNeg->name(),  prim::kPrimAbs->name(),
+  prim::kPrimExp->name(),        prim::kPrimSqrt->name(),    prim::kPrimRsqrt->name(), prim::kPrimSquare->name(),
+  prim::kPrimReciprocal->name(), prim::kPrimSigmoid->name(), prim::kPrimTanh->name()};
+
+bool GetSingleUserByFirstInput(const FuncGraphManagerPtr &manager, const AnfNodePtr &node, AnfNodePtr *user) {
+  MS_EXCEPTION_IF_NULL(user);
+  auto &node_users = manager->node_users();
+  auto iter = node_users.find(node);
+  if (iter == node_users.end() || iter->second.size() != 1) {
+    return false;
+  }
+  const auto &user_pair = *(iter->second.begin());
+  // The node must be the first input of the user, the format agnostic ops have only one tensor input.
+  if (user_pair.second != 1) {
+    return false;
+  }
+  *user = user_pair.first;
+  return true;
+}
+
+kernel::KernelBuildInfoPtr BuildKernelInfoWithFormat(const CNodePtr &cnode, const std::string &format) {
+  auto kernel_build_info = AnfAlgo::GetSelectKernelBuildInfo(cnode);
+  MS_EXCEPTION_IF_NULL(kernel_build_info);
+  auto builder = std::make_shared<kernel::KernelBuildInfo::KernelBuildInfoBuilder>();
+  MS_EXCEPTION_IF_NULL(builder);
+  builder->SetInputsFormat({format});
+  builder->SetOutputsFormat({format});
+  builder->SetInputsDeviceType(kernel_build_info->GetAllInputDeviceTypes());
+  builder->SetOutputsDeviceType(kernel_build_info->GetAllOutputDeviceTypes());
+  builder->SetKernelType(kernel_build_info->kernel_type());
+  builder->SetFusionType(kernel_build_info->fusion_type());
+  builder->SetProcessor(kernel_build_info->processor());
+  return builder->Build();
+}
+}  // namespace
+
+bool LayoutPropagation::Run(const FuncGraphPtr &func_graph) {
+  MS_EXCEPTION_IF_NULL(func_graph);
+  bool changed = false;
+  auto node_list = TopoSort(func_graph->get_return());
+  for (auto &node : node_list) {
+    if (node == nullptr || !node->isa<CNode>() || !AnfUtils::IsRealKernel(node)) {
+      continue;
+    }
+    if (common::AnfAlgo::GetCNodeName(node) != kTransDataOpName) {
+      continue;
+    }
+    changed = ProcessTransData(func_graph, node->cast<CNodePtr>()) || changed;
+  }
+  return changed;
+}
+
+bool LayoutPropagation::ProcessTransData(const FuncGraphPtr &func_graph, const CNodePtr &trans_node) {
+  MS_EXCEPTION_IF_NULL(func_graph);
+  MS_EXCEPTION_IF_NULL(trans_node);
+  auto manager = func_graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+
+  // Walk down the chain of format agnostic ops behind the transdata until the cancelling transdata. Every node
+  // of the chain must be used only by the next one, otherwise the propagated format would leak to other users.
+  std::vector<CNodePtr> chain;
+  CNodePtr back_trans_node = nullptr;
+  AnfNodePtr cur = trans_node;
+  AnfNodePtr user = nullptr;
+  while (GetSingleUserByFirstInput(manager, cur, &user)) {
+    if (!user->isa<CNode>()) {
+      break;
+    }
+    auto user_cnode = user->cast<CNodePtr>();
+    auto user_name = common::AnfAlgo::GetCNodeName(user_cnode);
+    if (user_name == kTransDataOpName) {
+      back_trans_node = user_cnode;
+      break;
+    }
+    if (kFormatAgnosticOps.count(user_name) == 0 || common::AnfAlgo::GetInputTensorNum(user_cnode) != 1) {
+      break;
+    }
+    (void)chain.emplace_back(user_cnode);
+    cur = user;
+  }
+  if (back_trans_node == nullptr || chain.empty()) {
+    return false;
+  }
+
+  // The transdata pair must cancel on the outside: same format and same device shape.
+  if (AnfAlgo::GetInputFormat(trans_node, 0) != AnfAlgo::GetOutputFormat(back_trans_node, 0) ||
+      !kernel::IsSameShape(AnfAlgo::GetInputDeviceShape(trans_node, 0),
+                           AnfAlgo::GetOutputDeviceShape(back_trans_node, 0))) {
+    return false;
+  }
+
+  const auto &format = AnfAlgo::GetInputFormat(trans_node, 0);
+  std::vector<kernel::KernelBuildInfoPtr> new_kernel_infos;
+  for (const auto &op : chain) {
+    auto new_kernel_info = BuildKernelInfoWithFormat(op, format);
+    if (!supported_checker_->CheckAICoreSupported(op, new_kernel_info)) {
+      MS_LOG(INFO) << "Stop propagating format " << format << " at node " << op->fullname_with_scope()
+                   << ", the format is not supported.";
+      return false;
+    }
+    (void)new_kernel_infos.emplace_back(new_kernel_info);
+  }
+
+  for (size_t i = 0; i < chain.size(); ++i) {
+    AnfAlgo::SetSelectKernelBuildInfo(new_kernel_infos[i], chain[i].get());
+  }
+  // Bypass both transdata, the chain runs in the producer format directly.
+  manager->SetEdge(chain.front(), 1, common::AnfAlgo::GetInputNode(trans_node, 0));
+  (void)manager->Replace(back_trans_node, chain.back());
+  MS_LOG(INFO) << "Propagate format " << format << " through " << chain.size()
+               << " ops and eliminate the transdata pair: " << trans_node->fullname_with_scope() << ", "
+               << back_trans_node->fullname_with_scope();
+  return true;
+}
+}  // namespace opt
+}  // namespace mindspore
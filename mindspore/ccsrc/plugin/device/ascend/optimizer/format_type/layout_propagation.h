@@ -0,0 +1,44 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_MINDSPORE_CCSRC_PLUGIN_DEVICE_ASCEND_OPTIMIZER_FORMAT_TYPE_LAYOUT_PROPAGATION_H_
+#define MINDSPORE_MINDSPORE_CCSRC_PLUGIN_DEVICE_ASCEND_OPTIMIZER_FORMAT_TYPE_LAYOUT_PROPAGATION_H_
+
+#include <memory>
+#include "ir/anf.h"
+#include "backend/common/optimizer/optimizer.h"
+#include "plugin/device/ascend/optimizer/ascend_helper.h"
+
+namespace mindspore {
+namespace opt {
+// Propagate the device format of a TransData producer through chains of format agnostic elementwise ops.
+// A pair of mutually cancelling TransData separated only by such ops is removed by running the chain in the
+// producer format directly, e.g. TransData(5HD->NCHW) -> ReLU -> TransData(NCHW->5HD) becomes ReLU in 5HD.
+// The adjacent cancelling pairs are already removed by EliminateRedundantOp, this pass handles the pairs the
+// compute ops keep apart.
+class LayoutPropagation : public Pass {
+ public:
+  LayoutPropagation() : Pass("layout_propagation") { supported_checker_ = std::make_shared<SupportedChecker>(); }
+  ~LayoutPropagation() override = default;
+  bool Run(const FuncGraphPtr &func_graph) override;
+
+ private:
+  bool ProcessTransData(const FuncGraphPtr &func_graph, const CNodePtr &trans_node);
+  SupportedCheckerPtr supported_checker_;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_MINDSPORE_CCSRC_PLUGIN_DEVICE_ASCEND_OPTIMIZER_FORMAT_TYPE_LAYOUT_PROPAGATION_H_
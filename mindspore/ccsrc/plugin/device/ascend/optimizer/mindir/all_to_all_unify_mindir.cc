@@ -201,6 +201,46 @@ CNodePtr AllToAllUnifyMindIR::CreateConcatNode(const FuncGraphPtr &graph, const
   return concat;
 }
 
+CNodePtr AllToAllUnifyMindIR::CreateFlattenAllToAllvNode(const FuncGraphPtr &graph, const CNodePtr &all_to_all) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(all_to_all);
+  int64_t split_count = common::AnfAlgo::GetNodeAttr<int64_t>(all_to_all, kAttrSplitCount);
+  std::string group = common::AnfAlgo::GetNodeAttr<std::string>(all_to_all, kAttrGroup);
+  std::vector<uint32_t> group_rank_ids =
+    common::AnfAlgo::HasNodeAttr(kAttrGroupRankIds, all_to_all)
+      ? common::AnfAlgo::GetNodeAttr<std::vector<uint32_t>>(all_to_all, kAttrGroupRankIds)
+      : std::vector<uint32_t>();
+  if (all_to_all->size() <= kAllToAllInputIdx) {
+    MS_LOG(EXCEPTION) << "Inputs should not be empty for cnode " << all_to_all->DebugString()
+                      << trace::DumpSourceLines(all_to_all);
+  }
+  auto all_to_all_input = all_to_all->input(kAllToAllInputIdx);
+  std::vector<AnfNodePtr> all_to_all_v_input = {NewValueNode(std::make_shared<Primitive>(kAllToAllVOpName)),
+                                                all_to_all_input};
+  auto all_to_all_v = NewCNode(all_to_all_v_input, graph);
+  MS_EXCEPTION_IF_NULL(all_to_all_v);
+  // Splitting along dim 0 and concatenating along dim 0 again keeps the overall shape.
+  common::AnfAlgo::SetOutputTypeAndDetailShape({common::AnfAlgo::GetOutputInferDataType(all_to_all_input, 0)},
+                                               {common::AnfAlgo::GetOutputDetailShape(all_to_all_input, 0)},
+                                               all_to_all_v.get());
+  uint32_t rank_size = GetRankSize(group);
+  std::vector<int64_t> rank_ids(rank_size, 0);
+  for (uint32_t i = 0; i < rank_size; ++i) {
+    rank_ids[i] = static_cast<int64_t>(i);
+  }
+  common::AnfAlgo::SetNodeAttr(kAttrSendRankIds, MakeValue<std::vector<int64_t>>(rank_ids), all_to_all_v);
+  common::AnfAlgo::SetNodeAttr(kAttrRecvRankIds, MakeValue<std::vector<int64_t>>(rank_ids), all_to_all_v);
+  common::AnfAlgo::SetNodeAttr(kAttrGroup, MakeValue<std::string>(group), all_to_all_v);
+  common::AnfAlgo::SetNodeAttr(kAttrGroupRankIds, MakeValue<std::vector<uint32_t>>(group_rank_ids), all_to_all_v);
+  // Marks the flattened single buffer form, the kernel derives even counts and displacements from it.
+  common::AnfAlgo::SetNodeAttr(kAttrSplitCount, MakeValue<int64_t>(split_count), all_to_all_v);
+  if (all_to_all->HasAttr(parallel::COMM_REUSE) && GetValue<bool>(all_to_all->GetAttr(parallel::COMM_REUSE))) {
+    all_to_all_v->AddAttr(parallel::COMM_REUSE, MakeValue(true));
+  }
+  MS_LOG(INFO) << "Create flattened AllToAllv success, split count " << split_count << ", rank size " << rank_size;
+  return all_to_all_v;
+}
+
 const BaseRef NeighborExchangeUnifyMindIR::DefinePattern() const {
   return VectorRef({prim::kPrimNeighborExchange, std::make_shared<SeqVar>()});
 }
@@ -223,6 +263,18 @@ const AnfNodePtr AllToAllUnifyMindIR::Process(const FuncGraphPtr &graph, const A
   MS_EXCEPTION_IF_NULL(node);
   auto all_to_all = node->cast<CNodePtr>();
   MS_EXCEPTION_IF_NULL(all_to_all);
+  // The expert dispatch of MoE models exchanges along the outermost dim; its slices are contiguous and the
+  // SplitV/Concat pair would only shuffle bytes, so the AllToAllv consumes the input buffer directly.
+  if (all_to_all->size() > kAllToAllInputIdx) {
+    auto shape = common::AnfAlgo::GetOutputInferShape(all_to_all->input(kAllToAllInputIdx), 0);
+    int64_t split_dim = NormalizeDim(shape, common::AnfAlgo::GetNodeAttr<int64_t>(all_to_all, kAttrSplitDim));
+    int64_t concat_dim = NormalizeDim(shape, common::AnfAlgo::GetNodeAttr<int64_t>(all_to_all, kAttrConcatDim));
+    int64_t split_count = common::AnfAlgo::GetNodeAttr<int64_t>(all_to_all, kAttrSplitCount);
+    if (split_dim == 0 && concat_dim == 0 && !IsDynamic(shape) && !shape.empty() && split_count != 0 &&
+        shape[0] % split_count == 0) {
+      return CreateFlattenAllToAllvNode(graph, all_to_all);
+    }
+  }
   auto split = CreateSplitNode(graph, all_to_all);
   auto all_to_all_v = CreateAllToAllvNode(graph, all_to_all, split);
   auto concat = CreateConcatNode(graph, all_to_all, all_to_all_v);
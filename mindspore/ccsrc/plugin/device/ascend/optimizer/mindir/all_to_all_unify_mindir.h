@@ -41,6 +41,10 @@ class AllToAllUnifyMindIR : public PatternProcessPass {
   CNodePtr CreateSplitNode(const FuncGraphPtr &graph, const CNodePtr &all_to_all) const;
   CNodePtr CreateAllToAllvNode(const FuncGraphPtr &graph, const CNodePtr &all_to_all, const CNodePtr &split) const;
   CNodePtr CreateConcatNode(const FuncGraphPtr &graph, const CNodePtr &all_to_all, const CNodePtr &all_to_all_v) const;
+  // When the exchange runs along the outermost dim (split_dim == concat_dim == 0, the expert dispatch of MoE
+  // models), the per destination slices are already contiguous, so the AllToAllv can consume the input buffer
+  // directly with computed counts and displacements instead of going through SplitV and Concat kernels.
+  CNodePtr CreateFlattenAllToAllvNode(const FuncGraphPtr &graph, const CNodePtr &all_to_all) const;
 };
 }  // namespace opt
 }  // namespace mindspore
@@ -119,6 +119,18 @@ void AddcdivCpuKernelMod::AddcdivMul(const T1 *input1, const T2 *input2, T1 *out
   if ((inputx_shape_size_ + inputy_shape_size_ + value_shape_size_) == 0) {
     T1 mul2 = static_cast<T1>(input2[0]);
     output[0] = input1[0] * mul2;
+  } else if (input_shape1_ == output_shape_ && input_shape3_ == output_shape_) {
+    // No broadcast, so index the buffers flatly without the per-element broadcast iterator.
+    auto mul_task = [&input1, &input2, &output](int64_t mul_start, int64_t mul_end) {
+      for (auto i = mul_start; i < mul_end; i++) {
+        output[i] = input1[i] * static_cast<T1>(input2[i]);
+      }
+    };
+    output_size_ = 1;
+    for (int64_t i = 0; i < static_cast<int64_t>(output_shape_.size()); ++i) {
+      output_size_ *= output_shape_[i];
+    }
+    ParallelLaunchAutoSearch(mul_task, output_size_, this, &parallel_search_info_);
   } else {
     BroadcastIterator mul_iter(input_shape1_, input_shape3_, output_shape_);
     auto mul_task = [&input1, &input2, &output, &mul_iter](int64_t mul_start, int64_t mul_end) {
@@ -142,6 +154,18 @@ template <typename T>
 void AddcdivCpuKernelMod::AddcdivAdd(const T *input1, const T *input2, T *output) {
   if ((inputx_shape_size_ + inputy_shape_size_ + value_shape_size_ + data_shape_size_) == 0) {
     output[0] = input1[0] + input2[0];
+  } else if (input_shape0_ == output_shape_) {
+    // No broadcast, so index the buffers flatly without the per-element broadcast iterator.
+    auto add_task = [&input1, &input2, &output](int64_t add_start, int64_t add_end) {
+      for (int64_t i = add_start; i < add_end; i++) {
+        output[i] = input1[i] + input2[i];
+      }
+    };
+    output_size_ = 1;
+    for (int64_t i = 0; i < static_cast<int64_t>(output_shape_.size()); ++i) {
+      output_size_ *= output_shape_[i];
+    }
+    ParallelLaunchAutoSearch(add_task, output_size_, this, &parallel_search_info_);
   } else {
     BroadcastIterator add_iter(input_shape0_, output_shape_, output_shape_);
     auto add_task = [&input1, &input2, &output, &add_iter](int64_t add_start, int64_t add_end) {
@@ -175,6 +199,34 @@ void AddcdivCpuKernelMod::AddcdivDiv(const T *input1, const T *input2, T *output
         output[0] = input1[0] > zero ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
       }
     }
+  } else if (input_shape2_ == output_shape_) {
+    // No broadcast, so index the buffers flatly without the per-element broadcast iterator.
+    auto div_task = [&input1, &input2, &output](int64_t div_start, int64_t div_end) {
+      auto zero = (T)0;
+      for (int64_t i = div_start; i < div_end; i++) {
+        auto addcdiv_dividend = input1[i];
+        auto addcdiv_divisor = input2[i];
+        if (addcdiv_divisor == zero) {
+          if (addcdiv_dividend == zero) {
+            output[i] = std::numeric_limits<T>::quiet_NaN();
+            continue;
+          }
+          if (std::numeric_limits<T>::has_infinity) {
+            output[i] =
+              addcdiv_dividend > zero ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+          } else {
+            output[i] = addcdiv_dividend > zero ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+          }
+          continue;
+        }
+        output[i] = addcdiv_dividend / addcdiv_divisor;
+      }
+    };
+    output_size_ = 1;
+    for (int64_t i = 0; i < static_cast<int64_t>(output_shape_.size()); ++i) {
+      output_size_ *= output_shape_[i];
+    }
+    ParallelLaunchAutoSearch(div_task, output_size_, this, &parallel_search_info_);
   } else {
     BroadcastIterator div_iter(output_shape_, input_shape2_, output_shape_);
     auto div_task = [&input1, &input2, &output, &div_iter](int64_t div_start, int64_t div_end) {
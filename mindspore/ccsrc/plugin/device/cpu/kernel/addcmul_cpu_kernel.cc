@@ -65,6 +65,18 @@ template <typename T>
 void AddcmulCpuKernelMod::AddcmulMul1(const T *input1, const T *input2, T *output) {
   if ((inputx_shape_size_ + inputy_shape_size_ + value_shape_size_) == 0) {
     output[0] = input1[0] * input2[0];
+  } else if (input_shape1_ == output_shape_ && input_shape2_ == output_shape_) {
+    // No broadcast, so index the buffers flatly without the per-element broadcast iterator.
+    auto mul_task = [&input1, &input2, &output](size_t mul_start, size_t mul_end) {
+      for (size_t i = mul_start; i < mul_end; i++) {
+        output[i] = static_cast<T>(input1[i] * input2[i]);
+      }
+    };
+    output_size_ = 1;
+    for (size_t i = 0; i < output_shape_.size(); ++i) {
+      output_size_ *= output_shape_[i];
+    }
+    ParallelLaunchAutoSearch(mul_task, output_size_, this, &parallel_search_info_);
   } else {
     BroadcastIterator mul_iter(input_shape1_, input_shape2_, output_shape_);
     auto mul_task = [&input1, &input2, &output, &mul_iter](size_t mul_start, size_t mul_end) {
@@ -87,6 +99,18 @@ template <typename T>
 void AddcmulCpuKernelMod::AddcmulMul2(const T *input1, const T *input2, T *output) {
   if ((inputx_shape_size_ + inputy_shape_size_ + value_shape_size_) == 0) {
     output[0] = input1[0] * input2[0];
+  } else if (input_shape3_ == output_shape_) {
+    // No broadcast, so index the buffers flatly without the per-element broadcast iterator.
+    auto task = [&input1, &input2, &output](size_t start, size_t end) {
+      for (size_t i = start; i < end; i++) {
+        output[i] = static_cast<T>(input1[i] * input2[i]);
+      }
+    };
+    output_size_ = 1;
+    for (size_t i = 0; i < output_shape_.size(); ++i) {
+      output_size_ *= static_cast<size_t>(output_shape_[i]);
+    }
+    ParallelLaunchAutoSearch(task, output_size_, this, &parallel_search_info_);
   } else {
     BroadcastIterator base_iter(input_shape3_, output_shape_, output_shape_);
     auto task = [&input1, &input2, &output, &base_iter](size_t start, size_t end) {
@@ -109,6 +133,18 @@ template <typename T>
 void AddcmulCpuKernelMod::AddcmulAdd(const T *input1, const T *input2, T *output) {
   if ((inputx_shape_size_ + inputy_shape_size_ + value_shape_size_ + data_shape_size_) == 0) {
     output[0] = input1[0] + input2[0];
+  } else if (input_shape0_ == output_shape_) {
+    // No broadcast, so index the buffers flatly without the per-element broadcast iterator.
+    auto add_task = [&input1, &input2, &output](size_t start, size_t end) {
+      for (size_t i = start; i < end; i++) {
+        output[i] = input1[i] + input2[i];
+      }
+    };
+    output_size_ = 1;
+    for (size_t i = 0; i < output_shape_.size(); ++i) {
+      output_size_ *= static_cast<size_t>(output_shape_[i]);
+    }
+    ParallelLaunchAutoSearch(add_task, output_size_, this, &parallel_search_info_);
   } else {
     BroadcastIterator base_iter(input_shape0_, output_shape_, output_shape_);
     auto add_task = [&input1, &input2, &output, &base_iter](size_t start, size_t end) {
@@ -351,6 +351,43 @@ void ParallelLaunch(const std::vector<common::Task> &tasks, Content content, Thr
   (void)thread_pool->ParallelLaunch(func, content, task_num);
 }
 
+void ParallelLaunch(const CTask &task, size_t count, const ParallelPartitionHint &hint, Content content,
+                    ThreadPool *pool) {
+  if (count == 0) {
+    return;
+  }
+  auto thread_pool = pool == nullptr ? GetActorMgrInnerThreadPool() : pool;
+  size_t kernel_thread_num = thread_pool->GetKernelThreadNum();
+  if (kernel_thread_num == 0) {
+    MS_LOG(EXCEPTION) << "Actor inner pool has been init, but kernel thread is 0!";
+  }
+
+  constexpr size_t kCacheLineSize = 64;
+  constexpr float kUnitCostBlockSize = 128.0f;
+  size_t element_size = hint.element_size == 0 ? 1 : hint.element_size;
+  // Align the chunk boundaries so no two chunks write the same cache line and every chunk holds a whole
+  // number of vectors.
+  size_t granule = (kCacheLineSize + element_size - 1) / element_size;
+  if (hint.vector_width > 1) {
+    granule = ((granule + hint.vector_width - 1) / hint.vector_width) * hint.vector_width;
+  }
+  // Scale the minimal chunk by the per-element cost, matching the default block_size for unit cost.
+  float per_element_cost = hint.per_element_cost > 0 ? hint.per_element_cost : 1.0f;
+  size_t min_chunk = std::max(granule, static_cast<size_t>(std::ceil(kUnitCostBlockSize / per_element_cost)));
+  size_t chunk = (count + kernel_thread_num - 1) / kernel_thread_num;
+  chunk = std::max(chunk, min_chunk);
+  chunk = ((chunk + granule - 1) / granule) * granule;
+  size_t task_num = std::max<size_t>(count / chunk, 1);
+  auto func = [&](void *, int task_id, float, float) {
+    size_t start = static_cast<size_t>(task_id) * chunk;
+    // The ragged tail is merged into the last chunk instead of forming a short chunk of its own.
+    size_t end = static_cast<size_t>(task_id) + 1 == task_num ? count : start + chunk;
+    task(start, end);
+    return common::SUCCESS;
+  };
+  (void)thread_pool->ParallelLaunch(func, content, task_num);
+}
+
 void ParallelLaunchAutoSearch(const CTask &task, size_t count, Content content,
                               ParallelSearchInfo *parallel_search_info, ThreadPool *pool) {
   if (parallel_search_info->kernel_thread_num_set == false) {
@@ -324,6 +324,20 @@ ActorThreadPool *GetActorMgrInnerThreadPool();
 void ParallelLaunch(const CTask &task, size_t count, float block_size = 128.0, Content content = nullptr,
                     ThreadPool *pool = nullptr);
 void ParallelLaunch(const std::vector<common::Task> &tasks, Content content = nullptr, ThreadPool *pool = nullptr);
+
+// Partitioning hints for SIMD kernels: chunk boundaries are aligned so no two chunks write the same cache
+// line and every chunk except the merged tail holds a whole number of vectors.
+struct ParallelPartitionHint {
+  // Size in bytes of one output element.
+  size_t element_size{sizeof(float)};
+  // Elements processed per SIMD vector, 0 or 1 when the kernel is scalar.
+  size_t vector_width{0};
+  // Relative cost of one element, 1.0 matching the default block_size granularity. Cheaper elements get
+  // proportionally larger chunks so the dispatch overhead still pays off.
+  float per_element_cost{1.0f};
+};
+void ParallelLaunch(const CTask &task, size_t count, const ParallelPartitionHint &hint, Content content = nullptr,
+                    ThreadPool *pool = nullptr);
 void ParallelLaunchAutoSearch(const CTask &task, size_t count, Content content,
                               ParallelSearchInfo *parallel_search_info, ThreadPool *pool = nullptr);
 
@@ -17,8 +17,10 @@
 #include "plugin/device/cpu/kernel/dropout_cpu_kernel.h"
 
 #include <algorithm>
+#include <limits>
 #include <random>
 
+#include "include/common/utils/philox_generator.h"
 #include "plugin/device/cpu/hal/device/cpu_device_address.h"
 
 namespace mindspore {
@@ -26,6 +28,7 @@ namespace kernel {
 namespace {
 constexpr size_t kDropoutInputsNum = 1;
 constexpr size_t kDropoutOutputsNum = 2;
+constexpr float kDropoutBlockSize = 128.0;
 }  // namespace
 
 void DropoutCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
@@ -64,19 +67,29 @@ bool DropoutCpuKernelMod::Launch(const std::vector<kernel::AddressPtr> &inputs,
 }
 
 template <typename T>
-void DropoutCpuKernelMod::LaunchKernel(const std::vector<AddressPtr> &inputs,
-                                       const std::vector<AddressPtr> &outputs) const {
+void DropoutCpuKernelMod::LaunchKernel(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &outputs) {
   const auto *input_addr = reinterpret_cast<T *>(inputs[0]->addr);
   auto *output_addr = reinterpret_cast<T *>(outputs[0]->addr);
   auto mask_addr = reinterpret_cast<T *>(outputs[1]->addr);
   std::random_device rd;
-  std::mt19937 gen(rd());
-  std::bernoulli_distribution dis(keep_prob_);
+  const uint64_t seed = (static_cast<uint64_t>(rd()) << 32) | rd();
+  // Keep an element when its random uint32 is below the scaled keep probability. Element i always
+  // uses lane i % kResultNum of Philox counter block i / kResultNum, so the mask is the same for
+  // any ParallelLaunch partition and thread number.
+  const uint32_t keep_threshold =
+    static_cast<uint32_t>(static_cast<double>(keep_prob_) * std::numeric_limits<uint32_t>::max());
   T scale = (T)(1.f / keep_prob_);
-  for (uint64_t i = 0; i < tensor_size_; ++i) {
-    mask_addr[i] = (T)dis(gen);
-    output_addr[i] = mask_addr[i] * input_addr[i] * scale;
-  }
+  auto task = [&](size_t start, size_t end) {
+    size_t i = start;
+    while (i < end) {
+      auto values = PhiloxBlock(seed, i / kResultNum);
+      for (size_t lane = i % kResultNum; lane < static_cast<size_t>(kResultNum) && i < end; ++lane, ++i) {
+        mask_addr[i] = (T)(values[lane] <= keep_threshold);
+        output_addr[i] = mask_addr[i] * input_addr[i] * scale;
+      }
+    }
+  };
+  ParallelLaunch(task, tensor_size_, kDropoutBlockSize, this);
 }
 
 MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, Dropout, DropoutCpuKernelMod);
@@ -106,10 +106,15 @@ void LayerNormCpuKernelMod::LaunchKernel(const std::vector<AddressPtr> &inputs,
       }
       T block_mean = sum / static_cast<T>(block_size_);
       T block_var = square_sum / static_cast<T>(block_size_) - block_mean * block_mean;
+      // One reciprocal sqrt per block instead of a sqrt and a division per element, and the param index is
+      // tracked incrementally to avoid the per-element modulo.
+      T scale = (T)(1.0 / std::sqrt(static_cast<double>(block_var) + eps_));
+      size_t param_shift = (i * block_size_) % param_num_;
       for (size_t j = i * block_size_; j < (i + 1) * block_size_; ++j) {
-        auto param_shift = j % param_num_;
-        y[j] = (x[j] - block_mean) / (T)std::sqrt(static_cast<double>(block_var) + eps_) * gamma[param_shift] +
-               beta[param_shift];
+        y[j] = (x[j] - block_mean) * scale * gamma[param_shift] + beta[param_shift];
+        if (++param_shift == param_num_) {
+          param_shift = 0;
+        }
       }
       mean[i] = block_mean;
       var[i] = block_var;
@@ -16,6 +16,7 @@
 
 #include "plugin/device/cpu/kernel/matmul_cpu_kernel.h"
 #include "plugin/device/cpu/kernel/eigen/matmul_double_cpu_kernel_func.h"
+#include "plugin/device/cpu/kernel/matmul_int8_cpu_kernel_func.h"
 #include "plugin/device/cpu/kernel/mkldnn/matmul_cpu_kernel_func.h"
 #include <utility>
 #include <algorithm>
@@ -34,7 +35,9 @@ static std::map<std::string, std::vector<std::pair<KernelAttr, MatMulFuncCreator
    {{KernelAttr().AddInputAttr(kNumberTypeFloat32).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32),
      []() { return std::make_shared<MatMulCpuKernelFunc>(); }},
     {KernelAttr().AddInputAttr(kNumberTypeFloat64).AddInputAttr(kNumberTypeFloat64).AddOutputAttr(kNumberTypeFloat64),
-     []() { return std::make_shared<MatmulDoubleCpuKernelFunc>(); }}}},
+     []() { return std::make_shared<MatmulDoubleCpuKernelFunc>(); }},
+    {KernelAttr().AddInputAttr(kNumberTypeInt8).AddInputAttr(kNumberTypeInt8).AddOutputAttr(kNumberTypeInt32),
+     []() { return std::make_shared<MatMulInt8CpuKernelFunc>(); }}}},
   {kBatchMatMul,
    {{KernelAttr().AddInputAttr(kNumberTypeFloat32).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32),
      []() { return std::make_shared<MatMulCpuKernelFunc>(); }}}}};
@@ -0,0 +1,89 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/matmul_int8_cpu_kernel_func.h"
+#include <vector>
+#include "plugin/device/cpu/kernel/nnacl/int8/matmul_int8.h"
+#include "plugin/device/cpu/kernel/nnacl/op_base.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr size_t kMatMulInputsNum = 2;
+constexpr size_t kMatMulOutputsNum = 1;
+constexpr size_t kMatMulDimNum = 2;
+}  // namespace
+
+void MatMulInt8CpuKernelFunc::InitFunc(const CNodePtr &kernel_node) {
+  MS_EXCEPTION_IF_NULL(kernel_node);
+  kernel_name_ = common::AnfAlgo::GetCNodeName(kernel_node);
+  std::vector<int64_t> a_shape = AnfAlgo::GetInputDeviceShape(kernel_node, 0);
+  std::vector<int64_t> b_shape = AnfAlgo::GetInputDeviceShape(kernel_node, 1);
+  std::vector<int64_t> out_shape = AnfAlgo::GetOutputDeviceShape(kernel_node, 0);
+  if (a_shape.size() != kMatMulDimNum || b_shape.size() != kMatMulDimNum || out_shape.size() != kMatMulDimNum) {
+    MS_LOG(EXCEPTION) << "The tensor rank of " << kernel_name_ << " must be equal to 2.";
+  }
+  trans_a_ = common::AnfAlgo::GetNodeAttr<bool>(kernel_node, TRANSPOSE_A);
+  trans_b_ = common::AnfAlgo::GetNodeAttr<bool>(kernel_node, TRANSPOSE_B);
+
+  row_ = static_cast<size_t>(out_shape[kDim0]);
+  col_ = static_cast<size_t>(out_shape[kDim1]);
+  deep_ = trans_a_ ? static_cast<size_t>(a_shape[kDim0]) : static_cast<size_t>(a_shape[kDim1]);
+
+  row_4_ = static_cast<size_t>(UP_ROUND(SizeToInt(row_), C4NUM));
+  col_4_ = static_cast<size_t>(UP_ROUND(SizeToInt(col_), C4NUM));
+  deep_16_ = static_cast<size_t>(UP_ROUND(SizeToInt(deep_), C16NUM));
+  pack_a_.resize(row_4_ * deep_16_);
+  pack_b_.resize(col_4_ * deep_16_);
+  // Symmetric quantization: both zero points are 0, so the row sums and the bias stay zero.
+  input_sum_.assign(row_4_, 0);
+  bias_.assign(col_4_, 0);
+  out_block_.resize(row_4_ * col_4_);
+}
+
+bool MatMulInt8CpuKernelFunc::RunFunc(const std::vector<kernel::AddressPtr> &inputs,
+                                      const std::vector<kernel::AddressPtr> &,
+                                      const std::vector<kernel::AddressPtr> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), kMatMulInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kMatMulOutputsNum, kernel_name_);
+  const auto *a_addr = reinterpret_cast<int8_t *>(inputs[0]->addr);
+  const auto *b_addr = reinterpret_cast<int8_t *>(inputs[1]->addr);
+  auto *output_addr = reinterpret_cast<int32_t *>(outputs[0]->addr);
+
+  if (trans_a_) {
+    RowMajor2Col16x4MajorInt8(a_addr, pack_a_.data(), SizeToInt(deep_), SizeToInt(row_));
+  } else {
+    RowMajor2Row16x4MajorInt8(a_addr, pack_a_.data(), SizeToInt(row_), SizeToInt(deep_));
+  }
+  if (trans_b_) {
+    RowMajor2Row16x4MajorInt8(b_addr, pack_b_.data(), SizeToInt(col_), SizeToInt(deep_));
+  } else {
+    RowMajor2Col16x4MajorInt8(b_addr, pack_b_.data(), SizeToInt(deep_), SizeToInt(col_));
+  }
+  MatMulInt8_16x4(pack_a_.data(), pack_b_.data(), out_block_.data(), SizeToInt(row_4_), SizeToInt(col_4_),
+                  SizeToInt(deep_16_), input_sum_.data(), bias_.data());
+
+  // Unpack the row4x4-major accumulator blocks into the row-major output.
+  for (size_t r = 0; r < row_; ++r) {
+    for (size_t c = 0; c < col_; ++c) {
+      const size_t block_index = (c / C4NUM) * row_4_ * C4NUM + r * C4NUM + c % C4NUM;
+      output_addr[r * col_ + c] = out_block_[block_index];
+    }
+  }
+  return true;
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,58 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MATMUL_INT8_CPU_KERNEL_FUNC_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MATMUL_INT8_CPU_KERNEL_FUNC_H_
+
+#include <string>
+#include <vector>
+#include "plugin/device/cpu/kernel/cpu_kernel.h"
+
+namespace mindspore {
+namespace kernel {
+// Int8 matmul with an int32 accumulator output, backed by the nnacl int8 GEMM. The inputs are
+// expected to be symmetrically quantized (zero point 0), so the raw int32 accumulator is exact
+// and the per-channel dequantization composes as an ordinary broadcast multiply on the output.
+class MatMulInt8CpuKernelFunc : public DeprecatedCpuKernelFunc {
+ public:
+  MatMulInt8CpuKernelFunc() = default;
+  ~MatMulInt8CpuKernelFunc() override = default;
+
+  void InitFunc(const CNodePtr &kernel_node) override;
+  bool RunFunc(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+               const std::vector<AddressPtr> &outputs) override;
+
+ private:
+  size_t row_{0};
+  size_t col_{0};
+  size_t deep_{0};
+  size_t row_4_{0};
+  size_t col_4_{0};
+  size_t deep_16_{0};
+  bool trans_a_{false};
+  bool trans_b_{false};
+  // Packing buffers and the blocked accumulator, sized once in InitFunc.
+  std::vector<int8_t> pack_a_;
+  std::vector<int8_t> pack_b_;
+  std::vector<int32_t> input_sum_;
+  std::vector<int32_t> bias_;
+  std::vector<int32_t> out_block_;
+  std::string kernel_name_;
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MATMUL_INT8_CPU_KERNEL_FUNC_H_
@@ -17,30 +17,30 @@
 #include "nnacl/fp32/exp_fp32.h"
 #include "nnacl/fp32/adam_fp32.h"
 #include "nnacl/intrinsics/ms_simd_instructions.h"
-#ifdef ENABLE_AVX512
-#include "nnacl/avx512/adam_fp32_avx512.h"
-#endif
+#include "nnacl/adam_fp32_simd.h"
 
 int AdamFp32(float *var, float *m, float *v, float lr, float beta1, float beta2, float epsilon, const float *gradient,
              size_t start, size_t end, bool use_nesterov) {
   size_t c1 = start;
+  SIMD_RUN_AVX512(AdamFp32, c1, var, m, v, lr, beta1, beta2, epsilon, gradient, use_nesterov, end);
 #ifdef ENABLE_AVX
-  size_t c8 = ((end - start) / C8NUM) * C8NUM;
+  // The avx block starts from c1 so that it picks up the tail left by the avx512 run.
+  size_t c8 = c1 + ((end - c1) / C8NUM) * C8NUM;
   __m256 coeff1_r = _mm256_set1_ps(1 - beta1);
   __m256 coeff2_r = _mm256_set1_ps(1 - beta2);
   __m256 beta1_r = _mm256_set1_ps(beta1);
   __m256 lr_r = _mm256_set1_ps(lr);
   __m256 epsi_r = _mm256_set1_ps(epsilon);
 
-  float *var_ptr = var + start;
-  float *m_ptr = m + start;
-  float *v_ptr = v + start;
-  const float *grad_ptr = gradient + start;
+  float *var_ptr = var + c1;
+  float *m_ptr = m + c1;
+  float *v_ptr = v + c1;
+  const float *grad_ptr = gradient + c1;
 
   __m256 avx_r0, avx_r1;
   __m256 var_r, m_r, v_r, grad_r;
 
-  for (; c1 < start + c8; c1 += C8NUM) {
+  for (; c1 < c8; c1 += C8NUM) {
     grad_r = _mm256_loadu_ps(grad_ptr);
     m_r = _mm256_loadu_ps(m_ptr);
     avx_r0 = _mm256_sub_ps(grad_r, m_r);
@@ -93,8 +93,10 @@ int AdamFp32(float *var, float *m, float *v, float lr, float beta1, float beta2,
 int AdamDeltaFp32(float *delta, float *m, float *v, float lr, float beta1, float beta2, float epsilon,
                   const float *gradient, size_t start, size_t end, bool use_nesterov) {
   size_t c1 = start;
+  SIMD_RUN_AVX512(AdamDeltaFp32, c1, delta, m, v, lr, beta1, beta2, epsilon, gradient, use_nesterov, end);
 #ifdef ENABLE_AVX
-  size_t c8 = ((end - start) / C8NUM) * C8NUM;
+  // The avx block starts from c1 so that it picks up the tail left by the avx512 run.
+  size_t c8 = c1 + ((end - c1) / C8NUM) * C8NUM;
   __m256 coeff1_r = _mm256_set1_ps(1.0f - beta1);
   __m256 coeff2_r = _mm256_set1_ps(1.0f - beta2);
   __m256 beta1_r = _mm256_set1_ps(beta1);
@@ -102,14 +104,14 @@ int AdamDeltaFp32(float *delta, float *m, float *v, float lr, float beta1, float
   __m256 lr_r = _mm256_set1_ps(-lr);
   __m256 epsi_r = _mm256_set1_ps(epsilon);
 
-  float *m_ptr = m + start;
-  float *v_ptr = v + start;
-  float *delta_ptr = delta + start;
-  const float *gradient_ptr = gradient + start;
+  float *m_ptr = m + c1;
+  float *v_ptr = v + c1;
+  float *delta_ptr = delta + c1;
+  const float *gradient_ptr = gradient + c1;
 
   __m256 m_r, v_r, delta_r, grad_r;
   __m256 avx_r0, avx_r1;
-  for (; c1 < start + c8; c1 += C8NUM) {
+  for (; c1 < c8; c1 += C8NUM) {
     m_r = _mm256_loadu_ps(m_ptr);
     avx_r0 = _mm256_mul_ps(m_r, beta1_r);
     grad_r = _mm256_loadu_ps(gradient_ptr);
@@ -159,7 +161,7 @@ int AdamDeltaFp32(float *delta, float *m, float *v, float lr, float beta1, float
 int AdamWeightDecayFp32(float *var, float *m, float *v, float lr, float beta1, float beta2, float epsilon, float decay,
                         const float *gradient, size_t start, size_t end) {
   size_t c1 = start;
-  SIMD_RUN_AVX512(AdamWeightDecayFp32, c1, var, m, v, lr, beta1, beta2, epsilon, decay, gradient, end);
+  SIMD_RUN_NO_SCALAR(AdamWeightDecayFp32, c1, var, m, v, lr, beta1, beta2, epsilon, decay, gradient, end);
 
   // remaining
   const float beta1_minus = 1 - beta1;
@@ -16,6 +16,7 @@
 #include <random>
 #include <thread>
 #include <memory>
+#include "include/common/utils/philox_generator.h"
 #include "plugin/device/cpu/hal/device/cpu_device_address.h"
 #include "plugin/device/cpu/kernel/random_cpu_kernel.h"
 
@@ -30,10 +31,19 @@ constexpr size_t kStandardNormalOutputsNum = 1;
 constexpr float kRandomBlockSize = 128.0;
 constexpr char kKernelName[] = "Random";
 }  // namespace
-void StandardNormal(float *output, std::normal_distribution<float> distribution,
-                    std::default_random_engine random_generator, size_t start, size_t end) {
-  for (size_t i = start; i < end; i++) {
-    output[i] = distribution(random_generator);
+// Fill output[start, end) from the Philox counter streams of `seed`. Element i always comes from
+// lane i % kResultNum of counter block i / kResultNum, so the result is the same no matter how
+// ParallelLaunch partitions the tensor or how many threads run.
+void StandardNormal(float *output, uint64_t seed, size_t start, size_t end) {
+  NormalDistribution<PhiloxGenerator, float> distribution;
+  size_t i = start;
+  while (i < end) {
+    PhiloxGenerator generator(seed);
+    generator.JumpStep(i / kResultNum);
+    auto values = distribution(&generator);
+    for (size_t lane = i % kResultNum; lane < static_cast<size_t>(kResultNum) && i < end; ++lane, ++i) {
+      output[i] = values[lane];
+    }
   }
 }
 
@@ -41,20 +51,11 @@ void LaunchStandardNormal(RandomCpuKernelMod *content, unsigned int seed, const
   auto output = reinterpret_cast<float *>(outputs[0]->addr);
   // multithreading
   size_t lens = outputs[0]->size / sizeof(float);
-  auto thread_pool = GetActorMgrInnerThreadPool();
-  size_t max_thread_num = thread_pool->GetKernelThreadNum();
-  size_t thread_num = lens < kRandomBlockSize * max_thread_num ? std::ceil(lens / kRandomBlockSize) : max_thread_num;
-  size_t once_compute_size = (lens + thread_num - 1) / thread_num;
-  std::normal_distribution<float> distribution;
-  auto task = [&](size_t start, size_t end) {
-    auto task_id = start / once_compute_size;
-    std::default_random_engine random_generator(seed + task_id);
-    StandardNormal(output, distribution, random_generator, start, end);
-  };
+  auto task = [&](size_t start, size_t end) { StandardNormal(output, seed, start, end); };
   ParallelLaunch(task, lens, kRandomBlockSize, content);
 }
 
-void LaunchUniformInt(unsigned int seed, const std::vector<AddressPtr> &inputs,
+void LaunchUniformInt(RandomCpuKernelMod *content, unsigned int seed, const std::vector<AddressPtr> &inputs,
                       const std::vector<AddressPtr> &outputs) {
   // Init min/max values.
   int min_val = reinterpret_cast<int *>(inputs[1]->addr)[0];
@@ -69,31 +70,42 @@ void LaunchUniformInt(unsigned int seed, const std::vector<AddressPtr> &inputs,
   // Init sample number.
   size_t num_sample = outputs[0]->size / sizeof(int);
 
-  // Init random int generator.
-  std::mt19937 gen(seed);
-  std::uniform_int_distribution<> distrib(min_val, max_val - 1);
-
-  // Generate random int values.
-  for (size_t i = 0; i < num_sample; ++i) {
-    output[i] = distrib(gen);
-  }
+  // Generate random int values in [min_val, max_val) from the per-block counter streams.
+  uint64_t range = static_cast<uint64_t>(max_val) - static_cast<uint64_t>(min_val);
+  auto task = [&](size_t start, size_t end) {
+    size_t i = start;
+    while (i < end) {
+      auto values = PhiloxBlock(seed, i / kResultNum);
+      for (size_t lane = i % kResultNum; lane < static_cast<size_t>(kResultNum) && i < end; ++lane, ++i) {
+        output[i] = min_val + static_cast<int>(values[lane] % range);
+      }
+    }
+  };
+  ParallelLaunch(task, num_sample, kRandomBlockSize, content);
 }
 
-void LaunchUniformReal(unsigned int seed, const std::vector<AddressPtr> &, const std::vector<AddressPtr> &outputs) {
+void LaunchUniformReal(RandomCpuKernelMod *content, unsigned int seed, const std::vector<AddressPtr> &,
+                       const std::vector<AddressPtr> &outputs) {
   // Init output address.
   auto output = reinterpret_cast<float *>(outputs[0]->addr);
 
   // Init sample number.
   size_t num_sample = outputs[0]->size / sizeof(int);
 
-  // Init random real generator.
-  std::mt19937 gen(seed);
-  std::uniform_real_distribution<> distrib(0.0, 1.0);
-
-  // Generate random real values.
-  for (size_t i = 0; i < num_sample; ++i) {
-    output[i] = static_cast<float>(distrib(gen));
-  }
+  // Generate random real values in [0.0, 1.0) from the per-block counter streams.
+  auto task = [&](size_t start, size_t end) {
+    UniformDistribution<PhiloxGenerator, float> distribution;
+    size_t i = start;
+    while (i < end) {
+      PhiloxGenerator generator(seed);
+      generator.JumpStep(i / kResultNum);
+      auto values = distribution(&generator);
+      for (size_t lane = i % kResultNum; lane < static_cast<size_t>(kResultNum) && i < end; ++lane, ++i) {
+        output[i] = values[lane];
+      }
+    }
+  };
+  ParallelLaunch(task, num_sample, kRandomBlockSize, content);
 }
 
 void RandomCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
@@ -132,11 +144,11 @@ bool RandomCpuKernelMod::Launch(const std::vector<kernel::AddressPtr> &inputs, c
   } else if (random_op_type_ == RANDOM_OP_UNIFORM_INT) {
     CHECK_KERNEL_INPUTS_NUM(inputs.size(), kUniformIntInputsNum, kernel_name_);
     CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kUniformIntOutputsNum, kernel_name_);
-    LaunchUniformInt(RNG_seed, inputs, outputs);
+    LaunchUniformInt(this, RNG_seed, inputs, outputs);
   } else if (random_op_type_ == RANDOM_OP_UNIFORM_REAL) {
     CHECK_KERNEL_INPUTS_NUM(inputs.size(), kUniformRealInputsNum, kernel_name_);
     CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kUniformRealOutputsNum, kernel_name_);
-    LaunchUniformReal(RNG_seed, inputs, outputs);
+    LaunchUniformReal(this, RNG_seed, inputs, outputs);
   } else {
     MS_LOG(EXCEPTION) << "For '" << kernel_name_
                       << ", only support these types: StandardNormal, UniformInt or UniformReal currently, but got "
@@ -39,7 +39,6 @@ constexpr size_t kEpsilonIndex = 8;
 constexpr size_t kGradIndex = 9;
 constexpr size_t kIndicesIndex = 10;
 constexpr size_t kSparseApplyAdamInputsNum = 11;
-constexpr size_t kSparseApplyAdamWorkspaceSize = 5;
 constexpr char kKernelName[] = "SparseApplyAdam";
 using KernelRunFunc = SparseApplyAdamCpuKernelMod::KernelRunFunc;
 
@@ -107,7 +106,11 @@ void SparseApplyAdamCpuKernelMod::InitWorkspaceSize() {
   (void)workspace_size_list_.emplace_back(indices_size_ * sizeof(T));
   (void)workspace_size_list_.emplace_back(indices_size_ * var_outer_dim_size_ * sizeof(float));
   (void)workspace_size_list_.emplace_back(indices_size_ * sizeof(T));
-  (void)workspace_size_list_.emplace_back(var_first_dim_size_ * var_outer_dim_size_ * sizeof(float));
+  // The m_t buffer covers the whole dense variable and is only written on the nesterov path. For sparse
+  // embedding tables the variable is far larger than the touched rows, so do not allocate it otherwise.
+  if (use_nesterov_) {
+    (void)workspace_size_list_.emplace_back(var_first_dim_size_ * var_outer_dim_size_ * sizeof(float));
+  }
 }
 
 // Initialization for the kernel mod.
@@ -278,7 +281,7 @@ bool SparseApplyAdamCpuKernelMod::LaunchKernel(const std::vector<kernel::Address
   auto *new_indices = reinterpret_cast<T *>(workspace[1]->addr);
   auto *workspace_grad = reinterpret_cast<float *>(workspace[2]->addr);
   auto *workspace_indices = reinterpret_cast<T *>(workspace[3]->addr);
-  auto *m_t = reinterpret_cast<float *>(workspace[4]->addr);
+  auto *m_t = use_nesterov_ ? reinterpret_cast<float *>(workspace[4]->addr) : nullptr;
 
   SparseGradient<T> unique_sparse_grad({new_grad, new_indices, indices_size_});
   SparseGradient<T> workspace_sparse_grad({workspace_grad, workspace_indices, indices_size_});
@@ -27,6 +27,9 @@
 #include "include/common/thread_pool.h"
 namespace mindspore {
 namespace kernel {
+// Bucket size from which the sorted segment reduce replaces the hash map reduce.
+constexpr size_t kSortReduceSizeThreshold = 256;
+
 template <typename T>
 struct SparseGradient {
   float *value_{nullptr};
@@ -283,6 +286,40 @@ class SparseOptimizerCpuKernelMod : public NativeCpuKernelMod {
     ParallelLaunch(tasks);
   }
 
+  // Indices are non-negative row numbers bounded by max_index, so a byte-wise LSD radix sort only
+  // needs as many counting passes as max_index has significant bytes, against the log n comparison
+  // passes of std::sort with branchy pair comparisons.
+  template <typename T>
+  static void RadixSortIndices(std::vector<std::pair<T, T>> *sorted_indices, size_t max_index) {
+    MS_EXCEPTION_IF_NULL(sorted_indices);
+    constexpr size_t kRadixBits = 8;
+    constexpr size_t kRadixSize = 1 << kRadixBits;
+    constexpr size_t kRadixMask = kRadixSize - 1;
+    std::vector<std::pair<T, T>> buffer(sorted_indices->size());
+    auto *src = sorted_indices;
+    auto *dst = &buffer;
+    constexpr size_t kIndexBits = sizeof(size_t) * kRadixBits;
+    for (size_t shift = 0; shift < kIndexBits && (max_index >> shift) != 0; shift += kRadixBits) {
+      size_t offsets[kRadixSize] = {0};
+      for (const auto &item : *src) {
+        offsets[(static_cast<size_t>(item.first) >> shift) & kRadixMask]++;
+      }
+      size_t offset = 0;
+      for (size_t digit = 0; digit < kRadixSize; ++digit) {
+        size_t count = offsets[digit];
+        offsets[digit] = offset;
+        offset += count;
+      }
+      for (const auto &item : *src) {
+        (*dst)[offsets[(static_cast<size_t>(item.first) >> shift) & kRadixMask]++] = item;
+      }
+      std::swap(src, dst);
+    }
+    if (src != sorted_indices) {
+      *sorted_indices = std::move(*src);
+    }
+  }
+
   template <typename T>
   static void SortAndReduceBucketSparseGradient(const MultiThreadReduceSparseGradientParam<T> &param,
                                                 const std::shared_ptr<BucketSparseGradient<T>> &bucket,
@@ -301,7 +338,7 @@ class SparseOptimizerCpuKernelMod : public NativeCpuKernelMod {
       T global_index = bucket->global_indices_[i];
       (void)sorted_indices.emplace_back(std::pair<T, T>(index, global_index));
     }
-    std::sort(sorted_indices.begin(), sorted_indices.end());
+    RadixSortIndices<T>(&sorted_indices, param.max_index_);
 
     float *global_value = param.input_grad_->value_;
     size_t unique_indices_size = 0;
@@ -398,7 +435,10 @@ class SparseOptimizerCpuKernelMod : public NativeCpuKernelMod {
       reduced_buckets[i]->indices_ = param.workspace_grad_->indices_ + current_indices_offset;
       reduced_buckets[i]->indices_size_ = buckets[i]->indices_size_;
       auto task = [&param, &buckets, &reduced_buckets, i]() {
-        if (param.use_sort_reduce_) {
+        // The sorted reduce turns duplicate accumulation into sequential segment passes over the
+        // values, which wins on the larger buckets of skewed index distributions; the hash map
+        // reduce stays for the small buckets where sorting does not pay off.
+        if (param.use_sort_reduce_ || buckets[i]->indices_size_ >= kSortReduceSizeThreshold) {
           SortAndReduceBucketSparseGradient<T>(param, buckets[i], reduced_buckets[i]);
         } else {
           ReduceBucketSparseGradient<T>(param, buckets[i], reduced_buckets[i]);
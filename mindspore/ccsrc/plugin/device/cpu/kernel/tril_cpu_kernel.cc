@@ -20,6 +20,7 @@
 #include "Eigen/Core"
 
 #include "plugin/device/cpu/hal/device/cpu_device_address.h"
+#include "plugin/device/cpu/kernel/type_id_dispatch.h"
 
 namespace mindspore {
 namespace kernel {
@@ -33,7 +34,11 @@ void TrilCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   MS_EXCEPTION_IF_NULL(kernel_node);
   kernel_name_ = common::AnfAlgo::GetCNodeName(kernel_node);
   input_shape_ = Convert2SizeTClipNeg(common::AnfAlgo::GetPrevNodeOutputInferShape(kernel_node, 0));
-  dtype_ = AnfAlgo::GetInputDeviceDataType(kernel_node, 0);
+  launch_func_ =
+    ResolveTypedLaunchFunc<TrilCpuKernelMod, kNumberTypeUInt8, kNumberTypeUInt16, kNumberTypeUInt32, kNumberTypeUInt64,
+                           kNumberTypeInt8, kNumberTypeInt16, kNumberTypeInt32, kNumberTypeInt64, kNumberTypeFloat16,
+                           kNumberTypeFloat32, kNumberTypeFloat64, kNumberTypeBool>(
+      kernel_name_, AnfAlgo::GetInputDeviceDataType(kernel_node, 0));
 
   input_dims_ = input_shape_.size();
   if (input_dims_ < kDim) {
@@ -50,48 +55,7 @@ bool TrilCpuKernelMod::Launch(const std::vector<AddressPtr> &inputs, const std::
   CHECK_KERNEL_INPUTS_NUM(inputs.size(), kTrilInputsNum, kernel_name_);
   CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kTrilOutputsNum, kernel_name_);
 
-  switch (dtype_) {
-    case (kNumberTypeUInt8):
-      LaunchKernel<uint8_t>(inputs, outputs);
-      break;
-    case (kNumberTypeUInt16):
-      LaunchKernel<uint16_t>(inputs, outputs);
-      break;
-    case (kNumberTypeUInt32):
-      LaunchKernel<uint32_t>(inputs, outputs);
-      break;
-    case (kNumberTypeUInt64):
-      LaunchKernel<uint64_t>(inputs, outputs);
-      break;
-    case (kNumberTypeInt8):
-      LaunchKernel<int8_t>(inputs, outputs);
-      break;
-    case (kNumberTypeInt16):
-      LaunchKernel<int16_t>(inputs, outputs);
-      break;
-    case (kNumberTypeInt32):
-      LaunchKernel<int32_t>(inputs, outputs);
-      break;
-    case (kNumberTypeInt64):
-      LaunchKernel<int64_t>(inputs, outputs);
-      break;
-    case (kNumberTypeFloat16):
-      LaunchKernel<float16>(inputs, outputs);
-      break;
-    case (kNumberTypeFloat32):
-      LaunchKernel<float>(inputs, outputs);
-      break;
-    case (kNumberTypeFloat64):
-      LaunchKernel<double>(inputs, outputs);
-      break;
-    case (kNumberTypeBool):
-      LaunchKernel<bool>(inputs, outputs);
-      break;
-    default:
-      MS_LOG(EXCEPTION) << "the datatype of the input not support, support datatype: "
-                           "uint8, uint16, uint32, uint64, int8, int16, int32, int64, "
-                           "float16, float32, float64, bool.";
-  }
+  (this->*launch_func_)(inputs, outputs);
   return true;
 }
 
@@ -37,6 +37,7 @@ class TrilCpuKernelMod : public DeprecatedNativeCpuKernelMod {
 
   template <typename T>
   void LaunchKernel(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &outputs);
+  using TypedLaunchFunc = void (TrilCpuKernelMod::*)(const std::vector<AddressPtr> &, const std::vector<AddressPtr> &);
 
  protected:
   std::vector<KernelAttr> GetOpSupport() override;
@@ -45,7 +46,8 @@ class TrilCpuKernelMod : public DeprecatedNativeCpuKernelMod {
   int64_t diagonal_{0};
   std::vector<size_t> input_shape_;
   size_t input_dims_;
-  TypeId dtype_{kTypeUnknown};
+  // The typed launch resolved for the input dtype at InitKernel, see ResolveTypedLaunchFunc.
+  TypedLaunchFunc launch_func_{nullptr};
 };
 }  // namespace kernel
 }  // namespace mindspore
@@ -17,6 +17,7 @@
 #include "plugin/device/cpu/kernel/trunc_cpu_kernel.h"
 #include <functional>
 #include "plugin/device/cpu/hal/device/cpu_device_address.h"
+#include "plugin/device/cpu/kernel/type_id_dispatch.h"
 
 namespace mindspore {
 namespace kernel {
@@ -42,25 +43,17 @@ bool TruncCpuKernelMod::Init(const BaseOperatorPtr &base_operator, const std::ve
   kernel_name_ = base_operator->name();
   auto input_shape = inputs[kZero]->GetShapeVector();
   input_size_ = std::accumulate(input_shape.begin(), input_shape.end(), size_t(1), std::multiplies<size_t>());
-  dtype_ = inputs[kZero]->GetDtype();
+  launch_func_ = ResolveTypedLaunchFunc<TruncCpuKernelMod, kNumberTypeFloat16, kNumberTypeFloat32>(
+    kernel_name_, inputs[kZero]->GetDtype());
   return true;
 }
 
 bool TruncCpuKernelMod::Launch(const std::vector<kernel::AddressPtr> &inputs,
                                const std::vector<kernel::AddressPtr> &workspace,
                                const std::vector<kernel::AddressPtr> &outputs) {
-  bool ret = true;
   CHECK_KERNEL_INPUTS_NUM(inputs.size(), kTruncInputsNum, kernel_name_);
   CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kTruncOutputsNum, kernel_name_);
-  if (dtype_ == kNumberTypeFloat16) {
-    ret = LaunchKernel<float16>(inputs, outputs);
-  } else if (dtype_ == kNumberTypeFloat32) {
-    ret = LaunchKernel<float>(inputs, outputs);
-  } else {
-    MS_EXCEPTION(TypeError) << "Unsupported input data type for operator [" << kernel_name_
-                            << "]: " << TypeIdToType(dtype_)->ToString();
-  }
-  return ret;
+  return (this->*launch_func_)(inputs, outputs);
 }
 
 template <typename T>
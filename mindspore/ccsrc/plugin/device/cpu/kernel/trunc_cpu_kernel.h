@@ -37,19 +37,18 @@ class TruncCpuKernelMod : public NativeCpuKernelMod {
   bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
               const std::vector<AddressPtr> &outputs) override;
 
+  template <typename T>
+  bool LaunchKernel(const std::vector<kernel::AddressPtr> &inputs, const std::vector<kernel::AddressPtr> &outputs);
+  using TypedLaunchFunc = bool (TruncCpuKernelMod::*)(const std::vector<kernel::AddressPtr> &,
+                                                      const std::vector<kernel::AddressPtr> &);
+
  protected:
   std::vector<KernelAttr> GetOpSupport() override;
 
  private:
   size_t input_size_;
-  TypeId dtype_{kTypeUnknown};
-
-  template <typename T>
-  bool LaunchKernel(const std::vector<kernel::AddressPtr> &inputs, const std::vector<kernel::AddressPtr> &outputs);
-  using TruncFunc = std::function<bool(TruncCpuKernelMod *, const std::vector<kernel::AddressPtr> &,
-                                       const std::vector<kernel::AddressPtr> &)>;
-  static std::vector<std::pair<KernelAttr, TruncFunc>> func_list_;
-  TruncFunc kernel_func_;
+  // The typed launch resolved for the input dtype at Init, see ResolveTypedLaunchFunc.
+  TypedLaunchFunc launch_func_{nullptr};
 };
 }  // namespace kernel
 }  // namespace mindspore
@@ -0,0 +1,76 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_TYPE_ID_DISPATCH_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_TYPE_ID_DISPATCH_H_
+
+#include <string>
+#include "base/float16.h"
+#include "ir/dtype.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace kernel {
+// Compile time mapping from a TypeId to the native type of the tensor elements.
+template <TypeId kTypeId>
+struct TypeIdToNative {};
+
+#define TYPE_ID_NATIVE_TYPE(TYPE_ID, NATIVE_TYPE) \
+  template <>                                     \
+  struct TypeIdToNative<TYPE_ID> {                \
+    using type = NATIVE_TYPE;                     \
+  }
+
+TYPE_ID_NATIVE_TYPE(kNumberTypeBool, bool);
+TYPE_ID_NATIVE_TYPE(kNumberTypeUInt8, uint8_t);
+TYPE_ID_NATIVE_TYPE(kNumberTypeUInt16, uint16_t);
+TYPE_ID_NATIVE_TYPE(kNumberTypeUInt32, uint32_t);
+TYPE_ID_NATIVE_TYPE(kNumberTypeUInt64, uint64_t);
+TYPE_ID_NATIVE_TYPE(kNumberTypeInt8, int8_t);
+TYPE_ID_NATIVE_TYPE(kNumberTypeInt16, int16_t);
+TYPE_ID_NATIVE_TYPE(kNumberTypeInt32, int32_t);
+TYPE_ID_NATIVE_TYPE(kNumberTypeInt64, int64_t);
+TYPE_ID_NATIVE_TYPE(kNumberTypeFloat16, float16);
+TYPE_ID_NATIVE_TYPE(kNumberTypeFloat32, float);
+TYPE_ID_NATIVE_TYPE(kNumberTypeFloat64, double);
+
+#undef TYPE_ID_NATIVE_TYPE
+
+template <TypeId kTypeId>
+using TypeIdNativeType = typename TypeIdToNative<kTypeId>::type;
+
+// Resolve the fully typed LaunchKernel instantiation of a kernel for type_id, out of the launch path.
+// The kernel declares the pointer type of its typed launch as Kernel::TypedLaunchFunc, resolves the
+// pointer once at Init over the TypeIds it supports and calls through it in every Launch, instead of
+// walking an if/switch ladder of TypeIds per step. Throws the uniform type error when type_id is not in
+// the supported list.
+template <typename Kernel, TypeId... kTypeIds>
+typename Kernel::TypedLaunchFunc ResolveTypedLaunchFunc(const std::string &kernel_name, TypeId type_id) {
+  typename Kernel::TypedLaunchFunc func = nullptr;
+  bool matched = ((type_id == kTypeIds
+                     ? (func = &Kernel::template LaunchKernel<TypeIdNativeType<kTypeIds>>, true)
+                     : false) ||
+                  ...);
+  if (!matched) {
+    MS_EXCEPTION(TypeError) << "Unsupported input data type for operator [" << kernel_name
+                            << "]: " << TypeIdToType(type_id)->ToString();
+  }
+  return func;
+}
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_TYPE_ID_DISPATCH_H_
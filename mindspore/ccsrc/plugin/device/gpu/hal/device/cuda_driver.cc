@@ -198,6 +198,15 @@ bool CudaDriver::RecordEvent(CudaDeviceEvent event, CudaDeviceStream stream) {
   return true;
 }
 
+bool CudaDriver::StreamWaitEvent(CudaDeviceStream stream, const CudaDeviceEvent &event) {
+  auto ret = cudaStreamWaitEvent((cudaStream_t)stream, (cudaEvent_t)event, 0);
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaStreamWaitEvent failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
 bool CudaDriver::SyncEvent(const CudaDeviceEvent &event) {
   auto ret = cudaEventSynchronize((cudaEvent_t)event);
   if (ret != cudaSuccess) {
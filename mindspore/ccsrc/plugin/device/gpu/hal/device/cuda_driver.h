@@ -58,6 +58,7 @@ class CudaDriver {
   static bool CreateEvent(CudaDeviceEvent *event, unsigned int flag = cudaEventDefault);
   static bool DestroyEvent(const CudaDeviceEvent &event);
   static bool RecordEvent(CudaDeviceEvent event, CudaDeviceStream stream = 0);
+  static bool StreamWaitEvent(CudaDeviceStream stream, const CudaDeviceEvent &event);
   static bool SyncEvent(const CudaDeviceEvent &event);
   static bool QueryEvent(const CudaDeviceEvent &event);
   static bool ElapsedTime(float *cost_time, const CudaDeviceEvent &start, const CudaDeviceEvent &end);
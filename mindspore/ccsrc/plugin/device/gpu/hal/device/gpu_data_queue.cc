@@ -31,6 +31,14 @@ GpuDataQueueDynamic::GpuDataQueueDynamic(const size_t capacity) : DataQueue(capa
   stream_ = reinterpret_cast<cudaStream_t>(gpu::GPUDeviceManager::GetInstance().default_stream());
 }
 
+GpuDataQueueDynamic::~GpuDataQueueDynamic() {
+  for (size_t i = 0; i < capacity_; ++i) {
+    if (node_info_[i].event_ != nullptr) {
+      (void)cudaEventDestroy(*(node_info_[i].event_));
+    }
+  }
+}
+
 BlockQueueStatus_T GpuDataQueueDynamic::Push(std::vector<DataQueueItem> data) {
   for (size_t i = 0; i < data.size(); i++) {
     auto &item = data[i];
@@ -44,8 +52,12 @@ BlockQueueStatus_T GpuDataQueueDynamic::Push(std::vector<DataQueueItem> data) {
     item.device_addr_ = addr;
   }
 
-  node_info_[tail_].event_.reset(new cudaEvent_t());
-  CHECK_CUDA_RET_WITH_ERROR(cudaEventCreate(&(*(node_info_[tail_].event_))), "Cuda Create Event Failed");
+  // The per-slot event is created once and reused, synchronization-only events skip the timing bookkeeping.
+  if (node_info_[tail_].event_ == nullptr) {
+    node_info_[tail_].event_.reset(new cudaEvent_t());
+    CHECK_CUDA_RET_WITH_ERROR(cudaEventCreateWithFlags(&(*(node_info_[tail_].event_)), cudaEventDisableTiming),
+                              "Cuda Create Event Failed");
+  }
   CHECK_CUDA_RET_WITH_ERROR(cudaEventRecord(*(node_info_[tail_].event_), stream_), "Cuda Create Event Failed");
   node_info_[tail_].data_ = data;
   tail_ = (tail_ + 1) % (capacity_);
@@ -55,7 +67,6 @@ BlockQueueStatus_T GpuDataQueueDynamic::Push(std::vector<DataQueueItem> data) {
 
 BlockQueueStatus_T GpuDataQueueDynamic::Front(std::vector<DataQueueItem> *data) const {
   CHECK_CUDA_RET_WITH_ERROR(cudaEventSynchronize(*(node_info_[head_].event_)), "Cuda Event Syn Failed");
-  CHECK_CUDA_RET_WITH_ERROR(cudaEventDestroy(*(node_info_[head_].event_)), "Cuda Destroy Event Failed");
   for (auto &item : node_info_[head_].data_) {
     host_release_(item.data_ptr_, item.worker_id_);
   }
@@ -80,7 +91,14 @@ GpuQueue::GpuQueue(void *addr, const std::vector<size_t> &shape, const size_t &c
   }
 }
 
-GpuQueue::~GpuQueue() { buffer_ = nullptr; }
+GpuQueue::~GpuQueue() {
+  for (size_t i = 0; i < capacity_; ++i) {
+    if (node_info_[i].event_ != nullptr) {
+      (void)cudaEventDestroy(*(node_info_[i].event_));
+    }
+  }
+  buffer_ = nullptr;
+}
 
 BlockQueueStatus_T GpuQueue::Push(std::vector<DataQueueItem> data) {
   void *addr = reinterpret_cast<uint8_t *>(buffer_) + tail_ * len_;
@@ -106,8 +124,12 @@ BlockQueueStatus_T GpuQueue::Push(std::vector<DataQueueItem> data) {
     addr = reinterpret_cast<uint8_t *>(addr) + item.data_len_;
   }
 
-  node_info_[tail_].event_.reset(new cudaEvent_t());
-  CHECK_CUDA_RET_WITH_ERROR(cudaEventCreate(&(*(node_info_[tail_].event_))), "Cuda Create Event Failed");
+  // The per-slot event is created once and reused, synchronization-only events skip the timing bookkeeping.
+  if (node_info_[tail_].event_ == nullptr) {
+    node_info_[tail_].event_.reset(new cudaEvent_t());
+    CHECK_CUDA_RET_WITH_ERROR(cudaEventCreateWithFlags(&(*(node_info_[tail_].event_)), cudaEventDisableTiming),
+                              "Cuda Create Event Failed");
+  }
   CHECK_CUDA_RET_WITH_ERROR(cudaEventRecord(*(node_info_[tail_].event_), stream_), "Cuda Create Event Failed");
   node_info_[tail_].data_ = data;
   tail_ = (tail_ + 1) % (capacity_);
@@ -117,7 +139,6 @@ BlockQueueStatus_T GpuQueue::Push(std::vector<DataQueueItem> data) {
 
 BlockQueueStatus_T GpuQueue::Front(std::vector<DataQueueItem> *data) const {
   CHECK_CUDA_RET_WITH_ERROR(cudaEventSynchronize(*(node_info_[head_].event_)), "Cuda Event Syn Failed");
-  CHECK_CUDA_RET_WITH_ERROR(cudaEventDestroy(*(node_info_[head_].event_)), "Cuda Destroy Event Failed");
   for (auto &item : node_info_[head_].data_) {
     host_release_(item.data_ptr_, item.worker_id_);
   }
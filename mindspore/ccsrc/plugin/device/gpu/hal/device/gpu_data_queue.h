@@ -30,7 +30,7 @@ namespace device {
 class GpuDataQueueDynamic : public DataQueue {
  public:
   explicit GpuDataQueueDynamic(const size_t capacity);
-  virtual ~GpuDataQueueDynamic() = default;
+  virtual ~GpuDataQueueDynamic();
 
   BlockQueueStatus_T Push(std::vector<DataQueueItem> data);
   BlockQueueStatus_T Front(std::vector<DataQueueItem> *data) const;
@@ -22,6 +22,7 @@
 #include "ir/tensor.h"
 #include "plugin/device/gpu/hal/device/gpu_device_manager.h"
 #include "plugin/device/gpu/hal/device/gpu_memory_allocator.h"
+#include "plugin/device/gpu/hal/device/gpu_pinned_staging_pool.h"
 #include "plugin/device/gpu/hal/hardware/gpu_device_context.h"
 #include "plugin/device/gpu/hal/device/gpu_common.h"
 #ifdef ENABLE_DEBUGGER
@@ -67,7 +68,9 @@ bool GPUDeviceAddress::SyncDeviceToHost(size_t size, void *host_ptr) const {
     // nccl kernel input and output device address is aligned, may lead to host size is not equal to device size
     MS_LOG(INFO) << "Sync memory size is inconsistent, host size: " << size << ", device size " << size_;
   }
-  return GPUDeviceManager::GetInstance().CopyDeviceMemToHost(host_ptr, ptr_, size);
+  // host_ptr is usually pageable tensor data; staging through cached pinned chunks gets the full DMA
+  // bandwidth and avoids the driver's internal staging on every data_sync.
+  return GPUPinnedStagingPool::GetInstance().CopyDeviceMemToHost(host_ptr, ptr_, size, stream);
 }
 
 bool GPUDeviceAddress::SyncHostToDevice(size_t size, const void *host_ptr) const {
@@ -16,6 +16,7 @@
 
 #include "plugin/device/gpu/hal/device/gpu_device_manager.h"
 #include "plugin/device/gpu/hal/device/gpu_common.h"
+#include "plugin/device/gpu/hal/device/gpu_pinned_staging_pool.h"
 #include "utils/log_adapter.h"
 #include "include/common/utils/convert_utils.h"
 
@@ -55,6 +56,8 @@ void GPUDeviceManager::ReleaseDevice() {
     return;
   }
 
+  GPUPinnedStagingPool::GetInstance().Clear();
+
   for (CudaDeviceStream stream : gpu_streams_) {
     if (stream != nullptr) {
       CHECK_OP_RET_WITH_ERROR(CudaDriver::DestroyStream(stream), "Failed to destroy CUDA stream.");
@@ -0,0 +1,154 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/hal/device/gpu_pinned_staging_pool.h"
+#include <algorithm>
+#include "utils/log_adapter.h"
+#include "securec/include/securec.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+namespace {
+inline void *AddressOffset(void *addr, size_t offset) { return static_cast<uint8_t *>(addr) + offset; }
+
+// 4MB chunks: large enough that the DMA saturates the PCIe link, small enough that the pipelined
+// host-side memcpy of one chunk hides under the transfer of the next.
+constexpr size_t kStagingChunkSize = 4 << 20;
+// At most two chunks are in flight per copy; cache a few more for concurrent readers before falling
+// back to pageable copies, so a burst of data_sync calls cannot pin unbounded host memory.
+constexpr size_t kMaxStagingChunkNum = 8;
+}  // namespace
+
+GPUPinnedStagingPool &GPUPinnedStagingPool::GetInstance() {
+  static GPUPinnedStagingPool instance;
+  return instance;
+}
+
+GPUPinnedStagingPool::~GPUPinnedStagingPool() { Clear(); }
+
+bool GPUPinnedStagingPool::AcquireChunk(StagingChunk *chunk) {
+  MS_EXCEPTION_IF_NULL(chunk);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!free_chunks_.empty()) {
+    *chunk = free_chunks_.back();
+    free_chunks_.pop_back();
+    return true;
+  }
+  if (total_chunk_num_ >= kMaxStagingChunkNum) {
+    return false;
+  }
+  StagingChunk new_chunk;
+  if (CudaDriver::AllocHostPinnedMem(kStagingChunkSize, &new_chunk.addr) == 0) {
+    return false;
+  }
+  if (!CudaDriver::CreateEvent(&new_chunk.event, cudaEventDisableTiming)) {
+    CudaDriver::FreeHostPinnedMem(new_chunk.addr);
+    return false;
+  }
+  ++total_chunk_num_;
+  *chunk = new_chunk;
+  return true;
+}
+
+void GPUPinnedStagingPool::ReleaseChunk(const StagingChunk &chunk) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  free_chunks_.push_back(chunk);
+}
+
+void GPUPinnedStagingPool::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (free_chunks_.size() != total_chunk_num_) {
+    MS_LOG(WARNING) << "Clear pinned staging pool while " << (total_chunk_num_ - free_chunks_.size())
+                    << " chunks are still in use.";
+  }
+  for (auto &chunk : free_chunks_) {
+    (void)CudaDriver::DestroyEvent(chunk.event);
+    CudaDriver::FreeHostPinnedMem(chunk.addr);
+  }
+  free_chunks_.clear();
+  total_chunk_num_ = 0;
+}
+
+bool GPUPinnedStagingPool::CopyDeviceMemToHost(void *dst, const DeviceMemPtr &src, size_t size,
+                                               const CudaDeviceStream &stream) {
+  MS_EXCEPTION_IF_NULL(dst);
+  StagingChunk chunks[2];
+  size_t chunk_num = size > kStagingChunkSize ? 2 : 1;
+  for (size_t i = 0; i < chunk_num; ++i) {
+    if (!AcquireChunk(&chunks[i])) {
+      for (size_t j = 0; j < i; ++j) {
+        ReleaseChunk(chunks[j]);
+      }
+      MS_LOG(INFO) << "No pinned staging chunk available, fall back to pageable copy, size: " << size;
+      return CudaDriver::CopyDeviceMemToHost(dst, src, size);
+    }
+  }
+
+  // Double-buffered pipeline: while chunk i is being filled by the DMA engine, the chunk issued before
+  // it is synced and drained to the pageable destination, so the host memcpy overlaps the transfer.
+  bool ret = true;
+  size_t pending_offset[2] = {0, 0};
+  size_t pending_size[2] = {0, 0};
+  size_t offset = 0;
+  size_t index = 0;
+  while (ret && offset < size) {
+    if (pending_size[index] != 0) {
+      ret = CudaDriver::SyncEvent(chunks[index].event);
+      if (ret) {
+        auto err = memcpy_s(AddressOffset(dst, pending_offset[index]), size - pending_offset[index],
+                            chunks[index].addr, pending_size[index]);
+        ret = (err == EOK);
+        if (!ret) {
+          MS_LOG(ERROR) << "Memcpy from staging chunk failed, errorno: " << err;
+        }
+      }
+      pending_size[index] = 0;
+    }
+    if (!ret) {
+      break;
+    }
+    size_t copy_size = std::min(kStagingChunkSize, size - offset);
+    ret = CudaDriver::CopyDeviceMemToHostAsync(chunks[index].addr, AddressOffset(src, offset), copy_size, stream) &&
+          CudaDriver::RecordEvent(chunks[index].event, stream);
+    pending_offset[index] = offset;
+    pending_size[index] = copy_size;
+    offset += copy_size;
+    index = (index + 1) % chunk_num;
+  }
+  for (size_t i = 0; ret && i < chunk_num; ++i) {
+    if (pending_size[index] != 0) {
+      ret = CudaDriver::SyncEvent(chunks[index].event);
+      if (ret) {
+        auto err = memcpy_s(AddressOffset(dst, pending_offset[index]), size - pending_offset[index],
+                            chunks[index].addr, pending_size[index]);
+        ret = (err == EOK);
+        if (!ret) {
+          MS_LOG(ERROR) << "Memcpy from staging chunk failed, errorno: " << err;
+        }
+      }
+      pending_size[index] = 0;
+    }
+    index = (index + 1) % chunk_num;
+  }
+  for (size_t i = 0; i < chunk_num; ++i) {
+    ReleaseChunk(chunks[i]);
+  }
+  return ret;
+}
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,68 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_HAL_DEVICE_GPU_PINNED_STAGING_POOL_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_HAL_DEVICE_GPU_PINNED_STAGING_POOL_H_
+
+#include <mutex>
+#include <vector>
+#include "plugin/device/gpu/hal/device/cuda_driver.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+// A small cache of pinned host chunks used to stage D2H reads onto a pageable destination, typically
+// tensor data_sync in pynative mode. A pageable cudaMemcpy stages through a driver-internal pinned
+// buffer anyway; staging through our own cached chunks instead gets the full pinned DMA bandwidth,
+// amortizes the expensive cudaHostAlloc across calls, and lets a large copy pipeline so the host-side
+// memcpy of one chunk overlaps the DMA of the next.
+class GPUPinnedStagingPool {
+ public:
+  static GPUPinnedStagingPool &GetInstance();
+
+  // Copy device memory to a (possibly pageable) host buffer through the staging chunks. The copies are
+  // issued on the given stream and the call returns only when dst is fully written, matching the
+  // synchronous CopyDeviceMemToHost it replaces. Falls back to the plain pageable copy when pinned
+  // memory cannot be allocated.
+  bool CopyDeviceMemToHost(void *dst, const DeviceMemPtr &src, size_t size, const CudaDeviceStream &stream);
+
+  // Release all cached pinned chunks, called when the device is released.
+  void Clear();
+
+ private:
+  struct StagingChunk {
+    void *addr{nullptr};
+    CudaDeviceEvent event{nullptr};
+  };
+
+  GPUPinnedStagingPool() = default;
+  ~GPUPinnedStagingPool();
+  GPUPinnedStagingPool(const GPUPinnedStagingPool &) = delete;
+  GPUPinnedStagingPool &operator=(const GPUPinnedStagingPool &) = delete;
+
+  // Take a chunk from the free list, allocating one if the cache is empty. Returns false when
+  // cudaHostAlloc or event creation fails; the caller then falls back to a pageable copy.
+  bool AcquireChunk(StagingChunk *chunk);
+  void ReleaseChunk(const StagingChunk &chunk);
+
+  std::mutex mutex_;
+  std::vector<StagingChunk> free_chunks_;
+  size_t total_chunk_num_{0};
+};
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_HAL_DEVICE_GPU_PINNED_STAGING_POOL_H_
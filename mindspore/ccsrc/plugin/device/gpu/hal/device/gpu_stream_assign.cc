@@ -15,11 +15,13 @@
  */
 
 #include "plugin/device/gpu/hal/device/gpu_stream_assign.h"
+#include <map>
 #include <set>
 #include <string>
 #include <memory>
 #include <algorithm>
 #include <utility>
+#include "utils/hash_map.h"
 #include "plugin/device/gpu/hal/device/gpu_common.h"
 #include "plugin/device/gpu/hal/device/kernel_info_setter.h"
 #include "plugin/device/gpu/hal/device/gpu_device_manager.h"
@@ -27,6 +29,11 @@
 namespace mindspore {
 namespace device {
 namespace gpu {
+namespace {
+// Upper bound for the number of concurrent stream slots one graph may occupy.
+constexpr size_t kMaxConcurrentStreamNum = 4;
+constexpr size_t kInvalidSlot = SIZE_MAX;
+}  // namespace
 void AssignGpuStream(const std::shared_ptr<session::KernelGraph> &kernel_graph) {
   MS_EXCEPTION_IF_NULL(kernel_graph);
   std::vector<CNodePtr> allreduce_kernels;
@@ -60,6 +67,105 @@ void AssignGpuStream(const std::shared_ptr<session::KernelGraph> &kernel_graph)
   }
 }
 
+void AssignConcurrentStreams(const std::shared_ptr<session::KernelGraph> &kernel_graph,
+                             DeviceResManager *res_manager) {
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  MS_EXCEPTION_IF_NULL(res_manager);
+  auto execution_kernels = kernel_graph->execution_order();
+  if (execution_kernels.size() <= 1) {
+    return;
+  }
+  for (const auto &kernel : execution_kernels) {
+    MS_EXCEPTION_IF_NULL(kernel);
+    // Communication kernels and dynamic shape kernels depend on the single stream launch order, so keep the whole
+    // graph on the default stream in these cases.
+    if (common::AnfAlgo::IsCommunicationOp(kernel) || common::AnfAlgo::IsDynamicShape(kernel)) {
+      return;
+    }
+  }
+
+  // Partition the kernels into chains: a kernel without an in-graph producer opens a new chain, any other kernel
+  // stays on the chain of its first producer. Chains are mapped onto stream slots round robin.
+  mindspore::HashMap<AnfNodePtr, size_t> kernel_to_slot;
+  std::set<size_t> used_slots;
+  size_t chain_num = 0;
+  for (const auto &kernel : execution_kernels) {
+    size_t slot = kInvalidSlot;
+    size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+    for (size_t i = 0; i < input_num; ++i) {
+      auto producer = common::AnfAlgo::GetPrevNodeOutput(kernel, i, true).first;
+      auto iter = kernel_to_slot.find(producer);
+      if (iter != kernel_to_slot.end()) {
+        slot = iter->second;
+        break;
+      }
+    }
+    if (slot == kInvalidSlot) {
+      slot = chain_num++ % kMaxConcurrentStreamNum;
+    }
+    kernel_to_slot[kernel] = slot;
+    (void)used_slots.insert(slot);
+  }
+  if (used_slots.size() <= 1) {
+    return;
+  }
+
+  // Slot 0 keeps the default stream, every other slot gets its own stream from the resource manager.
+  std::map<size_t, size_t> slot_to_stream_id;
+  for (size_t slot : used_slots) {
+    if (slot == 0) {
+      continue;
+    }
+    size_t stream_id = 0;
+    if (!res_manager->CreateStream(&stream_id)) {
+      MS_LOG(WARNING) << "Failed to create concurrent stream, fall back to single stream execution.";
+      return;
+    }
+    slot_to_stream_id[slot] = stream_id;
+  }
+  for (const auto &kernel : execution_kernels) {
+    auto slot = kernel_to_slot[kernel];
+    if (slot != 0) {
+      common::AnfAlgo::SetNodeAttr(kAttrStream, MakeValue(slot_to_stream_id[slot]), kernel);
+    }
+  }
+
+  // Connect every cross stream producer->consumer edge with a cuda event: the producer records it after its launch
+  // and the consumer's stream waits on it before the consumer is launched.
+  std::set<std::pair<AnfNodePtr, AnfNodePtr>> connected_edges;
+  mindspore::HashMap<AnfNodePtr, std::vector<int64_t>> record_events;
+  mindspore::HashMap<AnfNodePtr, std::vector<int64_t>> wait_events;
+  for (const auto &kernel : execution_kernels) {
+    auto consumer_slot = kernel_to_slot[kernel];
+    size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+    for (size_t i = 0; i < input_num; ++i) {
+      auto producer = common::AnfAlgo::GetPrevNodeOutput(kernel, i, true).first;
+      auto iter = kernel_to_slot.find(producer);
+      if (iter == kernel_to_slot.end() || iter->second == consumer_slot) {
+        continue;
+      }
+      if (!connected_edges.insert(std::make_pair(producer, kernel)).second) {
+        continue;
+      }
+      CudaDeviceEvent event = nullptr;
+      if (!CudaDriver::CreateEvent(&event, cudaEventDisableTiming)) {
+        MS_LOG(EXCEPTION) << "Creating cuda event for the cross stream dependency failed.";
+      }
+      auto event_id = static_cast<int64_t>(reinterpret_cast<uintptr_t>(event));
+      record_events[producer].push_back(event_id);
+      wait_events[kernel].push_back(event_id);
+    }
+  }
+  for (const auto &item : record_events) {
+    common::AnfAlgo::SetNodeAttr(kAttrConcurrentRecordEvents, MakeValue(item.second), item.first);
+  }
+  for (const auto &item : wait_events) {
+    common::AnfAlgo::SetNodeAttr(kAttrConcurrentWaitEvents, MakeValue(item.second), item.first);
+  }
+  MS_LOG(INFO) << "Assign " << used_slots.size() << " concurrent streams for graph " << kernel_graph->graph_id()
+               << ", cross stream event num: " << connected_edges.size();
+}
+
 bool FindAllReduceStreamSwitchPos(const std::shared_ptr<session::KernelGraph> &kernel_graph,
                                   std::vector<SendRecvPair> *send_recv_pairs) {
   MS_EXCEPTION_IF_NULL(kernel_graph);
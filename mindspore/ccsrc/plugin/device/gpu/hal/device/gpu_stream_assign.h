@@ -23,6 +23,7 @@
 #include "backend/common/session/kernel_graph.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
+#include "runtime/hardware/device_context.h"
 
 namespace mindspore {
 namespace device {
@@ -52,6 +53,11 @@ struct StreamSwitchNode {
   }
 };
 void AssignGpuStream(const std::shared_ptr<session::KernelGraph> &kernel_graph);
+// Partition the kernels into independent chains, map the chains onto concurrent streams created through the resource
+// manager, and connect every cross stream data dependency with a record/wait event pair which the kernel executor
+// replays at launch time.
+void AssignConcurrentStreams(const std::shared_ptr<session::KernelGraph> &kernel_graph,
+                             DeviceResManager *res_manager);
 bool FindAllReduceStreamSwitchPos(const std::shared_ptr<session::KernelGraph> &kernel_graph,
                                   std::vector<SendRecvPair> *send_recv_pairs);
 // Find Send node position according to "mock" recv node.
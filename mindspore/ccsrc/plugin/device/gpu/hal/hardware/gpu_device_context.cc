@@ -27,6 +27,7 @@
 #include "plugin/device/gpu/hal/device/gpu_device_manager.h"
 #include "runtime/data_queue/data_queue_mgr.h"
 #include "kernel/common_utils.h"
+#include "utils/ms_utils.h"
 #include "plugin/device/gpu/hal/device/gpu_common.h"
 #include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/cuda_common.h"
 #include "plugin/device/gpu/hal/hardware/optimizer.h"
@@ -443,6 +444,34 @@ std::lock_guard<std::mutex> LockLaunchKernel(const void *stream) {
   // Lock kernel launch for the stream.
   return std::lock_guard<std::mutex>(*stream_mtx);
 }
+
+// Make the launch stream wait for the events recorded by the cross stream producers of the kernel.
+void WaitConcurrentEvents(const CNodePtr &kernel, void *stream) {
+  if (!common::AnfAlgo::HasNodeAttr(kAttrConcurrentWaitEvents, kernel)) {
+    return;
+  }
+  auto events = common::AnfAlgo::GetNodeAttr<std::vector<int64_t>>(kernel, kAttrConcurrentWaitEvents);
+  for (const auto &event_id : events) {
+    auto event = reinterpret_cast<CudaDeviceEvent>(static_cast<uintptr_t>(event_id));
+    if (!CudaDriver::StreamWaitEvent(stream, event)) {
+      MS_LOG(EXCEPTION) << "Wait cross stream event failed for kernel: " << kernel->fullname_with_scope();
+    }
+  }
+}
+
+// Record the events which the cross stream consumers of the kernel wait on.
+void RecordConcurrentEvents(const CNodePtr &kernel, void *stream) {
+  if (!common::AnfAlgo::HasNodeAttr(kAttrConcurrentRecordEvents, kernel)) {
+    return;
+  }
+  auto events = common::AnfAlgo::GetNodeAttr<std::vector<int64_t>>(kernel, kAttrConcurrentRecordEvents);
+  for (const auto &event_id : events) {
+    auto event = reinterpret_cast<CudaDeviceEvent>(static_cast<uintptr_t>(event_id));
+    if (!CudaDriver::RecordEvent(event, stream)) {
+      MS_LOG(EXCEPTION) << "Record cross stream event failed for kernel: " << kernel->fullname_with_scope();
+    }
+  }
+}
 }  // namespace
 
 void GPUKernelExecutor::Initialize() {
@@ -488,6 +517,14 @@ void GPUKernelExecutor::OptimizeGraph(const FuncGraphPtr &graph) const {
 
     // Assign the stream and insert the send/recv node for all reduce kernel, so must be the last in the optimizer.
     device::gpu::AssignGpuStream(kernel_graph);
+
+    // Experimental concurrent execution of independent kernel chains on multiple streams. Opt-in only: the device
+    // memory pool reuses freed buffers based on the host side launch order, which is only safe on a single stream,
+    // so memory reuse must be disabled when this is enabled.
+    static const bool enable_concurrent_streams = common::GetEnv("MS_DEV_ENABLE_CONCURRENT_STREAMS") == "1";
+    if (enable_concurrent_streams) {
+      device::gpu::AssignConcurrentStreams(kernel_graph, res_manager_);
+    }
   }
 }
 
@@ -569,12 +606,16 @@ bool GPUKernelExecutor::LaunchKernel(const CNodePtr &kernel, const std::vector<A
 #endif
     auto lock = LockLaunchKernel(stream);
     MS_LOG(DEBUG) << "Launch kernel: " << kernel->fullname_with_scope();
+    WaitConcurrentEvents(kernel, stream);
     ret = DoLaunchKernel(kernel, inputs, workspace, outputs, stream);
+    RecordConcurrentEvents(kernel, stream);
 #ifndef ENABLE_SECURITY
   } else {
     auto lock = LockLaunchKernel(stream);
     MS_LOG(DEBUG) << "Launch kernel: " << kernel->fullname_with_scope();
+    WaitConcurrentEvents(kernel, stream);
     ret = LaunchKernelWithProfiling(kernel, inputs, workspace, outputs, stream);
+    RecordConcurrentEvents(kernel, stream);
   }
 #endif
   if (!ret) {
@@ -667,6 +708,11 @@ bool GPUDeviceResManager::SyncStream(size_t stream_id) const {
 
   MS_EXCEPTION_IF_NULL(stream);
   bool result = GPUDeviceManager::GetInstance().SyncStream(stream);
+  if (result) {
+    // All the in-flight frees are now ordered before future work, the idle bufs of the pool become
+    // reusable by every stream.
+    GPUMemoryAllocator::GetInstance().SyncFreeStreamTags();
+  }
 #ifdef ENABLE_DUMP_IR
   if (!result) {
     mindspore::RDR::TriggerAll();
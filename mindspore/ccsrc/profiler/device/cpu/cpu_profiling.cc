@@ -20,10 +20,12 @@
 #include <cmath>
 #include <ctime>
 #include "profiler/device/cpu/cpu_data_saver.h"
+#include "profiler/device/sampling_profiler.h"
 #include "include/common/pybind_api/api_register.h"
 #include "utils/log_adapter.h"
 #include "include/common/utils/utils.h"
 #include "utils/ms_context.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace profiler {
@@ -36,6 +38,20 @@ void CPUProfiler::Init(const std::string &profileDataPath = "") {
   base_time_ = GetHostMonoTimeStamp();
   profile_data_path_ = profileDataPath;
   MS_LOG(INFO) << " Host start time(ns): " << base_time_ << " profile data path: " << profile_data_path_;
+  // Opt-in stack sampling for environments where external profilers can not be attached. The value
+  // is the sampling interval of each running thread in microseconds.
+  auto sampling_interval = common::GetEnv("MS_SAMPLING_PROFILER_INTERVAL");
+  if (!sampling_interval.empty()) {
+    uint64_t interval_us = 0;
+    try {
+      interval_us = static_cast<uint64_t>(std::stoull(sampling_interval));
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Invalid MS_SAMPLING_PROFILER_INTERVAL value: " << sampling_interval << ", " << e.what();
+    }
+    if (interval_us > 0) {
+      (void)SamplingProfiler::GetInstance().Start(profile_data_path_, interval_us);
+    }
+  }
 }
 
 void CPUProfiler::StepProfilingEnable(const bool enable_flag) {
@@ -176,6 +192,7 @@ void CPUProfiler::OpDataProducerEnd() {
 
 void CPUProfiler::Stop() {
   MS_LOG(INFO) << "Stop CPU Profiling";
+  SamplingProfiler::GetInstance().Stop();
   SaveProfileData();
   ClearInst();
 }
@@ -14,8 +14,13 @@
  * limitations under the License.
  */
 #include "profiler/device/gpu/gpu_data_saver.h"
+#include <algorithm>
 #include <fstream>
+#include <limits>
+#include <map>
 #include <numeric>
+#include <tuple>
+#include <utility>
 #include "sys/stat.h"
 #include "utils/log_adapter.h"
 #include "utils/ms_utils.h"
@@ -145,6 +150,7 @@ void GpuDataSaver::WriteFile(std::string out_path_dir, const BaseTime &start_tim
   WriteOpDetail(out_path_dir);
   WriteOpType(out_path_dir);
   WriteActivity(out_path_dir);
+  WriteCommOverlap(out_path_dir);
   WriteOpTimestamp(out_path_dir);
   WriteStartTime(out_path_dir, start_time);
   CpuProfilingTimeSynchronizedToGpu(start_time);
@@ -193,6 +199,97 @@ void GpuDataSaver::WriteActivity(const std::string &saver_base_dir) {
   }
 }
 
+void GpuDataSaver::WriteCommOverlap(const std::string &saver_base_dir) {
+  std::string file_path_base = saver_base_dir + "/comm_overlap_analyse_";
+  for (auto &device_info : activity_infos_) {
+    // Split the activities into communication kernel intervals and compute kernel intervals. On GPU the
+    // communication ops all run as nccl kernels on their own streams.
+    std::vector<std::tuple<std::string, uint64_t, uint64_t>> comm_intervals;
+    std::vector<std::pair<uint64_t, uint64_t>> compute_intervals;
+    for (auto &activity : device_info.second) {
+      auto &activity_data = activity.second;
+      if (activity_data.basic_info_->activity_type != ActivityType::kKernel) {
+        continue;
+      }
+      bool is_comm = activity_data.basic_info_->kernel_name.find("nccl") != std::string::npos;
+      for (auto &start_duration : activity_data.start_duration) {
+        uint64_t start = start_duration.start_timestamp;
+        uint64_t end = start + static_cast<uint64_t>(start_duration.duration * kTimeUnit);
+        if (is_comm) {
+          (void)comm_intervals.emplace_back(activity_data.basic_info_->kernel_name, start, end);
+        } else {
+          (void)compute_intervals.emplace_back(start, end);
+        }
+      }
+    }
+    if (comm_intervals.empty()) {
+      MS_LOG(INFO) << "No communication kernel found on device " << device_info.first
+                   << ", skip the comm overlap analyse.";
+      continue;
+    }
+    // Merge the compute intervals into a disjoint coverage timeline.
+    std::sort(compute_intervals.begin(), compute_intervals.end());
+    std::vector<std::pair<uint64_t, uint64_t>> merged;
+    for (auto &interval : compute_intervals) {
+      if (!merged.empty() && interval.first <= merged.back().second) {
+        merged.back().second = std::max(merged.back().second, interval.second);
+      } else {
+        (void)merged.emplace_back(interval);
+      }
+    }
+    auto covered_time = [&merged](uint64_t start, uint64_t end) -> uint64_t {
+      uint64_t covered = 0;
+      auto iter =
+        std::upper_bound(merged.begin(), merged.end(), std::make_pair(start, std::numeric_limits<uint64_t>::max()));
+      if (iter != merged.begin()) {
+        --iter;
+        if (iter->second <= start) {
+          ++iter;
+        }
+      }
+      for (; iter != merged.end() && iter->first < end; ++iter) {
+        covered += std::min(end, iter->second) - std::max(start, iter->first);
+      }
+      return covered;
+    };
+    // Aggregate per kernel name: one fused allreduce bucket keeps one kernel name, so every row of the
+    // report is one fusion bucket.
+    struct CommOverlapData {
+      int count{0};
+      float total_duration{0};
+      float overlapped_duration{0};
+    };
+    std::map<std::string, CommOverlapData> comm_overlap_infos;
+    for (auto &comm_interval : comm_intervals) {
+      auto &info = comm_overlap_infos[std::get<0>(comm_interval)];
+      auto start = std::get<1>(comm_interval);
+      auto end = std::get<2>(comm_interval);
+      info.count++;
+      info.total_duration += (end - start) / kTimeUnit;
+      info.overlapped_duration += covered_time(start, end) / kTimeUnit;
+    }
+    // Write the comm overlap result csv.
+    std::string file_path = file_path_base + std::to_string(device_info.first) + ".csv";
+    std::ofstream ofs(file_path);
+    if (!ofs.is_open()) {
+      MS_LOG(WARNING) << "Open file '" << file_path << "' failed!";
+      return;
+    }
+    ofs << "kernel_name,occurrences,total_duration(us),overlapped_duration(us),exposed_duration(us),overlap_ratio"
+        << std::endl;
+    for (auto &comm_overlap : comm_overlap_infos) {
+      auto &info = comm_overlap.second;
+      float exposed = info.total_duration - info.overlapped_duration;
+      float ratio = info.total_duration > 0 ? info.overlapped_duration / info.total_duration : 0;
+      ofs << "\"" << comm_overlap.first << "\"," << info.count << ',' << info.total_duration << ','
+          << info.overlapped_duration << ',' << exposed << ',' << ratio << std::endl;
+    }
+    ofs.close();
+    ChangeFileMode(file_path);
+    MS_LOG(INFO) << "Write " << comm_overlap_infos.size() << " comm overlap infos into file: " << file_path;
+  }
+}
+
 void GpuDataSaver::WriteStepTraceAsyncLaunchKernel(const std::string &saver_base_dir) {
   std::string file_path = saver_base_dir + "/step_trace_profiling_" + device_id_ + ".txt";
   std::ofstream ofs(file_path);
@@ -90,6 +90,12 @@ class GpuDataSaver : public DataSaver {
 
   void WriteStepTrace(const std::string &saver_base_dir);
 
+  // Analyse how well every communication kernel overlapped concurrent compute: for each one, the covered
+  // part of its duration is the union of the compute kernel intervals of the other streams, the rest is
+  // exposed communication time. Aggregated per kernel name, which keeps one row per allreduce fusion
+  // bucket, so the fusion configuration can be tuned from the report instead of from eyeballed timelines.
+  void WriteCommOverlap(const std::string &saver_base_dir);
+
   void WriteStepTraceAsyncLaunchKernel(const std::string &saver_base_dir);
 
   void WriteStartTime(const std::string &saver_base_dir, const BaseTime &start_time);
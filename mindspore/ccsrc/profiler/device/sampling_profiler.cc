@@ -0,0 +1,225 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profiler/device/sampling_profiler.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include "utils/log_adapter.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <csignal>
+#include <ctime>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace mindspore {
+namespace profiler {
+namespace {
+constexpr size_t kMaxSamples = 32768;
+constexpr uint64_t kUSecondInSecond = 1000000;
+constexpr uint64_t kNSecondInSecond = 1000000000;
+
+// Tag of the work the current thread runs, read by the signal handler on the same thread.
+thread_local uint64_t t_thread_tag = 0;
+// Stack range of the current thread, registered outside the handler by RegisterCurrentThreadStack.
+// Every frame dereference of the walk is bounded to this range, so the walk can not touch unmapped
+// memory even when a build without frame pointers leaves spill data in the frame slots. A zero
+// high bound means the thread is not registered and only a frameless sample is taken.
+thread_local uintptr_t t_stack_low = 0;
+thread_local uintptr_t t_stack_high = 0;
+}  // namespace
+
+SamplingProfiler &SamplingProfiler::GetInstance() {
+  static SamplingProfiler instance;
+  return instance;
+}
+
+void SamplingProfiler::SetThreadTag(uint64_t tag) {
+  t_thread_tag = tag;
+  RegisterCurrentThreadStack();
+}
+
+void SamplingProfiler::RegisterCurrentThreadStack() {
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
+  if (t_stack_high != 0) {
+    return;
+  }
+  pthread_attr_t attr;
+  if (pthread_getattr_np(pthread_self(), &attr) != 0) {
+    return;
+  }
+  void *stack_addr = nullptr;
+  size_t stack_size = 0;
+  if (pthread_attr_getstack(&attr, &stack_addr, &stack_size) == 0) {
+    t_stack_low = reinterpret_cast<uintptr_t>(stack_addr);
+    t_stack_high = t_stack_low + stack_size;
+  }
+  (void)pthread_attr_destroy(&attr);
+#endif
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+/*
+ * SIGPROF handler. Everything here must be async-signal-safe: no allocation, no locks, no
+ * logging. The slot is claimed with a fetch_add and samples are dropped once the ring is full.
+ */
+void SamplingProfilerSignalHandler(int, void *, void *) {
+  auto &profiler = SamplingProfiler::GetInstance();
+  if (!profiler.enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  size_t slot = profiler.sample_num_.fetch_add(1, std::memory_order_relaxed);
+  if (slot >= profiler.samples_.size()) {
+    return;
+  }
+  StackSample &sample = profiler.samples_[slot];
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  sample.timestamp_ns = static_cast<uint64_t>(ts.tv_sec) * kNSecondInSecond + static_cast<uint64_t>(ts.tv_nsec);
+  sample.thread_id = static_cast<uint64_t>(syscall(SYS_gettid));
+  sample.tag = t_thread_tag;
+  sample.frame_num = 0;
+
+  // Walk the frame pointer chain: [fp] is the caller frame pointer, [fp + 1] the return address.
+  // The chain ends at a null, misaligned or non monotonic frame, or one outside the registered
+  // stack range of this thread, so every dereference hits mapped stack memory. Threads that never
+  // registered their stack (see RegisterCurrentThreadStack) keep a frameless sample.
+  if (t_stack_high == 0) {
+    return;
+  }
+  uintptr_t fp = reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+  while (sample.frame_num < StackSample::kMaxFrames) {
+    if (fp < t_stack_low || fp + (2 * sizeof(uintptr_t)) > t_stack_high || (fp % sizeof(uintptr_t)) != 0) {
+      break;
+    }
+    uintptr_t next_fp = reinterpret_cast<uintptr_t *>(fp)[0];
+    uintptr_t ret_addr = reinterpret_cast<uintptr_t *>(fp)[1];
+    if (ret_addr == 0) {
+      break;
+    }
+    sample.pcs[sample.frame_num++] = static_cast<uint64_t>(ret_addr);
+    if (next_fp <= fp) {
+      break;
+    }
+    fp = next_fp;
+  }
+}
+
+bool SamplingProfiler::Start(const std::string &output_path, uint64_t interval_us) {
+  if (enabled_.load()) {
+    MS_LOG(WARNING) << "Sampling profiler is already running.";
+    return false;
+  }
+  if (interval_us == 0) {
+    MS_LOG(ERROR) << "Sampling interval must be greater than 0.";
+    return false;
+  }
+  output_path_ = output_path;
+  samples_.assign(kMaxSamples, StackSample());
+  sample_num_ = 0;
+  RegisterCurrentThreadStack();
+
+  struct sigaction action;
+  (void)memset(&action, 0, sizeof(action));
+  action.sa_sigaction = [](int sig, siginfo_t *info, void *ucontext) {
+    SamplingProfilerSignalHandler(sig, info, ucontext);
+  };
+  action.sa_flags = SA_RESTART | SA_SIGINFO;
+  (void)sigemptyset(&action.sa_mask);
+  if (sigaction(SIGPROF, &action, nullptr) != 0) {
+    MS_LOG(ERROR) << "Failed to install the SIGPROF handler, errno: " << errno;
+    return false;
+  }
+  enabled_.store(true);
+
+  struct itimerval timer;
+  timer.it_interval.tv_sec = static_cast<time_t>(interval_us / kUSecondInSecond);
+  timer.it_interval.tv_usec = static_cast<suseconds_t>(interval_us % kUSecondInSecond);
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+    MS_LOG(ERROR) << "Failed to arm the profiling timer, errno: " << errno;
+    enabled_.store(false);
+    return false;
+  }
+  MS_LOG(INFO) << "Sampling profiler started, interval(us): " << interval_us << ", output path: " << output_path_;
+  return true;
+}
+
+void SamplingProfiler::Stop() {
+  if (!enabled_.load()) {
+    return;
+  }
+  struct itimerval timer;
+  (void)memset(&timer, 0, sizeof(timer));
+  (void)setitimer(ITIMER_PROF, &timer, nullptr);
+  enabled_.store(false);
+
+  struct sigaction action;
+  (void)memset(&action, 0, sizeof(action));
+  action.sa_handler = SIG_IGN;
+  (void)sigaction(SIGPROF, &action, nullptr);
+
+  WriteSamples();
+  samples_.clear();
+  samples_.shrink_to_fit();
+}
+
+void SamplingProfiler::WriteSamples() {
+  size_t valid_num = std::min(sample_num_.load(), samples_.size());
+  std::string prefix = output_path_ + "/sampling_profiler_" + std::to_string(getpid());
+  std::ofstream sample_file(prefix + ".samples", std::ios::binary);
+  if (!sample_file.is_open()) {
+    MS_LOG(ERROR) << "Failed to open the sample file: " << prefix << ".samples";
+    return;
+  }
+  // Header: magic, version and sample count, followed by the raw fixed size sample records.
+  const char magic[4] = {'M', 'S', 'S', 'P'};
+  const uint32_t version = 1;
+  const uint64_t count = valid_num;
+  (void)sample_file.write(magic, sizeof(magic));
+  (void)sample_file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+  (void)sample_file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+  (void)sample_file.write(reinterpret_cast<const char *>(samples_.data()),
+                          static_cast<std::streamsize>(valid_num * sizeof(StackSample)));
+  sample_file.close();
+
+  // The module map is required to symbolize the raw pcs offline.
+  std::ifstream maps_in("/proc/self/maps");
+  std::ofstream maps_out(prefix + ".maps");
+  if (maps_in.is_open() && maps_out.is_open()) {
+    maps_out << maps_in.rdbuf();
+  }
+  MS_LOG(INFO) << "Sampling profiler wrote " << valid_num << " samples to " << prefix << ".samples"
+               << (sample_num_.load() > valid_num ? ", ring was full, tail samples dropped" : "");
+}
+#else
+bool SamplingProfiler::Start(const std::string &, uint64_t) {
+  MS_LOG(WARNING) << "The sampling profiler is not supported on this platform.";
+  return false;
+}
+
+void SamplingProfiler::Stop() {}
+
+void SamplingProfiler::WriteSamples() {}
+#endif
+}  // namespace profiler
+}  // namespace mindspore
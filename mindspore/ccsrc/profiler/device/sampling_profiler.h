@@ -0,0 +1,85 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PROFILER_DEVICE_SAMPLING_PROFILER_H
+#define MINDSPORE_CCSRC_PROFILER_DEVICE_SAMPLING_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mindspore {
+namespace profiler {
+// One stack sample taken from the SIGPROF handler. The pcs are raw return addresses, symbolized
+// offline against the module map dumped next to the samples, so the handler does no allocation,
+// no locking and no symbol lookup.
+struct StackSample {
+  static constexpr size_t kMaxFrames = 32;
+  uint64_t timestamp_ns{0};
+  uint64_t thread_id{0};
+  // Tag of the work the thread was running, see SetThreadTag. For actor threads this is the actor
+  // address, resolved with the actor table the scheduler dumps at transform time.
+  uint64_t tag{0};
+  uint32_t frame_num{0};
+  uint64_t pcs[kMaxFrames];
+};
+
+// Built-in sampling profiler for environments where external profilers can not be attached.
+// SIGPROF fires on the threads consuming CPU time, the handler walks the frame pointer chain into
+// a preallocated ring and Stop writes the raw samples plus /proc/self/maps for offline
+// symbolization. The handler path is async-signal-safe.
+class SamplingProfiler {
+ public:
+  static SamplingProfiler &GetInstance();
+  SamplingProfiler(const SamplingProfiler &) = delete;
+  SamplingProfiler &operator=(const SamplingProfiler &) = delete;
+
+  // Arm the SIGPROF timer. interval_us is the CPU time between samples of each running thread.
+  bool Start(const std::string &output_path, uint64_t interval_us);
+  // Disarm the timer and write <output_path>/sampling_profiler_<pid>.samples and .maps.
+  void Stop();
+  bool enabled() const { return enabled_.load(); }
+
+  // Tag the work the calling thread is running from now on; recorded into every sample of the
+  // thread until overwritten. Zero cost when the profiler is off, one relaxed store otherwise.
+  // Also registers the stack range of the calling thread, which the handler needs before it can
+  // walk frames on this thread.
+  static void SetThreadTag(uint64_t tag);
+
+ private:
+  SamplingProfiler() = default;
+  ~SamplingProfiler() = default;
+  void WriteSamples();
+  // Look up the stack range of the calling thread and cache it thread locally. Must be called
+  // outside the signal handler (the lookup is not async-signal-safe); threads without a
+  // registered range contribute frameless samples.
+  static void RegisterCurrentThreadStack();
+
+  std::atomic<bool> enabled_{false};
+  std::string output_path_;
+  // Preallocated before the timer is armed; the handler only claims slots with a fetch_add and
+  // drops samples once the ring is full, so capture cost stays bounded.
+  std::vector<StackSample> samples_;
+  std::atomic<size_t> sample_num_{0};
+
+  friend void SamplingProfilerSignalHandler(int, void *, void *);
+};
+}  // namespace profiler
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PROFILER_DEVICE_SAMPLING_PROFILER_H
@@ -315,27 +315,22 @@ bool Worker::DoPSEmbeddingLookup(const Key &key, const std::vector<int> &lookup_
   }
 
   int64_t single_id_len = SizeToLong(lookup_result->size() / lookup_ids.size());
-  mindspore::HashMap<Key, std::shared_ptr<std::pair<float *, int64_t>>> id_addr_map;
-  std::shared_ptr<std::vector<float>> values = std::make_shared<std::vector<float>>();
-  std::shared_ptr<std::vector<Key>> keys = std::make_shared<std::vector<Key>>();
+  mindspore::HashMap<Key, const float *> id_addr_map;
+  std::vector<float> values;
+  std::vector<Key> keys;
   int64_t value_offset = 0;
   for (size_t i = 0; i < resp.size(); ++i) {
     KVMessage message;
     CHECK_RETURN_TYPE(message.ParseFromArray(resp.at(i)->data(), resp.at(i)->size()));
-    for (auto j = 0; j < message.values_size(); j++) {
-      values->push_back(message.values(j));
-    }
-    for (auto k = 0; k < message.keys_size(); k++) {
-      const Key &message_key = message.keys(k);
-      keys->push_back(message_key);
-    }
+    // Merge the batched response of each server shard in bulk instead of element by element.
+    (void)values.insert(values.end(), message.values().begin(), message.values().end());
+    (void)keys.insert(keys.end(), message.keys().begin(), message.keys().end());
   }
 
-  for (size_t i = 0; i < keys->size(); i++) {
-    const Key &map_key = keys->at(i);
-    float *addr = values->data() + value_offset;
+  id_addr_map.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    id_addr_map[keys[i]] = values.data() + value_offset;
     value_offset += single_id_len;
-    id_addr_map[map_key] = std::make_shared<std::pair<float *, int64_t>>(std::make_pair(addr, single_id_len));
   }
 
   float *result_addr = lookup_result->data();
@@ -351,12 +346,11 @@ bool Worker::DoPSEmbeddingLookup(const Key &key, const std::vector<int> &lookup_
       continue;
     }
     const Key &id_key = static_cast<Key>(lookup_ids[i]);
-    auto &pair = id_addr_map[id_key];
     size_t size = LongToSize(single_id_len * sizeof(float));
     dst_size = size;
     src_size = size;
     dst_data = result_addr + offset;
-    src_data = pair->first;
+    src_data = const_cast<float *>(id_addr_map[id_key]);
     MS_ERROR_IF_NULL(dst_data);
     MS_ERROR_IF_NULL(src_data);
     auto mem_ret = memcpy_s(dst_data, dst_size, src_data, src_size);
@@ -683,14 +677,16 @@ void Worker::LookupIdPartitioner(const EmbeddingTableLookup &send, PartitionEmbe
     const EmbeddingTableShardMetadata &range = ranges[i];
     const auto &begin = range.begin();
     const auto &end = range.end();
-    mindspore::HashSet<int32_t> unique_ids;
+    // Coalesce the lookup ids of one step into a sorted unique batch, so that each id is queried at most once
+    // and the server gathers the embedding table rows in ascending order.
+    std::set<int32_t> unique_ids;
     auto &kvs = partition->at(i).second;
 
     kvs.set_key(key);
 
     std::for_each(send.keys().begin(), send.keys().end(), [&](int32_t lookup_id) {
       if (lookup_id >= SizeToInt(begin) && lookup_id <= SizeToInt(end)) {
-        unique_ids.insert(lookup_id);
+        (void)unique_ids.insert(lookup_id);
       }
     });
     MS_LOG(DEBUG) << "The unique ids size is:" << unique_ids.size();
@@ -901,9 +897,8 @@ void Worker::UpdateEmbeddingPartitioner(const KVMessage &send, PartitionKVMessag
       auto lookup_id = lookup_ids[j];
       if (lookup_id >= begin && lookup_id <= end) {
         kvs.add_keys(lookup_id);
-        for (size_t k = 0; k < embedding_dim; k++) {
-          kvs.add_values(embedding_vals[j * embedding_dim + k]);
-        }
+        // Append the whole embedding row at once instead of value by value.
+        kvs.mutable_values()->Add(embedding_vals + j * embedding_dim, embedding_vals + (j + 1) * embedding_dim);
       }
     }
 
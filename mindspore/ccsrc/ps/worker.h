@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <map>
 #include <mutex>
+#include <set>
 
 #include "utils/hash_map.h"
 #include "utils/hash_set.h"
@@ -382,6 +382,19 @@ py::array TensorPy::SyncAsNumpy(const Tensor &tensor) {
   return AsNumpy(tensor);
 }
 
+py::buffer_info TensorPy::GetBuffer(const Tensor &tensor) {
+  {
+    // Buffer consumers bypass asnumpy(), so make sure the host data is the latest before
+    // the data pointer leaves the C++ side.
+    py::gil_scoped_release gil_release;
+    if (tensor.NeedWait()) {
+      tensor.Wait();
+    }
+    tensor.data_sync();
+  }
+  return GetPyBufferInfo(tensor);
+}
+
 py::array TensorPy::AsNumpy(const Tensor &tensor) {
   py::object self = py::cast(&tensor);
   auto data_numpy = dynamic_cast<const TensorDataNumpy *>(&tensor.data());
@@ -426,7 +439,9 @@ REGISTER_PYBIND_DEFINE(TensorGroup, ([](const py::module *m) {
                              }));
                          // Define python Tensor class.
                          // dtype should define before Tensor, because Tensor init depend dtype
-                         (void)py::class_<Tensor, MetaTensor, std::shared_ptr<Tensor>>(*m, "Tensor")
+                         (void)py::class_<Tensor, MetaTensor, std::shared_ptr<Tensor>>(*m, "Tensor",
+                                                                                      py::buffer_protocol())
+                           .def_buffer(TensorPy::GetBuffer)
                            .def(py::init([](const Tensor &tensor) { return std::make_shared<Tensor>(tensor); }),
                                 py::arg("input"))
                            .def(py::init([](const Tensor &tensor, const TypePtr &type_ptr) {
@@ -106,6 +106,15 @@ class TensorPy {
 
   static py::array SyncAsNumpy(const Tensor &tensor);
 
+  // brief Get a buffer protocol view over the tensor's host data without copy.
+  //
+  // The returned buffer shares memory with the tensor, so consumers such as memoryview or
+  // numpy.frombuffer can read or fill the tensor data in place. Device data is synchronized
+  // to host before the data pointer is exposed.
+  //
+  // param tensor [Tensor] The viewed tensor.
+  static py::buffer_info GetBuffer(const Tensor &tensor);
+
   static py::array AsNumpy(const Tensor &tensor);
 
   static py::tuple GetPyTupleShape(const Tensor &tensor);
@@ -24,44 +24,8 @@
 namespace py = pybind11;
 
 namespace mindspore {
-template <class T, typename vartype>
-class NormalDistribution;
-template <class T>
-class NormalDistribution<T, float> {
- public:
-  bool UInt32ToFloat32(uint32_t input, float *output) {
-    const uint32_t temp_value = input & 0x7fffffu;
-    const uint32_t exp = static_cast<uint32_t>(127);
-    const uint32_t val = (exp << 23) | temp_value;
-    errno_t mem_ret = memcpy_s(output, sizeof(float), &val, sizeof(uint32_t));
-    if (mem_ret != EOK) {
-      MS_LOG(ERROR) << "UInt32ToFloat32 memcpy is failed";
-      return false;
-    }
-    *output = *output - 1.0f;
-    return true;
-  }
-
-  std::array<float, kResultNum> operator()(T *generator) {
-    std::array<uint32_t, 4> generate_value = (*generator)();
-    const float PI = 3.14;
-    for (uint32_t i = 0; i < kResultNum; i += 2) {
-      float temp[2];
-      UInt32ToFloat32(generate_value[i], &temp[0]);
-      UInt32ToFloat32(generate_value[i + 1], &temp[1]);
-      const float threshold = 1.0e-7f;
-      temp[0] = temp[0] < threshold ? threshold : temp[0];
-      temp[1] = temp[1] < threshold ? threshold : temp[1];
-      result_[i] = sqrt(-2.0 * log(temp[0])) * sin(2 * PI * temp[1]);
-      result_[i + 1] = sqrt(-2.0 * log(temp[0])) * cos(2 * PI * temp[1]);
-    }
-    return result_;
-  }
-
- private:
-  std::array<float, kResultNum> result_;
-};
-
+// NormalDistribution and the other Philox based distributions live in
+// include/common/utils/philox_generator.h so that the CPU kernels share them.
 bool InitRandomNormal(std::vector<int64_t> out_shape, int64_t seed, int64_t seed2, const py::object &output_tensor);
 }  // namespace mindspore
 
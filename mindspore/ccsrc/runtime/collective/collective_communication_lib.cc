@@ -15,9 +15,15 @@
  */
 
 #include "runtime/collective/collective_communication_lib.h"
+#include <algorithm>
+#include <vector>
 
 namespace mindspore {
 namespace device {
+namespace {
+// Buckets below this element count are not worth the quantization cost and header overhead.
+constexpr size_t kCompressionMinCount = 1024;
+}  // namespace
 bool CollectiveCommunicationLib::Finalize() {
   if (!initialized_ || finalized_.load()) {
     return true;
@@ -69,6 +75,45 @@ CommunicationGroupPtr CollectiveCommunicationLib::GetGroup(const std::string &gr
   return groups_[group_name];
 }
 
+bool CollectiveCommunicationLib::AllReduceCompressed(const void *send_buff, void *recv_buff, size_t send_count,
+                                                     TypeId data_type, CollectiveOpReduceType reduce_op,
+                                                     const std::string &group_name, const std::string &bucket_key) {
+  // Compression only handles large float32 sum/mean buckets, everything else takes the plain path.
+  if (gradient_compressor_ == nullptr || data_type != kNumberTypeFloat32 ||
+      (reduce_op != Reduce_Sum && reduce_op != Reduce_Mean) || send_count < kCompressionMinCount) {
+    return AllReduce(send_buff, recv_buff, send_count, data_type, reduce_op, group_name);
+  }
+  uint32_t rank_size = GetGroupSize(group_name);
+  if (rank_size <= 1) {
+    return AllReduce(send_buff, recv_buff, send_count, data_type, reduce_op, group_name);
+  }
+
+  size_t wire_size = gradient_compressor_->CompressedSize(send_count);
+  std::vector<uint8_t> send_wire(wire_size);
+  if (!gradient_compressor_->Compress(bucket_key, static_cast<const float *>(send_buff), send_count,
+                                      send_wire.data())) {
+    return false;
+  }
+  std::vector<uint8_t> recv_wire(wire_size * rank_size);
+  if (!AllGather(send_wire.data(), recv_wire.data(), wire_size, kNumberTypeUInt8, group_name)) {
+    return false;
+  }
+
+  auto *output = static_cast<float *>(recv_buff);
+  std::fill(output, output + send_count, 0.0f);
+  for (uint32_t rank = 0; rank < rank_size; rank++) {
+    if (!gradient_compressor_->DecompressAccumulate(recv_wire.data() + rank * wire_size, send_count, output)) {
+      return false;
+    }
+  }
+  if (reduce_op == Reduce_Mean) {
+    for (size_t i = 0; i < send_count; i++) {
+      output[i] /= static_cast<float>(rank_size);
+    }
+  }
+  return true;
+}
+
 const std::string &CollectiveCommunicationLib::global_group_name() const { return global_group_name_; }
 
 uint32_t CollectiveCommunicationLib::global_rank_id() const { return global_rank_id_; }
@@ -24,6 +24,7 @@
 #include <string>
 #include "ir/dtype/type_id.h"
 #include "runtime/collective/communication_group.h"
+#include "runtime/collective/gradient_compression.h"
 
 namespace mindspore {
 namespace device {
@@ -103,6 +104,18 @@ class CollectiveCommunicationLib {
     return true;
   }
 
+  // AllReduce with the gradient compression stage. When a compressor is set and the bucket is a
+  // float32 sum/mean on host-accessible buffers, the bucket is compressed, exchanged through
+  // AllGather (quantized payloads cannot be summed by the transport) and reduced locally after
+  // decompression; otherwise it falls back to the plain AllReduce. 'bucket_key' identifies the
+  // bucket across steps so the compressor can keep its error-feedback residual.
+  bool AllReduceCompressed(const void *send_buff, void *recv_buff, size_t send_count, TypeId data_type,
+                           CollectiveOpReduceType reduce_op, const std::string &group_name,
+                           const std::string &bucket_key);
+
+  // Assign the compressor used by AllReduceCompressed, nullptr disables compression.
+  void set_gradient_compressor(const GradientCompressorPtr &compressor) { gradient_compressor_ = compressor; }
+
   virtual bool Send(const void *send_buff, size_t count, TypeId data_type, uint32_t peer, const std::string &group_name,
                     void *stream = nullptr) {
     return true;
@@ -147,6 +160,9 @@ class CollectiveCommunicationLib {
 
   // This map stores the groups which will be accessed and used by the caller.
   std::map<std::string, std::shared_ptr<CommunicationGroup>> groups_;
+
+  // The gradient compressor used by AllReduceCompressed, nullptr when compression is disabled.
+  GradientCompressorPtr gradient_compressor_;
 };
 using CollectiveCommunicationLibPtr = CollectiveCommunicationLib *;
 }  // namespace device
@@ -0,0 +1,105 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/collective/gradient_compression.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace mindspore {
+namespace device {
+namespace {
+// The wire header of an int8 compressed bucket: the min and max of the quantized values.
+constexpr size_t kInt8HeaderFloatNum = 2;
+constexpr float kInt8QuantLevels = 255.0f;
+constexpr float kInt8QuantOffset = 128.0f;
+}  // namespace
+
+size_t Int8GradientCompressor::CompressedSize(size_t count) const {
+  return kInt8HeaderFloatNum * sizeof(float) + count * sizeof(int8_t);
+}
+
+bool Int8GradientCompressor::Compress(const std::string &bucket_key, const float *input, size_t count, void *output) {
+  if (input == nullptr || output == nullptr || count == 0) {
+    return false;
+  }
+  auto &residual = residuals_[bucket_key];
+  if (residual.size() != count) {
+    // The bucket changed size (first step or regraphed bucket), restart the error feedback.
+    residual.assign(count, 0.0f);
+  }
+
+  // Fold the residual of the last step in before quantization.
+  std::vector<float> corrected(count);
+  for (size_t i = 0; i < count; i++) {
+    corrected[i] = input[i] + residual[i];
+  }
+  auto minmax = std::minmax_element(corrected.begin(), corrected.end());
+  float min_val = *minmax.first;
+  float max_val = *minmax.second;
+  float scale = (max_val - min_val) / kInt8QuantLevels;
+  if (scale == 0.0f || !std::isfinite(scale)) {
+    // A constant bucket quantizes exactly; non-finite gradients are passed through unscaled so
+    // the failure surfaces at the consumer instead of being silently clipped here.
+    scale = 1.0f;
+  }
+
+  auto *header = static_cast<float *>(output);
+  header[0] = min_val;
+  header[1] = max_val;
+  auto *payload = reinterpret_cast<int8_t *>(header + kInt8HeaderFloatNum);
+  for (size_t i = 0; i < count; i++) {
+    float level = std::round((corrected[i] - min_val) / scale - kInt8QuantOffset);
+    level = std::max(std::min(level, kInt8QuantOffset - 1.0f), -kInt8QuantOffset);
+    payload[i] = static_cast<int8_t>(level);
+    // The residual keeps the quantization error for the next step.
+    float dequantized = (level + kInt8QuantOffset) * scale + min_val;
+    residual[i] = corrected[i] - dequantized;
+  }
+  return true;
+}
+
+bool Int8GradientCompressor::DecompressAccumulate(const void *input, size_t count, float *output) const {
+  if (input == nullptr || output == nullptr || count == 0) {
+    return false;
+  }
+  const auto *header = static_cast<const float *>(input);
+  float min_val = header[0];
+  float max_val = header[1];
+  float scale = (max_val - min_val) / kInt8QuantLevels;
+  if (scale == 0.0f || !std::isfinite(scale)) {
+    scale = 1.0f;
+  }
+  const auto *payload = reinterpret_cast<const int8_t *>(header + kInt8HeaderFloatNum);
+  for (size_t i = 0; i < count; i++) {
+    output[i] += (static_cast<float>(payload[i]) + kInt8QuantOffset) * scale + min_val;
+  }
+  return true;
+}
+
+GradientCompressorPtr CreateGradientCompressor(GradCompressionType type) {
+  switch (type) {
+    case GradCompressionType::kInt8:
+      return std::make_shared<Int8GradientCompressor>();
+    case GradCompressionType::kNone:
+    default:
+      return nullptr;
+  }
+}
+}  // namespace device
+}  // namespace mindspore
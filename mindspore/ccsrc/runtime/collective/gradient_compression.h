@@ -0,0 +1,84 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_COLLECTIVE_GRADIENT_COMPRESSION_H_
+#define MINDSPORE_CCSRC_RUNTIME_COLLECTIVE_GRADIENT_COMPRESSION_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mindspore {
+namespace device {
+// The compression codec applied to gradient buckets before they enter the collective path.
+enum class GradCompressionType { kNone = 0, kInt8 };
+
+// The base class of gradient compressors plugged into the collective communication library.
+// A compressor turns a float32 gradient bucket into a smaller wire representation and back.
+// The lossy error is kept per bucket as an error-feedback residual which is added onto the
+// next compression of the same bucket, so the quantization noise does not accumulate over
+// steps. Compressors run on host-accessible buffers; device-resident buckets have to be
+// staged to host by the caller before compression.
+class GradientCompressor {
+ public:
+  GradientCompressor() = default;
+  virtual ~GradientCompressor() = default;
+
+  virtual GradCompressionType type() const = 0;
+
+  // Returns the wire size in bytes of a compressed bucket of 'count' float32 elements.
+  virtual size_t CompressedSize(size_t count) const = 0;
+
+  // Compress 'count' float32 elements of the bucket identified by 'bucket_key' into 'output',
+  // which must hold at least CompressedSize(count) bytes. The error-feedback residual of the
+  // bucket is folded in before quantization and updated afterwards.
+  virtual bool Compress(const std::string &bucket_key, const float *input, size_t count, void *output) = 0;
+
+  // Decompress a wire buffer of 'count' elements and accumulate the result into 'output'.
+  // Accumulation instead of assignment lets the caller sum the contributions of all ranks
+  // without an extra staging buffer.
+  virtual bool DecompressAccumulate(const void *input, size_t count, float *output) const = 0;
+
+  // Drop all error-feedback residuals, e.g. when the bucket layout changes between graphs.
+  virtual void Reset() = 0;
+};
+using GradientCompressorPtr = std::shared_ptr<GradientCompressor>;
+
+// Min-max linear quantization to int8 with error feedback, the same scheme the federated
+// learning module uses for weight upload, applied per gradient bucket. The wire format is a
+// header of two floats (min and max of the bucket) followed by one int8 per element.
+class Int8GradientCompressor : public GradientCompressor {
+ public:
+  Int8GradientCompressor() = default;
+  ~Int8GradientCompressor() override = default;
+
+  GradCompressionType type() const override { return GradCompressionType::kInt8; }
+  size_t CompressedSize(size_t count) const override;
+  bool Compress(const std::string &bucket_key, const float *input, size_t count, void *output) override;
+  bool DecompressAccumulate(const void *input, size_t count, float *output) const override;
+  void Reset() override { residuals_.clear(); }
+
+ private:
+  // Key: bucket key, Value: the error-feedback residual of the last compression of this bucket.
+  std::map<std::string, std::vector<float>> residuals_;
+};
+
+// Create the compressor for the given type, or nullptr for kNone.
+GradientCompressorPtr CreateGradientCompressor(GradCompressionType type);
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_RUNTIME_COLLECTIVE_GRADIENT_COMPRESSION_H_
@@ -20,12 +20,32 @@
 namespace mindspore {
 namespace device {
 const size_t kTimeout = 100;
+// Log the accumulated starvation metrics once per this many consumer-side empty waits.
+constexpr uint64_t kEmptyWaitLogInterval = 100;
+
 void BlockingQueue::RegisterRelease(const std::function<void(void *, int32_t)> &func) { queue_->RegisterRelease(func); }
 
+void BlockingQueue::RecordEmptyWait(const std::chrono::steady_clock::time_point &wait_start) {
+  auto waited_us = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - wait_start).count());
+  empty_wait_time_us_ += waited_us;
+  auto wait_count = ++empty_wait_count_;
+  if (wait_count % kEmptyWaitLogInterval == 0) {
+    MS_LOG(INFO) << "Data queue was empty when the device needed data " << wait_count << " times, waited "
+                 << (empty_wait_time_us_ / 1000) << "ms in total, capacity: " << queue_->Capacity()
+                 << ". Frequent waits mean the host pipeline cannot keep up with the configured prefetch depth.";
+  }
+}
+
 BlockQueueStatus_T BlockingQueue::Push(const std::vector<DataQueueItem> &data, unsigned int) {
-  std::unique_lock<std::mutex> locker(mutex_);
+  std::unique_lock<std::mutex> locker(producer_mutex_);
   if (queue_->IsFull()) {
-    if (not_full_cond_.wait_for(locker, std::chrono::microseconds(kTimeout)) == std::cv_status::timeout) {
+    std::unique_lock<std::mutex> waiter(wait_mutex_);
+    ++full_waiters_;
+    bool not_full =
+      not_full_cond_.wait_for(waiter, std::chrono::microseconds(kTimeout), [this] { return !queue_->IsFull(); });
+    --full_waiters_;
+    if (!not_full) {
       return TIMEOUT;
     }
   }
@@ -33,27 +53,51 @@ BlockQueueStatus_T BlockingQueue::Push(const std::vector<DataQueueItem> &data, u
   if (ret) {
     return ret;
   }
-  not_empty_cond_.notify_one();
+  // Notify the consumer only when it is blocked on the empty queue: the waiter counter is published before the
+  // consumer re-checks the queue size, so either the consumer sees the pushed data or the producer sees the waiter.
+  if (empty_waiters_ > 0) {
+    std::lock_guard<std::mutex> waiter(wait_mutex_);
+    not_empty_cond_.notify_one();
+  }
   return SUCCESS;
 }
 
 BlockQueueStatus_T BlockingQueue::Front(std::vector<DataQueueItem> *data) {
-  std::unique_lock<std::mutex> locker(mutex_);
-  bool timeout = not_empty_cond_.wait_for(locker, std::chrono::seconds(30), [this] { return !queue_->IsEmpty(); });
-  if (!timeout) {
-    return TIMEOUT;
+  std::unique_lock<std::mutex> locker(consumer_mutex_);
+  if (queue_->IsEmpty()) {
+    auto wait_start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> waiter(wait_mutex_);
+    ++empty_waiters_;
+    bool not_empty =
+      not_empty_cond_.wait_for(waiter, std::chrono::seconds(30), [this] { return !queue_->IsEmpty(); });
+    --empty_waiters_;
+    RecordEmptyWait(wait_start);
+    if (!not_empty) {
+      return TIMEOUT;
+    }
   }
   return queue_->Front(data);
 }
 
 BlockQueueStatus_T BlockingQueue::Pop() {
-  std::unique_lock<std::mutex> locker(mutex_);
-  not_empty_cond_.wait(locker, [this] { return !queue_->IsEmpty(); });
+  std::unique_lock<std::mutex> locker(consumer_mutex_);
+  if (queue_->IsEmpty()) {
+    auto wait_start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> waiter(wait_mutex_);
+    ++empty_waiters_;
+    not_empty_cond_.wait(waiter, [this] { return !queue_->IsEmpty(); });
+    --empty_waiters_;
+    RecordEmptyWait(wait_start);
+  }
   auto ret = queue_->Pop();
   if (ret) {
     return ret;
   }
-  not_full_cond_.notify_one();
+  // Notify a producer only when one is blocked on the full queue, symmetrical to Push.
+  if (full_waiters_ > 0) {
+    std::lock_guard<std::mutex> waiter(wait_mutex_);
+    not_full_cond_.notify_one();
+  }
   return SUCCESS;
 }
 
@@ -63,7 +107,9 @@ BlockQueueStatus_T BlockingQueue::Create(const std::shared_ptr<DataQueue> &data_
 }
 
 BlockQueueStatus_T BlockingQueue::Clear() {
-  std::unique_lock<std::mutex> locker(mutex_);
+  // Exclude both the producer and consumer sides while draining the queue.
+  std::unique_lock<std::mutex> producer_locker(producer_mutex_);
+  std::unique_lock<std::mutex> consumer_locker(consumer_mutex_);
   while (Size() > 0) {
     std::vector<DataQueueItem> data;
     auto ret = queue_->Front(&data);
@@ -75,6 +121,10 @@ BlockQueueStatus_T BlockingQueue::Clear() {
       return ret;
     }
   }
+  if (full_waiters_ > 0) {
+    std::lock_guard<std::mutex> waiter(wait_mutex_);
+    not_full_cond_.notify_all();
+  }
   return SUCCESS;
 }
 
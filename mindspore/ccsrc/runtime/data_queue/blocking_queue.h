@@ -18,6 +18,8 @@
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_GPU_BLOCKING_QUEUE_H_
 
 #include <unistd.h>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -43,11 +45,32 @@ class BlockingQueue {
   bool Destroy();
   size_t Size() { return queue_->Size(); }
   size_t Capacity() { return queue_->Capacity(); }
+  // Starvation metrics of the consumer side: how often and for how long the device-bound consumer found
+  // the queue empty. A growing wait time means the host pipeline cannot keep up with the configured
+  // prefetch depth and the device queue capacity or the input pipeline needs attention.
+  uint64_t EmptyWaitCount() const { return empty_wait_count_; }
+  uint64_t EmptyWaitTimeUs() const { return empty_wait_time_us_; }
 
  private:
-  std::mutex mutex_;
+  // Accumulate one consumer-side empty wait into the starvation counters.
+  void RecordEmptyWait(const std::chrono::steady_clock::time_point &wait_start);
+
+  // The producer and consumer sides of the ring are synchronized only by the atomic size of the data queue, so each
+  // side has its own mutex: producers are serialized with each other and consumers with each other, but a Push never
+  // convoys behind a Front/Pop on one global lock.
+  std::mutex producer_mutex_;
+  std::mutex consumer_mutex_;
+  // Only guards the blocking of threads when the queue is empty or full; queue operations do not hold it.
+  std::mutex wait_mutex_;
   std::condition_variable not_full_cond_;
   std::condition_variable not_empty_cond_;
+  // Numbers of threads blocked on the empty/full state. A notification is only needed when a counter is non-zero,
+  // so the uncontended fast path never touches wait_mutex_.
+  std::atomic<int> empty_waiters_{0};
+  std::atomic<int> full_waiters_{0};
+  // Cumulative consumer-side starvation counters, see EmptyWaitCount/EmptyWaitTimeUs.
+  std::atomic<uint64_t> empty_wait_count_{0};
+  std::atomic<uint64_t> empty_wait_time_us_{0};
   std::shared_ptr<DataQueue> queue_;
 };
 }  // namespace device
@@ -18,6 +18,7 @@
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_DATA_QUEUE_H_
 
 #include <unistd.h>
+#include <atomic>
 #include <string>
 #include <memory>
 #include <vector>
@@ -45,9 +46,12 @@ class DataQueue {
   virtual size_t Capacity() { return capacity_; }
 
  protected:
-  size_t head_;
-  size_t tail_;
-  size_t size_;
+  // The head is only mutated by the consumer side and the tail only by the producer side; keep them on separate
+  // cache lines to avoid false sharing between the producer and consumer threads. The atomic size is the
+  // synchronization point between both sides, so the ring entries themselves need no lock shared by them.
+  alignas(64) size_t head_;
+  alignas(64) size_t tail_;
+  alignas(64) std::atomic<size_t> size_;
   size_t capacity_;
 
   std::function<void(void *, int32_t)> host_release_;
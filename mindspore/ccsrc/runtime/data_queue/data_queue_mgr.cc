@@ -241,6 +241,22 @@ size_t DataQueueMgr::Capacity(const std::string &channel_name) {
   return name_queue_map_.at(channel_name)->Capacity();
 }
 
+uint64_t DataQueueMgr::EmptyWaitCount(const std::string &channel_name) {
+  if (!name_queue_map_.count(channel_name)) {
+    MS_LOG(ERROR) << "Queue not exist " << channel_name;
+    return 0;
+  }
+  return name_queue_map_.at(channel_name)->EmptyWaitCount();
+}
+
+uint64_t DataQueueMgr::EmptyWaitTimeUs(const std::string &channel_name) {
+  if (!name_queue_map_.count(channel_name)) {
+    MS_LOG(ERROR) << "Queue not exist " << channel_name;
+    return 0;
+  }
+  return name_queue_map_.at(channel_name)->EmptyWaitTimeUs();
+}
+
 bool PopDataFromDataQueue(const AnfNodePtr &data_kernel) {
   auto queue_name = common::AnfAlgo::GetNodeAttr<std::string>(data_kernel, "shared_name");
   device::DataQueueMgr &buf_mgr = device::DataQueueMgr::GetInstance();
@@ -105,6 +105,12 @@ class DataQueueMgr {
 
   EXPORT size_t Capacity(const std::string &channel_name);
 
+  // Consumer-side starvation metrics of a channel: number of device-side waits on an empty queue and the
+  // cumulative time spent waiting. Exposed so profiling and monitoring can spot misconfigured prefetch.
+  EXPORT uint64_t EmptyWaitCount(const std::string &channel_name);
+
+  EXPORT uint64_t EmptyWaitTimeUs(const std::string &channel_name);
+
  private:
   int cur_dev_id_;
   bool init_;
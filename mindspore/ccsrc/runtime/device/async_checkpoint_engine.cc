@@ -0,0 +1,198 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/device/async_checkpoint_engine.h"
+
+#include "runtime/device/stream_synchronizer.h"
+#include "runtime/hardware/device_context_manager.h"
+#include "distributed/persistent/storage/file_io_utils.h"
+#include "utils/ms_context.h"
+
+namespace mindspore {
+namespace device {
+namespace {
+// Per parameter, the serialized layout is: name length, name, data length, data.
+constexpr size_t kHeadersPerParameter = 2;
+constexpr size_t kInputsPerParameter = 4;
+}  // namespace
+
+std::mutex AsyncCheckpointEngine::instance_lock_;
+std::shared_ptr<AsyncCheckpointEngine> AsyncCheckpointEngine::instance_ = nullptr;
+
+void AsyncCheckpointEngine::Initialize() { worker_thread_ = std::thread(&AsyncCheckpointEngine::DoWriteTask, this); }
+
+void AsyncCheckpointEngine::Finalize() {
+  WaitAll();
+  {
+    std::unique_lock<std::mutex> lock(task_mutex_);
+    stop_ = true;
+  }
+  task_cv_.notify_all();
+  if (worker_thread_.joinable()) {
+    worker_thread_.join();
+  }
+}
+
+bool AsyncCheckpointEngine::Snapshot(const std::string &file_name, const std::vector<CheckpointParameter> &parameters,
+                                     const std::string &device_name) {
+  std::unique_lock<std::mutex> reentrant_lock(reentrant_mutex_);
+  auto ms_context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(ms_context);
+  uint32_t device_id = ms_context->get_param<uint32_t>(MS_CTX_DEVICE_ID);
+
+  const auto &device_context =
+    device::DeviceContextManager::GetInstance().GetOrCreateDeviceContext({device_name, device_id});
+  MS_EXCEPTION_IF_NULL(device_context);
+  device_context->Initialize();
+  MS_EXCEPTION_IF_NULL(device_context->device_res_manager_);
+
+  size_t total_size = 0;
+  for (const auto &parameter : parameters) {
+    MS_EXCEPTION_IF_NULL(parameter.device_address);
+    total_size += parameter.device_address->GetSize();
+  }
+  if (total_size == 0) {
+    MS_LOG(WARNING) << "There is no parameter data to snapshot for checkpoint file: " << file_name;
+    return false;
+  }
+
+  SnapshotTask task;
+  task.file_name = file_name;
+  task.staging_buffer = AcquireStagingBuffer(total_size, &task.staging_capacity);
+  MS_EXCEPTION_IF_NULL(task.staging_buffer);
+
+  // Wait for the compute stream that produces the parameters, with the timeout and recovery handling of the
+  // stream synchronizer, so the D2H copies below can safely overlap the following steps.
+  if (!StreamSynchronizer::GetInstance()->SyncStream(device_name)) {
+    MS_LOG(ERROR) << "Failed to synchronize stream before the checkpoint snapshot.";
+    return false;
+  }
+
+  // Stage the parameters through a dedicated copy stream, so the copies do not serialize with the kernels
+  // that the next step has already launched on the compute stream.
+  const auto &device_key = device_context->device_context_key().ToString();
+  if (copy_stream_ids_.count(device_key) == 0) {
+    size_t stream_id;
+    if (!device_context->device_res_manager_->CreateStream(&stream_id)) {
+      MS_LOG(ERROR) << "Failed to create the D2H copy stream for checkpoint snapshot.";
+      return false;
+    }
+    copy_stream_ids_[device_key] = stream_id;
+  }
+  size_t copy_stream_id = copy_stream_ids_[device_key];
+  auto copy_stream = device_context->device_res_manager_->GetStream(copy_stream_id);
+
+  size_t offset = 0;
+  for (const auto &parameter : parameters) {
+    const auto &device_address = parameter.device_address;
+    size_t data_size = device_address->GetSize();
+    if (data_size == 0) {
+      continue;
+    }
+    if (!device_address->AsyncDeviceToHost(device_address->host_shape(), data_size, device_address->type_id(),
+                                           task.staging_buffer.get() + offset, copy_stream)) {
+      MS_LOG(ERROR) << "Failed to copy parameter " << parameter.name << " to the checkpoint staging buffer.";
+      return false;
+    }
+    (void)task.layout.emplace_back(parameter.name, std::make_pair(offset, data_size));
+    offset += data_size;
+  }
+  if (!device_context->device_res_manager_->SyncStream(copy_stream_id)) {
+    MS_LOG(ERROR) << "Failed to synchronize the D2H copy stream of checkpoint snapshot.";
+    return false;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(task_mutex_);
+    if (stop_) {
+      MS_LOG(EXCEPTION) << "The checkpoint write task has stopped.";
+    }
+    (void)tasks_.emplace_back(std::move(task));
+  }
+  task_cv_.notify_one();
+  return true;
+}
+
+void AsyncCheckpointEngine::WaitAll() {
+  std::unique_lock<std::mutex> lock(task_mutex_);
+  done_cv_.wait(lock, [this]() { return tasks_.empty() && !writing_; });
+}
+
+std::unique_ptr<uint8_t[]> AsyncCheckpointEngine::AcquireStagingBuffer(size_t size, size_t *capacity) {
+  MS_EXCEPTION_IF_NULL(capacity);
+  std::unique_lock<std::mutex> lock(task_mutex_);
+  // Prefer the smallest recycled buffer which is large enough.
+  auto iter = staging_pool_.end();
+  for (auto it = staging_pool_.begin(); it != staging_pool_.end(); ++it) {
+    if (it->second >= size && (iter == staging_pool_.end() || it->second < iter->second)) {
+      iter = it;
+    }
+  }
+  if (iter != staging_pool_.end()) {
+    auto buffer = std::move(iter->first);
+    *capacity = iter->second;
+    (void)staging_pool_.erase(iter);
+    return buffer;
+  }
+  *capacity = size;
+  return std::make_unique<uint8_t[]>(size);
+}
+
+void AsyncCheckpointEngine::DoWriteTask() {
+  for (;;) {
+    SnapshotTask task;
+    {
+      std::unique_lock<std::mutex> lock(task_mutex_);
+      task_cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+      writing_ = true;
+    }
+
+    // Serialize every parameter as: name length, name, data length, data. The headers must outlive the
+    // write call, so they are kept in a local vector sized up front.
+    std::vector<uint64_t> headers;
+    headers.reserve(task.layout.size() * kHeadersPerParameter);
+    std::vector<std::pair<const void *, size_t>> inputs;
+    inputs.reserve(task.layout.size() * kInputsPerParameter);
+    for (const auto &item : task.layout) {
+      headers.push_back(static_cast<uint64_t>(item.first.size()));
+      headers.push_back(static_cast<uint64_t>(item.second.second));
+      const uint64_t *name_len = &headers[headers.size() - kHeadersPerParameter];
+      const uint64_t *data_len = &headers[headers.size() - 1];
+      (void)inputs.emplace_back(name_len, sizeof(uint64_t));
+      (void)inputs.emplace_back(item.first.data(), item.first.size());
+      (void)inputs.emplace_back(data_len, sizeof(uint64_t));
+      (void)inputs.emplace_back(task.staging_buffer.get() + item.second.first, item.second.second);
+    }
+    if (!distributed::storage::FileIOUtils::Write(task.file_name, inputs)) {
+      MS_LOG(ERROR) << "Failed to write the checkpoint file: " << task.file_name;
+    }
+
+    {
+      std::unique_lock<std::mutex> lock(task_mutex_);
+      // Recycle the staging buffer for the following snapshots.
+      (void)staging_pool_.emplace_back(std::move(task.staging_buffer), task.staging_capacity);
+      writing_ = false;
+    }
+    done_cv_.notify_all();
+  }
+}
+}  // namespace device
+}  // namespace mindspore
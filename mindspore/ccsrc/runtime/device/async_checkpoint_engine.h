@@ -0,0 +1,129 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_ASYNC_CHECKPOINT_ENGINE_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_ASYNC_CHECKPOINT_ENGINE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "runtime/hardware/device_context.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace device {
+// One parameter to be captured by a checkpoint snapshot: the name recorded in the checkpoint file and the
+// device address holding the parameter data.
+struct CheckpointParameter {
+  std::string name;
+  DeviceAddressPtr device_address;
+};
+
+// Takes checkpoint snapshots of device side parameters without stalling training. Snapshot copies the
+// parameters D2H on a dedicated copy stream into a host staging buffer recycled across snapshots, then a
+// background thread serializes the staged data to file, so the training step only pays for the device sync
+// and the staging copy instead of the full file write.
+class BACKEND_EXPORT AsyncCheckpointEngine {
+ public:
+  static std::shared_ptr<AsyncCheckpointEngine> &GetInstance() {
+    std::lock_guard<std::mutex> lock(instance_lock_);
+    if (instance_ == nullptr) {
+      instance_.reset(new (std::nothrow) AsyncCheckpointEngine());
+      MS_EXCEPTION_IF_NULL(instance_);
+      instance_->Initialize();
+    }
+    return instance_;
+  }
+
+  ~AsyncCheckpointEngine() = default;
+
+  // Stage the parameters into host memory and queue the file write, returning once the staging copy is
+  // done. The queued write serializes every parameter as: name length, name, data length, data.
+  bool Snapshot(const std::string &file_name, const std::vector<CheckpointParameter> &parameters,
+                const std::string &device_name);
+
+  // Block until all queued snapshots are persisted to file.
+  void WaitAll();
+
+  // Start the background write thread.
+  void Initialize();
+
+  // Stop the background write thread after draining the queued snapshots.
+  void Finalize();
+
+ private:
+  AsyncCheckpointEngine() = default;
+
+  DISABLE_COPY_AND_ASSIGN(AsyncCheckpointEngine);
+
+  // One queued file write: the staging buffer holding the tensor data, its capacity for recycling, and the
+  // name and (offset, size) in the staging buffer of every parameter.
+  struct SnapshotTask {
+    std::string file_name;
+    std::unique_ptr<uint8_t[]> staging_buffer;
+    size_t staging_capacity;
+    std::vector<std::pair<std::string, std::pair<size_t, size_t>>> layout;
+  };
+
+  // Take a recycled staging buffer of at least the given capacity from the pool, or allocate a new one.
+  std::unique_ptr<uint8_t[]> AcquireStagingBuffer(size_t size, size_t *capacity);
+
+  // Monitor the snapshot task queue and actually serialize the staged snapshots to file.
+  void DoWriteTask();
+
+  // Used for multi-thread safety of singleton creation.
+  static std::mutex instance_lock_;
+
+  // The singleton pointer.
+  static std::shared_ptr<AsyncCheckpointEngine> instance_;
+
+  // Whether the background write thread needs to stop.
+  bool stop_{false};
+
+  // Whether the background write thread is serializing a snapshot at the moment.
+  bool writing_{false};
+
+  // The D2H copy stream of every device context, created lazily and keyed by the device context key.
+  std::map<std::string, size_t> copy_stream_ids_;
+
+  // Staging buffers recycled across snapshots so periodic checkpoints do not reallocate host memory.
+  std::vector<std::pair<std::unique_ptr<uint8_t[]>, size_t>> staging_pool_;
+
+  std::deque<SnapshotTask> tasks_;
+
+  // The method Snapshot is not multiple threads safe, so use this lock to prevent simultaneous access by
+  // multiple threads.
+  std::mutex reentrant_mutex_;
+
+  // Use this lock to ensure the safety of the task queue and the staging pool shared with the write thread.
+  std::mutex task_mutex_;
+
+  // The thread to actually serialize the staged snapshots.
+  std::thread worker_thread_;
+
+  std::condition_variable task_cv_;
+  std::condition_variable done_cv_;
+};
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_ASYNC_CHECKPOINT_ENGINE_H_
@@ -15,6 +15,7 @@
  */
 
 #include "runtime/device/auto_mem_offload.h"
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <queue>
@@ -49,13 +50,32 @@ void MemHandler::FreeHost(void *ptr) {
   cached_host_mem_[mem_size].emplace(iter->first);
 }
 
+AutoMemoryOffload::~AutoMemoryOffload() {
+  {
+    std::lock_guard<std::mutex> lock(migration_mutex_);
+    migration_stop_ = true;
+  }
+  migration_cv_.notify_all();
+  if (migration_thread_.joinable()) {
+    // The migration thread drains the remaining requests before exiting.
+    migration_thread_.join();
+  }
+}
+
 void AutoMemoryOffload::SetInitHostPtr(const void *key, void *host_ptr, size_t mem_size) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   init_from_host_keys_.insert(key);
   init_host_ptr_[key] = host_ptr;
   mem_size_[key] = mem_size;
 }
 
 void AutoMemoryOffload::Free(const void *key) {
+  CancelOrWaitMigration(key);
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  FreeNoCancel(key);
+}
+
+void AutoMemoryOffload::FreeNoCancel(const void *key) {
   const auto &iter = mem_result_.find(key);
   if (iter == mem_result_.end()) {
     return;
@@ -66,6 +86,8 @@ void AutoMemoryOffload::Free(const void *key) {
 }
 
 void *AutoMemoryOffload::Get(const void *key, void *stream, const HashSet<const void *> &not_offload) {
+  CancelOrWaitMigration(key);
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   auto iter = mem_result_.find(key);
   if (iter != mem_result_.end()) {
     return iter->second;
@@ -86,8 +108,7 @@ void *AutoMemoryOffload::Get(const void *key, void *stream, const HashSet<const
   }
   mem_handler_->SwapIn(host_ptr, device_ptr, mem_size, stream);
   if (!from_init) {
-    (void)swap_host_ptr_.erase(key);
-    mem_handler_->FreeHost(host_ptr);
+    ReleaseSwapHostPtr(key);
   }
   mem_result_[key] = device_ptr;
   return device_ptr;
@@ -96,6 +117,7 @@ void *AutoMemoryOffload::Get(const void *key, void *stream, const HashSet<const
 std::vector<void *> AutoMemoryOffload::MallocContinuous(const std::vector<const void *> &keys,
                                                         const std::vector<size_t> &size_list, void *stream,
                                                         const HashSet<const void *> &not_offload) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   auto device_ptr = mem_handler_->MallocContinuousMemFromMemPool(size_list);
   if (device_ptr.size() == keys.size() || stream == nullptr) {
     for (size_t i = 0; i < device_ptr.size(); i += 1) {
@@ -111,13 +133,14 @@ std::vector<void *> AutoMemoryOffload::MallocContinuous(const std::vector<const
   std::priority_queue<KeySizePair, std::vector<KeySizePair>, decltype(less)> mem_can_offload(less);
   for (const auto &mem : mem_result_) {
     const auto offload_key = mem.first;
-    if (not_offload.count(offload_key) != 0 || continuous_mem_key_.count(offload_key) != 0) {
+    if (not_offload.count(offload_key) != 0 || continuous_mem_key_.count(offload_key) != 0 ||
+        IsMigrating(offload_key)) {
       continue;
     }
     const auto device_mem_size = GetMemSize(offload_key);
     if (device_mem_size >= total_size) {
-      SwapOut(offload_key, stream);
-      Free(offload_key);
+      SwapOutNoCancel(offload_key, stream);
+      FreeNoCancel(offload_key);
       device_ptr = mem_handler_->MallocContinuousMemFromMemPool(size_list);
       if (device_ptr.size() != keys.size()) {
         continue;
@@ -136,8 +159,8 @@ std::vector<void *> AutoMemoryOffload::MallocContinuous(const std::vector<const
     const auto offload_mem_key = max_mem_in_device.first;
     auto offload_device_ptr = mem_result_[offload_mem_key];
     MS_EXCEPTION_IF_NULL(offload_device_ptr);
-    SwapOut(offload_mem_key, stream);
-    Free(offload_mem_key);
+    SwapOutNoCancel(offload_mem_key, stream);
+    FreeNoCancel(offload_mem_key);
     device_ptr = mem_handler_->MallocContinuousMemFromMemPool(size_list);
     if (device_ptr.size() != keys.size()) {
       mem_can_offload.pop();
@@ -155,6 +178,8 @@ std::vector<void *> AutoMemoryOffload::MallocContinuous(const std::vector<const
 
 void *AutoMemoryOffload::Malloc(const void *key, size_t mem_size, void *stream,
                                 const HashSet<const void *> &not_offload) {
+  CancelOrWaitMigration(key);
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   auto iter = mem_result_.find(key);
   if (iter != mem_result_.end()) {
     return iter->second;
@@ -170,13 +195,14 @@ void *AutoMemoryOffload::Malloc(const void *key, size_t mem_size, void *stream,
   std::priority_queue<KeySizePair, std::vector<KeySizePair>, decltype(less)> mem_can_offload(less);
   for (const auto &i : mem_result_) {
     const auto offload_key = i.first;
-    if (not_offload.count(offload_key) != 0) {
+    // Keys with an eviction already queued or in flight are leaving the device anyway.
+    if (not_offload.count(offload_key) != 0 || IsMigrating(offload_key)) {
       continue;
     }
     const auto device_mem_size = GetMemSize(offload_key);
     if (device_mem_size >= mem_size) {
-      SwapOut(offload_key, stream);
-      Free(offload_key);
+      SwapOutNoCancel(offload_key, stream);
+      FreeNoCancel(offload_key);
       device_ptr = mem_handler_->MallocDevice(mem_size);
       mem_result_[key] = device_ptr;
       mem_size_[key] = mem_size;
@@ -189,8 +215,8 @@ void *AutoMemoryOffload::Malloc(const void *key, size_t mem_size, void *stream,
     const auto offload_mem_key = max_mem_in_device.first;
     auto offload_device_ptr = mem_result_[offload_mem_key];
     MS_EXCEPTION_IF_NULL(offload_device_ptr);
-    SwapOut(offload_mem_key, stream);
-    Free(offload_mem_key);
+    SwapOutNoCancel(offload_mem_key, stream);
+    FreeNoCancel(offload_mem_key);
     device_ptr = mem_handler_->MallocDevice(mem_size);
     if (device_ptr != nullptr) {
       mem_result_[key] = device_ptr;
@@ -203,6 +229,12 @@ void *AutoMemoryOffload::Malloc(const void *key, size_t mem_size, void *stream,
 }
 
 void *AutoMemoryOffload::SwapOut(const void *key, void *stream) {
+  CancelOrWaitMigration(key);
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  return SwapOutNoCancel(key, stream);
+}
+
+void *AutoMemoryOffload::SwapOutNoCancel(const void *key, void *stream) {
   const auto iter = mem_result_.find(key);
   void *host_ptr = nullptr;
   bool from_init = false;
@@ -228,6 +260,8 @@ void *AutoMemoryOffload::SwapOut(const void *key, void *stream) {
 }
 
 void *AutoMemoryOffload::SwapIn(const void *key, void *stream) {
+  CancelOrWaitMigration(key);
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   const size_t mem_size = GetMemSize(key);
   const auto &iter = mem_result_.find(key);
   if (iter == mem_result_.end()) {
@@ -236,15 +270,151 @@ void *AutoMemoryOffload::SwapIn(const void *key, void *stream) {
   bool from_init = true;
   void *host_ptr = nullptr;
   GetHostPtr(key, &host_ptr, &from_init);
-  MS_EXCEPTION_IF_NULL(host_ptr);
+  if (host_ptr == nullptr) {
+    // The asynchronous eviction of this tensor was cancelled before the copy happened, the
+    // device data is still valid and there is nothing to copy back.
+    return iter->second;
+  }
   mem_handler_->SwapIn(host_ptr, iter->second, mem_size, stream);
   if (!from_init) {
-    mem_handler_->FreeHost(host_ptr);
-    (void)swap_host_ptr_.erase(key);
+    ReleaseSwapHostPtr(key);
   }
   return iter->second;
 }
 
+void AutoMemoryOffload::SwapOutAsync(const void *key, void *stream, size_t next_use_time) {
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    if (mem_result_.find(key) == mem_result_.end()) {
+      return;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> migration_lock(migration_mutex_);
+    if (!migration_stop_) {
+      if (migration_pending_.count(key) != 0) {
+        return;
+      }
+      if (!migration_thread_.joinable()) {
+        migration_thread_ = std::thread(&AutoMemoryOffload::DoMigrationTask, this);
+      }
+      (void)migration_queue_.emplace_back(MigrationRequest{key, stream, next_use_time});
+      (void)migration_pending_.insert(key);
+      migration_cv_.notify_one();
+      return;
+    }
+  }
+  // The migration thread has stopped, evict synchronously.
+  (void)SwapOut(key, stream);
+  Free(key);
+}
+
+void AutoMemoryOffload::WaitSwapOut() {
+  std::unique_lock<std::mutex> lock(migration_mutex_);
+  migration_done_cv_.wait(lock, [this]() { return migration_pending_.empty() && migration_inflight_.empty(); });
+}
+
+void AutoMemoryOffload::CancelOrWaitMigration(const void *key) {
+  std::unique_lock<std::mutex> lock(migration_mutex_);
+  if (migration_pending_.erase(key) != 0) {
+    // Re-referenced before the eviction started: drop the request, the tensor stays on device.
+    return;
+  }
+  migration_done_cv_.wait(lock, [this, key]() { return migration_inflight_.count(key) == 0; });
+}
+
+bool AutoMemoryOffload::IsMigrating(const void *key) {
+  std::lock_guard<std::mutex> lock(migration_mutex_);
+  return migration_pending_.count(key) != 0 || migration_inflight_.count(key) != 0;
+}
+
+void AutoMemoryOffload::DoMigrationTask() {
+  for (;;) {
+    std::vector<MigrationRequest> batch;
+    {
+      std::unique_lock<std::mutex> lock(migration_mutex_);
+      migration_cv_.wait(lock, [this]() { return migration_stop_ || !migration_queue_.empty(); });
+      if (migration_queue_.empty()) {
+        return;
+      }
+      for (const auto &request : migration_queue_) {
+        // Requests cancelled by a re-reference are no longer pending, skip them.
+        if (migration_pending_.erase(request.key) != 0) {
+          (void)migration_inflight_.insert(request.key);
+          (void)batch.emplace_back(request);
+        }
+      }
+      migration_queue_.clear();
+    }
+    // Tensors used furthest in the future leave the device first.
+    std::sort(batch.begin(), batch.end(),
+              [](const MigrationRequest &a, const MigrationRequest &b) { return a.next_use_time > b.next_use_time; });
+    {
+      std::lock_guard<std::recursive_mutex> lock(mutex_);
+      ProcessMigrationBatch(batch);
+    }
+    {
+      std::lock_guard<std::mutex> lock(migration_mutex_);
+      migration_inflight_.clear();
+    }
+    migration_done_cv_.notify_all();
+  }
+}
+
+void AutoMemoryOffload::ProcessMigrationBatch(const std::vector<MigrationRequest> &batch) {
+  struct Region {
+    const void *key;
+    uint8_t *device_ptr;
+    size_t mem_size;
+    void *stream;
+  };
+  std::vector<Region> regions;
+  for (const auto &request : batch) {
+    const auto &iter = mem_result_.find(request.key);
+    if (iter == mem_result_.end()) {
+      continue;
+    }
+    if (init_from_host_keys_.count(request.key) != 0) {
+      // Tensors initialized from host may need no copy at all, take the ordinary path.
+      (void)SwapOutNoCancel(request.key, request.stream);
+      FreeNoCancel(request.key);
+      continue;
+    }
+    (void)regions.emplace_back(
+      Region{request.key, static_cast<uint8_t *>(iter->second), GetMemSize(request.key), request.stream});
+  }
+  // Merge device-adjacent tensors into one transfer with a shared host staging block. Within one
+  // batch the merge order wins over the next-use order, the whole batch is issued back to back
+  // anyway.
+  std::sort(regions.begin(), regions.end(), [](const Region &a, const Region &b) { return a.device_ptr < b.device_ptr; });
+  for (size_t begin = 0; begin < regions.size();) {
+    size_t end = begin + 1;
+    size_t total_size = regions[begin].mem_size;
+    while (end < regions.size() && regions[end - 1].device_ptr + regions[end - 1].mem_size == regions[end].device_ptr) {
+      total_size += regions[end].mem_size;
+      ++end;
+    }
+    if (end - begin == 1) {
+      (void)SwapOutNoCancel(regions[begin].key, regions[begin].stream);
+    } else {
+      auto base = static_cast<uint8_t *>(mem_handler_->MallocHost(total_size));
+      MS_EXCEPTION_IF_NULL(base);
+      mem_handler_->SwapOut(regions[begin].device_ptr, base, total_size, regions[begin].stream);
+      auto block = std::make_shared<BatchHostBlock>(BatchHostBlock{base, end - begin});
+      size_t offset = 0;
+      for (size_t i = begin; i < end; ++i) {
+        swap_host_ptr_[regions[i].key] = base + offset;
+        batch_host_block_[regions[i].key] = block;
+        offset += regions[i].mem_size;
+      }
+    }
+    for (size_t i = begin; i < end; ++i) {
+      FreeNoCancel(regions[i].key);
+    }
+    begin = end;
+  }
+}
+
 size_t AutoMemoryOffload::GetMemSize(const void *key) {
   const auto &iter = mem_size_.find(key);
   if (iter == mem_size_.end()) {
@@ -280,25 +450,60 @@ void AutoMemoryOffload::GetHostPtr(const void *key, void **host_ptr, bool *from_
   }
 }
 
+void AutoMemoryOffload::ReleaseSwapHostPtr(const void *key) {
+  const auto &iter = swap_host_ptr_.find(key);
+  if (iter == swap_host_ptr_.end()) {
+    return;
+  }
+  const auto &block_iter = batch_host_block_.find(key);
+  if (block_iter != batch_host_block_.end()) {
+    // The staging block is shared by the coalesced batch, free it with the last member.
+    auto block = block_iter->second;
+    (void)batch_host_block_.erase(block_iter);
+    if (--block->ref_count == 0) {
+      mem_handler_->FreeHost(block->base);
+    }
+  } else {
+    mem_handler_->FreeHost(iter->second);
+  }
+  (void)swap_host_ptr_.erase(iter);
+}
+
 void AutoMemoryOffload::Clear() {
   if (mem_handler_ == nullptr) {
     return;
   }
+  WaitSwapOut();
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   for (auto &item : mem_result_) {
     mem_handler_->FreeDevice(item.second);
   }
   mem_result_.clear();
   for (const auto &item : swap_host_ptr_) {
+    if (batch_host_block_.count(item.first) != 0) {
+      continue;
+    }
     const auto host_ptr = item.second;
     if (host_ptr != nullptr) {
       mem_handler_->FreeHost(host_ptr);
     }
   }
+  // Shared staging blocks are freed once, whichever member key comes first.
+  HashSet<void *> freed_blocks;
+  for (const auto &item : batch_host_block_) {
+    if (freed_blocks.insert(item.second->base).second) {
+      mem_handler_->FreeHost(item.second->base);
+    }
+  }
+  batch_host_block_.clear();
   swap_host_ptr_.clear();
   init_host_ptr_.clear();
   init_from_host_keys_.clear();
 }
 
-void AutoMemoryOffload::UpdateHighPriorityMem(const void *key) { updated_device_mem_.insert(key); }
+void AutoMemoryOffload::UpdateHighPriorityMem(const void *key) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  updated_device_mem_.insert(key);
+}
 }  // namespace device
 }  // namespace mindspore
@@ -21,6 +21,9 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #include "runtime/device/memory_manager.h"
 #include "utils/hash_map.h"
@@ -56,7 +59,7 @@ class MemHandler {
 class AutoMemoryOffload {
  public:
   explicit AutoMemoryOffload(std::shared_ptr<MemHandler> mem_handler) : mem_handler_(std::move(mem_handler)) {}
-  ~AutoMemoryOffload() = default;
+  ~AutoMemoryOffload();
   void *Get(const void *key, void *stream = nullptr, const HashSet<const void *> &not_offload = {});
   void *Malloc(const void *key, size_t mem_size, void *stream, const HashSet<const void *> &not_offload);
   std::vector<void *> MallocContinuous(const std::vector<const void *> &keys, const std::vector<size_t> &size_list,
@@ -71,10 +74,41 @@ class AutoMemoryOffload {
   // Return the device ptr where the data is copied to
   void *SwapIn(const void *key, void *stream);
 
+  // Queue the tensor for asynchronous eviction. A dedicated migration thread issues the copy and
+  // frees the device memory afterwards, so the caller does not wait for the transfer. Requests are
+  // processed in batches ordered by next_use_time (tensors used furthest in the future leave the
+  // device first) and device-adjacent tensors in one batch are merged into a single transfer.
+  // Getting the tensor again before the copy starts cancels the request, the tensor stays on
+  // device and no data moves at all.
+  void SwapOutAsync(const void *key, void *stream, size_t next_use_time);
+  // Block until every queued eviction is done and its device memory freed. Must not be called
+  // while another AutoMemoryOffload method of the same instance is on the stack.
+  void WaitSwapOut();
+
  private:
+  // A queued asynchronous eviction.
+  struct MigrationRequest {
+    const void *key;
+    void *stream;
+    size_t next_use_time;
+  };
+  // A host staging block shared by coalesced tensors, freed when the last member swaps back in.
+  struct BatchHostBlock {
+    void *base;
+    size_t ref_count;
+  };
   size_t GetMemSize(const void *key);
   void GetHostPtr(const void *key, void **host_ptr, bool *from_init);
   void GetOrMallocHostPtr(const void *key, size_t mem_size, void **host_ptr, bool *from_init);
+  void *SwapOutNoCancel(const void *key, void *stream);
+  void FreeNoCancel(const void *key);
+  void ReleaseSwapHostPtr(const void *key);
+  // Cancel the queued eviction of the key, or wait for it when the copy is already in flight.
+  void CancelOrWaitMigration(const void *key);
+  bool IsMigrating(const void *key);
+  // Consume migration requests in the migration thread.
+  void DoMigrationTask();
+  void ProcessMigrationBatch(const std::vector<MigrationRequest> &batch);
   std::shared_ptr<MemHandler> mem_handler_;
   HashMap<const void *, void *> mem_result_;
   HashMap<const void *, size_t> mem_size_;
@@ -83,6 +117,20 @@ class AutoMemoryOffload {
   HashSet<const void *> continuous_mem_key_;
   HashMap<const void *, void *> init_host_ptr_;
   HashMap<const void *, void *> swap_host_ptr_;
+  HashMap<const void *, std::shared_ptr<BatchHostBlock>> batch_host_block_;
+  // Guards the memory maps above, shared between the callers and the migration thread. Recursive
+  // because the public methods call each other.
+  std::recursive_mutex mutex_;
+  // Migration engine state, guarded by migration_mutex_.
+  std::vector<MigrationRequest> migration_queue_;
+  HashSet<const void *> migration_pending_;
+  HashSet<const void *> migration_inflight_;
+  bool migration_stop_{false};
+  std::mutex migration_mutex_;
+  std::condition_variable migration_cv_;
+  std::condition_variable migration_done_cv_;
+  // The thread which issues the eviction copies, created lazily on the first SwapOutAsync call.
+  std::thread migration_thread_;
 };
 }  // namespace device
 }  // namespace mindspore
@@ -1727,7 +1727,7 @@ bool KernelRuntime::LaunchKernelMod(const session::KernelGraph &graph, bool mock
       MS_EXCEPTION_IF_NULL(kernel_mod);
       opt::dynamic_shape::InferOp(kernel);
       auto args = kernel::GetArgsFromCNode(kernel);
-      if (kernel_mod->Resize(args->op, args->inputs, args->outputs, args->depend_tensor_map) ==
+      if (kernel_mod->ResizeWithCache(args->op, args->inputs, args->outputs, args->depend_tensor_map) ==
           kernel::KRET_RESIZE_FAILED) {
         MS_LOG(EXCEPTION) << "Node " << kernel->fullname_with_scope() << " Resize  failed.";
       }
@@ -143,8 +143,15 @@ void MemOffloadStrategy::GenEventSpan() {
         span = total_step_;
       }
       if (span > 1) {
-        const size_t span_mul_size = (span - 1) * event->mem_size;
-        (void)event_span_.emplace(span_mul_size, std::make_pair(event, span));
+        size_t span_weight = (span - 1) * event->mem_size;
+        if (compute_time_.size() == total_step_) {
+          // When the step durations have been profiled, weight the candidates by the measured idle time of the
+          // memory instead of the step count, so that the memory staying idle longest in real time is swapped
+          // first and short-lived memory between fast kernels is kept on the device.
+          const auto span_time = GetSpanTimeBetweenMemEvents(latest_get_event->index, event->index);
+          span_weight = static_cast<size_t>(span_time * static_cast<double>(event->mem_size));
+        }
+        (void)event_span_.emplace(span_weight, std::make_pair(event, span));
       }
     }
   }
@@ -303,6 +310,35 @@ size_t MemOffloadStrategy::GetFirstMallocIndex(const ContinuousMemInfoPtr &conti
   return earliest_malloc_index;
 }
 
+double MemOffloadStrategy::GetSpanTimeBetweenMemEvents(size_t pre_index, size_t post_index) const {
+  double span_time = 0;
+  for (size_t index = (pre_index + 1) % total_step_; index != post_index; index = (index + 1) % total_step_) {
+    span_time += compute_time_[index];
+  }
+  return span_time;
+}
+
+size_t MemOffloadStrategy::GetSwapInPrefetchSpan(const MemEventPtr &swap_in_event, size_t max_span) const {
+  if (swap_bandwidth_ <= 0 || compute_time_.size() != total_step_ || max_span <= 1) {
+    return 0;
+  }
+  const double copy_time = static_cast<double>(swap_in_event->mem_size) / swap_bandwidth_;
+  double overlapped_time = 0;
+  size_t prefetch_span = 0;
+  // Advance the swap-in step by step until the compute time of the covered steps hides the copy time, but
+  // never earlier than the step following the swap-out, and never into a step whose minimum memory plus
+  // the prefetched memory would exceed the memory budget.
+  while (prefetch_span + 1 < max_span && overlapped_time < copy_time) {
+    const size_t prefetch_index = GetPreMemEventIndex(swap_in_event->index, prefetch_span + 1);
+    if (min_mem_used_[prefetch_index] + swap_in_event->mem_size > mem_size_) {
+      break;
+    }
+    overlapped_time += compute_time_[prefetch_index];
+    prefetch_span += 1;
+  }
+  return prefetch_span;
+}
+
 void MemOffloadStrategy::GenContinuousMemAllocSteps() {
   for (const auto &continuous_mem_info : continuous_mem_info_helper_->GetAllContinuousMemInfo()) {
     GenContinuousMemAllocStep(continuous_mem_info);
@@ -356,10 +392,14 @@ void MemOffloadStrategy::GenComputeMemEvents() {
         (void)post_compute_events_[pre_index].emplace_back(swap_out_event);
         // avoid swap-in-event follow init-event
         if (i != kFirstGetMemEventIndex || first_event->type != kInit) {
-          auto swap_in_event = std::make_shared<MemEvent>(kSwapIn, event->index);
+          // Prefetch the swap-in far enough ahead of the using step to hide the copy time behind the
+          // measured compute time of the preceding steps.
+          const auto prefetch_span = GetSwapInPrefetchSpan(event, GetSpanBetweenMemEvents(pre_index, event->index));
+          const auto swap_in_index = GetPreMemEventIndex(event->index, prefetch_span);
+          auto swap_in_event = std::make_shared<MemEvent>(kSwapIn, swap_in_index);
           swap_in_event->key = item.first;
           swap_in_event->mem_size = first_event->mem_size;
-          (void)pre_compute_events_[event->index].emplace_back(swap_in_event);
+          (void)pre_compute_events_[swap_in_index].emplace_back(swap_in_event);
         }
       }
       if (event->index < pre_compute_events_.size()) {
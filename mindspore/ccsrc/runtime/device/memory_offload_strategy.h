@@ -105,7 +105,16 @@ class MemOffloadStrategy {
 
   virtual void Execute();
 
-  void SetComputeTime(const std::vector<double> &compute_time) { compute_time_ = compute_time; }
+  void SetComputeTime(const std::vector<double> &compute_time) {
+    compute_time_ = compute_time;
+    // The measured step durations change the swap candidate ordering, so the cached spans must be rebuilt
+    // on the next Execute.
+    event_span_.clear();
+  }
+
+  // Set the measured swap copy bandwidth(bytes per microsecond), used to estimate the copy time of swap
+  // events when the strategy is regenerated with profiled compute time.
+  void SetSwapBandwidth(double bytes_per_time) { swap_bandwidth_ = bytes_per_time; }
 
   MemEventPtrList &GetPreComputeEvents(size_t step);
 
@@ -154,6 +163,10 @@ class MemOffloadStrategy {
     return (cur_index + total_step_ - span) % total_step_;
   }
 
+  double GetSpanTimeBetweenMemEvents(size_t pre_index, size_t post_index) const;
+
+  size_t GetSwapInPrefetchSpan(const MemEventPtr &swap_in_event, size_t max_span) const;
+
   const std::map<const void *, MemPriority> &mem_priority_;
   const std::map<const void *, MemEventPtrList> &mem_events_;
   const std::set<const void *> &manual_offload_keys_;
@@ -163,6 +176,7 @@ class MemOffloadStrategy {
 
   size_t mem_size_{0};
   std::vector<double> compute_time_;
+  double swap_bandwidth_{0};
   bool need_swap_{false};
   std::multimap<size_t, std::pair<MemEventPtr, size_t>> event_span_;
   std::multimap<size_t, std::pair<MemEventPtr, size_t>> continuous_input_event_span_;
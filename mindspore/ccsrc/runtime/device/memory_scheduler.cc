@@ -92,15 +92,44 @@ void *MemScheduler::GetOrMalloc(const void *key, size_t mem_size, MemPriority pr
   return auto_mem_offload_->Get(key);
 }
 
+void *MemScheduler::MallocDeviceMem(const MemEventPtr &event, void *stream) {
+  auto device_ptr = auto_mem_offload_->Malloc(event->key, event->mem_size, stream, GetNoReuseKeys());
+  if (device_ptr == nullptr && stream != nullptr) {
+    // Queued asynchronous evictions may still hold the memory, let them land and try again.
+    auto_mem_offload_->WaitSwapOut();
+    device_ptr = auto_mem_offload_->Malloc(event->key, event->mem_size, stream, GetNoReuseKeys());
+  }
+  return device_ptr;
+}
+
+size_t MemScheduler::GetNextUseSpan(const void *key) const {
+  const auto &iter = mem_events_.find(key);
+  if (iter == mem_events_.end() || total_step_ == 0) {
+    return 0;
+  }
+  size_t min_span = total_step_;
+  for (const auto &event : iter->second) {
+    MS_EXCEPTION_IF_NULL(event);
+    if (event->type != kGet && event->type != kSwapIn) {
+      continue;
+    }
+    const size_t span = (event->index + total_step_ - current_step_) % total_step_;
+    if (span != 0 && span < min_span) {
+      min_span = span;
+    }
+  }
+  return min_span;
+}
+
 void *MemScheduler::Malloc(const std::shared_ptr<MemEvent> &event, void *stream) {
   const bool is_continuous_mem = continuous_mem_info_helper_->IsContinuousMem(event->key);
   if (!is_continuous_mem) {
-    return auto_mem_offload_->Malloc(event->key, event->mem_size, stream, GetNoReuseKeys());
+    return MallocDeviceMem(event, stream);
   }
   const auto &continuous_mem_info = continuous_mem_info_helper_->GetContinuousMemInfo(event->key);
   if (!continuous_mem_info_helper_->NeedMallocContinuousMem(continuous_mem_info, current_step_) ||
       cur_step_allocated_continuous_mem_.count(continuous_mem_info) != 0) {
-    return auto_mem_offload_->Malloc(event->key, event->mem_size, stream, GetNoReuseKeys());
+    return MallocDeviceMem(event, stream);
   }
   std::vector<const void *> keys(continuous_mem_info->key_index_map_.size(), nullptr);
   for (const auto &iter : continuous_mem_info->key_index_map_) {
@@ -110,8 +139,13 @@ void *MemScheduler::Malloc(const std::shared_ptr<MemEvent> &event, void *stream)
     }
     keys[iter.second] = iter.first;
   }
-  const auto &device_ptr_list =
+  auto device_ptr_list =
     auto_mem_offload_->MallocContinuous(keys, continuous_mem_info->align_size_list_, stream, GetNoReuseKeys());
+  if (device_ptr_list.size() != keys.size() && stream != nullptr) {
+    auto_mem_offload_->WaitSwapOut();
+    device_ptr_list =
+      auto_mem_offload_->MallocContinuous(keys, continuous_mem_info->align_size_list_, stream, GetNoReuseKeys());
+  }
   if (device_ptr_list.size() != keys.size()) {
     MS_LOG(WARNING) << "Alloc continuous memory failed, size: " << continuous_mem_info->total_size_;
     return nullptr;
@@ -154,6 +188,13 @@ bool MemScheduler::PreComputeSwapIn(const std::shared_ptr<MemEvent> &event, void
   if (Malloc(event, stream) == nullptr) {
     return false;
   }
+  if (record_compute_time_ && !updated_) {
+    const double swap_start_time = GetCurrentTime();
+    const auto device_ptr = auto_mem_offload_->SwapIn(event->key, stream);
+    swap_copy_time_ += GetCurrentTime() - swap_start_time;
+    swap_copy_size_ += static_cast<double>(event->mem_size);
+    return device_ptr != nullptr;
+  }
   return auto_mem_offload_->SwapIn(event->key, stream) != nullptr;
 }
 
@@ -207,7 +248,17 @@ bool MemScheduler::PostCompute(void *stream) {
     MS_EXCEPTION_IF_NULL(event);
     MS_LOG(DEBUG) << "Post compute " << current_step_ << ": " << event->key << " v " << event->type;
     if (event->type == kSwapOut && optimized_) {
-      auto_mem_offload_->SwapOut(event->key, stream);
+      if (record_compute_time_ && !updated_) {
+        // The swap bandwidth estimate needs the real copy time, keep this path synchronous.
+        const double swap_start_time = GetCurrentTime();
+        (void)auto_mem_offload_->SwapOut(event->key, stream);
+        swap_copy_time_ += GetCurrentTime() - swap_start_time;
+        swap_copy_size_ += static_cast<double>(event->mem_size);
+      } else {
+        // The migration thread frees the device copy once the transfer is done.
+        auto_mem_offload_->SwapOutAsync(event->key, stream, GetNextUseSpan(event->key));
+        continue;
+      }
     }
     auto_mem_offload_->Free(event->key);
   }
@@ -314,6 +365,9 @@ void MemScheduler::Update() {
     return;
   }
 
+  if (swap_copy_time_ > 0) {
+    strategy_->SetSwapBandwidth(swap_copy_size_ / swap_copy_time_);
+  }
   strategy_->SetComputeTime(compute_time_);
   strategy_->Execute();
   updated_ = true;
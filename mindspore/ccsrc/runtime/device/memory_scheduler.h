@@ -101,6 +101,13 @@ class MemScheduler {
 
   void *Malloc(const MemEventPtr &event, void *stream);
 
+  // Malloc device memory, waiting once for queued asynchronous evictions when the pool is full.
+  void *MallocDeviceMem(const MemEventPtr &event, void *stream);
+
+  // Get the step distance from current_step_ to the next use of the key, used to order the
+  // asynchronous evictions: the further the next use, the earlier the tensor leaves the device.
+  size_t GetNextUseSpan(const void *key) const;
+
   // Scheduler status
   bool need_record_event_{true};
   bool optimized_{false};
@@ -119,6 +126,9 @@ class MemScheduler {
   // Compute time
   std::vector<double> compute_time_;
   double compute_start_time_{0};
+  // Swap copy profile accumulated while the compute time is recorded, used to estimate the swap bandwidth.
+  double swap_copy_time_{0};
+  double swap_copy_size_{0};
 
   std::shared_ptr<AutoMemoryOffload> auto_mem_offload_;
   std::shared_ptr<MemHandler> mem_handler_{nullptr};
@@ -45,9 +45,65 @@ void StreamSynchronizer::Finalize() {
   if (worker_thread_.joinable()) {
     worker_thread_.join();
   }
+  {
+    std::unique_lock<std::mutex> lock(callback_mutex_);
+    callback_stop_ = true;
+  }
+  callback_cv_.notify_all();
+  if (callback_thread_.joinable()) {
+    // The callback thread drains the remaining deferred callbacks before exiting.
+    callback_thread_.join();
+  }
   device_context_ = nullptr;
 }
 
+void StreamSynchronizer::DeferCallbackAfterStream(const std::string &device_name, size_t stream_id,
+                                                  std::function<void()> callback) {
+  MS_EXCEPTION_IF_NULL(callback);
+  {
+    std::unique_lock<std::mutex> lock(callback_mutex_);
+    if (!callback_stop_) {
+      if (!callback_thread_.joinable()) {
+        callback_thread_ = std::thread(&StreamSynchronizer::DoCallbackTask, this);
+      }
+      (void)callback_tasks_.emplace_back(StreamCallbackTask{device_name, stream_id, std::move(callback)});
+      lock.unlock();
+      callback_cv_.notify_one();
+      return;
+    }
+  }
+  // After Finalize the streams are already drained, so the callback can run right away.
+  callback();
+}
+
+void StreamSynchronizer::DoCallbackTask() {
+  for (;;) {
+    StreamCallbackTask task;
+    {
+      std::unique_lock<std::mutex> lock(callback_mutex_);
+      callback_cv_.wait(lock, [this]() { return callback_stop_ || !callback_tasks_.empty(); });
+      if (callback_tasks_.empty()) {
+        return;
+      }
+      task = std::move(callback_tasks_.front());
+      callback_tasks_.pop_front();
+    }
+
+    auto ms_context = MsContext::GetInstance();
+    MS_EXCEPTION_IF_NULL(ms_context);
+    uint32_t device_id = ms_context->get_param<uint32_t>(MS_CTX_DEVICE_ID);
+    const auto &device_context =
+      device::DeviceContextManager::GetInstance().GetOrCreateDeviceContext({task.device_name, device_id});
+    MS_EXCEPTION_IF_NULL(device_context);
+    device_context->Initialize();
+    // Wait only for the producing stream, the other streams keep running.
+    if (!device_context->device_res_manager_->SyncStream(task.stream_id)) {
+      MS_LOG(ERROR) << "Synchronize stream " << task.stream_id << " failed before running the deferred callback.";
+    }
+    task.callback();
+  }
+}
+
 bool StreamSynchronizer::SyncStream(const std::string &device_name, uint32_t timeout) {
   std::unique_lock<std::mutex> reentrant_lock(reentrant_mutex_);
   auto ms_context = MsContext::GetInstance();
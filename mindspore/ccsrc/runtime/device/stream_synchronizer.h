@@ -17,6 +17,8 @@
 #ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_SYNC_STREAM_H_
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_SYNC_STREAM_H_
 
+#include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -50,6 +52,14 @@ class BACKEND_EXPORT StreamSynchronizer {
   // Execute synchronization stream with timeout mechanism.
   bool SyncStream(const std::string &device_name, uint32_t timeout = kTimeoutInSeconds);
 
+  // Queue a host callback to run after all work currently submitted to 'stream_id' completes.
+  // The wait happens on a dedicated worker thread with a per-stream sync, so neither the calling
+  // thread nor the other streams are stalled - unlike SyncStream, which blocks the caller on the
+  // whole device. Typical use is releasing memory or decrementing ref counts behind an async
+  // kernel. Callbacks of one stream run in submission order; after Finalize the streams are
+  // already drained and the callback runs inline.
+  void DeferCallbackAfterStream(const std::string &device_name, size_t stream_id, std::function<void()> callback);
+
   // Initialize stream synchronizer, Create a thread to actually execute the synchronization stream task.
   void Initialize();
 
@@ -65,6 +75,16 @@ class BACKEND_EXPORT StreamSynchronizer {
   // tasks.
   void DoSyncStreamTask();
 
+  // The deferred host callback with the stream it waits for.
+  struct StreamCallbackTask {
+    std::string device_name;
+    size_t stream_id;
+    std::function<void()> callback;
+  };
+
+  // Wait per stream and run the deferred callbacks, executed in callback_thread_.
+  void DoCallbackTask();
+
   // Used for multi-thread safety of singleton creation.
   static std::mutex instance_lock_;
 
@@ -92,6 +112,21 @@ class BACKEND_EXPORT StreamSynchronizer {
 
   std::condition_variable time_out_cv_;
   std::condition_variable do_sync_stream_cv_;
+
+  // The queued deferred callbacks, consumed by callback_thread_ in FIFO order.
+  std::deque<StreamCallbackTask> callback_tasks_;
+
+  // Whether the callback thread needs to stop.
+  bool callback_stop_{false};
+
+  // Protect callback_tasks_ and callback_stop_.
+  std::mutex callback_mutex_;
+
+  std::condition_variable callback_cv_;
+
+  // The thread which waits per stream and runs the deferred callbacks, created lazily on the
+  // first DeferCallbackAfterStream call.
+  std::thread callback_thread_;
 };
 }  // namespace device
 }  // namespace mindspore
@@ -17,20 +17,71 @@
 #include "runtime/graph_scheduler/actor/abstract_actor.h"
 #include "runtime/graph_scheduler/actor/output_actor.h"
 #include "utils/log_adapter.h"
+#ifndef ENABLE_SECURITY
+#include "profiler/device/sampling_profiler.h"
+#endif
+#ifdef ENABLE_DUMP_IR
+#include "debug/rdr/flight_recorder.h"
+#endif
 
 namespace mindspore {
 namespace runtime {
+namespace {
+// Appends one actor runtime event to the flight recorder ring. Compiled away without rdr; with rdr
+// but the recorder disabled, it is one early-out check per message.
+inline void RecordActorFlightEvent(uint16_t event, const void *actor, int sequential_num) {
+#ifdef ENABLE_DUMP_IR
+  (void)RDR::RecordFlightEvent(SubModuleId::SM_RUNTIME_FRAMEWORK, event, reinterpret_cast<uint64_t>(actor),
+                               static_cast<uint64_t>(sequential_num));
+#endif
+#ifndef ENABLE_SECURITY
+  // Tag the stack samples of this thread with the actor it starts running, so the sampling profiler
+  // maps samples back to kernels through the actor table. One thread local store per event.
+  if (event == kFlightEventActorRun) {
+    profiler::SamplingProfiler::SetThreadTag(reinterpret_cast<uint64_t>(actor));
+  }
+#endif
+}
+}  // namespace
+void AbstractActor::EnableLockFreeInputDispatch() {
+  enable_lock_free_input_ = true;
+  lock_free_input_data_slots_.resize(input_datas_num_, nullptr);
+  lock_free_input_control_slots_.resize(input_controls_num_, nullptr);
+  recv_input_data_num_ = 0;
+  recv_input_control_num_ = 0;
+  recv_input_msg_num_ = 0;
+}
+
 void AbstractActor::RunOpData(OpData<DeviceTensor> *const input_data, OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(input_data);
   MS_EXCEPTION_IF_NULL(input_data->data_);
   MS_EXCEPTION_IF_NULL(input_data->data_->GetPtr());
   MS_EXCEPTION_IF_NULL(context);
   auto &sequential_num = context->sequential_num_;
+  RecordActorFlightEvent(kFlightEventActorRecvData, this, sequential_num);
+  if (enable_lock_free_input_) {
+    // Lock free path: record the message into the pre-sized slot and only the last arrived message triggers running.
+    auto data_slot = recv_input_data_num_.fetch_add(1, std::memory_order_acq_rel);
+    if (data_slot >= lock_free_input_data_slots_.size()) {
+      MS_LOG(ERROR) << "Invalid input data num:" << (data_slot + 1) << " need:" << input_datas_num_
+                    << " for actor:" << GetAID() << ", sequential num:" << sequential_num;
+      return;
+    }
+    lock_free_input_data_slots_[data_slot] = input_data;
+    if ((recv_input_msg_num_.fetch_add(1, std::memory_order_acq_rel) + 1) ==
+        (input_datas_num_ + input_controls_num_)) {
+      MaterializeLockFreeInputs(context);
+      RecordActorFlightEvent(kFlightEventActorRun, this, sequential_num);
+      Run(context);
+    }
+    return;
+  }
   (void)input_op_datas_[sequential_num].emplace_back(input_data);
 
   auto is_run = CheckRunningCondition(context);
   MS_LOG(DEBUG) << "Actor(" << GetAID().Name() << ") receive the input op data and check running condition:" << is_run;
   if (is_run) {
+    RecordActorFlightEvent(kFlightEventActorRun, this, sequential_num);
     Run(context);
   }
 }
@@ -38,16 +89,48 @@ void AbstractActor::RunOpData(OpData<DeviceTensor> *const input_data, OpContext<
 void AbstractActor::RunOpControl(AID *const input_control, OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   auto &sequential_num = context->sequential_num_;
+  RecordActorFlightEvent(kFlightEventActorRecvControl, this, sequential_num);
+  if (enable_lock_free_input_) {
+    auto control_slot = recv_input_control_num_.fetch_add(1, std::memory_order_acq_rel);
+    if (control_slot >= lock_free_input_control_slots_.size()) {
+      MS_LOG(ERROR) << "Invalid input control num:" << (control_slot + 1) << " need:" << input_controls_num_
+                    << " for actor:" << GetAID() << ", sequential num:" << sequential_num;
+      return;
+    }
+    lock_free_input_control_slots_[control_slot] = input_control;
+    if ((recv_input_msg_num_.fetch_add(1, std::memory_order_acq_rel) + 1) ==
+        (input_datas_num_ + input_controls_num_)) {
+      MaterializeLockFreeInputs(context);
+      RecordActorFlightEvent(kFlightEventActorRun, this, sequential_num);
+      Run(context);
+    }
+    return;
+  }
   (void)input_op_controls_[sequential_num].emplace_back(input_control);
 
   auto is_run = CheckRunningCondition(context);
   MS_LOG(DEBUG) << "Actor(" << GetAID().Name()
                 << ") receive the input op control and check running condition:" << is_run;
   if (is_run) {
+    RecordActorFlightEvent(kFlightEventActorRun, this, sequential_num);
     Run(context);
   }
 }
 
+void AbstractActor::MaterializeLockFreeInputs(OpContext<DeviceTensor> *const context) {
+  MS_EXCEPTION_IF_NULL(context);
+  // Only the thread receiving the last message reaches here, so the map insertion needs no protection and happens
+  // once per step instead of once per message. The subclasses fetch inputs from the maps as usual.
+  auto &sequential_num = context->sequential_num_;
+  if (input_datas_num_ != 0) {
+    input_op_datas_[sequential_num].assign(lock_free_input_data_slots_.begin(), lock_free_input_data_slots_.end());
+  }
+  if (input_controls_num_ != 0) {
+    input_op_controls_[sequential_num].assign(lock_free_input_control_slots_.begin(),
+                                              lock_free_input_control_slots_.end());
+  }
+}
+
 void AbstractActor::RunBatchOpData(std::vector<OpData<DeviceTensor> *> *const batch_input_data,
                                    OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(batch_input_data);
@@ -91,6 +174,12 @@ bool AbstractActor::CheckRunningCondition(const OpContext<DeviceTensor> *context
 
 void AbstractActor::EraseInput(const OpContext<DeviceTensor> *context) {
   MS_EXCEPTION_IF_NULL(context);
+  if (enable_lock_free_input_) {
+    // The running thread is the only owner of the slots here, so the reset needs no protection.
+    recv_input_data_num_.store(0, std::memory_order_release);
+    recv_input_control_num_.store(0, std::memory_order_release);
+    recv_input_msg_num_.store(0, std::memory_order_release);
+  }
   if ((input_datas_num_ != 0) && (!input_op_datas_.empty())) {
     auto ret = input_op_datas_.erase(context->sequential_num_);
     if (ret == 0) {
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_ABSTRACT_ACTOR_H_
 #define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_ABSTRACT_ACTOR_H_
 
+#include <atomic>
 #include <vector>
 #include <string>
 #include <memory>
@@ -47,6 +48,14 @@ constexpr int kOutputDataFlagBetweenFusion = 8;
 // Indicates that the output data destination is the fusion actor, and needs to use the fusion output index.
 constexpr int kOutputDataFlagToFusion = 16;
 
+// Flight recorder event codes of the actor runtime (module SM_RUNTIME_FRAMEWORK). arg0 is the actor
+// address and arg1 the step sequential number; the address is resolved to the actor name offline with
+// the actor table dumped at transform time, so a captured step can be replayed as the exact message
+// interleaving the threads executed.
+constexpr uint16_t kFlightEventActorRecvData = 1;
+constexpr uint16_t kFlightEventActorRecvControl = 2;
+constexpr uint16_t kFlightEventActorRun = 3;
+
 // The abstract common attributes of actors. The actor inheritance relationship:  OpActor --> AbstractActor -->
 // MemoryAwareActor --> DebugAwareActor --> KernelActor/DataSourceActor/CopyActor/LoopCountActor/OutputActor.
 class AbstractActor : public OpActor<DeviceTensor> {
@@ -74,6 +83,12 @@ class AbstractActor : public OpActor<DeviceTensor> {
   // Get the position of node in the actor.
   virtual size_t FetchNodePosition(const KernelWithIndex &node) const { return 0; }
 
+  // Enable the lock free input dispatch: the input bookkeeping uses atomic counters and pre-sized slot arrays
+  // instead of the hash map insertion per message, so that the high concurrency scene of massive actors does not
+  // serialize on the input erasure. It only supports the scene that single step is in flight, so the scheduler
+  // enables it for the static shape graphs without control flow.
+  void EnableLockFreeInputDispatch();
+
   // Get the member.
   KernelTransformType type() const { return type_; }
   const std::vector<const DeviceContext *> &device_contexts() const { return device_contexts_; }
@@ -106,6 +121,10 @@ class AbstractActor : public OpActor<DeviceTensor> {
   // Erase input data and input controls when finish actor running.
   virtual void EraseInput(const OpContext<DeviceTensor> *context);
 
+  // Copy the collected lock free slots into the input maps once before running, so the fetch interfaces of the
+  // subclasses keep unchanged. Only called by the thread which receives the last input message.
+  void MaterializeLockFreeInputs(OpContext<DeviceTensor> *const context);
+
   // Init the member output_data_ and batch_output_data_ by output data arrows.
   void InitOutputData();
   // Update the output data before send output data.
@@ -164,6 +183,16 @@ class AbstractActor : public OpActor<DeviceTensor> {
   // The dependent messages number of actor running.
   int running_dependent_msg_num_;
 
+  // The lock free input dispatch members. The received messages are collected into the pre-sized slot arrays by the
+  // atomic counters, and only the thread receiving the last message touches input_op_datas_/input_op_controls_, so
+  // no mutex is needed. See EnableLockFreeInputDispatch for the usage constraint.
+  bool enable_lock_free_input_{false};
+  std::vector<OpData<DeviceTensor> *> lock_free_input_data_slots_;
+  std::vector<AID *> lock_free_input_control_slots_;
+  std::atomic<size_t> recv_input_data_num_{0};
+  std::atomic<size_t> recv_input_control_num_{0};
+  std::atomic<size_t> recv_input_msg_num_{0};
+
   // Indicates whether the actor is in fusion actor.
   AbstractActor *parent_fusion_actor_;
 
@@ -174,6 +203,11 @@ class AbstractActor : public OpActor<DeviceTensor> {
   // All actors that the actor depends on for execution, the dependent actors are expanded by the input data and input
   // controls. For example, ActorA->ActorB->ActorC, the expanded dependent actors of ActorC are ActorA and ActorB.
   std::unordered_set<std::string> dependent_actors_;
+
+  // Membership index of the destinations of output_control_arrows_, kept in sync by the schedulers when linking.
+  // AddControlArrow checks for a duplicate on every insertion, and scanning the arrow names linearly is quadratic
+  // on the actors with many control arrows.
+  std::unordered_set<std::string> output_control_arrow_dsts_;
 };
 
 using AbstractActorPtr = std::shared_ptr<AbstractActor>;
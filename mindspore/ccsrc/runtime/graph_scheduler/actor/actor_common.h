@@ -226,6 +226,9 @@ class ActorDispatcher {
   static constexpr size_t kSingleThreadExecutionCountEnd{50};
   // The single thread execution constraint.
   static constexpr size_t kSingleThreadExecutionActorMaxNum{100};
+  // The direct call execution constraint: only the tiny graphs whose compute is in the same order as the
+  // messaging overhead benefit from skipping the measurement phases.
+  static constexpr size_t kDirectCallExecutionKernelMaxNum{20};
 
  private:
   ActorDispatcher() = default;
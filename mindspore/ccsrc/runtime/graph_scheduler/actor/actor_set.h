@@ -24,6 +24,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <unordered_map>
 #include <map>
@@ -115,9 +116,23 @@ struct ActorSet {
   ActorInfo name_;
   // The related statistics information of multi thread and single thread to decide whether use the multi thread.
   bool is_multi_thread_execution_{true};
+  // Whether the actors use the lock free input dispatch, only enabled for the static shape graphs without control
+  // flow. See AbstractActor::EnableLockFreeInputDispatch for details.
+  bool enable_lock_free_input_dispatch_{false};
+  // Whether the actor set runs on the calling thread with direct function calls from the first step, skipping the
+  // multi/single thread measurement phases. Only set for tiny linear chains of static shape kernels, where the
+  // messaging overhead exceeds the compute. See GraphScheduler::SetDirectCallExecution for the constraints.
+  bool enable_direct_call_execution_{false};
   size_t execution_count_{0};
+  // Tick of the last Run of this actor set, stamped by the scheduler. Orders the compiled variants of a
+  // long-running dynamic shape service from cold to hot for the idle-time eviction.
+  size_t last_used_tick_{0};
   double multi_thread_execution_time_{0};
   double single_thread_execution_time_{0};
+  // Serializes executions of this actor set so several serving threads can share one compiled graph and
+  // its weight device tensors instead of replicating whole sessions. The kernel output device addresses
+  // live in the shared kernel info, so two steps of the same actor set must never be in flight at once.
+  std::mutex run_mutex_;
 };
 using ActorSetPtr = std::shared_ptr<ActorSet>;
 
@@ -45,6 +45,24 @@ void ControlActor::Init() {
     (void)output_data_by_output_index_[data_arrow->from_output_index_].emplace_back(data);
     ++output_data_index;
   }
+
+  // Group the output partial arrows by the destination actor as the static routing table, so that all the partials
+  // to one destination can be sent in a single batch message at running.
+  single_output_partial_arrows_.clear();
+  batch_output_partial_arrows_.clear();
+  std::map<std::string, std::vector<DataArrowPtr>> grouped_partial_arrows;
+  for (const auto &partial_arrow : output_partial_arrows_) {
+    MS_EXCEPTION_IF_NULL(partial_arrow);
+    (void)grouped_partial_arrows[partial_arrow->to_op_id_.Name()].emplace_back(partial_arrow);
+  }
+  for (const auto &grouped_partial_arrow : grouped_partial_arrows) {
+    if (grouped_partial_arrow.second.size() > 1) {
+      (void)batch_output_partial_arrows_.emplace_back(grouped_partial_arrow.second.front()->to_op_id_,
+                                                      grouped_partial_arrow.second);
+    } else {
+      (void)single_output_partial_arrows_.emplace_back(grouped_partial_arrow.second.front());
+    }
+  }
 }
 
 void ControlActor::GetAllDeviceTensors(const OpPartialPtr &op_partial, std::vector<DeviceTensor *> *device_tensors) {
@@ -140,6 +158,14 @@ void ControlActor::RunOpPartial(const OpPartialPtr &partial, size_t position, Op
   }
 }
 
+void ControlActor::RunBatchOpPartial(const std::vector<std::pair<size_t, OpPartialPtr>> &partials,
+                                     OpContext<DeviceTensor> *const context) {
+  MS_EXCEPTION_IF_NULL(context);
+  for (const auto &partial : partials) {
+    RunOpPartial(partial.second, partial.first, context);
+  }
+}
+
 void ControlActor::RunBranchID(int branch_id, OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   auto &sequential_num = context->sequential_num_;
@@ -438,18 +464,47 @@ void ControlActor::SendOutput(OpContext<DeviceTensor> *const context) {
   AbstractActor::SendOutput(context);
 
   // Send Partial.
-  for (const auto &partial_arrow : output_partial_arrows_) {
+  SendOutputPartials(context);
+}
+
+OpPartialPtr ControlActor::FetchOutputPartial(const DataArrowPtr &partial_arrow) {
+  MS_EXCEPTION_IF_NULL(partial_arrow);
+  if (IntToSize(partial_arrow->from_output_index_) >= input_partials_.size()) {
+    return nullptr;
+  }
+  return input_partials_[IntToSize(partial_arrow->from_output_index_)];
+}
+
+void ControlActor::SendOutputPartials(OpContext<DeviceTensor> *const context) {
+  MS_EXCEPTION_IF_NULL(context);
+  for (const auto &partial_arrow : single_output_partial_arrows_) {
     MS_EXCEPTION_IF_NULL(partial_arrow);
-    if (IntToSize(partial_arrow->from_output_index_) >= input_partials_.size()) {
+    auto output_partial = FetchOutputPartial(partial_arrow);
+    if (output_partial == nullptr) {
       std::string error_info = "Invalid partial input:" + std::to_string(partial_arrow->from_output_index_) +
                                " current:" + std::to_string(input_partials_.size()) + " for actor:" + GetAID().Name();
       SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
     }
-    auto output_partial = input_partials_[partial_arrow->from_output_index_];
-    MS_EXCEPTION_IF_NULL(output_partial);
     ActorDispatcher::Send(partial_arrow->to_op_id_, &ControlActor::RunOpPartial, output_partial,
                           IntToSize(partial_arrow->to_input_index_), context);
   }
+
+  // All the partials to one destination actor are packed into a single batch message.
+  for (const auto &batch_partial_arrows : batch_output_partial_arrows_) {
+    std::vector<std::pair<size_t, OpPartialPtr>> batch_partials;
+    for (const auto &partial_arrow : batch_partial_arrows.second) {
+      MS_EXCEPTION_IF_NULL(partial_arrow);
+      auto output_partial = FetchOutputPartial(partial_arrow);
+      if (output_partial == nullptr) {
+        std::string error_info = "Invalid partial input:" + std::to_string(partial_arrow->from_output_index_) +
+                                 " current:" + std::to_string(input_partials_.size()) +
+                                 " for actor:" + GetAID().Name();
+        SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+      }
+      (void)batch_partials.emplace_back(IntToSize(partial_arrow->to_input_index_), output_partial);
+    }
+    ActorDispatcher::Send(batch_partial_arrows.first, &ControlActor::RunBatchOpPartial, batch_partials, context);
+  }
 }
 
 void ControlActor::UpdateDynamicShapeInParameter() {
@@ -61,6 +61,11 @@ class ControlActor : public MemoryAwareActor {
   // Receive partial.
   virtual void RunOpPartial(const OpPartialPtr &partial, size_t position, OpContext<DeviceTensor> *const context);
 
+  // Receive all the partials sent by one actor in a single message, instead of one message per partial. The batch
+  // is unpacked by the virtual RunOpPartial, so the subclass receiving semantics are kept.
+  void RunBatchOpPartial(const std::vector<std::pair<size_t, OpPartialPtr>> &partials,
+                         OpContext<DeviceTensor> *const context);
+
   // Receive branch id.
   virtual void RunBranchID(int branch_id, OpContext<DeviceTensor> *const context);
 
@@ -108,6 +113,11 @@ class ControlActor : public MemoryAwareActor {
   // Update the dynamic shape in backend parameters.
   void UpdateDynamicShapeInParameter();
   void SendOutput(OpContext<DeviceTensor> *const context) override;
+  // Fetch the output partial of the partial arrow, return nullptr when the arrow index is invalid.
+  virtual OpPartialPtr FetchOutputPartial(const DataArrowPtr &partial_arrow);
+  // Send the output partials by the grouped arrows. The partials to a same destination actor are packed into one
+  // batch message to cut down the messaging between the control actors in the multi-branch scenario.
+  void SendOutputPartials(OpContext<DeviceTensor> *const context);
   void EraseInput(const OpContext<DeviceTensor> *context) override;
 
   // Increase the dynamic ref count by the outputs. It corresponds to the SendOutput.
@@ -143,6 +153,10 @@ class ControlActor : public MemoryAwareActor {
 
   // Output Arrows.
   std::vector<DataArrowPtr> output_partial_arrows_;
+  // The output partial arrows grouped by the destination actor, precomputed in Init as the static routing table.
+  // The arrows to a same destination actor are sent in one batch message, the others are sent one by one.
+  std::vector<std::pair<AID, std::vector<DataArrowPtr>>> batch_output_partial_arrows_;
+  std::vector<DataArrowPtr> single_output_partial_arrows_;
 
   std::vector<AID> output_branch_id_arrows_;
   // The branch id is the unique identifier of the control actor. In the control flow, there are multiple control
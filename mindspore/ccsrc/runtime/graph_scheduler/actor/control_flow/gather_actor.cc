@@ -49,28 +49,21 @@ void GatherActor::SendOutput(OpContext<DeviceTensor> *const context) {
   AbstractActor::SendOutput(context);
 
   // 4.Send Partial.
-  for (const auto &partial_arrow : output_partial_arrows_) {
-    MS_EXCEPTION_IF_NULL(partial_arrow);
-    if (IntToSize(partial_arrow->from_output_index_) >= input_partials_.size()) {
-      std::string error_info = "Invalid partial input:" + std::to_string(partial_arrow->from_output_index_) +
-                               " current:" + std::to_string(input_partials_.size()) + " for actor:" + GetAID().Name();
-      SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
-    }
-    // The first partial maybe the local partial in the partial node, so the output need use the gather input partial.
-    if (partial_arrow->from_output_index_ == 0) {
-      ActorDispatcher::Send(partial_arrow->to_op_id_, &ControlActor::RunOpPartial, gather_input_,
-                            IntToSize(partial_arrow->to_input_index_), context);
-    } else {
-      ActorDispatcher::Send(partial_arrow->to_op_id_, &ControlActor::RunOpPartial,
-                            input_partials_[IntToSize(partial_arrow->from_output_index_)],
-                            IntToSize(partial_arrow->to_input_index_), context);
-    }
-  }
+  SendOutputPartials(context);
 
   // 5.Destroy the gathehr input.
   gather_input_ = nullptr;
 }
 
+OpPartialPtr GatherActor::FetchOutputPartial(const DataArrowPtr &partial_arrow) {
+  MS_EXCEPTION_IF_NULL(partial_arrow);
+  // The first partial maybe the local partial in the partial node, so the output need use the gather input partial.
+  if (partial_arrow->from_output_index_ == 0) {
+    return gather_input_;
+  }
+  return ControlActor::FetchOutputPartial(partial_arrow);
+}
+
 void GatherActor::IncreaseDynamicRefCounts(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   // Build the gather input.
@@ -45,6 +45,7 @@ class GatherActor : public ControlActor {
  protected:
   void SendOutput(OpContext<DeviceTensor> *const context) override;
   void IncreaseDynamicRefCounts(OpContext<DeviceTensor> *const context) override;
+  OpPartialPtr FetchOutputPartial(const DataArrowPtr &partial_arrow) override;
 
  private:
   friend class ControlNodeScheduler;
@@ -15,8 +15,10 @@
  */
 
 #include <algorithm>
+#include <string_view>
 
 #include "runtime/graph_scheduler/actor/data_prepare_actor.h"
+#include "runtime/graph_scheduler/actor/host_timeline_recorder.h"
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 #include "runtime/graph_scheduler/actor/kernel_actor.h"
 #include "runtime/graph_scheduler/actor/loop_count_actor.h"
@@ -24,6 +26,10 @@
 #include "runtime/hardware/device_context_manager.h"
 #include "mindrt/include/async/async.h"
 #include "utils/log_adapter.h"
+#include "utils/hashing.h"
+#include "utils/hash_set.h"
+#include "utils/ms_utils.h"
+#include "utils/profile.h"
 #include "include/common/utils/convert_utils.h"
 #include "distributed/recovery/recovery_context.h"
 #ifdef WITH_BACKEND
@@ -64,6 +70,58 @@ void SyncTensorData(const TensorPtr &host_tensor, const DeviceTensorPtr &device_
   }
 }
 
+// Whether the device memory of identical value node tensors can be shared across graphs. When enabled, the first
+// prepared device tensor of given content is cached in the device tensor store and the later identical ones are
+// filled by device-to-device copy instead of another host-to-device transfer.
+bool EnableConstDeviceTensorShare() {
+  static const bool enable_share = common::GetEnv("MS_DEV_SHARE_CONST_DEVICE_TENSOR") == "1";
+  return enable_share;
+}
+
+size_t GetTensorContentHash(const TensorPtr &host_tensor) {
+  MS_EXCEPTION_IF_NULL(host_tensor);
+  const auto data_size = LongToSize(host_tensor->data().nbytes());
+  const auto *data = static_cast<const char *>(host_tensor->data_c());
+  if (data == nullptr || data_size == 0) {
+    return 0;
+  }
+  return hash_combine(std::hash<std::string_view>{}(std::string_view(data, data_size)),
+                      static_cast<size_t>(host_tensor->data_type()));
+}
+
+// Try to fill the device tensor of a value node by copying from an already prepared device tensor with the same
+// content. Return false if there is no reusable device tensor or the copy fails, so that the caller falls back to
+// the normal host-to-device sync.
+bool CopyConstTensorFromCache(const DeviceTensorPtr &device_tensor, const AnfNodePtr &node,
+                              const DeviceContext *device_context, size_t content_hash) {
+  MS_EXCEPTION_IF_NULL(device_tensor);
+  MS_EXCEPTION_IF_NULL(node);
+  MS_EXCEPTION_IF_NULL(device_context);
+  if (content_hash == 0) {
+    return false;
+  }
+  const auto &cached_tensor =
+    DeviceTensorStore::GetInstance().FetchConstDeviceTensor(content_hash, device_tensor->GetDeviceType());
+  if (cached_tensor == nullptr || cached_tensor == device_tensor ||
+      cached_tensor->GetSize() != device_tensor->GetSize() || cached_tensor->format() != device_tensor->format() ||
+      cached_tensor->type_id() != device_tensor->type_id()) {
+    return false;
+  }
+
+  device::DynamicMemAllocatorDebugInfo::SetDebugInfo(node->fullname_with_scope(),
+                                                     device::AllocatorType::kConstantValue, 0);
+  if ((device_tensor->GetPtr() == nullptr) &&
+      (!device_context->device_res_manager_->AllocateMemory(device_tensor.get()))) {
+    return false;
+  }
+  if (!device_tensor->SyncDeviceToDevice(cached_tensor.get())) {
+    MS_LOG(WARNING) << "Copy cached const device tensor failed for value node: " << node->fullname_with_scope()
+                    << ", fall back to sync from host.";
+    return false;
+  }
+  return true;
+}
+
 void FetchContinuousMemoryInfo(const CNodePtr &node, std::vector<DeviceTensorPtr> *const addr_list,
                                std::vector<size_t> *const size_list, size_t *const total_size, bool is_input) {
   MS_EXCEPTION_IF_NULL(node);
@@ -296,6 +354,70 @@ void DataPrepareActor::Init() {
   }
 }
 
+void DataPrepareActor::InitWeightPrefetchList() {
+  MS_EXCEPTION_IF_NULL(graph_compiler_info_);
+  mindspore::HashSet<const AnfNode *> recorded_nodes;
+  for (size_t i = 0; i < graph_compiler_info_->graphs_.size(); ++i) {
+    const auto &graph = graph_compiler_info_->graphs_[i];
+    const auto *device_context = graph_compiler_info_->device_contexts_[i];
+    MS_EXCEPTION_IF_NULL(graph);
+    MS_EXCEPTION_IF_NULL(device_context);
+    if (device_context->GetDeviceType() != device::DeviceType::kCPU) {
+      continue;
+    }
+    // Walk the kernels in schedule order, so the weights are warmed in the order the step will touch
+    // them and the front of the working set is still resident when the first kernels launch.
+    for (const auto &kernel : graph->execution_order()) {
+      MS_EXCEPTION_IF_NULL(kernel);
+      auto input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+      for (size_t input_index = 0; input_index < input_num; ++input_index) {
+        const auto &input_node = common::AnfAlgo::GetInputNode(kernel, input_index);
+        if (input_node == nullptr || !IsPersistentDeviceTensor(input_node)) {
+          continue;
+        }
+        const auto &front_node = AnfAlgo::FetchFrontNodeByBackendNode(input_node, *graph);
+        if (front_node == nullptr || recorded_nodes.count(front_node.get()) > 0) {
+          continue;
+        }
+        (void)recorded_nodes.insert(front_node.get());
+        (void)weight_prefetch_nodes_.emplace_back(front_node.get());
+      }
+    }
+  }
+  MS_LOG(INFO) << "The weight prefetch list contains " << weight_prefetch_nodes_.size() << " persistent tensors.";
+}
+
+void DataPrepareActor::PrefetchWeightsForCPU() {
+  // The data buffers of a step usually evict the persistent weights from the last level cache, so their
+  // first touch in the next step pays a cold miss per cache line. Optionally walk the weight working set
+  // at the end of data prepare to warm the cache before the kernels launch. Opt-in, since it only pays
+  // off for memory-bound CPU training whose weights fit in the last level cache.
+  static const bool enable_prefetch = common::GetEnv("MS_ENABLE_CPU_WEIGHT_PREFETCH") == "1";
+  if (!enable_prefetch) {
+    return;
+  }
+#if defined(__GNUC__) || defined(__clang__)
+  if (!weight_prefetch_inited_) {
+    InitWeightPrefetchList();
+    weight_prefetch_inited_ = true;
+  }
+  constexpr size_t kCacheLineSize = 64;
+  for (auto *front_node : weight_prefetch_nodes_) {
+    // The device tensor is refetched every step because the data prepare may replace it in the store.
+    auto *device_tensor = DeviceTensorStore::GetInstance().Fetch(front_node, device::DeviceType::kCPU);
+    if (device_tensor == nullptr || device_tensor->GetPtr() == nullptr) {
+      continue;
+    }
+    const auto *addr = static_cast<const char *>(device_tensor->GetPtr());
+    auto size = device_tensor->GetSize();
+    for (size_t offset = 0; offset < size; offset += kCacheLineSize) {
+      // Read prefetch with low temporal locality, aimed at the outer cache levels.
+      __builtin_prefetch(addr + offset, 0, 1);
+    }
+  }
+#endif
+}
+
 void DataPrepareActor::UpdateDynamicShape(const AnfNodePtr &input_node, const TensorPtr &input_tensor) const {
   MS_EXCEPTION_IF_NULL(input_node);
   if (input_tensor == nullptr) {
@@ -370,6 +492,10 @@ void DataPrepareActor::SetInitTensorsIfNeeded(const std::vector<std::vector<Tens
 void DataPrepareActor::PrepareData(const std::vector<std::vector<TensorPtr>> &input_tensors,
                                    OpContext<DeviceTensor> *const context, GraphExecutionStrategy real_strategy) {
   MS_EXCEPTION_IF_NULL(context);
+  double timeline_start_time = 0;
+  if (HostTimelineRecorder::IsEnabled()) {
+    timeline_start_time = GetTime();
+  }
   try {
     // Preprocess before prepare data for data prepare actor.
     PreprocessBeforePrepareData();
@@ -403,6 +529,10 @@ void DataPrepareActor::PrepareData(const std::vector<std::vector<TensorPtr>> &in
   }
 
   UpdateGraphsRefNodeAddress(graph_compiler_info_->graphs_);
+  PrefetchWeightsForCPU();
+  if (HostTimelineRecorder::IsEnabled()) {
+    HostTimelineRecorder::GetInstance().RecordSpan("data_prepare", GetAID().Name(), timeline_start_time, GetTime());
+  }
   // Debug actor is blocked, must wait debug actor callback message to process continue.
   if (debug_aid_ != nullptr && strategy_ == GraphExecutionStrategy::kPipeline) {
     SendDebugReq(context);
@@ -650,7 +780,17 @@ void DataPrepareActor::PrepareDataForValueNodeTensor(const ValueNodePtr &node, c
     tensor->set_device_address(device_tensor);
     UpdateRefCount(device_tensor.get(), true);
 
-    SyncTensorData(tensor, device_tensor, node, device_context, context, real_strategy_);
+    if (EnableConstDeviceTensorShare()) {
+      const auto content_hash = GetTensorContentHash(tensor);
+      if (!CopyConstTensorFromCache(device_tensor, node, device_context, content_hash)) {
+        SyncTensorData(tensor, device_tensor, node, device_context, context, real_strategy_);
+        if (content_hash != 0) {
+          DeviceTensorStore::GetInstance().InsertConstDeviceTensor(content_hash, device_tensor);
+        }
+      }
+    } else {
+      SyncTensorData(tensor, device_tensor, node, device_context, context, real_strategy_);
+    }
     CopyDataFromDeviceTensorStore(front_node, node, device_tensor, device_context, context);
   }
 }
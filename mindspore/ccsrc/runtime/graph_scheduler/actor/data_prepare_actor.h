@@ -118,6 +118,10 @@ class DataPrepareActor : public DebugAwareActor {
   // Preprocess before prepare data for data prepare actor.
   void PreprocessBeforePrepareData() const;
 
+  // The optional LLC warming stage for CPU training, see PrefetchWeightsForCPU.
+  void InitWeightPrefetchList();
+  void PrefetchWeightsForCPU();
+
   const GraphCompilerInfo *graph_compiler_info_;
   GraphExecutionStrategy strategy_;
   GraphExecutionStrategy real_strategy_;
@@ -134,6 +138,11 @@ class DataPrepareActor : public DebugAwareActor {
   std::vector<size_t> total_size_list_;
   std::vector<const DeviceContext *> continuous_memory_device_contexts_;
   std::vector<std::vector<TensorPtr>> init_tensors_;
+
+  // The persistent tensors of the CPU graphs in first-use order of the execution schedule, built lazily
+  // after the first data prepare assigned the weight device addresses.
+  std::vector<AnfNode *> weight_prefetch_nodes_;
+  bool weight_prefetch_inited_{false};
 };  // namespace runtime
 
 using DataPrepareActorPtr = std::shared_ptr<DataPrepareActor>;
@@ -265,6 +265,8 @@ void HostQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *cons
   }
 
   // Copy data from host tensor to device tensor.
+  void *copy_stream = GetCopyStream();
+  bool has_async_copy = false;
   for (size_t i = 0; i < host_tensors.size(); ++i) {
     auto &host_tensor = host_tensors[i];
     auto &device_tensor = device_tensors[i];
@@ -282,6 +284,20 @@ void HostQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *cons
       continue;
     }
 
+    // Issue the copy on the dedicated copy stream when no host side format/type transformation is needed, so the
+    // copies of all inputs are pipelined instead of blocking one by one.
+    if (copy_stream != nullptr && host_tensor->data_type() == device_tensor->type_id() &&
+        device_tensor->format() == kOpFormat_DEFAULT &&
+        LongToSize(host_tensor->data().nbytes()) == device_tensor->GetSize()) {
+      if (!device_tensor->AsyncHostToDevice(
+            trans::GetRuntimePaddingShape(data_node_with_indexs_[i].first, data_node_with_indexs_[i].second),
+            LongToSize(host_tensor->data().nbytes()), host_tensor->data_type(), host_tensor->data_c(), copy_stream)) {
+        SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), "AsyncHostToDevice failed.");
+      }
+      has_async_copy = true;
+      continue;
+    }
+
     // Sync data from host_tensor to device_tensor.
     if (!device_tensor->SyncHostToDevice(
           trans::GetRuntimePaddingShape(data_node_with_indexs_[i].first, data_node_with_indexs_[i].second),
@@ -290,6 +306,10 @@ void HostQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *cons
       SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), "SyncHostToDevice failed.");
     }
   }
+  // Wait for the copy stream before handing the device tensors to the downstream kernel actors.
+  if (has_async_copy && !device_contexts_[0]->device_res_manager_->SyncStream(copy_stream_id_)) {
+    SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), "Sync the host to device copy stream failed.");
+  }
   host_queue_->Pop();
 
   PostRun(context);
@@ -312,6 +332,30 @@ KernelWithIndex HostQueueDataSourceActor::FetchNode(size_t node_position) const
   return data_node_with_indexs_[node_position];
 }
 
+void *HostQueueDataSourceActor::GetCopyStream() {
+  if (copy_stream_inited_) {
+    return copy_stream_;
+  }
+  copy_stream_inited_ = true;
+  if (!IsSameDeviceType()) {
+    return nullptr;
+  }
+  const auto &device_context = device_contexts_[0];
+  MS_EXCEPTION_IF_NULL(device_context);
+  // Only the devices with stream support can issue asynchronous copies, the others keep the synchronous interface.
+  auto device_type = device_context->GetDeviceType();
+  if (device_type != device::DeviceType::kGPU && device_type != device::DeviceType::kAscend) {
+    return nullptr;
+  }
+  MS_EXCEPTION_IF_NULL(device_context->device_res_manager_);
+  if (!device_context->device_res_manager_->CreateStream(&copy_stream_id_)) {
+    MS_LOG(WARNING) << "Create the host to device copy stream failed, fall back to the synchronous copy.";
+    return nullptr;
+  }
+  copy_stream_ = device_context->device_res_manager_->GetStream(copy_stream_id_);
+  return copy_stream_;
+}
+
 bool HostQueueDataSourceActor::IsSameDeviceType() const {
   for (size_t i = 1; i < device_contexts_.size(); i++) {
     if (device_contexts_[i] != device_contexts_[0]) {
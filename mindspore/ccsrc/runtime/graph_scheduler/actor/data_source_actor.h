@@ -141,7 +141,17 @@ class HostQueueDataSourceActor : public DataSourceActor {
   // Judge all the data_nodes_ is from the same device.
   bool IsSameDeviceType() const;
 
+  // Fetch the dedicated stream for host-to-device copies, created lazily on the first step. Return nullptr when the
+  // device has no copy stream and the copies need the synchronous interface.
+  void *GetCopyStream();
+
   HostTensorQueuePtr host_queue_;
+
+  // The members of the dedicated copy stream, which makes the input copies pipelined with each other and not
+  // serialized behind the compute stream.
+  bool copy_stream_inited_{false};
+  size_t copy_stream_id_{0};
+  void *copy_stream_{nullptr};
   // Input data nodes fetch data from host queue.
   std::vector<KernelWithIndex> data_node_with_indexs_;
 
@@ -15,7 +15,9 @@
  */
 
 #include "runtime/graph_scheduler/actor/embedding_cache/embedding_cache_prefetch_actor.h"
+#include <algorithm>
 #include <limits>
+#include <numeric>
 #include "backend/common/optimizer/dynamic_shape/dynamic_shape_helper.h"
 #include "kernel/common_utils.h"
 #include "runtime/graph_scheduler/actor/rpc/rpc_actor.h"
@@ -35,6 +37,9 @@ const size_t kInputIndexZero = 0;
 const size_t kInputIndexOne = 1;
 const size_t kInputIndexTwo = 2;
 
+// Interval (in data steps) at which the cumulative per-tier cache hit rates are dumped.
+constexpr size_t kDumpTierStatisticsInterval = 1000;
+
 // Maximum number of threads for concurrent accelerated cache processing.
 constexpr size_t kMaxThreadNum = 16;
 // Maximum number of feature ids processed per thread.
@@ -265,6 +270,7 @@ void EmbeddingCachePrefetchActor::Finalize() {
   if (!initialized_ || finalized_) {
     return;
   }
+  DumpTierStatistics();
   SyncEmbeddingTable();
 
   running_ = false;
@@ -527,6 +533,7 @@ bool EmbeddingCachePrefetchActor::PrefetchCache() {
   // 2. Count cache miss ids.
   RETURN_IF_FALSE_WITH_LOG(CountCacheMissIds(batch_ids, batch_ids_num, hash_index.get()),
                            "Count cache miss ids failed.");
+  AccumulateTierStatistics();
 
   if ((device_cache_need_wait_graph_ || host_cache_need_wait_graph_) && (!WaitGraphRun())) {
     MS_LOG(ERROR) << "Cache prefetching waits graph finish failed.";
@@ -547,6 +554,35 @@ bool EmbeddingCachePrefetchActor::PrefetchCache() {
   return true;
 }
 
+void EmbeddingCachePrefetchActor::AccumulateTierStatistics() {
+  total_id_count_ += statistics_info_.batch_id_count_;
+  device_hit_count_ += statistics_info_.hash_hit_count_;
+  device_miss_count_ += statistics_info_.host_to_device_size_;
+  // The ids which miss the device cache but need not be pulled from the remote cache hit the local host cache.
+  host_hit_count_ += statistics_info_.host_to_device_size_ - statistics_info_.server_to_host_size_;
+  host_miss_count_ += statistics_info_.server_to_host_size_;
+
+  if (data_step_ % kDumpTierStatisticsInterval == 0) {
+    DumpTierStatistics();
+  }
+}
+
+void EmbeddingCachePrefetchActor::DumpTierStatistics() const {
+  size_t device_lookup_count = device_hit_count_ + device_miss_count_;
+  size_t host_lookup_count = host_hit_count_ + host_miss_count_;
+  if (device_lookup_count == 0) {
+    return;
+  }
+  const float device_hit_rate = static_cast<float>(device_hit_count_) / static_cast<float>(device_lookup_count);
+  const float host_hit_rate =
+    host_lookup_count == 0 ? 1.0f : static_cast<float>(host_hit_count_) / static_cast<float>(host_lookup_count);
+  MS_LOG(INFO) << "Embedding cache tier statistics after step " << data_step_ << ": total ids count: "
+               << total_id_count_ << ", device cache hit rate: " << device_hit_rate << "(hit count: "
+               << device_hit_count_ << ", miss count: " << device_miss_count_ << "), local host cache hit rate: "
+               << host_hit_rate << "(hit count: " << host_hit_count_ << ", miss count(pulled from remote): "
+               << host_miss_count_ << ").";
+}
+
 bool EmbeddingCachePrefetchActor::IncreaseStep() {
   if (data_step_ >= UINT64_MAX) {
     MS_LOG(ERROR) << "The data step (" << data_step_ << ") will exceed the maximum value of uint64_t.";
@@ -1401,6 +1437,111 @@ bool EmbeddingCachePrefetchActor::RetrieveEmbeddings(
   return true;
 }
 
+namespace {
+// Id batch size of the bulk export, keeps the export memory bounded no matter how many rows are exported.
+constexpr size_t kExportBatchIdsNum = 65536;
+}  // namespace
+
+bool EmbeddingCachePrefetchActor::ExportEmbeddingsToFile(int32_t param_key, int start_id, int end_id,
+                                                         const std::string &file_path) {
+  if (start_id < 0 || end_id <= start_id) {
+    MS_LOG(ERROR) << "Invalid export id range: [" << start_id << ", " << end_id << ")";
+    return false;
+  }
+
+  const auto &iter = std::find_if(hash_tables_.begin(), hash_tables_.end(),
+                                  [param_key](const auto &item) { return item.second.param_key_ == param_key; });
+  if (iter == hash_tables_.end()) {
+    MS_LOG(ERROR) << "Can not find the hash table info for parameter key: " << param_key;
+    return false;
+  }
+  size_t embedding_dim = iter->second.embedding_size;
+
+  RETURN_IF_FALSE_WITH_LOG(PushLatestCacheToRemote(), "Push latest embedding cache to remote failed.");
+
+  std::ofstream output_file(file_path, std::ios::binary | std::ios::trunc);
+  if (!output_file.is_open()) {
+    MS_LOG(ERROR) << "Open export file failed, file path: " << file_path;
+    return false;
+  }
+
+  std::vector<int> batch_ids;
+  for (int batch_start = start_id; batch_start < end_id; batch_start += SizeToInt(kExportBatchIdsNum)) {
+    size_t batch_ids_num = std::min(kExportBatchIdsNum, IntToSize(end_id - batch_start));
+    batch_ids.resize(batch_ids_num);
+    std::iota(batch_ids.begin(), batch_ids.end(), batch_start);
+    RETURN_IF_FALSE_WITH_LOG(ExportEmbeddingBatch(param_key, batch_ids.data(), batch_ids_num, embedding_dim,
+                                                  &output_file),
+                             "Export one batch of embeddings failed.");
+  }
+  output_file.close();
+  MS_LOG(INFO) << "Export embeddings of parameter key: " << param_key << ", id range: [" << start_id << ", "
+               << end_id << ") to file: " << file_path << " success.";
+  return true;
+}
+
+bool EmbeddingCachePrefetchActor::ExportEmbeddingsToFile(int32_t param_key, const std::vector<int> &ids,
+                                                         const std::string &file_path) {
+  if (ids.empty()) {
+    MS_LOG(ERROR) << "The export ids is empty.";
+    return false;
+  }
+
+  const auto &iter = std::find_if(hash_tables_.begin(), hash_tables_.end(),
+                                  [param_key](const auto &item) { return item.second.param_key_ == param_key; });
+  if (iter == hash_tables_.end()) {
+    MS_LOG(ERROR) << "Can not find the hash table info for parameter key: " << param_key;
+    return false;
+  }
+  size_t embedding_dim = iter->second.embedding_size;
+
+  RETURN_IF_FALSE_WITH_LOG(PushLatestCacheToRemote(), "Push latest embedding cache to remote failed.");
+
+  std::ofstream output_file(file_path, std::ios::binary | std::ios::trunc);
+  if (!output_file.is_open()) {
+    MS_LOG(ERROR) << "Open export file failed, file path: " << file_path;
+    return false;
+  }
+
+  for (size_t offset = 0; offset < ids.size(); offset += kExportBatchIdsNum) {
+    size_t batch_ids_num = std::min(kExportBatchIdsNum, ids.size() - offset);
+    RETURN_IF_FALSE_WITH_LOG(ExportEmbeddingBatch(param_key, ids.data() + offset, batch_ids_num, embedding_dim,
+                                                  &output_file),
+                             "Export one batch of embeddings failed.");
+  }
+  output_file.close();
+  MS_LOG(INFO) << "Export embeddings of parameter key: " << param_key << ", ids number: " << ids.size()
+               << " to file: " << file_path << " success.";
+  return true;
+}
+
+bool EmbeddingCachePrefetchActor::PushLatestCacheToRemote() {
+  std::lock_guard<std::mutex> locker(sync_embedding_table_mutex_);
+  if (!initialized_) {
+    MS_LOG(ERROR) << "The embedding cache prefetch actor is not initialized.";
+    return false;
+  }
+  RETURN_IF_FALSE_WITH_LOG(SyncHostEmbeddingTable(), "SyncHostEmbeddingTable failed.");
+  RETURN_IF_FALSE_WITH_LOG(SyncDeviceEmbeddingTable(), "SyncDeviceEmbeddingTable failed.");
+  return true;
+}
+
+bool EmbeddingCachePrefetchActor::ExportEmbeddingBatch(int32_t param_key, const int *ids, size_t ids_num,
+                                                       size_t embedding_dim, std::ofstream *output_file) {
+  MS_ERROR_IF_NULL(ids);
+  MS_ERROR_IF_NULL(output_file);
+  std::vector<float> embeddings(SizetMulWithOverflowCheck(ids_num, embedding_dim));
+  RETURN_IF_FALSE_WITH_LOG(PullEembeddingsFromRemote(param_key, ids, ids_num, &embeddings),
+                           "Pull embeddings from remote failed.");
+  (void)output_file->write(reinterpret_cast<const char *>(embeddings.data()),
+                           SizeToLong(embeddings.size() * sizeof(float)));
+  if (!output_file->good()) {
+    MS_LOG(ERROR) << "Write embeddings to the export file failed.";
+    return false;
+  }
+  return true;
+}
+
 void EmbeddingCachePrefetchActor::SyncEmbeddingTable() {
   std::lock_guard<std::mutex> locker(sync_embedding_table_mutex_);
   // Do not synchronize in case of abnormally finalizing.
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_RUNTIME_GRAPH_SCHEDULER_ACTOR_EMBEDDING_CACHE_EMBEDDING_CACHE_PREFETCH_ACTOR_H_
 #define MINDSPORE_CCSRC_RUNTIME_GRAPH_SCHEDULER_ACTOR_EMBEDDING_CACHE_EMBEDDING_CACHE_PREFETCH_ACTOR_H_
 
+#include <fstream>
 #include <map>
 #include <memory>
 #include <string>
@@ -90,6 +91,17 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   // Sync latest embedding table to remote.
   void SyncEmbeddingTable();
 
+  // Bulk export embedding rows for offline inspection or evaluation. The rows of the embedding table identified
+  // by 'param_key' whose feature ids lie in [start_id, end_id) are pulled from the remote cache in bounded
+  // batches and streamed into a binary file (row-major, embedding dim floats per id, ascending id order). The
+  // whole path is C++ only, no Python marshalling is involved. The latest local host and device cache content is
+  // pushed to the remote first, so the export sees the newest weights. Intended to be called between steps, such
+  // as at epoch end.
+  bool ExportEmbeddingsToFile(int32_t param_key, int start_id, int end_id, const std::string &file_path);
+
+  // The same bulk export for an explicit feature id list instead of an id range.
+  bool ExportEmbeddingsToFile(int32_t param_key, const std::vector<int> &ids, const std::string &file_path);
+
   // Finalize embedding cache prefetch actor and push latest embedding from local cache to remote cache.
   void Finalize();
 
@@ -126,6 +138,15 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   // Reset EmbeddingHashMap for device and local host cache.
   bool ResetEmbeddingHashMap();
 
+  // Accumulate the per-batch hit/miss counters of the current batch into the cumulative per-tier counters, which
+  // record how often each tier(device cache, local host cache) of the cache hierarchy is hit and are used to size
+  // the tiers.
+  void AccumulateTierStatistics();
+
+  // Dump the cumulative hit rate of each tier(device cache, local host cache) of the cache hierarchy. A miss on the
+  // local host cache means the embedding has to be pulled from the remote cache.
+  void DumpTierStatistics() const;
+
   // Update the current computed graph's step to real global step at the time when this actor starts to prefetch cache
   // for a batch ids.
   void set_current_graph_step() { graph_running_step_ = graph_step_; }
@@ -190,6 +211,15 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   // Send finalize request to remote and finalize it.
   bool FinalizeRemote();
 
+  // Push the current local host and device embedding cache content to the remote before a bulk export, so
+  // the remote holds the newest weights. Unlike SyncEmbeddingTable, the finish flag is not set, so the final
+  // synchronization on finalizing still runs.
+  bool PushLatestCacheToRemote();
+
+  // Pull the embeddings of one id batch from the remote and append them to the export file.
+  bool ExportEmbeddingBatch(int32_t param_key, const int *ids, size_t ids_num, size_t embedding_dim,
+                            std::ofstream *output_file);
+
   // Sync latest local host embedding cache to remote.
   bool SyncHostEmbeddingTable();
   // Sync latest device embedding cache to remote.
@@ -277,6 +307,19 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   // Statistics on the cache hit rate of the host and device and the information used to update cache.
   EmbeddingCacheStatisticsInfo statistics_info_;
 
+  // Cumulative per-tier counters of the cache hierarchy accumulated over all batches, used to analyze whether the
+  // device cache and local host cache are sized properly.
+  // Total number of feature ids which have been analyzed.
+  size_t total_id_count_{0};
+  // Number of unique feature ids which hit the device cache.
+  size_t device_hit_count_{0};
+  // Number of unique feature ids which miss the device cache and need to be swapped in from the local host cache.
+  size_t device_miss_count_{0};
+  // Number of device cache missing feature ids which hit the local host cache.
+  size_t host_hit_count_{0};
+  // Number of feature ids which miss the local host cache and need to be pulled from the remote cache.
+  size_t host_miss_count_{0};
+
   // Model parallelism is used between multiple workers, and local_embedding_slice_bounds_ records the feature range
   // corresponding to the embedding table slice of the process.
   std::pair<int, int> local_embedding_slice_bounds_;
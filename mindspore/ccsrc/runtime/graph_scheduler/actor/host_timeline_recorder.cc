@@ -0,0 +1,124 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/actor/host_timeline_recorder.h"
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <utility>
+#include "utils/log_adapter.h"
+#include "utils/ms_utils.h"
+#include "utils/profile.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+constexpr auto kHostTimelineEnv = "MS_DEV_HOST_TIMELINE";
+constexpr auto kHostTimelinePathEnv = "MS_DEV_HOST_TIMELINE_PATH";
+constexpr auto kDefaultTimelinePath = "./host_timeline.json";
+constexpr double kSecondToMicro = 1000000.0;
+
+uint64_t GetCurrentTid() {
+  static thread_local uint64_t tid = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return tid;
+}
+}  // namespace
+
+HostTimelineRecorder::HostTimelineRecorder() {
+  // Anchor the steady clock of GetTime() to the wall clock once, so every exported span lands on the same
+  // microsecond axis the device profilers use for their host timestamps.
+  auto wall_now = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+  steady_to_wall_offset_sec_ = wall_now - GetTime();
+}
+
+HostTimelineRecorder &HostTimelineRecorder::GetInstance() {
+  static HostTimelineRecorder instance;
+  return instance;
+}
+
+bool HostTimelineRecorder::IsEnabled() {
+#ifdef ENABLE_SECURITY
+  return false;
+#else
+  static const bool enabled = common::GetEnv(kHostTimelineEnv) == "1";
+  return enabled;
+#endif
+}
+
+uint64_t HostTimelineRecorder::ToWallClockUs(double steady_time) const {
+  double wall_time = steady_time + steady_to_wall_offset_sec_;
+  if (wall_time <= 0) {
+    return 0;
+  }
+  return static_cast<uint64_t>(wall_time * kSecondToMicro);
+}
+
+void HostTimelineRecorder::RecordSpan(const std::string &category, const std::string &name, double start_time,
+                                      double end_time) {
+  if (end_time < start_time) {
+    return;
+  }
+  TimelineSpan span;
+  span.category = category;
+  span.name = name;
+  span.start_us = ToWallClockUs(start_time);
+  span.duration_us = static_cast<uint64_t>((end_time - start_time) * kSecondToMicro);
+  span.tid = GetCurrentTid();
+  std::lock_guard<std::mutex> lock(mutex_);
+  (void)spans_.emplace_back(std::move(span));
+}
+
+void HostTimelineRecorder::Dump() {
+  if (!IsEnabled()) {
+    return;
+  }
+  std::vector<TimelineSpan> spans;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    spans.swap(spans_);
+  }
+  if (spans.empty()) {
+    return;
+  }
+
+  auto file_path = common::GetEnv(kHostTimelinePathEnv);
+  if (file_path.empty()) {
+    file_path = kDefaultTimelinePath;
+  }
+  std::ofstream ofs(file_path, std::ofstream::trunc);
+  if (!ofs.is_open()) {
+    MS_LOG(WARNING) << "Open the host timeline file failed: " << file_path;
+    return;
+  }
+
+  // The Chrome trace event format: one complete("X") event per span, the timestamps are in microseconds.
+  ofs << "{\"traceEvents\":[";
+  for (size_t i = 0; i < spans.size(); ++i) {
+    const auto &span = spans[i];
+    if (i != 0) {
+      ofs << ",";
+    }
+    ofs << "{\"name\":\"" << span.name << "\",\"cat\":\"" << span.category << "\",\"ph\":\"X\",\"ts\":" << span.start_us
+        << ",\"dur\":" << span.duration_us << ",\"pid\":\"host\",\"tid\":" << span.tid << "}";
+  }
+  ofs << "]}";
+  ofs.close();
+  MS_LOG(INFO) << "Export " << spans.size() << " host timeline spans to " << file_path;
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_HOST_TIMELINE_RECORDER_H_
+#define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_HOST_TIMELINE_RECORDER_H_
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mindspore {
+namespace runtime {
+// One host span of the unified timeline, the timestamps are wall clock microseconds.
+struct TimelineSpan {
+  std::string category;
+  std::string name;
+  uint64_t start_us;
+  uint64_t duration_us;
+  uint64_t tid;
+};
+
+// Records the host side phases of the actor runtime (kernel dispatch, memory wait, kernel launch and data prepare)
+// into a trace buffer and exports it in the Chrome trace event format when the graph scheduler is cleared. The spans
+// are stamped with the same wall clock microseconds the device profilers use for their host timestamps, so the file
+// can be opened together with the device timeline and the device idle gaps can be attributed to scheduling, memory
+// or data feed. Enabled by the env MS_DEV_HOST_TIMELINE=1, the output file path is set by the env
+// MS_DEV_HOST_TIMELINE_PATH (default ./host_timeline.json).
+class HostTimelineRecorder {
+ public:
+  static HostTimelineRecorder &GetInstance();
+  static bool IsEnabled();
+
+  // Record one finished span, the boundaries are the values of GetTime() at the span start and end.
+  void RecordSpan(const std::string &category, const std::string &name, double start_time, double end_time);
+
+  // Write the collected spans into the Chrome trace file and clear the buffer, called when the graph scheduler
+  // is cleared.
+  void Dump();
+
+ private:
+  HostTimelineRecorder();
+  ~HostTimelineRecorder() = default;
+  HostTimelineRecorder(const HostTimelineRecorder &) = delete;
+  HostTimelineRecorder &operator=(const HostTimelineRecorder &) = delete;
+
+  // Convert a GetTime() value (steady clock seconds) into wall clock microseconds.
+  uint64_t ToWallClockUs(double steady_time) const;
+
+  mutable std::mutex mutex_;
+  std::vector<TimelineSpan> spans_;
+  // The offset from the steady clock of GetTime() to the wall clock, fixed at construction so all the spans share
+  // one clock mapping.
+  double steady_to_wall_offset_sec_{0};
+};
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_HOST_TIMELINE_RECORDER_H_
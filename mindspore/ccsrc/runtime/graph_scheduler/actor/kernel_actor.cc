@@ -15,12 +15,18 @@
  */
 
 #include "runtime/graph_scheduler/actor/kernel_actor.h"
+#include <algorithm>
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 #include "runtime/graph_scheduler/actor/output_actor.h"
 #include "runtime/graph_scheduler/actor/recorder_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
+#include "runtime/graph_scheduler/actor/host_timeline_recorder.h"
+#include "runtime/graph_scheduler/actor/kernel_latency_monitor.h"
 #include "mindrt/include/async/async.h"
+#include "include/common/debug/alloc_counter.h"
 #include "utils/log_adapter.h"
+#include "utils/ms_utils.h"
+#include "utils/profile.h"
 #include "distributed/recovery/recovery_context.h"
 #include "distributed/collective/collective_manager.h"
 #include "kernel/common_utils.h"
@@ -43,6 +49,9 @@ void KernelActor::Init() {
   real_input_num_ = common::AnfAlgo::GetInputTensorNum(kernel_);
   kernel_info_ = dynamic_cast<KernelInfo *>(kernel_->kernel_info());
   is_dynamic_shape_ = common::AnfAlgo::IsDynamicShape(kernel_);
+  // Retaining the workspace memory across steps trades footprint for allocator traffic, so it is opt-in.
+  static const bool enable_workspace_reuse = common::GetEnv("MS_DEV_DYNAMIC_WORKSPACE_REUSE") == "1";
+  workspace_reuse_ = enable_workspace_reuse && is_dynamic_shape_;
 
   for (size_t i = 0; i < real_input_num_; ++i) {
     const auto &input_device_tensor = AnfAlgo::GetPrevNodeMutableOutputAddr(kernel_, i, false);
@@ -104,6 +113,19 @@ void KernelActor::Init() {
 void KernelActor::Run(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   MS_EXCEPTION_IF_NULL(device_contexts_[0]);
+  AllocCounterScope alloc_scope("KernelActor::Run");
+
+  // Sample one run in every interval for the latency monitor, so the timestamp cost is amortized.
+  latency_sampled_ =
+    KernelLatencyMonitor::IsEnabled() && (++latency_sample_count_ >= KernelLatencyMonitor::GetSampleInterval());
+  // The host timeline records every run, so the device stalls can be matched span by span.
+  timeline_recorded_ = HostTimelineRecorder::IsEnabled();
+  if (latency_sampled_) {
+    latency_sample_count_ = 0;
+  }
+  if (latency_sampled_ || timeline_recorded_) {
+    latency_phase_start_time_ = GetTime();
+  }
 
   FetchInputDeviceTensor(context);
   FetchOutputDeviceTensor(context);
@@ -111,6 +133,17 @@ void KernelActor::Run(OpContext<DeviceTensor> *const context) {
     FetchWorkspaceDeviceTensor();
   }
 
+  if (latency_sampled_ || timeline_recorded_) {
+    auto now = GetTime();
+    if (latency_sampled_) {
+      KernelLatencyMonitor::GetInstance().RecordDispatch(now - latency_phase_start_time_);
+    }
+    if (timeline_recorded_) {
+      HostTimelineRecorder::GetInstance().RecordSpan("dispatch", GetAID().Name(), latency_phase_start_time_, now);
+    }
+    latency_phase_start_time_ = now;
+  }
+
   if (memory_alloc_list_.size() > 0) {
     SendMemoryAllocReq(context);
   } else {
@@ -124,6 +157,10 @@ void KernelActor::FetchWorkspaceDeviceTensor() {
   auto kernel_mod = AnfAlgo::GetKernelMod(kernel_);
   MS_EXCEPTION_IF_NULL(kernel_mod);
   auto workspace_sizes = kernel_mod->GetWorkspaceSizeList();
+  if (workspace_reuse_) {
+    FetchWorkspaceDeviceTensorWithReuse(workspace_sizes);
+    return;
+  }
   // Resize of workspace_device_tensors_, memory_alloc_list_, memory_free_list_ and launch_info_.workspaces_, because of
   // the dynamic size of workspace.
   if (launch_info_.workspaces_.size() > workspace_sizes.size()) {
@@ -152,6 +189,61 @@ void KernelActor::FetchWorkspaceDeviceTensor() {
   }
 }
 
+void KernelActor::FetchWorkspaceDeviceTensorWithReuse(const std::vector<size_t> &workspace_sizes) {
+  // Strip all the workspace entries from the memory lists first: the retained workspaces must not enter
+  // memory_free_list_ (their memory survives the step) and only the slots whose capacity is insufficient
+  // re-enter memory_alloc_list_.
+  auto is_workspace = [this](DeviceTensor *device_tensor) {
+    return std::find(workspace_device_tensors_.begin(), workspace_device_tensors_.end(), device_tensor) !=
+           workspace_device_tensors_.end();
+  };
+  (void)memory_alloc_list_.erase(std::remove_if(memory_alloc_list_.begin(), memory_alloc_list_.end(), is_workspace),
+                                 memory_alloc_list_.end());
+  (void)memory_free_list_.erase(std::remove_if(memory_free_list_.begin(), memory_free_list_.end(), is_workspace),
+                                memory_free_list_.end());
+
+  // Sync the workspace count with the current resize result.
+  if (launch_info_.workspaces_.size() > workspace_sizes.size()) {
+    size_t size = launch_info_.workspaces_.size() - workspace_sizes.size();
+    for (size_t i = workspace_sizes.size(); i < workspace_device_tensors_.size(); ++i) {
+      MS_EXCEPTION_IF_NULL(workspace_device_tensors_[i]);
+      if (workspace_device_tensors_[i]->GetPtr() != nullptr) {
+        device_contexts_[0]->device_res_manager_->FreeMemory(workspace_device_tensors_[i]);
+      }
+    }
+    (void)workspace_device_tensors_.erase(workspace_device_tensors_.end() - size, workspace_device_tensors_.end());
+    (void)launch_info_.workspaces_.erase(launch_info_.workspaces_.end() - size, launch_info_.workspaces_.end());
+  } else if (launch_info_.workspaces_.size() < workspace_sizes.size()) {
+    for (size_t i = launch_info_.workspaces_.size(); i < workspace_sizes.size(); ++i) {
+      auto device_address = device_contexts_[0]->device_res_manager_->CreateDeviceAddress(
+        nullptr, workspace_sizes[i], "", kTypeUnknown, ShapeVector());
+      MS_LOG(DEBUG) << "Create addr for node:" << common::AnfAlgo::GetNodeDebugString(kernel_)
+                    << " addr:" << device_address;
+      AnfAlgo::SetWorkspaceAddr(device_address, i, kernel_.get());  // set to kernel_info
+      MS_EXCEPTION_IF_NULL(device_address);
+      (void)workspace_device_tensors_.emplace_back(device_address.get());
+      (void)launch_info_.workspaces_.emplace_back(std::make_shared<Address>());
+    }
+  }
+  workspace_capacities_.resize(workspace_device_tensors_.size(), 0);
+
+  // Reuse the retained memory in place when it is large enough, otherwise release it and request a new
+  // allocation for the current size. Recurring workspace sizes thus never reach the device allocator.
+  for (size_t i = 0; i < workspace_sizes.size(); ++i) {
+    auto &device_tensor = workspace_device_tensors_[i];
+    MS_EXCEPTION_IF_NULL(device_tensor);
+    if ((device_tensor->GetPtr() != nullptr) && (workspace_capacities_[i] < workspace_sizes[i])) {
+      device_contexts_[0]->device_res_manager_->FreeMemory(device_tensor);
+      workspace_capacities_[i] = 0;
+    }
+    device_tensor->SetSize(workspace_sizes[i]);
+    if (device_tensor->GetPtr() == nullptr) {
+      (void)memory_alloc_list_.emplace_back(device_tensor);
+      workspace_capacities_[i] = workspace_sizes[i];
+    }
+  }
+}
+
 namespace {
 void AllocateMemory(const std::vector<DeviceTensor *> &alloc_list, const DeviceContext *device_context,
                     OpContext<DeviceTensor> *const context, const std::string &actor_name) {
@@ -194,7 +286,9 @@ void FreeMemory(const std::vector<DeviceTensor *> &free_list, const DeviceContex
 void KernelActor::SendMemoryAllocReq(OpContext<DeviceTensor> *const context) {
   running_dependent_msg_num_ = 1;
   if (strategy_ == GraphExecutionStrategy::kPipeline) {
-    if (ActorDispatcher::is_memory_allocation_sync()) {
+    // The sub actors in the fusion actor run in one actor turn, so the memory allocation must be synchronous to
+    // avoid the per-kernel mailbox round trip to the memory manager actor in the fused sequential region.
+    if (ActorDispatcher::is_memory_allocation_sync() || (parent_fusion_actor_ != nullptr)) {
       ActorDispatcher::SendSync(memory_manager_aid_, &MemoryManagerActor::AllocateMemory, &memory_alloc_list_,
                                 device_contexts_[0], context, GetAID());
       OnMemoryAllocFinish(context);
@@ -210,7 +304,8 @@ void KernelActor::SendMemoryAllocReq(OpContext<DeviceTensor> *const context) {
 void KernelActor::SendMemoryFreeReq(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(device_contexts_[0]);
   if (strategy_ == GraphExecutionStrategy::kPipeline) {
-    if (ActorDispatcher::is_memory_free_sync()) {
+    // Keep the memory free synchronous in the fusion actor for the same reason as SendMemoryAllocReq.
+    if (ActorDispatcher::is_memory_free_sync() || (parent_fusion_actor_ != nullptr)) {
       ActorDispatcher::SendSync(memory_manager_aid_, &MemoryManagerActor::FreeMemory, &memory_free_list_,
                                 device_contexts_[0], context, GetAID());
     } else {
@@ -236,6 +331,16 @@ void KernelActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
   if (IsRunningFailed(context)) {
     return;
   }
+  if (latency_sampled_ || timeline_recorded_) {
+    auto now = GetTime();
+    if (latency_sampled_) {
+      KernelLatencyMonitor::GetInstance().RecordMemoryWait(now - latency_phase_start_time_);
+    }
+    if (timeline_recorded_) {
+      HostTimelineRecorder::GetInstance().RecordSpan("memory_wait", GetAID().Name(), latency_phase_start_time_, now);
+    }
+    latency_phase_start_time_ = now;
+  }
   PreLaunchKernel(context);
 
   try {
@@ -245,7 +350,21 @@ void KernelActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
       MS_LOG(WARNING) << "Collective communication need reinitialize, skip launch kernel: "
                       << kernel_->fullname_with_scope();
     } else {
+      if (latency_sampled_ || timeline_recorded_) {
+        latency_phase_start_time_ = GetTime();
+      }
       auto ret = LaunchKernel();
+      if (latency_sampled_ || timeline_recorded_) {
+        auto now = GetTime();
+        if (latency_sampled_) {
+          KernelLatencyMonitor::GetInstance().RecordLaunch(kernel_->fullname_with_scope(),
+                                                           now - latency_phase_start_time_);
+        }
+        if (timeline_recorded_) {
+          HostTimelineRecorder::GetInstance().RecordSpan("launch", kernel_->fullname_with_scope(),
+                                                         latency_phase_start_time_, now);
+        }
+      }
       if (!ret) {
         std::string error_info = "Launch kernel failed: " + kernel_->fullname_with_scope();
         SET_OPCONTEXT_FAIL_RET_WITH_ERROR_BY_STRATEGY(strategy_, (*context), error_info);
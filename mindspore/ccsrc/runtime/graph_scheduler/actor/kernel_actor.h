@@ -106,11 +106,15 @@ class KernelActor : public DebugAwareActor {
  private:
   friend class GraphScheduler;
   friend class ControlNodeScheduler;
+  friend class SchedulerHelper;
 
   // Fetch the device tensor for launch.
   void FetchInputDeviceTensor(OpContext<DeviceTensor> *const context);
   void FetchOutputDeviceTensor(OpContext<DeviceTensor> *const context);
   void FetchWorkspaceDeviceTensor();
+  // The workspace fetch used when the retained workspace reuse is enabled: the recurring sizes reuse the
+  // allocation of the previous step in place instead of going through the memory manager actor.
+  void FetchWorkspaceDeviceTensorWithReuse(const std::vector<size_t> &workspace_sizes);
   // Need copy when the data type or format between real parameters and formal parameters are inconsistent.
   void CopyInputDeviceTensor(const OpData<DeviceTensor> *input_data, OpContext<DeviceTensor> *const context);
   // In step mode, push the input tensors which contain valid device address into input_device_tensors_ directly.
@@ -158,6 +162,19 @@ class KernelActor : public DebugAwareActor {
 
   // Whether skip the kernel launch.
   bool is_launch_skipped_;
+
+  // Retain the workspace allocations of dynamic shape kernels across steps (enabled by the env
+  // MS_DEV_DYNAMIC_WORKSPACE_REUSE), recording the capacity behind each retained workspace pointer.
+  bool workspace_reuse_{false};
+  std::vector<size_t> workspace_capacities_;
+
+  // The sampling state of the kernel latency monitor: the number of runs since the last sample, whether the current
+  // run is sampled, and the start timestamp of the phase being measured in the current run.
+  size_t latency_sample_count_{0};
+  bool latency_sampled_{false};
+  double latency_phase_start_time_{0};
+  // Whether the current run records its phases into the host timeline, shares the phase timestamp above.
+  bool timeline_recorded_{false};
 };
 
 using KernelActorPtr = std::shared_ptr<KernelActor>;
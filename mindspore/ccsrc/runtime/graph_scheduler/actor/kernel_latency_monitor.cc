@@ -0,0 +1,144 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/actor/kernel_latency_monitor.h"
+
+#include "utils/log_adapter.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+constexpr auto kLatencyMonitorEnv = "MS_DEV_KERNEL_LATENCY_MONITOR";
+constexpr auto kLatencySampleIntervalEnv = "MS_DEV_KERNEL_LATENCY_SAMPLE_INTERVAL";
+constexpr size_t kDefaultSampleInterval = 10;
+constexpr double kSecondToMicro = 1000000.0;
+
+uint64_t SecondToMicro(double duration_sec) {
+  if (duration_sec <= 0) {
+    return 0;
+  }
+  return static_cast<uint64_t>(duration_sec * kSecondToMicro);
+}
+}  // namespace
+
+void LatencyHistogram::Record(uint64_t time_us) {
+  (void)count_.fetch_add(1, std::memory_order_relaxed);
+  (void)total_us_.fetch_add(time_us, std::memory_order_relaxed);
+  uint64_t old_max = max_us_.load(std::memory_order_relaxed);
+  while (time_us > old_max && !max_us_.compare_exchange_weak(old_max, time_us)) {
+  }
+  // The bucket index is the position of the highest set bit, so the bucket i covers [2^i, 2^(i+1)) microseconds.
+  size_t bucket = 0;
+  while ((time_us >> 1) != 0 && bucket + 1 < kLatencyBucketNum) {
+    time_us >>= 1;
+    ++bucket;
+  }
+  (void)buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::Percentile(double percent) const {
+  uint64_t count = count_.load(std::memory_order_relaxed);
+  if (count == 0) {
+    return 0;
+  }
+  auto target = static_cast<uint64_t>(count * percent);
+  if (target == 0) {
+    target = 1;
+  }
+  uint64_t accumulated = 0;
+  for (size_t i = 0; i < kLatencyBucketNum; ++i) {
+    accumulated += buckets_[i].load(std::memory_order_relaxed);
+    if (accumulated >= target) {
+      return uint64_t(1) << (i + 1);
+    }
+  }
+  return max_us_.load(std::memory_order_relaxed);
+}
+
+KernelLatencyMonitor &KernelLatencyMonitor::GetInstance() {
+  static KernelLatencyMonitor instance;
+  return instance;
+}
+
+bool KernelLatencyMonitor::IsEnabled() {
+  static const bool enabled = common::GetEnv(kLatencyMonitorEnv) == "1";
+  return enabled;
+}
+
+size_t KernelLatencyMonitor::GetSampleInterval() {
+  static const size_t sample_interval = []() -> size_t {
+    auto env = common::GetEnv(kLatencySampleIntervalEnv);
+    if (env.empty()) {
+      return kDefaultSampleInterval;
+    }
+    size_t interval = 0;
+    try {
+      interval = static_cast<size_t>(std::stoull(env));
+    } catch (const std::exception &) {
+      MS_LOG(WARNING) << "Invalid value of env " << kLatencySampleIntervalEnv << ": " << env
+                      << ", use the default sample interval: " << kDefaultSampleInterval;
+      return kDefaultSampleInterval;
+    }
+    return (interval == 0) ? kDefaultSampleInterval : interval;
+  }();
+  return sample_interval;
+}
+
+void KernelLatencyMonitor::RecordDispatch(double duration_sec) { dispatch_histogram_.Record(SecondToMicro(duration_sec)); }
+
+void KernelLatencyMonitor::RecordMemoryWait(double duration_sec) {
+  memory_wait_histogram_.Record(SecondToMicro(duration_sec));
+}
+
+void KernelLatencyMonitor::RecordLaunch(const std::string &op_name, double duration_sec) {
+  auto time_us = SecondToMicro(duration_sec);
+  if (time_us > launch_histogram_.max_us_.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> lock(max_launch_op_mutex_);
+    max_launch_op_name_ = op_name;
+  }
+  launch_histogram_.Record(time_us);
+}
+
+void KernelLatencyMonitor::DumpHistogram(const std::string &phase_name, const LatencyHistogram &histogram) const {
+  uint64_t count = histogram.count_.load(std::memory_order_relaxed);
+  if (count == 0) {
+    return;
+  }
+  constexpr double kP50 = 0.5;
+  constexpr double kP90 = 0.9;
+  constexpr double kP99 = 0.99;
+  MS_LOG(INFO) << "Kernel latency of " << phase_name << ": sample count: " << count
+               << ", avg: " << (histogram.total_us_.load(std::memory_order_relaxed) / count)
+               << "us, p50<=" << histogram.Percentile(kP50) << "us, p90<=" << histogram.Percentile(kP90)
+               << "us, p99<=" << histogram.Percentile(kP99)
+               << "us, max: " << histogram.max_us_.load(std::memory_order_relaxed) << "us";
+}
+
+void KernelLatencyMonitor::Dump() const {
+  if (!IsEnabled()) {
+    return;
+  }
+  DumpHistogram("dispatch(run entry to memory alloc request)", dispatch_histogram_);
+  DumpHistogram("memory wait(memory alloc request to alloc finish)", memory_wait_histogram_);
+  DumpHistogram("launch(host duration of the kernel launch call)", launch_histogram_);
+  std::lock_guard<std::mutex> lock(max_launch_op_mutex_);
+  if (!max_launch_op_name_.empty()) {
+    MS_LOG(INFO) << "Kernel with the max launch duration: " << max_launch_op_name_;
+  }
+}
+}  // namespace runtime
+}  // namespace mindspore
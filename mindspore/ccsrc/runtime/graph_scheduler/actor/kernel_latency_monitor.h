@@ -0,0 +1,81 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_KERNEL_LATENCY_MONITOR_H_
+#define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_KERNEL_LATENCY_MONITOR_H_
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace mindspore {
+namespace runtime {
+// The number of power-of-two microsecond buckets in one latency histogram, covering 1us to about 35min.
+constexpr size_t kLatencyBucketNum = 32;
+
+// A latency histogram with power-of-two microsecond buckets. Recording is a few relaxed atomic increments, so one
+// histogram can be shared by all the kernel actor threads without locks.
+struct LatencyHistogram {
+  void Record(uint64_t time_us);
+  // Return the upper bucket boundary covering the given percentile, eg. 0.99 for p99.
+  uint64_t Percentile(double percent) const;
+
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> total_us_{0};
+  std::atomic<uint64_t> max_us_{0};
+  std::array<std::atomic<uint64_t>, kLatencyBucketNum> buckets_{};
+};
+
+// The low overhead latency monitor of the kernel launch path, intended to stay on in production jobs where the full
+// profiler is too expensive. The kernel actors sample their runs and record the host duration of three phases into
+// the shared histograms: the dispatch phase(run entry to memory alloc request), the memory wait phase(memory alloc
+// request to alloc finish) and the kernel launch call. Enabled by the env MS_DEV_KERNEL_LATENCY_MONITOR=1, the
+// sampling interval is configured by the env MS_DEV_KERNEL_LATENCY_SAMPLE_INTERVAL(default 10, record one run in N).
+class KernelLatencyMonitor {
+ public:
+  static KernelLatencyMonitor &GetInstance();
+  static bool IsEnabled();
+  static size_t GetSampleInterval();
+
+  void RecordDispatch(double duration_sec);
+  void RecordMemoryWait(double duration_sec);
+  void RecordLaunch(const std::string &op_name, double duration_sec);
+
+  // Log the statistics of the histograms, called when the graph scheduler is cleared.
+  void Dump() const;
+
+ private:
+  KernelLatencyMonitor() = default;
+  ~KernelLatencyMonitor() = default;
+  KernelLatencyMonitor(const KernelLatencyMonitor &) = delete;
+  KernelLatencyMonitor &operator=(const KernelLatencyMonitor &) = delete;
+
+  void DumpHistogram(const std::string &phase_name, const LatencyHistogram &histogram) const;
+
+  LatencyHistogram dispatch_histogram_;
+  LatencyHistogram memory_wait_histogram_;
+  LatencyHistogram launch_histogram_;
+
+  // The name of the kernel with the max launch duration seen so far. Only written when a new max appears, which is
+  // rare, so a mutex on this slow path is acceptable.
+  mutable std::mutex max_launch_op_mutex_;
+  std::string max_launch_op_name_;
+};
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_KERNEL_LATENCY_MONITOR_H_
@@ -18,6 +18,7 @@
 #include "runtime/graph_scheduler/actor/data_source_actor.h"
 #include "runtime/graph_scheduler/actor/kernel_actor.h"
 #include "mindrt/include/async/async.h"
+#include "runtime/device/memory_manager.h"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -37,6 +38,12 @@ void MemoryManagerActor::AllocateMemory(const std::vector<DeviceTensor *> *alloc
   MS_EXCEPTION_IF_NULL(device_context);
   MS_EXCEPTION_IF_NULL(op_context);
 
+  // Coalesce the allocations of one batch into a single pool operation if possible.
+  if (AllocateSlabMemory(*alloc_list, device_context, from_aid)) {
+    OnMemoryAllocFinish(from_aid, op_context);
+    return;
+  }
+
   for (auto &device_tensor : *alloc_list) {
     MS_EXCEPTION_IF_NULL(device_tensor);
     if (device_tensor->GetPtr() != nullptr) {
@@ -178,6 +185,50 @@ void MemoryManagerActor::FreeBatchMemory(const std::vector<DeviceTensor *> *free
   }
 }
 
+bool MemoryManagerActor::AllocateSlabMemory(const std::vector<DeviceTensor *> &alloc_list,
+                                            const DeviceContext *device_context, const AID &from_aid) {
+  MS_EXCEPTION_IF_NULL(device_context);
+
+  std::vector<DeviceTensor *> pending_list;
+  std::vector<size_t> size_list;
+  for (auto &device_tensor : alloc_list) {
+    MS_EXCEPTION_IF_NULL(device_tensor);
+    if (device_tensor->GetPtr() != nullptr) {
+      continue;
+    }
+    if (device_tensor->GetSize() == 0) {
+      return false;
+    }
+    (void)pending_list.emplace_back(device_tensor);
+    // The pool splits the slab by the raw sizes in the size list, so each size must be aligned to keep the device
+    // pointers of the subsequent device tensors aligned.
+    (void)size_list.emplace_back(device::MemoryManager::GetCommonAlignSize(device_tensor->GetSize()));
+  }
+  // A single device tensor is allocated directly by the normal pool operation.
+  if (pending_list.size() <= 1) {
+    return false;
+  }
+
+  std::vector<void *> dev_ptr_list;
+  try {
+    device::DynamicMemAllocatorDebugInfo::SetDebugInfo(from_aid.Name(), device::AllocatorType::kKernelOutput);
+    dev_ptr_list = device_context->device_res_manager_->AllocateContinuousMemory(size_list);
+  } catch (const std::exception &e) {
+    // Not all device res managers support continuous memory allocation.
+    return false;
+  }
+  if (dev_ptr_list.size() != pending_list.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < pending_list.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(dev_ptr_list[i]);
+    pending_list[i]->set_ptr(dev_ptr_list[i]);
+    pending_list[i]->set_from_mem_pool(true);
+  }
+  return true;
+}
+
 void MemoryManagerActor::Wait(OpContext<DeviceTensor> *const op_context, const AID &from_aid) {
   // Call back to the from actor to process.
   ActorDispatcher::Send(from_aid, &MemoryAwareActor::OnMemoryAllocFinish, op_context);
@@ -64,6 +64,13 @@ class MemoryManagerActor : public ActorBase {
   void Wait(OpContext<DeviceTensor> *const op_context, const AID &from_aid);
 
  private:
+  // Try to allocate the device memory of all the device tensors in the alloc list as one continuous slab with a
+  // single memory pool operation, instead of one pool operation per device tensor. The slab is split by the pool
+  // into one memory buf per device tensor, so each one can still be freed separately by the ref count. Return false
+  // if the slab allocation is not applicable or fails, then the caller allocates each device tensor separately.
+  bool AllocateSlabMemory(const std::vector<DeviceTensor *> &alloc_list, const DeviceContext *device_context,
+                          const AID &from_aid);
+
   void FreeMemoryByRefCount(DeviceTensor *const device_tensor, const DeviceContext *device_context,
                             const std::string &op_name);
 
@@ -17,6 +17,7 @@
 #include "runtime/graph_scheduler/actor/output_actor.h"
 #include "runtime/hardware/device_context_manager.h"
 #include "utils/log_adapter.h"
+#include "utils/ms_utils.h"
 #include "distributed/recovery/recovery_context.h"
 #include "distributed/collective/collective_manager.h"
 
@@ -89,6 +90,7 @@ void OutputActor::FreeOutputNodeMem() {
 
 void OutputActor::ClearOutputCache() {
   output_node_to_tensor_device_address_.clear();
+  reused_output_device_addresses_.clear();
   outputs_.clear();
   outputs_.resize(outputs_num_);
   output_nodes_.clear();
@@ -267,7 +269,27 @@ void OutputActor::UpdateOutputDeviceAddress() {
       auto device_context = device_contexts_[i];
       MS_EXCEPTION_IF_NULL(device_context);
       device::DynamicMemAllocatorDebugInfo::SetDebugInfo(GetAID().Name(), device::AllocatorType::kOther);
-      if (!device_context->device_res_manager_->AllocateMemory(tensor_device_address.get())) {
+      static const bool reuse_output_buffer = common::GetEnv("MS_DEV_OUTPUT_BUFFER_REUSE") == "1";
+      if (reuse_output_buffer) {
+        // Borrow the reusable copy buffer instead of allocating a fresh block of device memory every step. The
+        // ownership stays in the cache, so the output tensor must be consumed before the next step overwrites it.
+        auto &reused_address = reused_output_device_addresses_[output_nodes_[i]];
+        if (reused_address == nullptr || reused_address->GetSize() < tensor_device_address->GetSize() ||
+            reused_address->GetDeviceType() != tensor_device_address->GetDeviceType()) {
+          reused_address = device_context->device_res_manager_->CreateDeviceAddress(
+            nullptr, tensor_device_address->GetSize(), tensor_device_address->format(),
+            tensor_device_address->type_id(), tensor_device_address->host_shape());
+          MS_EXCEPTION_IF_NULL(reused_address);
+          if (!device_context->device_res_manager_->AllocateMemory(reused_address.get())) {
+            MS_LOG(EXCEPTION) << "Device(id:" << device_context->device_context_key().device_id_
+                              << ") memory isn't enough and alloc failed, kernel name: "
+                              << output_node->fullname_with_scope()
+                              << ", alloc size: " << tensor_device_address->GetSize() << "B.";
+          }
+        }
+        tensor_device_address->set_ptr(reused_address->GetMutablePtr());
+        tensor_device_address->set_from_mem_pool(false);
+      } else if (!device_context->device_res_manager_->AllocateMemory(tensor_device_address.get())) {
         MS_LOG(EXCEPTION) << "Device(id:" << device_context->device_context_key().device_id_
                           << ") memory isn't enough and alloc failed, kernel name: "
                           << output_node->fullname_with_scope() << ", alloc size: " << tensor_device_address->GetSize()
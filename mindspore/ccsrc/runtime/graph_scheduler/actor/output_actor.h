@@ -100,6 +100,12 @@ class OutputActor : public AbstractActor {
   size_t current_outputs_num_;
 
   std::map<KernelWithIndex, DeviceTensorPtr> output_node_to_tensor_device_address_;
+
+  // The reusable copy buffers of the persisted graph outputs (enabled by the env MS_DEV_OUTPUT_BUFFER_REUSE).
+  // The persisted output address can't be handed over to the output tensor, so its data needs a device copy
+  // every step; the cache keeps the ownership of the copy buffers so that they are allocated only once and
+  // the output tensors of each step borrow them.
+  std::map<KernelWithIndex, DeviceTensorPtr> reused_output_device_addresses_;
 };
 
 using OutputActorPtr = std::shared_ptr<OutputActor>;
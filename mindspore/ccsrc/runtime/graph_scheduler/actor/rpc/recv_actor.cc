@@ -303,7 +303,17 @@ MessageBase *RecvActor::HandleMessage(MessageBase *const msg) {
   if (msg == nullptr || op_context_ == nullptr) {
     return distributed::rpc::NULL_MSG;
   }
+  bool need_flow_control_ack = (msg->name == kRpcFlowControlData);
   ActorDispatcher::Send(GetAID(), &RecvActor::RunOpInterProcessData, msg, op_context_);
+  if (need_flow_control_ack) {
+    // Return one credit to the peer send actor now that the message is accepted by this actor. This
+    // handler blocks above while the op context is invalid, so credits naturally stop flowing back when
+    // this stage falls behind and the sender throttles instead of flooding the receive path.
+    auto ack_msg = std::make_unique<MessageBase>();
+    ack_msg->name = kRpcFlowControlAck;
+    ack_msg->from = GetAID();
+    return ack_msg.release();
+  }
   return distributed::rpc::NULL_MSG;
 }
 
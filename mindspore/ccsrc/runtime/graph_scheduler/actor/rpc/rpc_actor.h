@@ -45,6 +45,15 @@ constexpr char kInterProcessEdgeMark[] = "->";
 // The magic header of the rpc data which indicates this message contains dynamic shape data.
 constexpr char kRpcDynamicShapeData[] = "RPC_DYNAMIC_SHAPE_DATA";
 
+// The message name of a rpc data message whose sender expects a flow control credit ack from the receiver.
+constexpr char kRpcFlowControlData[] = "RPC_FLOW_CONTROL_DATA";
+
+// The message name of the flow control credit ack piggybacked on the data connection from recv to send actor.
+constexpr char kRpcFlowControlAck[] = "RPC_FLOW_CONTROL_ACK";
+
+// The environment variable of the send actor flow control window. 0 or unset disables flow control.
+constexpr char kEnvRpcSendWindow[] = "MS_DEV_RPC_SEND_WINDOW";
+
 // RpcActor is used to do rpc with other processes in distributed execution.
 // Besides data arrows and controlling arrows, RpcActor also has inter-process arrows which is in charge of remote
 // communication with other processes. It supports both sync and async communication.
@@ -16,7 +16,12 @@
 
 #include "runtime/graph_scheduler/actor/rpc/send_actor.h"
 
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <utility>
+#include "utils/ms_utils.h"
+#include "utils/convert_utils_base.h"
 
 namespace mindspore {
 namespace runtime {
@@ -39,6 +44,16 @@ bool SendActor::ConnectServer() {
   if (!client_->Initialize()) {
     MS_LOG(EXCEPTION) << "Failed to initialize tcp server for send actor.";
   }
+  std::string window_env = common::GetEnv(kEnvRpcSendWindow);
+  if (!window_env.empty()) {
+    flow_control_window_ = LongToSize(std::strtol(window_env.c_str(), nullptr, 10));
+  }
+  if (flow_control_window_ > 0) {
+    flow_control_credits_ = flow_control_window_;
+    client_->SetAckMessageHandler(kRpcFlowControlAck, [this](const MessageBase &) { OnFlowControlAck(); });
+    MS_LOG(INFO) << "Enable flow control for send actor " << GetAID().Name()
+                 << ", window size: " << flow_control_window_;
+  }
   // Lookup actor addresses for each peer actor.
   for (const auto &peer_actor_id : peer_actor_ids_) {
     MS_EXCEPTION_IF_NULL(actor_route_table_proxy_);
@@ -70,6 +85,7 @@ bool SendActor::LaunchKernel() {
     std::string peer_server_url = peer.second;
     auto message = BuildRpcMessage(send_output, peer_server_url);
     MS_ERROR_IF_NULL_W_RET_VAL(message, false);
+    AcquireFlowControlCredit();
     MS_LOG(INFO) << "Rpc actor send message for inter-process edge: " << peer.first;
     client_->SendAsync(std::move(message));
   }
@@ -84,6 +100,28 @@ void SendActor::EraseInput(const OpContext<DeviceTensor> *context) {
   }
 }
 
+void SendActor::AcquireFlowControlCredit() {
+  if (flow_control_window_ == 0) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(credit_mutex_);
+  const int64_t wait_log_interval_sec = 30;
+  while (!credit_cv_.wait_for(lock, std::chrono::seconds(wait_log_interval_sec),
+                              [this] { return flow_control_credits_ > 0; })) {
+    MS_LOG(WARNING) << "Send actor " << GetAID().Name() << " is still waiting for flow control credits from its peer "
+                    << "recv actor, window size: " << flow_control_window_;
+  }
+  --flow_control_credits_;
+}
+
+void SendActor::OnFlowControlAck() {
+  std::lock_guard<std::mutex> lock(credit_mutex_);
+  if (flow_control_credits_ < flow_control_window_) {
+    ++flow_control_credits_;
+  }
+  credit_cv_.notify_one();
+}
+
 void SendActor::SerializeDynamicShapeMessgae(std::string *msg_body, const ShapeVector &shape_vec,
                                              const TypeId &data_type, const kernel::AddressPtr &addr) {
   MS_EXCEPTION_IF_NULL(msg_body);
@@ -94,6 +132,10 @@ void SendActor::SerializeDynamicShapeMessgae(std::string *msg_body, const ShapeV
   *pb_msg.mutable_shape_vector() = {shape_vec.begin(), shape_vec.end()};
   std::string pb_msg_str = pb_msg.SerializeAsString();
 
+  // Reserve the exact segment size up front, otherwise appending the data buffer reallocates and copies the
+  // whole message body for every input.
+  msg_body->reserve(msg_body->size() + strlen(kRpcDynamicShapeData) + sizeof(size_t) + pb_msg_str.size() + addr->size);
+
   // 1. Magic header for dynamic shape.
   msg_body->append(kRpcDynamicShapeData);
   // 2. The size of the protobuf message DynamicShapeMessage.
@@ -110,6 +152,10 @@ std::unique_ptr<MessageBase> SendActor::BuildRpcMessage(const kernel::AddressPtr
   std::unique_ptr<MessageBase> message = std::make_unique<MessageBase>();
   MS_ERROR_IF_NULL_W_RET_VAL(message, nullptr);
   message->to = AID("", server_url);
+  if (flow_control_window_ > 0) {
+    // Mark the message so the peer recv actor acks it with a flow control credit.
+    message->name = kRpcFlowControlData;
+  }
 
   if (is_dynamic_shape_) {
     MS_LOG(INFO) << "This send actor builds message with dynamic shape.";
@@ -21,6 +21,8 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
 #include "runtime/graph_scheduler/actor/rpc/rpc_actor.h"
 
 namespace mindspore {
@@ -58,6 +60,12 @@ class SendActor : public RpcActor {
   std::unique_ptr<TCPClient> client_;
 
  private:
+  // Block until a flow control credit is available and consume it, no-op when flow control is disabled.
+  void AcquireFlowControlCredit();
+
+  // Called on the tcp receiving thread when the peer recv actor acks a data message, returns one credit.
+  void OnFlowControlAck();
+
   // Serialize dynamic shape data. The format is shown below:
   // |--------22 bytes------|---4 bytes--|PB data size bytes| data size bytes |
   // |RPC_DYNAMIC_SHAPE_DATA|PB data size|      PB data     | real data       |
@@ -72,6 +80,15 @@ class SendActor : public RpcActor {
 
   // The url of the peer recv actor's tcp server.
   std::string server_url_;
+
+  // Credit-based flow control between this actor and its peer recv actor: each data message consumes one
+  // credit and the receiver returns it by ack once the message is accepted, so at most
+  // flow_control_window_ messages are in flight and a fast stage cannot flood a slow stage's receive
+  // path. The window is read from MS_DEV_RPC_SEND_WINDOW, 0 (the default) disables flow control.
+  size_t flow_control_window_{0};
+  size_t flow_control_credits_{0};
+  std::mutex credit_mutex_;
+  std::condition_variable credit_cv_;
 };
 
 using SendActorPtr = std::shared_ptr<SendActor>;
@@ -15,11 +15,14 @@
  */
 
 #include "runtime/graph_scheduler/actor/super_kernel_actor.h"
+#include <algorithm>
 #include "runtime/graph_scheduler/actor/output_actor.h"
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
+#include "runtime/graph_scheduler/actor/kernel_latency_monitor.h"
 #include "mindrt/include/async/async.h"
 #include "utils/log_adapter.h"
+#include "utils/profile.h"
 
 namespace mindspore {
 namespace runtime {
@@ -76,12 +79,31 @@ void SuperKernelActor::Run(OpContext<DeviceTensor> *const context) {
     SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
   }
 
+  // The copied inputs have had their last read, free them before the launch so that the upstream
+  // activations do not stay alive across the whole sunk-graph execution, the same way the copy actor
+  // frees its input right after the copy.
+  if (!copy_freed_inputs_.empty()) {
+    memory_free_lists_.push(copy_freed_inputs_);
+    if (ActorDispatcher::is_memory_free_sync()) {
+      ActorDispatcher::SendSync(memory_manager_aid_, &MemoryManagerActor::FreeMemory, &(memory_free_lists_.back()),
+                                device_contexts_[0], context, GetAID());
+    } else {
+      ActorDispatcher::Send(memory_manager_aid_, &MemoryManagerActor::FreeMemory, &(memory_free_lists_.back()),
+                            device_contexts_[0], context, GetAID());
+    }
+  }
+
   try {
     // @TODO: @TBD: run graph with inputs and outputs
     const std::vector<tensor::Tensor> inputs;
     std::vector<tensor::Tensor> outputs;
     const std::map<string, string> compile_options;
+    // The super kernel actor runs once per step, so record every run without sampling.
+    double launch_start_time = KernelLatencyMonitor::IsEnabled() ? GetTime() : 0;
     auto ret = device_contexts_[0]->graph_executor_->RunGraph(graph_, inputs, &outputs, compile_options);
+    if (KernelLatencyMonitor::IsEnabled()) {
+      KernelLatencyMonitor::GetInstance().RecordLaunch(GetAID().Name(), GetTime() - launch_start_time);
+    }
     if (!ret) {
       std::string error_info = "Launch graph failed, graph id: " + std::to_string(graph_->graph_id());
       SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
@@ -124,11 +146,18 @@ void SuperKernelActor::SendDebugReq(OpContext<DeviceTensor> *const context) {
 bool SuperKernelActor::CopyInputData(const OpContext<DeviceTensor> *context) {
   MS_EXCEPTION_IF_NULL(context);
   MS_EXCEPTION_IF_NULL(graph_);
+  copy_freed_inputs_.clear();
+  if (input_data_frozen_) {
+    return true;
+  }
   const auto &data_iter = input_op_datas_.find(context->sequential_num_);
   if (data_iter == input_op_datas_.end()) {
     return true;
   }
 
+  // The checks can be frozen only if every input aliases the graph's persistent device address: a copy
+  // or a dynamically ref counted input means the actual address may differ on the next step.
+  bool can_freeze = true;
   auto &input_nodes = graph_->input_nodes();
   // Copy input data.
   for (auto &input_data : data_iter->second) {
@@ -147,9 +176,13 @@ bool SuperKernelActor::CopyInputData(const OpContext<DeviceTensor> *context) {
     MS_EXCEPTION_IF_NULL(device_address);
     auto &input_device_tensor = input_data->data_;
     MS_EXCEPTION_IF_NULL(input_device_tensor);
+    if (input_device_tensor->dynamic_ref_count() != INT32_MAX) {
+      can_freeze = false;
+    }
     if (input_device_tensor->GetPtr() == device_address->GetPtr()) {
       continue;
     }
+    can_freeze = false;
 
     MS_LOG(INFO) << "The input data of node:" << input_node->DebugString()
                  << " need copy from address:" << input_device_tensor->GetPtr()
@@ -159,8 +192,13 @@ bool SuperKernelActor::CopyInputData(const OpContext<DeviceTensor> *context) {
       MS_LOG(ERROR) << "Copy data failed.";
       return false;
     }
-    if (common::AnfAlgo::HasAbstractRef(input_node) && ref_node_addr_map_.count(input_node) == 0) {
-      ref_node_addr_map_[input_node] = input_device_tensor;
+    if (common::AnfAlgo::HasAbstractRef(input_node)) {
+      // Ref inputs are copied back after the run and can not be released early.
+      if (ref_node_addr_map_.count(input_node) == 0) {
+        ref_node_addr_map_[input_node] = input_device_tensor;
+      }
+    } else if (input_device_tensor->dynamic_ref_count() != INT32_MAX) {
+      (void)copy_freed_inputs_.emplace_back(input_device_tensor);
     }
   }
 
@@ -170,6 +208,7 @@ bool SuperKernelActor::CopyInputData(const OpContext<DeviceTensor> *context) {
                                                                       device_contexts_[0]->GetDeviceType());
     // todo:
     if (input_device_tensor == nullptr) {
+      can_freeze = false;
       continue;
     }
     MS_EXCEPTION_IF_NULL(input_device_tensor);
@@ -197,6 +236,11 @@ bool SuperKernelActor::CopyInputData(const OpContext<DeviceTensor> *context) {
     }
   }
 
+  if (can_freeze && ref_node_addr_map_.empty()) {
+    MS_LOG(INFO) << "All the inputs of graph: " << graph_->graph_id()
+                 << " alias the graph device addresses, freeze the input checking of actor: " << GetAID().Name();
+    input_data_frozen_ = true;
+  }
   return true;
 }
 
@@ -204,13 +248,21 @@ void SuperKernelActor::SendMemoryFreeReq(OpContext<DeviceTensor> *const context)
   MS_EXCEPTION_IF_NULL(context);
   const auto &sequential_num = context->sequential_num_;
 
-  // Collect the input device tensors.
+  // Collect the input device tensors, skipping one occurrence for each input already freed right
+  // after its copy in Run.
+  std::vector<DeviceTensor *> copy_freed = std::move(copy_freed_inputs_);
+  copy_freed_inputs_.clear();
   std::vector<DeviceTensor *> memory_free_list;
   if (input_op_datas_.count(sequential_num) > 0) {
     for (auto &input_data : input_op_datas_[sequential_num]) {
       MS_EXCEPTION_IF_NULL(input_data);
       MS_EXCEPTION_IF_NULL(input_data->data_);
       if (input_data->data_->dynamic_ref_count() != INT32_MAX) {
+        auto freed_iter = std::find(copy_freed.begin(), copy_freed.end(), input_data->data_);
+        if (freed_iter != copy_freed.end()) {
+          (void)copy_freed.erase(freed_iter);
+          continue;
+        }
         (void)memory_free_list.emplace_back(input_data->data_);
       }
     }
@@ -65,8 +65,18 @@ class SuperKernelActor : public DebugAwareActor {
 
   KernelGraphPtr graph_;
 
+  // Whether the per-step input checking can be skipped. Set after a step shows that every input already
+  // aliases the graph's own persistent device address, so a fully static sunk graph pays no host-side
+  // bookkeeping on later steps beyond the launch itself.
+  bool input_data_frozen_{false};
+
   std::map<AnfNodePtr, DeviceAddress *> ref_node_addr_map_;
 
+  // Inputs whose data was copied into the graph's own device addresses in CopyInputData. The copy is
+  // their last read, so they are freed before the graph launches instead of after the whole run,
+  // which shrinks the lifetime of the upstream activations across the sunk-graph execution.
+  std::vector<DeviceTensor *> copy_freed_inputs_;
+
   // The lists of device tensors which need free by dynamic ref count, will be cleared at the end of step.
   std::queue<std::vector<DeviceTensor *>> memory_free_lists_;
 };
@@ -695,6 +695,8 @@ void ControlNodeParser::Parse(const std::vector<AnfNodePtr> &control_nodes, cons
   root_func_graph_ = root_graph;
 
   root_graph_parameters_ = root_graph->parameters();
+  root_graph_parameter_set_.clear();
+  root_graph_parameter_set_.insert(root_graph_parameters_.begin(), root_graph_parameters_.end());
 
   func_graph_to_kernel_graph_groups_ = func_graph_to_kernel_graphs;
   for (const auto &func_graph_to_kernel_graph_groups : func_graph_to_kernel_graph_groups_) {
@@ -796,7 +798,7 @@ bool ControlNodeParser::IsRootGraphPersistentDeviceTensor(const AnfNodePtr &node
     return true;
   }
 
-  return find(root_graph_parameters_.begin(), root_graph_parameters_.end(), node) != root_graph_parameters_.end();
+  return root_graph_parameter_set_.find(node) != root_graph_parameter_set_.end();
 }
 
 bool ControlNodeParser::IsNeedStackControlNode(const AnfNodePtr &node) {
@@ -813,7 +815,7 @@ bool ControlNodeParser::IsRecursionCallNode(const AnfNodePtr &node) {
   if (!common::AnfAlgo::IsCallNode(node)) {
     return false;
   }
-  return find(unrecursion_call_nodes_.begin(), unrecursion_call_nodes_.end(), node) == unrecursion_call_nodes_.end();
+  return unrecursion_call_nodes_.find(node) == unrecursion_call_nodes_.end();
 }
 
 bool ControlNodeParser::IsRecursionKernelGraph(const KernelGraphPtr &graph) {
@@ -1704,13 +1706,22 @@ void ControlNodeParser::ParseUnRecursionCallNode() {
                                                 call_node_to_func_graphs.second.end());
   }
 
+  // The execution funcgraphs reachable from one funcgraph are the same for every call node which calls
+  // it, so the closure is computed once per funcgraph instead of once per call node.
+  std::unordered_map<FuncGraphPtr, std::set<FuncGraphPtr>> func_graph_to_execution_func_graphs;
   for (const auto &call_node_to_func_graphs : call_node_to_func_graphs_) {
     const auto &call_node = call_node_to_func_graphs.first;
     const auto &dest_func_graph = call_node->func_graph();
     MS_EXCEPTION_IF_NULL(dest_func_graph);
     std::set<FuncGraphPtr> exexution_func_graphs;
     for (const auto &func_graph : call_node_to_func_graphs.second) {
-      FetchAllExecutionFunction(func_graph, &exexution_func_graphs, func_graph_call_relation);
+      auto closure_iter = func_graph_to_execution_func_graphs.find(func_graph);
+      if (closure_iter == func_graph_to_execution_func_graphs.end()) {
+        std::set<FuncGraphPtr> closure;
+        FetchAllExecutionFunction(func_graph, &closure, func_graph_call_relation);
+        closure_iter = func_graph_to_execution_func_graphs.emplace(func_graph, std::move(closure)).first;
+      }
+      exexution_func_graphs.insert(closure_iter->second.begin(), closure_iter->second.end());
     }
     if (exexution_func_graphs.find(dest_func_graph) == exexution_func_graphs.end()) {
       (void)unrecursion_call_nodes_.emplace(call_node);
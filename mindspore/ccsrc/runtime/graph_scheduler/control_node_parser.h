@@ -317,6 +317,9 @@ class ControlNodeParser {
   // Root funcgraph and its parameters.
   FuncGraphPtr root_func_graph_;
   std::vector<AnfNodePtr> root_graph_parameters_;
+  // Membership index of root_graph_parameters_, IsRootGraphPersistentDeviceTensor is called for every
+  // persistent device tensor during graph scheduling and data prepare, so the lookup needs to be O(1).
+  std::set<AnfNodePtr> root_graph_parameter_set_;
 };
 
 using ControlNodeParserPtr = std::shared_ptr<ControlNodeParser>;
@@ -1325,10 +1325,7 @@ void ControlNodeScheduler::LinkControlArrowByAutoMonad(ControlActor *to_actor, c
       }
       from_actor = FetchActor(parser->FetchGroupNameByKernelGraph(graph) + kExitActorNameSuffix);
       MS_EXCEPTION_IF_NULL(from_actor);
-      if (std::find_if(from_actor->output_control_arrows_.begin(), from_actor->output_control_arrows_.end(),
-                       [&to_actor](auto &output_control_arrow) {
-                         return output_control_arrow->to_op_id_.Name() == to_actor->GetAID().Name();
-                       }) != from_actor->output_control_arrows_.end()) {
+      if (from_actor->output_control_arrow_dsts_.count(to_actor->GetAID().Name()) > 0) {
         MS_LOG(DEBUG) << "Link auto monad control from actor:" << from_actor->GetAID()
                       << " to actor:" << to_actor->GetAID() << " is already exist.";
         continue;
@@ -39,30 +39,57 @@ class DeviceTensorCopyStore {
   void Insert(DeviceTensor *const key, DeviceTensor *const value) {
     MS_EXCEPTION_IF_NULL(key);
     MS_EXCEPTION_IF_NULL(value);
-    (void)copy_device_tensors_[key].insert(value);
+    auto &slot = copy_device_tensors_[key];
+    if (slot.generation != generation_) {
+      // The slot survived from an older generation, reclaim it lazily on reuse.
+      slot.values.clear();
+      slot.generation = generation_;
+    }
+    (void)slot.values.insert(value);
   }
 
   std::set<DeviceTensor *> Fetch(DeviceTensor *const key) const {
     MS_EXCEPTION_IF_NULL(key);
     const auto &iter = copy_device_tensors_.find(key);
-    if (iter != copy_device_tensors_.end()) {
-      return iter->second;
+    if (iter != copy_device_tensors_.end() && iter->second.generation == generation_) {
+      return iter->second.values;
     } else {
       return {};
     }
   }
 
-  void Clear() { copy_device_tensors_.clear(); }
+  // Invalidate all the copy relations by bumping the generation instead of sweeping the map,
+  // so the step boundary does not pay for the accumulated entries. The stale slots are either
+  // reused by Insert or dropped by the occasional compaction below.
+  void Clear() {
+    ++generation_;
+    if (copy_device_tensors_.size() > kCompactionThreshold) {
+      copy_device_tensors_.clear();
+    }
+  }
 
  private:
   DeviceTensorCopyStore() = default;
   ~DeviceTensorCopyStore() = default;
   DISABLE_COPY_AND_ASSIGN(DeviceTensorCopyStore);
 
+  // A set of source device tensors stamped with the generation it was filled in. Entries of an
+  // older generation are invisible to Fetch.
+  struct CopySlot {
+    size_t generation{0};
+    std::set<DeviceTensor *> values;
+  };
+
+  // Above this entry count the stale slots are really released on Clear to bound the memory.
+  static constexpr size_t kCompactionThreshold = 4096;
+
   // The data storage of device tensor which need be back refreshed dynamically.
   // It is created and removed dynamically in the running.
   // Key is the dest device tensor, value is the source device tensors which provide copy data to dest device tensor.
-  mindspore::HashMap<DeviceTensor *, std::set<DeviceTensor *>> copy_device_tensors_;
+  mindspore::HashMap<DeviceTensor *, CopySlot> copy_device_tensors_;
+
+  // The current step generation, bumped by Clear.
+  size_t generation_{0};
 };
 }  // namespace runtime
 }  // namespace mindspore
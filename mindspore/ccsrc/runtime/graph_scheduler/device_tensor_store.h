@@ -18,6 +18,7 @@
 #define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_DEVICE_TENSOR_STORE_H_
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <shared_mutex>
 #include "utils/hash_map.h"
@@ -67,6 +68,7 @@ class DeviceTensorStore {
     if (iter != device_tensors_.end()) {
       (void)device_tensors_.erase(iter);
     }
+    (void)weight_format_variants_.erase(key);
   }
 
   std::vector<DeviceTensorPtr> Fetch(AnfNode *key) const {
@@ -96,9 +98,80 @@ class DeviceTensorStore {
     return nullptr;
   }
 
+  // Cache a constant device tensor keyed by the content hash of its host data, so that identical constants
+  // (such as position tables and masks appearing in multiple graph instances) are uploaded to device only
+  // once and the other instances are filled by device-to-device copy. Weak pointers keep the cache from
+  // extending the lifetime of the cached tensors.
+  void InsertConstDeviceTensor(size_t content_hash, const DeviceTensorPtr &value) {
+    MS_EXCEPTION_IF_NULL(value);
+    std::unique_lock<std::shared_mutex> lock(map_mutex_);
+    auto &cached_tensors = const_device_tensors_[content_hash];
+    // Drop the expired entries before caching the new one.
+    for (auto iter = cached_tensors.begin(); iter != cached_tensors.end();) {
+      if (iter->expired()) {
+        iter = cached_tensors.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    (void)cached_tensors.emplace_back(value);
+  }
+
+  DeviceTensorPtr FetchConstDeviceTensor(size_t content_hash, DeviceTensorType value_type) const {
+    std::shared_lock<std::shared_mutex> lock(map_mutex_);
+    const auto &iter = const_device_tensors_.find(content_hash);
+    if (iter == const_device_tensors_.end()) {
+      return nullptr;
+    }
+    for (const auto &weak_device_tensor : iter->second) {
+      auto device_tensor = weak_device_tensor.lock();
+      if (device_tensor != nullptr && device_tensor->GetDeviceType() == value_type &&
+          device_tensor->GetPtr() != nullptr) {
+        return device_tensor;
+      }
+    }
+    return nullptr;
+  }
+
+  // Cache the device tensor of a weight formatted for the device, keyed by the front parameter and the device
+  // format, so that every kernel graph referencing the same parameter with the same format shares one device
+  // tensor instead of storing its own formatted copy (eg. the train and eval graphs or the shape buckets of a
+  // dynamic service).
+  void InsertFormatVariant(AnfNode *key, const DeviceTensorPtr &value) {
+    MS_EXCEPTION_IF_NULL(key);
+    MS_EXCEPTION_IF_NULL(value);
+    std::unique_lock<std::shared_mutex> lock(map_mutex_);
+    auto &variants = weight_format_variants_[key];
+    for (const auto &variant : variants) {
+      if (variant->GetDeviceType() == value->GetDeviceType() && variant->format() == value->format()) {
+        return;
+      }
+    }
+    (void)variants.emplace_back(value);
+  }
+
+  DeviceTensorPtr FetchFormatVariant(AnfNode *key, DeviceTensorType value_type, const std::string &format,
+                                     size_t size) const {
+    MS_EXCEPTION_IF_NULL(key);
+    std::shared_lock<std::shared_mutex> lock(map_mutex_);
+    const auto &iter = weight_format_variants_.find(key);
+    if (iter == weight_format_variants_.end()) {
+      return nullptr;
+    }
+    for (const auto &variant : iter->second) {
+      MS_EXCEPTION_IF_NULL(variant);
+      if (variant->GetDeviceType() == value_type && variant->format() == format && variant->GetSize() == size) {
+        return variant;
+      }
+    }
+    return nullptr;
+  }
+
   void Clear() {
     std::unique_lock<std::shared_mutex> lock(map_mutex_);
     device_tensors_.clear();
+    const_device_tensors_.clear();
+    weight_format_variants_.clear();
   }
 
  private:
@@ -109,6 +182,12 @@ class DeviceTensorStore {
   // The data storage of device tensor. Key is the anf node, value is the vector which may contains the device
   // tensors from different devices.
   mindspore::HashMap<AnfNode *, std::vector<DeviceTensorPtr>> device_tensors_;
+  // The cache of constant device tensors keyed by the content hash of their host data, see
+  // InsertConstDeviceTensor.
+  mindspore::HashMap<size_t, std::vector<std::weak_ptr<DeviceTensor>>> const_device_tensors_;
+  // The formatted weight variants shared across kernel graphs. Key is the front parameter, value holds one
+  // device tensor per (device, format) pair, see InsertFormatVariant.
+  mindspore::HashMap<AnfNode *, std::vector<DeviceTensorPtr>> weight_format_variants_;
   // Read/Write lock for map.
   mutable std::shared_mutex map_mutex_;
 };
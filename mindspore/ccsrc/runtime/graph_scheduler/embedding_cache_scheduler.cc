@@ -396,6 +396,12 @@ void EmbeddingCacheScheduler::SyncEmbeddingTable() const {
   embedding_cache_prefetch_actor_->SyncEmbeddingTable();
 }
 
+bool EmbeddingCacheScheduler::ExportEmbeddingTable(int32_t param_key, int start_id, int end_id,
+                                                   const std::string &file_path) const {
+  MS_EXCEPTION_IF_NULL(embedding_cache_prefetch_actor_);
+  return embedding_cache_prefetch_actor_->ExportEmbeddingsToFile(param_key, start_id, end_id, file_path);
+}
+
 void EmbeddingCacheScheduler::Finalize() {
   if (!initialized_ || finalized_) {
     return;
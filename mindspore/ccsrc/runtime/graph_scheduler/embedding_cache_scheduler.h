@@ -58,6 +58,11 @@ class BACKEND_EXPORT EmbeddingCacheScheduler {
   // Synchronize latest embedding table in local cache to remote.
   void SyncEmbeddingTable() const;
 
+  // Bulk export the embedding rows of the table identified by parameter key whose feature ids lie in
+  // [start_id, end_id) into a binary file, streamed from the remote cache in batches without any Python
+  // marshalling. Intended for offline inspection or evaluation, called between steps.
+  bool ExportEmbeddingTable(int32_t param_key, int start_id, int end_id, const std::string &file_path) const;
+
   // Finalize embedding cache prefetch actor.
   void Finalize();
 
@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <functional>
 #include "runtime/graph_scheduler/graph_scheduler.h"
+#include "runtime/graph_scheduler/device_tensor_store.h"
 #include "runtime/pynative/op_executor.h"
 #include "runtime/device/device_address.h"
 #include "runtime/device/ms_device_shape_transfer.h"
@@ -103,6 +104,10 @@ void CreateParameterDeviceAddress(const DeviceContext *device_context, const Ker
   // Create device address for anf node in nodes_list
   for (const auto &item : nodes_list) {
     auto output_size = common::AnfAlgo::GetOutputTensorNum(item);
+    // The formatted device tensor of a weight is shared by all the kernel graphs referencing the same front
+    // parameter with the same device format, instead of each graph storing its own copy.
+    bool is_weight = item->isa<Parameter>() && common::AnfAlgo::IsParameterWeight(item->cast<ParameterPtr>());
+    auto front_node = is_weight ? graph->GetFrontAnfByBackendAnf(item) : nullptr;
     for (size_t index = 0; index < output_size; index++) {
       TypeId output_type_id = AnfAlgo::GetOutputDeviceDataType(item, index);
       if (output_type_id == kTypeUnknown) {
@@ -110,13 +115,26 @@ void CreateParameterDeviceAddress(const DeviceContext *device_context, const Ker
       }
 
       size_t tensor_size = AnfAlgo::GetOutputTensorMemSize(item, index);
+      auto format = AnfAlgo::GetOutputFormat(item, index);
+      if (front_node != nullptr) {
+        auto cached_address = DeviceTensorStore::GetInstance().FetchFormatVariant(
+          front_node.get(), device_context->GetDeviceType(), format, tensor_size);
+        if (cached_address != nullptr) {
+          MS_LOG(DEBUG) << "Reuse the cached format variant for node:" << common::AnfAlgo::GetNodeDebugString(item)
+                        << " addr:" << cached_address;
+          AnfAlgo::SetOutputAddr(cached_address, index, item.get());
+          continue;
+        }
+      }
       auto device_address = device_context->device_res_manager_->CreateDeviceAddress(
-        nullptr, tensor_size, AnfAlgo::GetOutputFormat(item, index), output_type_id,
-        trans::GetRuntimePaddingShape(item, index));
+        nullptr, tensor_size, format, output_type_id, trans::GetRuntimePaddingShape(item, index));
       device_address->set_from_persistent_mem(item->isa<Parameter>());
       MS_LOG(DEBUG) << "Create addr for node:" << common::AnfAlgo::GetNodeDebugString(item)
                     << " addr:" << device_address;
       AnfAlgo::SetOutputAddr(device_address, index, item.get());
+      if (front_node != nullptr) {
+        DeviceTensorStore::GetInstance().InsertFormatVariant(front_node.get(), device_address);
+      }
     }
   }
 }
@@ -15,11 +15,15 @@
  */
 
 #include "runtime/graph_scheduler/graph_scheduler.h"
+#include <algorithm>
 #include <queue>
+#include <sstream>
 #include "runtime/graph_scheduler/scheduler_helper.h"
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
 #include "runtime/graph_scheduler/actor/recorder_actor.h"
+#include "runtime/graph_scheduler/actor/host_timeline_recorder.h"
+#include "runtime/graph_scheduler/actor/kernel_latency_monitor.h"
 #include "runtime/graph_scheduler/optimizer/optimizer.h"
 #include "runtime/graph_scheduler/optimizer/invalid_data_arrow_elimination.h"
 #include "runtime/graph_scheduler/optimizer/batch_data_arrow_fusion.h"
@@ -45,6 +49,10 @@
 #endif
 #ifdef ENABLE_DUMP_IR
 #include "include/common/debug/rdr/recorder_manager.h"
+#include "debug/rdr/string_recorder.h"
+#ifdef ENABLE_ALLOC_AUDIT
+#include "debug/rdr/alloc_counter_recorder.h"
+#endif
 #endif
 #ifdef ENABLE_DEBUGGER
 #include "debug/debugger/debugger.h"
@@ -319,6 +327,10 @@ void GraphScheduler::Clear(const ActorInfo &actor_info, const std::vector<Kernel
 }
 
 void GraphScheduler::Clear() {
+  // Export the latency statistics and the host timeline collected by the actors before the actors are terminated.
+  KernelLatencyMonitor::GetInstance().Dump();
+  HostTimelineRecorder::GetInstance().Dump();
+
   // Terminate all actors.
   auto actor_manager = ActorMgr::GetActorMgrRef();
   MS_EXCEPTION_IF_NULL(actor_manager);
@@ -504,11 +516,44 @@ ActorSet *GraphScheduler::Transform(const GraphCompilerInfo &graph_compiler_info
   Link(actor_set.get(), graph_compiler_info);
 
   DumpActor(actor_set.get(), graph_compiler_info);
+#ifdef ENABLE_DUMP_IR
+  if (mindspore::RecorderManager::Instance().RdrEnable()) {
+    // Dump the actor address to name table. The flight events emitted per message record only the
+    // actor address; the offline decoder joins them with this table to replay the captured step as
+    // the exact message interleaving the threads executed.
+    std::ostringstream actor_table;
+    for (const auto &base_actor : SchedulerHelper::CollectActors(actor_set.get())) {
+      MS_EXCEPTION_IF_NULL(base_actor);
+      actor_table << reinterpret_cast<uint64_t>(base_actor.get()) << " " << base_actor->GetAID().Name() << "\n";
+    }
+    (void)mindspore::RDR::RecordString(SubModuleId::SM_RUNTIME_FRAMEWORK, "actor_table." + actor_set->name_,
+                                       actor_table.str());
+  }
+#endif
   if (graph_compiler_info.strategy_ == GraphExecutionStrategy::kPipeline) {
     SchedulerHelper::CheckActorValid(actor_set.get());
   }
 
   Optimize(actor_set);
+  SchedulerHelper::CalcKernelLaunchPriority(actor_set.get());
+  SchedulerHelper::PackKernelLaunchInfo(actor_set.get());
+
+  // The lock free input dispatch only supports the single step in flight, so it is restricted to the pipeline
+  // execution of static shape graphs without control flow.
+  actor_set->enable_lock_free_input_dispatch_ =
+    (graph_compiler_info.strategy_ == GraphExecutionStrategy::kPipeline) && (actor_set->control_actors_ == nullptr) &&
+    std::none_of(graph_compiler_info.graphs_.begin(), graph_compiler_info.graphs_.end(),
+                 [](const KernelGraphPtr &graph) { return graph->is_dynamic_shape(); });
+#ifdef ENABLE_RPC_ACTOR
+  // Rpc actors override CheckRunningCondition to additionally wait for the inter-process messages, which the
+  // lock free completion count does not cover: a recv actor would launch before the remote payload arrived.
+  // So any actor set with rpc actors keeps the locked dispatch.
+  if (actor_set->rpc_actors_ != nullptr &&
+      (!actor_set->rpc_actors_->send_actors_.empty() || !actor_set->rpc_actors_->recv_actors_.empty())) {
+    actor_set->enable_lock_free_input_dispatch_ = false;
+  }
+#endif
+  SetDirectCallExecution(actor_set.get(), graph_compiler_info);
   MS_LOG(INFO) << "Graph(" << graph_compiler_info.name_ << ") transforms actor end.";
 
 #ifdef WITH_BACKEND
@@ -536,6 +581,10 @@ ActorSet *GraphScheduler::Transform(const GraphCompilerInfo &graph_compiler_info
 
 void GraphScheduler::Schedule(const ActorSet *actor_set) {
   MS_EXCEPTION_IF_NULL(actor_set);
+#if defined(ENABLE_DUMP_IR) && defined(ENABLE_ALLOC_AUDIT)
+  // Register the host allocation counters so they are exported with the other rdr records on triggering.
+  (void)mindspore::RDR::RecordAllocCounter(SubModuleId::SM_RUNTIME_FRAMEWORK, "alloc_counter");
+#endif
   auto actors = SchedulerHelper::CollectActors(actor_set);
   // Schedule actors.
   auto actor_manager = ActorMgr::GetActorMgrRef();
@@ -548,6 +597,9 @@ void GraphScheduler::Schedule(const ActorSet *actor_set) {
     } else {
       actor->Init();
     }
+    if (actor_set->enable_lock_free_input_dispatch_) {
+      actor->EnableLockFreeInputDispatch();
+    }
   }
 
 #ifdef ENABLE_RPC_ACTOR
@@ -566,6 +618,10 @@ void GraphScheduler::Run(ActorSet *const actor_set, const std::vector<DeviceCont
                          const std::vector<TensorPtr> &input_tensors_with_value_node, GraphExecutionStrategy strategy) {
   MS_EXCEPTION_IF_NULL(actor_set);
   MS_EXCEPTION_IF_NULL(actor_set->data_prepare_actor_);
+  // Serialize the steps of one actor set: concurrent serving threads may share a single compiled graph
+  // (and thereby one copy of its weight device tensors) and their requests are executed back to back.
+  std::lock_guard<std::mutex> run_lock(actor_set->run_mutex_);
+  actor_set->last_used_tick_ = ++actor_set_use_tick_;
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
   SignalGuard sg(IntHandler);
 #endif
@@ -653,6 +709,11 @@ void GraphScheduler::SetActorExecutionStrategy(ActorSet *const actor_set, GraphE
   return;
 #endif
 
+  // The direct call execution is decided ahead of time and not revisited by the measurement phases.
+  if (actor_set->enable_direct_call_execution_) {
+    return;
+  }
+
   // The step mode uses the default multi thread.
   if (strategy == GraphExecutionStrategy::kStep) {
     return;
@@ -702,6 +763,72 @@ void GraphScheduler::SetActorExecutionStrategy(ActorSet *const actor_set, GraphE
   }
 }
 
+void GraphScheduler::SetDirectCallExecution(ActorSet *const actor_set,
+                                            const GraphCompilerInfo &graph_compiler_info) const {
+  MS_EXCEPTION_IF_NULL(actor_set);
+#if defined(_WIN32) || defined(_WIN64) || defined(__APPLE__)
+  return;
+#else
+  static const bool enable_direct_call = common::GetEnv("MS_DEV_DIRECT_CALL_EXECUTION") == "1";
+  if (!enable_direct_call || (graph_compiler_info.strategy_ != GraphExecutionStrategy::kPipeline)) {
+    return;
+  }
+  // The same constraints as the single thread execution, checked ahead of time instead of after the measurement
+  // phases, plus the tiny graph limit.
+  if ((actor_set->control_actors_ != nullptr) || (!actor_set->copy_actors_.empty()) ||
+      (!actor_set->super_kernel_actors_.empty()) || (!actor_set->custom_actors_.empty()) ||
+      (actor_set->loop_count_actor_ == nullptr) || (actor_set->loop_count_actor_->loop_count() > 1) ||
+      (actor_set->kernel_actors_.size() > ActorDispatcher::kDirectCallExecutionKernelMaxNum)) {
+    return;
+  }
+#ifdef ENABLE_RPC_ACTOR
+  if (HaveRpcActors(actor_set)) {
+    return;
+  }
+#endif
+  // Only a linear chain of static shape kernels is eligible: every kernel feeds at most one downstream kernel, so
+  // the direct calls walk the chain on the calling thread without any fan out or mailbox overhead.
+  for (const auto &kernel_actor : actor_set->kernel_actors_) {
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    if (kernel_actor->is_dynamic_shape()) {
+      return;
+    }
+    size_t to_kernel_num = 0;
+    for (const auto &output_data_arrow : kernel_actor->output_data_arrows()) {
+      MS_EXCEPTION_IF_NULL(output_data_arrow);
+      auto to_actor = FetchActor(output_data_arrow->to_op_id_.Name());
+      if ((to_actor != nullptr) && (to_actor->type() == KernelTransformType::kKernelActor)) {
+        ++to_kernel_num;
+      }
+    }
+    if (to_kernel_num > 1) {
+      return;
+    }
+  }
+
+  actor_set->enable_direct_call_execution_ = true;
+  actor_set->is_multi_thread_execution_ = false;
+  MS_LOG(INFO) << "Actor set:" << actor_set->name_
+               << " enables the direct call execution on the calling thread, kernel actor number: "
+               << actor_set->kernel_actors_.size();
+#endif
+}
+
+std::vector<ActorInfo> GraphScheduler::FetchActorSetsByColdness() const {
+  std::vector<std::pair<size_t, ActorInfo>> ticks;
+  ticks.reserve(actors_.size());
+  for (const auto &actor : actors_) {
+    MS_EXCEPTION_IF_NULL(actor.second);
+    (void)ticks.emplace_back(actor.second->last_used_tick_, actor.first);
+  }
+  std::sort(ticks.begin(), ticks.end());
+  std::vector<ActorInfo> actor_infos;
+  actor_infos.reserve(ticks.size());
+  (void)std::transform(ticks.begin(), ticks.end(), std::back_inserter(actor_infos),
+                       [](const auto &tick) { return tick.second; });
+  return actor_infos;
+}
+
 ActorSet *GraphScheduler::Fetch(const ActorInfo &actor_info) const {
   auto iter = actors_.find(actor_info);
   if (iter != actors_.end()) {
@@ -1601,6 +1728,24 @@ void GraphScheduler::LinkControlArrowByAutoMonad(AbstractActor *to_actor, const
                     << " is not actor for the graph: " << graph->graph_id();
       continue;
     }
+    // An auto monad predecessor updating a provably different parameter does not need ordering with this kernel, so
+    // recurse through its own monad input instead of linking to it, which keeps the ordering against the earlier
+    // updates of the same parameter and lets the independent updates run concurrently.
+    auto to_kernel_actor = dynamic_cast<KernelActor *>(to_actor);
+    if ((to_kernel_actor != nullptr) &&
+        SchedulerHelper::IsIndependentSideEffectKernelPair(real_depend_kernel, to_kernel_actor->kernel())) {
+      MS_LOG(INFO) << "Skip the control arrow between independent side effect kernels from actor: "
+                   << from_actor->GetAID().Name() << ", to actor: " << to_actor->GetAID().Name() << " for the graph: "
+                   << graph->graph_id();
+      auto real_depend_cnode = real_depend_kernel->cast<CNodePtr>();
+      MS_EXCEPTION_IF_NULL(real_depend_cnode);
+      for (const auto &depend_input : real_depend_cnode->inputs()) {
+        if (HasAbstractMonad(depend_input)) {
+          LinkControlArrowByAutoMonad(to_actor, depend_input, graph, parser);
+        }
+      }
+      continue;
+    }
     MS_LOG(INFO) << "Link control arrow by auto monad from actor:  " << from_actor->GetAID().Name()
                  << ", to actor: " << to_actor->GetAID().Name() << " for the graph: " << graph->graph_id();
     SchedulerHelper::AddControlArrow(from_actor, to_actor);
@@ -2134,6 +2279,7 @@ void GraphScheduler::LinkDeviceTensorStoreForAutoMonadActor(const std::vector<Ab
       }
       // Move the control arrows from auto monad actor to auto monad actor users.
       auto_monad_actor->output_control_arrows_.clear();
+      auto_monad_actor->output_control_arrow_dsts_.clear();
       for (auto &output_contorl_actor : output_contorl_actors) {
         MS_EXCEPTION_IF_NULL(output_contorl_actor);
         for (auto iter = output_contorl_actor->input_control_arrow_aids_.begin();
@@ -2367,13 +2513,16 @@ void GraphScheduler::DumpDeviceTensorStore(const GraphCompilerInfo &graph_compil
 void GraphScheduler::BindNumaNode() {
   auto numa_enable = common::GetEnv(kNumaEnableEnv);
   auto numa_enable2 = common::GetEnv(kNumaEnableEnv2);
-  if ((numa_enable.empty() || numa_enable != "1") && (numa_enable2.empty() || numa_enable2 != "1")) {
+  // "interleave" spreads the host allocations over all the numa nodes instead of binding them to one:
+  // the right policy when this process feeds devices sitting on different sockets, where any single-node
+  // placement sends half of the host to device copies across the socket interconnect.
+  bool interleave = (numa_enable == "interleave" || numa_enable2 == "interleave");
+  if (!interleave && (numa_enable.empty() || numa_enable != "1") && (numa_enable2.empty() || numa_enable2 != "1")) {
     return;
   }
 
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__) && !defined(ENABLE_ANDROID)
   uint32_t rank_id = CommManager::GetInstance().GetRank();
-  MS_LOG(INFO) << "Bind numa node for rank " << rank_id;
   if (numa_handle_ == nullptr) {
     numa_handle_ = GetNumaAdapterHandle();
     if (numa_handle_ == nullptr) {
@@ -2381,6 +2530,16 @@ void GraphScheduler::BindNumaNode() {
     }
   }
 
+  if (interleave) {
+    auto ret = NumaSetInterleave(numa_handle_.get());
+    if (ret != StatusCode::kSuccess) {
+      MS_LOG(EXCEPTION) << "Set numa interleave policy failed, ret = " << ret.GetErrDescription();
+    }
+    MS_LOG(INFO) << "Numa interleave memory policy set successful.";
+    return;
+  }
+
+  MS_LOG(INFO) << "Bind numa node for rank " << rank_id;
   auto ret = NumaBind(numa_handle_.get(), rank_id);
   if (ret != StatusCode::kSuccess) {
     MS_LOG(EXCEPTION) << "Bind numa node failed, ret = " << ret.GetErrDescription();
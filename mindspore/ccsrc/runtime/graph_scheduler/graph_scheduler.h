@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_GRAPH_SCHEDULER_H_
 #define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_GRAPH_SCHEDULER_H_
 
+#include <atomic>
 #include <vector>
 #include <string>
 #include <memory>
@@ -80,6 +81,10 @@ class BACKEND_EXPORT GraphScheduler {
   // Fetch the actor set by actor info.
   ActorSet *Fetch(const ActorInfo &actor_info) const;
 
+  // Return the actor set names ordered from the least to the most recently run. Used to pick the cold compiled
+  // variants of a long-running dynamic shape service for the idle-time eviction.
+  std::vector<ActorInfo> FetchActorSetsByColdness() const;
+
  private:
   GraphScheduler() = default;
   ~GraphScheduler() = default;
@@ -89,6 +94,11 @@ class BACKEND_EXPORT GraphScheduler {
   void SetActorExecutionStrategy(ActorSet *const actor_set, GraphExecutionStrategy strategy,
                                  double execution_time) const;
 
+  // Enable running the actor set on the calling thread with direct function calls from the first step, enabled by
+  // MS_DEV_DIRECT_CALL_EXECUTION=1 for the tiny linear chains of static shape kernels whose compute is smaller than
+  // the actor messaging overhead.
+  void SetDirectCallExecution(ActorSet *const actor_set, const GraphCompilerInfo &graph_compiler_info) const;
+
   // The Global actors contain memory manager actor, recorder actor and debug actor.
   void BuildAndScheduleGlobalActor();
 
@@ -196,6 +206,9 @@ class BACKEND_EXPORT GraphScheduler {
   // The global maps, only be cleared in the deconstruction.
   mindspore::HashMap<ActorInfo, ActorSetPtr> actors_;
 
+  // The tick stamped into the actor set on each Run, see FetchActorSetsByColdness.
+  std::atomic<size_t> actor_set_use_tick_{0};
+
   // The local maps and vectors, will be cleared at the end of each graph transform:
   // 1.The second element of pair represents the output index of op actor corresponding to the graph output front node.
   std::map<KernelWithIndex, GraphOutputPair, session::KernelWithIndexCmp> graph_output_to_actor_;
@@ -16,10 +16,12 @@
 
 #include "runtime/graph_scheduler/scheduler_helper.h"
 #include "runtime/graph_scheduler/actor/actor_dump.h"
+#include "mindspore/core/ops/core_ops.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
 #include "utils/anf_utils.h"
 #include "utils/log_adapter.h"
+#include "utils/ms_utils.h"
 #include "include/common/utils/convert_utils.h"
 
 namespace mindspore {
@@ -159,11 +161,7 @@ void SchedulerHelper::AddControlArrow(AbstractActor *const from_actor, AbstractA
   MS_EXCEPTION_IF_NULL(to_actor);
 
   // Check the control arrow whether exists.
-  auto iter = std::find_if(from_actor->output_control_arrows_.begin(), from_actor->output_control_arrows_.end(),
-                           [&to_actor](const auto &output_control_arrow) {
-                             return output_control_arrow->to_op_id_.Name() == to_actor->GetAID().Name();
-                           });
-  if (iter != from_actor->output_control_arrows_.end()) {
+  if (from_actor->output_control_arrow_dsts_.count(to_actor->GetAID().Name()) > 0) {
     // The stack actor can only link the single control arrow.
     if (to_actor->type_ == KernelTransformType::kStackActor) {
       MS_LOG(EXCEPTION) << "The control arrow between " << from_actor->GetAID().Name() << " and "
@@ -174,10 +172,46 @@ void SchedulerHelper::AddControlArrow(AbstractActor *const from_actor, AbstractA
 
   auto control_arrow = std::make_shared<ControlArrow>(to_actor->GetAID());
   (void)from_actor->output_control_arrows_.emplace_back(control_arrow);
+  (void)from_actor->output_control_arrow_dsts_.insert(to_actor->GetAID().Name());
   to_actor->input_controls_num_++;
   (void)to_actor->input_control_arrow_aids_.emplace_back(std::make_pair(from_actor->GetAID(), control_arrow.get()));
 }
 
+namespace {
+// The side-effect kernels whose written resource is identified by their first real input parameter.
+bool IsParameterUpdateKernel(const AnfNodePtr &node) {
+  static const PrimitiveSet update_prims = {prim::kPrimAssign, prim::kPrimAssignAdd, prim::kPrimAssignSub};
+  return IsOneOfPrimitiveCNode(node, update_prims);
+}
+
+AnfNodePtr FetchUpdatedParameter(const AnfNodePtr &node) {
+  const auto &cnode = node->cast<CNodePtr>();
+  if (cnode == nullptr || cnode->inputs().size() <= 1) {
+    return nullptr;
+  }
+  const auto &real_input = common::AnfAlgo::VisitKernelWithReturnType(cnode->input(1), 0);
+  if (real_input.first == nullptr || !real_input.first->isa<Parameter>()) {
+    return nullptr;
+  }
+  return real_input.first;
+}
+}  // namespace
+
+bool SchedulerHelper::IsIndependentSideEffectKernelPair(const AnfNodePtr &from_kernel, const AnfNodePtr &to_kernel) {
+  // Relaxing the auto monad chain changes the execution order of side-effect kernels, so it is opt-in.
+  static const bool enable_per_resource_order = common::GetEnv("MS_DEV_SIDE_EFFECT_PER_RESOURCE") == "1";
+  if (!enable_per_resource_order || from_kernel == nullptr || to_kernel == nullptr) {
+    return false;
+  }
+  if (!IsParameterUpdateKernel(from_kernel) || !IsParameterUpdateKernel(to_kernel)) {
+    return false;
+  }
+  // Distinct root parameters are distinct buffers, so the two updates do not need ordering between each other.
+  const auto &from_parameter = FetchUpdatedParameter(from_kernel);
+  const auto &to_parameter = FetchUpdatedParameter(to_kernel);
+  return (from_parameter != nullptr) && (to_parameter != nullptr) && (from_parameter != to_parameter);
+}
+
 void SchedulerHelper::AddPartialArrow(ControlActor *const from_actor, ControlActor *const to_actor, size_t from_index,
                                       size_t to_index) {
   MS_EXCEPTION_IF_NULL(from_actor);
@@ -202,6 +236,7 @@ void SchedulerHelper::AddLoopBodyControlArrow(AbstractActor *from_actor, Entranc
   MS_LOG(DEBUG) << "Link loop body control arrow from:" << from_actor->GetAID() << " to actor:" << to_actor->GetAID();
   auto control_arrow = std::make_shared<ControlArrow>(to_actor->GetAID());
   (void)from_actor->output_control_arrows_.emplace_back(control_arrow);
+  (void)from_actor->output_control_arrow_dsts_.insert(to_actor->GetAID().Name());
   to_actor->loop_body_input_controls_nums_++;
   (void)to_actor->loop_body_input_control_arrow_aids_.emplace_back(from_actor->GetAID());
 }
@@ -641,6 +676,125 @@ void SchedulerHelper::CheckActorValid(const ActorSet *actor_set) {
   CheckControlActorValid(actor_set);
 }
 
+void SchedulerHelper::PackKernelLaunchInfo(const ActorSet *actor_set) {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  size_t slot_num = 0;
+  for (const auto &kernel_actor : actor_set->kernel_actors_) {
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    slot_num += kernel_actor->launch_info_.inputs_.size() + kernel_actor->launch_info_.outputs_.size() +
+                kernel_actor->launch_info_.workspaces_.size();
+  }
+  if (slot_num == 0) {
+    return;
+  }
+
+  // The block is kept alive by the aliasing shared_ptrs handed to the actors, so it lives exactly
+  // as long as the last actor which points into it. The reserve makes sure the block is never
+  // reallocated while the aliasing pointers are taken; workspace slots which dynamic shape kernels
+  // append later keep their individual allocations, which is safe because the slot type is the
+  // same AddressPtr either way.
+  auto arena = std::make_shared<std::vector<kernel::Address>>();
+  arena->reserve(slot_num);
+  auto repack_slots = [&arena](kernel::AddressPtrList *slots) {
+    for (auto &slot : *slots) {
+      MS_EXCEPTION_IF_NULL(slot);
+      (void)arena->emplace_back(*slot);
+      slot = kernel::AddressPtr(arena, &arena->back());
+    }
+  };
+  for (const auto &kernel_actor : actor_set->kernel_actors_) {
+    repack_slots(&kernel_actor->launch_info_.inputs_);
+    repack_slots(&kernel_actor->launch_info_.outputs_);
+    repack_slots(&kernel_actor->launch_info_.workspaces_);
+  }
+}
+
+void SchedulerHelper::CalcKernelLaunchPriority(const ActorSet *actor_set) {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  // Control flow graphs run the branches iteratively, the single critical path is undefined
+  // there, keep the plain FIFO dispatch.
+  if (actor_set->control_actors_ != nullptr) {
+    return;
+  }
+  const auto &kernel_actors = actor_set->kernel_actors_;
+  if (kernel_actors.size() <= 1) {
+    return;
+  }
+
+  mindspore::HashMap<std::string, size_t> actor_indexes;
+  for (size_t i = 0; i < kernel_actors.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(kernel_actors[i]);
+    actor_indexes[kernel_actors[i]->GetAID().Name()] = i;
+  }
+  // Build the kernel actor sub graph from the input arrows. The arrows from and to the other
+  // actor kinds do not change which kernel chain is the longest.
+  std::vector<std::vector<size_t>> predecessors(kernel_actors.size());
+  std::vector<std::vector<size_t>> successors(kernel_actors.size());
+  std::vector<size_t> in_degrees(kernel_actors.size(), 0);
+  for (size_t i = 0; i < kernel_actors.size(); ++i) {
+    auto add_edge = [&actor_indexes, &predecessors, &successors, &in_degrees, i](const AID &from_aid) {
+      const auto &iter = actor_indexes.find(from_aid.Name());
+      if (iter == actor_indexes.end()) {
+        return;
+      }
+      (void)predecessors[i].emplace_back(iter->second);
+      (void)successors[iter->second].emplace_back(i);
+      ++in_degrees[i];
+    };
+    for (const auto &input_data_arrow_aid : kernel_actors[i]->input_data_arrow_aids_) {
+      add_edge(input_data_arrow_aid.first);
+    }
+    for (const auto &input_control_arrow_aid : kernel_actors[i]->input_control_arrow_aids_) {
+      add_edge(input_control_arrow_aid.first);
+    }
+  }
+
+  // The longest path through every actor in two passes over the topological order, with unit
+  // kernel cost. Profiled kernel durations can replace the unit cost once they are available at
+  // compile time.
+  std::vector<size_t> topo_order;
+  topo_order.reserve(kernel_actors.size());
+  for (size_t i = 0; i < kernel_actors.size(); ++i) {
+    if (in_degrees[i] == 0) {
+      (void)topo_order.emplace_back(i);
+    }
+  }
+  std::vector<size_t> to_here(kernel_actors.size(), 1);
+  for (size_t pos = 0; pos < topo_order.size(); ++pos) {
+    const auto index = topo_order[pos];
+    for (const auto &successor : successors[index]) {
+      to_here[successor] = std::max(to_here[successor], to_here[index] + 1);
+      if (--in_degrees[successor] == 0) {
+        (void)topo_order.emplace_back(successor);
+      }
+    }
+  }
+  if (topo_order.size() != kernel_actors.size()) {
+    MS_LOG(WARNING) << "The kernel actors do not form a DAG, skip the launch priority calculation.";
+    return;
+  }
+  std::vector<size_t> from_here(kernel_actors.size(), 1);
+  for (auto iter = topo_order.rbegin(); iter != topo_order.rend(); ++iter) {
+    for (const auto &predecessor : predecessors[*iter]) {
+      from_here[predecessor] = std::max(from_here[predecessor], from_here[*iter] + 1);
+    }
+  }
+  size_t critical_path_length = 0;
+  for (size_t i = 0; i < kernel_actors.size(); ++i) {
+    critical_path_length = std::max(critical_path_length, to_here[i] + from_here[i] - 1);
+  }
+  // An actor lies on a critical path iff its longest through path reaches the critical length.
+  size_t high_priority_num = 0;
+  for (size_t i = 0; i < kernel_actors.size(); ++i) {
+    if (to_here[i] + from_here[i] - 1 == critical_path_length) {
+      kernel_actors[i]->set_dispatch_priority(1);
+      ++high_priority_num;
+    }
+  }
+  MS_LOG(INFO) << "Critical path length: " << critical_path_length << ", raise the dispatch priority of "
+               << high_priority_num << " of " << kernel_actors.size() << " kernel actors.";
+}
+
 void SchedulerHelper::DumpActorSet(const ActorSet *actor_set, std::ofstream &ofs) {
   MS_EXCEPTION_IF_NULL(actor_set);
   DumpDataPrepareActor(actor_set->data_prepare_actor_, ofs);
@@ -44,6 +44,11 @@ class SchedulerHelper {
                              const AnfNodePtr &from_kernel, size_t from_output_index, size_t output_position);
   static void AddControlArrow(AbstractActor *const from_actor, AbstractActor *const to_actor);
 
+  // Return true if the two side-effect kernels update provably different parameters, in which case the auto monad
+  // ordering between them can be relaxed and they may run concurrently (enabled by the env
+  // MS_DEV_SIDE_EFFECT_PER_RESOURCE).
+  static bool IsIndependentSideEffectKernelPair(const AnfNodePtr &from_kernel, const AnfNodePtr &to_kernel);
+
   // Add the arrow for control actor.
   static void AddPartialArrow(ControlActor *const from_actor, ControlActor *const to_actor, size_t from_index,
                               size_t to_index);
@@ -80,6 +85,15 @@ class SchedulerHelper {
   // Check whether the actor set is valid.
   static void CheckActorValid(const ActorSet *actor_set);
 
+  // Compute the critical path over the kernel actors and raise the dispatch priority of the
+  // actors lying on it, so that the thread pool launches them before the non-critical backlog.
+  static void CalcKernelLaunchPriority(const ActorSet *actor_set);
+
+  // Repack the launch address slots of all kernel actors into one contiguous block, so that the
+  // per step refresh and launch loops stream through memory instead of chasing the individually
+  // allocated Address objects.
+  static void PackKernelLaunchInfo(const ActorSet *actor_set);
+
   static void DumpActorSet(const ActorSet *actor_set, std::ofstream &ofs);
 
   static size_t fusion_actor_index_;
@@ -15,10 +15,20 @@
  */
 
 #include "runtime/hardware/device_context_manager.h"
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <dlfcn.h>
+#endif
 #include "utils/ms_context.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace device {
+namespace {
+// Manifest mapping each device target to the shared object providing its device context, so that resolving
+// a backend never needs to probe every library in the plugin directory with dlopen.
+const std::map<std::string, std::string> kPluginManifest = {
+  {"GPU", "libmindspore_gpu.so"}, {"Ascend", "libmindspore_ascend.so"}, {"GE", "libmindspore_ascend.so"}};
+}  // namespace
 DeviceContextManager &DeviceContextManager::GetInstance() {
   static DeviceContextManager instance{};
   return instance;
@@ -58,6 +68,12 @@ DeviceContext *DeviceContextManager::GetOrCreateDeviceContext(const DeviceContex
 
   std::shared_ptr<DeviceContext> device_context;
   auto creator_iter = device_context_creators_.find(name);
+  if (creator_iter == device_context_creators_.end()) {
+    // The backend plugins are resolved lazily on the first device context request, so a cpu only process
+    // never pays the load and symbol resolution of the device libraries at import.
+    LoadPlugin(name);
+    creator_iter = device_context_creators_.find(name);
+  }
   if (creator_iter != device_context_creators_.end()) {
     device_context = (creator_iter->second)(device_context_key);
     MS_EXCEPTION_IF_NULL(device_context);
@@ -68,6 +84,30 @@ DeviceContext *DeviceContextManager::GetOrCreateDeviceContext(const DeviceContex
   return device_context.get();
 }
 
+void DeviceContextManager::LoadPlugin(const std::string &device_name) {
+#if !defined(_WIN32) && !defined(_WIN64)
+  std::lock_guard<std::mutex> lock(plugin_mutex_);
+  auto manifest_iter = kPluginManifest.find(device_name);
+  if (manifest_iter == kPluginManifest.end()) {
+    return;
+  }
+  const std::string &lib_name = manifest_iter->second;
+  if (plugin_handles_.find(lib_name) != plugin_handles_.end()) {
+    return;
+  }
+  std::string plugin_dir = common::GetEnv("MS_DEVICE_PLUGIN_PATH");
+  std::string plugin_path = plugin_dir.empty() ? lib_name : plugin_dir + "/" + lib_name;
+  void *handle = dlopen(plugin_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (handle == nullptr) {
+    MS_LOG(INFO) << "Load device plugin " << plugin_path << " for target " << device_name
+                 << " failed: " << dlerror();
+    return;
+  }
+  MS_LOG(INFO) << "Load device plugin " << plugin_path << " for target " << device_name << " success.";
+  plugin_handles_[lib_name] = handle;
+#endif
+}
+
 void DeviceContextManager::UpdateDeviceContextKey(const DeviceContextKey &old_key, const DeviceContextKey &new_key) {
   std::string old_key_str = old_key.ToString();
   std::string new_key_str = new_key.ToString();
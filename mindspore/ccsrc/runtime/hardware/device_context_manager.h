@@ -45,10 +45,20 @@ class BACKEND_EXPORT DeviceContextManager {
   ~DeviceContextManager() = default;
   DISABLE_COPY_AND_ASSIGN(DeviceContextManager);
 
+  // Load the backend plugin library providing the device target from the plugin manifest, so that a process
+  // only pays the dlopen and symbol resolution of the backends it actually uses. The plugin registers its
+  // device context creator through its static registrations during the load. A missing library is not an
+  // error here, the caller reports the unavailable target.
+  void LoadPlugin(const std::string &device_name);
+
   // The string converted from DeviceContextKey -> DeviceContextPtr.
   std::map<std::string, DeviceContextPtr> device_contexts_;
   // The name of device -> DeviceContextCreator.
   std::map<std::string, DeviceContextCreator> device_context_creators_;
+  // The handles of the lazily loaded plugin libraries, keyed by library name. The handles stay open for the
+  // process lifetime, unloading a backend with live static registrations is not safe.
+  std::map<std::string, void *> plugin_handles_;
+  std::mutex plugin_mutex_;
 };
 
 class DeviceContextRegister {
@@ -422,6 +422,8 @@ void ChangeInputDynamicAbsToActualAbs(const CNodePtr &cnode) {
   }
 }
 
+constexpr auto kLastLaunchShapes = "last_launch_shapes";
+
 void UpdateDynamicShape(const CNodePtr &kernel) {
   MS_EXCEPTION_IF_NULL(kernel);
   auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
@@ -429,6 +431,23 @@ void UpdateDynamicShape(const CNodePtr &kernel) {
   if (session::AnfRuntimeAlgorithm::GetKernelType(kernel) == KernelType::AKG_KERNEL) {
     MS_LOG(EXCEPTION) << "Akg kernel do not support dynamic shape: " << kernel->fullname_with_scope();
   }
+  // Dynamic shape models usually revisit a small set of shapes. If the input shapes are unchanged since the last
+  // launch and the kernel does not depend on input values, the infer and resize result held by the node and the
+  // kernel mod is still valid, so the host side InferOp and Resize cost can be skipped.
+  auto input_size = common::AnfAlgo::GetInputTensorNum(kernel);
+  std::vector<ShapeVector> input_shapes;
+  input_shapes.reserve(input_size);
+  for (size_t i = 0; i < input_size; ++i) {
+    (void)input_shapes.emplace_back(common::AnfAlgo::GetPrevNodeOutputInferShape(kernel, i));
+  }
+  auto prev_args = kernel::GetArgsFromCNode(kernel);
+  bool value_depend = (prev_args != nullptr && !prev_args->depend_tensor_map.empty());
+  if (!value_depend && kernel->has_user_data(kLastLaunchShapes)) {
+    const auto &last_shapes = kernel->user_data<std::vector<ShapeVector>>(kLastLaunchShapes);
+    if (*last_shapes == input_shapes) {
+      return;
+    }
+  }
   opt::dynamic_shape::InferOp(kernel);
   auto args = kernel::GetArgsFromCNode(kernel);
   if (kernel_mod->GetKernelModType() == kernel::KernelModType::NativeGpuKernelMod ||
@@ -441,10 +460,11 @@ void UpdateDynamicShape(const CNodePtr &kernel) {
     update.depend_tensor_map = args->depend_tensor_map;
     kernel::SetArgsToCNode(kernel, update);
   }
-  if (kernel_mod->Resize(args->op, args->inputs, args->outputs, args->depend_tensor_map) ==
+  if (kernel_mod->ResizeWithCache(args->op, args->inputs, args->outputs, args->depend_tensor_map) ==
       static_cast<int>(kernel::KRET_RESIZE_FAILED)) {
     MS_LOG(EXCEPTION) << "Node " << kernel->fullname_with_scope() << " Resize failed.";
   }
+  kernel->set_user_data(kLastLaunchShapes, std::make_shared<std::vector<ShapeVector>>(std::move(input_shapes)));
 }
 
 // kernel_mode launch
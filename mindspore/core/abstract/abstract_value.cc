@@ -1375,7 +1375,9 @@ std::size_t AbstractBasePtrListHash(const AbstractBasePtrList &args_spec_list) {
   for (size_t i = 0; i < num; ++i) {
     const auto &arg = args_spec_list[i];
     MS_EXCEPTION_IF_NULL(arg);
-    hash_value = hash_combine(hash_value, arg->hash());
+    // Evaluator caches probe the same argument abstracts over and over; the cached hash avoids
+    // recursively re-hashing nested values, types and shapes on every probe.
+    hash_value = hash_combine(hash_value, arg->CachedHash());
   }
   if (n_args > kMaxElementsNum) {
     hash_value = hash_combine(hash_value, n_args);
@@ -1389,6 +1391,14 @@ bool AbstractBasePtrListDeepEqual(const AbstractBasePtrList &lhs, const Abstract
     return false;
   }
   for (std::size_t i = 0; i < size; ++i) {
+    if (lhs[i] == rhs[i]) {
+      continue;
+    }
+    // Equal abstracts hash equally, so a digest mismatch proves inequality without the recursive deep
+    // compare; the deep compare only runs on digest collisions.
+    if (lhs[i] != nullptr && rhs[i] != nullptr && lhs[i]->CachedHash() != rhs[i]->CachedHash()) {
+      return false;
+    }
     if (!IsEqual(lhs[i], rhs[i])) {
       return false;
     }
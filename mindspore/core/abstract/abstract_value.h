@@ -84,12 +84,31 @@ class MS_CORE_API AbstractBase : public Base {
   /// \return A boolean, which indicates whether the other abstract is same.
   virtual bool operator==(const AbstractBase &other) const;
 
+  /// \brief Get the hash number of the abstract, cached after the first computation.
+  ///
+  /// \note The cache is invalidated when the tracked value, type or shape is replaced, so use this only
+  /// where the abstract serves as a lookup key and is not mutated deeply behind its back, e.g. the
+  /// evaluator cache probes.
+  ///
+  /// \return The hash of the object.
+  std::size_t CachedHash() const {
+    std::size_t hash_value = cached_hash_;
+    if (hash_value == 0) {
+      hash_value = this->hash();
+      // Keep 0 as the "not computed yet" mark.
+      hash_value += (hash_value == 0) ? 1 : 0;
+      cached_hash_ = hash_value;
+    }
+    return hash_value;
+  }
+
   /// \brief Set the value for the AbstractBase.
   ///
   /// \param[in] value The value of an anf node.
   void set_value(const ValuePtr &value) {
     MS_EXCEPTION_IF_NULL(value);
     value_ = value;
+    cached_hash_ = 0;
   }
 
   /// \brief Set the type for the AbstractBase.
@@ -98,6 +117,7 @@ class MS_CORE_API AbstractBase : public Base {
   void set_type(const TypePtr &type) {
     MS_EXCEPTION_IF_NULL(type);
     type_ = type;
+    cached_hash_ = 0;
   }
 
   /// \brief Set the shape for the AbstractBase.
@@ -106,6 +126,7 @@ class MS_CORE_API AbstractBase : public Base {
   virtual void set_shape(const BaseShapePtr &shape) {
     MS_EXCEPTION_IF_NULL(shape);
     shape_ = shape;
+    cached_hash_ = 0;
   }
 
   /// \brief Set the value description for the AbstractBase.
@@ -219,6 +240,8 @@ class MS_CORE_API AbstractBase : public Base {
   BaseShapePtr shape_;
   std::string value_desc_;  // store initial value description for error report
   bool value_mutable_{false};
+  // The cached hash of this abstract, 0 means not computed yet. See CachedHash.
+  mutable std::size_t cached_hash_{0};
 };
 
 /// \brief Class AbstractScalar describes a scalar's type and value.
@@ -568,7 +591,9 @@ class MS_CORE_API AbstractUndetermined : public AbstractBase {
     if (element_type == nullptr) {
       MS_LOG(EXCEPTION) << "element_type is nullptr";
     }
-    AbstractBase::set_shape(std::make_shared<Shape>(shape));
+    // Equal static shapes share one interned instance, see InternedShape. All in-place shape
+    // mutations (Broaden, shape propagation) already Clone() before writing.
+    AbstractBase::set_shape(InternedShape(shape));
   }
 
   /// \brief Constructor of AbstractUndetermined.
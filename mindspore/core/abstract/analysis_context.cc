@@ -25,12 +25,16 @@
 namespace mindspore {
 namespace abstract {
 std::list<AnalysisContextPtr> AnalysisContext::all_context_;
+std::mutex AnalysisContext::context_mutex_;
 AnalysisContextPtr AnalysisContext::NewContext(const FuncGraphPtr &func_graph,
                                                const AbstractBasePtrList &args_spec_list) {
   // Find func graph's parent and its parent context firstly.
   MS_EXCEPTION_IF_NULL(func_graph);
   FuncGraphPtr parent_graph = func_graph->parent();
   AnalysisContextPtr parent_context = nullptr;
+  // Hold the lock for the whole find-or-create sequence, so two branch evaluation threads entering the same func
+  // graph with the same arguments get the same context instead of racing on the caches.
+  std::lock_guard<std::mutex> lock(context_mutex_);
   auto iter = extant_context_cache_.find(parent_graph);
   if (iter != extant_context_cache_.end()) {
     parent_context = iter->second.lock();
@@ -58,7 +62,7 @@ AnalysisContextPtr AnalysisContext::NewContext(const FuncGraphPtr &func_graph,
   }
 
   // Create a new context for the func graph and its specific arguments.
-  AnalysisContextPtr new_context = CreateContext(parent_context, func_graph, args_spec_list);
+  AnalysisContextPtr new_context = CreateContextWithLockHeld(parent_context, func_graph, args_spec_list);
   // To avoid cycle-reference, use weak_ptr here.
   auto weak_new_context = std::weak_ptr<AnalysisContext>(new_context);
   new_context->extant_context_cache_[func_graph] = weak_new_context;
@@ -67,6 +71,7 @@ AnalysisContextPtr AnalysisContext::NewContext(const FuncGraphPtr &func_graph,
 }
 
 AnalysisContextPtr AnalysisContext::FindOwnOrParentContext(const FuncGraphPtr &func_graph) {
+  std::lock_guard<std::mutex> lock(context_mutex_);
   auto p_iter = extant_context_cache_.find(func_graph);
   AnalysisContextPtr extant_context = nullptr;
   if (p_iter != extant_context_cache_.end()) {
@@ -210,6 +215,7 @@ std::string AnalysisContext::ToString() const {
 }
 
 void AnalysisContext::ClearContext() {
+  std::lock_guard<std::mutex> lock(context_mutex_);
   for (auto &item : all_context_) {
     item->parent_ = nullptr;
     item->func_graph_ = nullptr;
@@ -222,6 +228,13 @@ void AnalysisContext::ClearContext() {
 
 AnalysisContextPtr AnalysisContext::CreateContext(const AnalysisContextPtr &parent, const FuncGraphPtr &fg,
                                                   const AbstractBasePtrList &args_spec_list) {
+  std::lock_guard<std::mutex> lock(context_mutex_);
+  return CreateContextWithLockHeld(parent, fg, args_spec_list);
+}
+
+AnalysisContextPtr AnalysisContext::CreateContextWithLockHeld(const AnalysisContextPtr &parent, const FuncGraphPtr &fg,
+                                                              const AbstractBasePtrList &args_spec_list) {
+  // The constructor copies the extant context cache of the parent, so it must run with context_mutex_ held as well.
   auto context = std::make_shared<AnalysisContext>(parent, fg, args_spec_list);
   (void)all_context_.emplace_back(context);
   return context;
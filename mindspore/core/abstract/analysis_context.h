@@ -20,6 +20,7 @@
 #define MINDSPORE_CORE_ABSTRACT_ANALYSIS_CONTEXT_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <list>
 #include <unordered_map>
@@ -66,6 +67,10 @@ class MS_CORE_API AnalysisContext {
                                           const AbstractBasePtrList &args_spec_list);
 
  private:
+  // Create a context without taking context_mutex_, only for the callers which already hold it.
+  static AnalysisContextPtr CreateContextWithLockHeld(const AnalysisContextPtr &parent, const FuncGraphPtr &fg,
+                                                      const AbstractBasePtrList &args_spec_list);
+
   AnalysisContextPtr parent_;
   FuncGraphPtr func_graph_;
   AbstractBasePtrList args_spec_list_;
@@ -80,6 +85,9 @@ class MS_CORE_API AnalysisContext {
   // FuncGraphAbstactClosur->AnalysisContext->children_cache_->ArgsSpec->FuncGraphAbstactClosur.
   // For break the loop, using all_context_ to clear context_.
   static std::list<AnalysisContextPtr> all_context_;
+  // Guards all_context_ and the context caches, so the contexts can be created and looked up concurrently by the
+  // branch evaluation threads of the analysis schedule.
+  static std::mutex context_mutex_;
 };
 
 struct ContextHasher {
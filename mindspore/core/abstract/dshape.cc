@@ -18,9 +18,26 @@
 
 #include "abstract/dshape.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace mindspore {
 namespace abstract {
 namespace {
+struct ShapeVectorHash {
+  std::size_t operator()(const ShapeVector &shape) const noexcept {
+    std::size_t hash_code = shape.size();
+    for (auto dim : shape) {
+      hash_code = hash_combine(hash_code, static_cast<std::size_t>(dim));
+    }
+    return hash_code;
+  }
+};
+
+// The interned shapes live for the whole process, so the pool is bounded: models have a few
+// thousand distinct static shapes, anything beyond the limit simply gets a fresh instance.
+constexpr size_t kShapePoolSizeLimit = 65536;
+
 std::string ShapeVectorToStr(const std::vector<int64_t> &shp) {
   std::ostringstream buffer;
   bool f_begin = true;
@@ -85,10 +102,14 @@ std::string Shape::DumpText() const {
 }
 
 bool Shape::operator==(const BaseShape &other) const {
+  // Interned shapes compare by identity.
+  if (this == &other) {
+    return true;
+  }
   if (tid() != other.tid()) {
     return false;
   }
-  Shape other_shape = static_cast<const Shape &>(other);
+  const Shape &other_shape = static_cast<const Shape &>(other);
   if (shape_ != other_shape.shape_) {
     return false;
   }
@@ -98,6 +119,27 @@ bool Shape::operator==(const BaseShape &other) const {
   return (min_shape_ == other_shape.min_shape_) && (max_shape_ == other_shape.max_shape_);
 }
 
+ShapePtr InternedShape(const ShapeVector &shape) {
+  // Dynamic shapes carry per-instance min/max information and are mutated by shape propagation,
+  // so only static shapes are interned.
+  if (mindspore::IsDynamic(shape)) {
+    return std::make_shared<Shape>(shape);
+  }
+  static std::unordered_map<ShapeVector, ShapePtr, ShapeVectorHash> pool;
+  static std::mutex pool_mutex;
+  std::lock_guard<std::mutex> lock(pool_mutex);
+  auto iter = pool.find(shape);
+  if (iter != pool.end()) {
+    return iter->second;
+  }
+  if (pool.size() >= kShapePoolSizeLimit) {
+    return std::make_shared<Shape>(shape);
+  }
+  auto result = std::make_shared<Shape>(shape);
+  (void)pool.emplace(shape, result);
+  return result;
+}
+
 const int64_t Shape::SHP_ANY;
 void Shape::Broaden() {
   for (size_t i = 0; i < shape_.size(); i++) {
@@ -203,6 +203,18 @@ class MS_CORE_API Shape final : public BaseShape {
 using ShapePtr = std::shared_ptr<Shape>;
 using ShapePtrList = std::vector<ShapePtr>;
 
+/// \brief Get the canonical interned Shape instance of the given dimensions.
+///
+/// Large models create millions of identical static shapes during compilation; the interned
+/// instances are shared process-wide so equal shapes collapse to one object and compare by
+/// identity. Dynamic shapes are never interned and get a fresh instance. The returned shape is
+/// shared: a caller that needs to mutate it in place must Clone() it first, the same contract
+/// the Broaden paths already follow.
+///
+/// \param[in] shape The shape dimensions.
+/// \return The canonical Shape instance for static shapes, or a fresh instance otherwise.
+MS_CORE_API ShapePtr InternedShape(const ShapeVector &shape);
+
 /// \brief SequequeShape defines base class of multiple-shape classes.
 class MS_CORE_API SequenceShape : public BaseShape {
  public:
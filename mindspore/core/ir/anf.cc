@@ -96,6 +96,11 @@ void CNode::set_inputs(const std::vector<AnfNodePtr> &inputs) {
   input_tensor_num_ = -1;
 }
 
+void CNode::set_inputs(std::vector<AnfNodePtr> &&inputs) {
+  inputs_ = std::move(inputs);
+  input_tensor_num_ = -1;
+}
+
 const AnfNodePtr &CNode::input(size_t i) const {
   if (i >= inputs_.size()) {
     MS_LOG(EXCEPTION) << "i: " << i << " out of range: " << inputs_.size() << ", cnode: " << DebugString();
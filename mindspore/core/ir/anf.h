@@ -449,6 +449,11 @@ class MS_CORE_API CNode final : public AnfNode, public EffectInfoHolder {
   /// \param[in] inputs Input nodes.
   void set_inputs(const std::vector<AnfNodePtr> &inputs);
 
+  /// \brief Set the input nodes for this CNode by moving the given vector.
+  ///
+  /// \param[in] inputs Input nodes.
+  void set_inputs(std::vector<AnfNodePtr> &&inputs);
+
   // output_value store cnode value and id in pynative mode.
   using OutputValue = std::pair<ValueNodePtr, std::string>;
 
@@ -21,6 +21,7 @@
 #include "utils/trace_base.h"
 #include "ir/manager.h"
 #include "utils/flags.h"
+#include "utils/node_pool_allocator.h"
 #include "utils/ordered_set.h"
 #include "utils/convert_utils_base.h"
 #include "abstract/abstract_function.h"
@@ -166,10 +167,18 @@ ValuePtr FuncGraph::get_attr(const std::string &key) const {
 }
 
 CNodePtr FuncGraph::NewCNode(std::vector<AnfNodePtr> &&inputs) {
+  // Allocating from the node pool packs the cnode and its control block of big graphs together and recycles the
+  // freed blocks, which cuts the global heap traffic of the frontend compilation.
+  if (NodeMemPool::IsEnabled()) {
+    return std::allocate_shared<CNode>(NodePoolAllocator<CNode>(), std::move(inputs), shared_from_base<FuncGraph>());
+  }
   return std::make_shared<CNode>(std::move(inputs), shared_from_base<FuncGraph>());
 }
 
 CNodePtr FuncGraph::NewCNode(const std::vector<AnfNodePtr> &inputs) {
+  if (NodeMemPool::IsEnabled()) {
+    return std::allocate_shared<CNode>(NodePoolAllocator<CNode>(), inputs, shared_from_base<FuncGraph>());
+  }
   return std::make_shared<CNode>(inputs, shared_from_base<FuncGraph>());
 }
 
@@ -23,6 +23,7 @@
 #include "abstract/abstract_function.h"
 #include "utils/convert_utils_base.h"
 #include "utils/log_adapter.h"
+#include "utils/node_pool_allocator.h"
 #include "utils/profile.h"
 #include "utils/ms_context.h"
 #include "ir/graph_utils.h"
@@ -117,7 +118,14 @@ void Cloner::CloneCNode(const AnfNodePtr &node, const FuncGraphPtr &target) {
     debug_info = node->debug_info();
   }
   auto cloned_debug_info = CloneNodeDebugInfo(debug_info, relation_);
-  CNodePtr new_node = std::make_shared<CNode>(std::move(inputs), target, std::move(cloned_debug_info));
+  CNodePtr new_node;
+  // Cloning is the other big producer of cnodes besides FuncGraph::NewCNode, so it uses the node pool as well.
+  if (NodeMemPool::IsEnabled()) {
+    new_node = std::allocate_shared<CNode>(NodePoolAllocator<CNode>(), std::move(inputs), target,
+                                           std::move(cloned_debug_info));
+  } else {
+    new_node = std::make_shared<CNode>(std::move(inputs), target, std::move(cloned_debug_info));
+  }
   new_node->CloneCNodeInfo(old_node);
   ScopePtr scope;
   if (this->update_info() != nullptr && this->update_info()->scope_ != nullptr) {
@@ -734,11 +742,14 @@ void Cloner::LinkEdges() {
     }
     CNodePtr new_node = repl.second->cast<CNodePtr>();
     MS_EXCEPTION_IF_NULL(new_node);
+    // Build the whole input vector at once and move it into the cloned node, instead of growing it input by input.
+    AnfNodePtrList new_inputs;
+    new_inputs.reserve(old_node->size());
     for (auto &input : old_node->inputs()) {
       auto iter = repl_node_.find(input);
-      auto &new_input = (iter == repl_node_.end() ? input : iter->second);
-      new_node->add_input(new_input);
+      (void)new_inputs.emplace_back(iter == repl_node_.end() ? input : iter->second);
     }
+    new_node->set_inputs(std::move(new_inputs));
   }
 }
 
@@ -41,6 +41,25 @@ static size_t DumpSortingCircleList(const std::deque<AnfNodePtr> &todo, const An
   return pos;
 }
 
+// Push one successor of the node on the top of the TopoSort stack, raise an exception on a graph cycle.
+static void PushTopoSortSuccessor(const AnfNodePtr &next, SeenNum seen, std::deque<AnfNodePtr> *todo) {
+  if (next == nullptr || next->extra_seen_ == seen) {
+    return;
+  }
+  if (next->seen_ != seen) {
+    (void)todo->emplace_back(next);
+    return;
+  }
+  auto fg = next->func_graph();
+  if (fg != nullptr && fg->return_node() == next) {
+    return;
+  }
+  // To dump all nodes in a circle.
+  MS_LOG(ERROR) << "Graph cycle exists. Circle is: ";
+  auto circle_len = DumpSortingCircleList(*todo, next, seen);
+  MS_LOG(EXCEPTION) << "Graph cycle exists, size: " << circle_len << ", strike node: " << next->DebugString(2);
+}
+
 std::vector<AnfNodePtr> TopoSort(const AnfNodePtr &root, const SuccFunc &succ, const IncludeFunc &include) {
   constexpr size_t kVecReserve = 64;
   std::vector<AnfNodePtr> res;
@@ -48,6 +67,10 @@ std::vector<AnfNodePtr> TopoSort(const AnfNodePtr &root, const SuccFunc &succ, c
     return res;
   }
   res.reserve(kVecReserve);
+  // The default successor function only walks the inputs of a CNode; inline that walk so sorting a large
+  // graph does not heap-allocate one successor vector per visited node.
+  const auto *succ_fp = succ.target<std::vector<AnfNodePtr> (*)(const AnfNodePtr &)>();
+  const bool succ_is_incoming = (succ_fp != nullptr && *succ_fp == &SuccIncoming);
   auto seen = NewSeenGeneration();
   std::deque<AnfNodePtr> todo;
   (void)todo.emplace_back(root);
@@ -68,22 +91,27 @@ std::vector<AnfNodePtr> TopoSort(const AnfNodePtr &root, const SuccFunc &succ, c
     }
     node->seen_ = seen;
     if (incl == FOLLOW) {
-      for (auto &next : succ(node)) {
-        if (next == nullptr || next->extra_seen_ == seen) {
-          continue;
-        }
-        if (next->seen_ != seen) {
-          (void)todo.emplace_back(std::move(next));
-          continue;
+      auto cnode = succ_is_incoming ? dyn_cast<CNode>(node) : nullptr;
+      if (cnode != nullptr) {
+        // Keep the push order of FetchCNodeSuccessors: the inputs from right to left in default, so the
+        // sort visits them from left to right, unless kAttrTopoSortRhsFirst is set.
+        auto &inputs = cnode->inputs();
+        auto attr_sort_rhs_first = cnode->GetAttr(kAttrTopoSortRhsFirst);
+        auto sort_rhs_first =
+          attr_sort_rhs_first != nullptr && attr_sort_rhs_first->isa<BoolImm>() && GetValue<bool>(attr_sort_rhs_first);
+        if (sort_rhs_first) {
+          for (auto iter = inputs.cbegin(); iter != inputs.cend(); ++iter) {
+            PushTopoSortSuccessor(*iter, seen, &todo);
+          }
+        } else {
+          for (auto iter = inputs.crbegin(); iter != inputs.crend(); ++iter) {
+            PushTopoSortSuccessor(*iter, seen, &todo);
+          }
         }
-        auto fg = next->func_graph();
-        if (fg != nullptr && fg->return_node() == next) {
-          continue;
+      } else if (!succ_is_incoming) {
+        for (auto &next : succ(node)) {
+          PushTopoSortSuccessor(next, seen, &todo);
         }
-        // To dump all nodes in a circle.
-        MS_LOG(ERROR) << "Graph cycle exists. Circle is: ";
-        auto circle_len = DumpSortingCircleList(todo, next, seen);
-        MS_LOG(EXCEPTION) << "Graph cycle exists, size: " << circle_len << ", strike node: " << next->DebugString(2);
       }
     } else if (incl > EXCLUDE) {  // Not NOFOLLOW or EXCLUDE
       MS_LOG(EXCEPTION) << "The result of include(node) must be one of: \"follow\", \"nofollow\", \"exclude\"";
@@ -704,7 +704,7 @@ void FuncGraphManager::OnEdgeAdded(const AnfNodePtr &node, int index, const AnfN
       auto used = GetValueNode<FuncGraphPtr>(input);
       used->AddFuncGraphCNodeIndex(std::make_shared<CNodeIndexPair>(std::make_pair(node, index)));
       if (fg->AddFuncGraphUsed(used)) {
-        signals_->InvalidateComputer();
+        signals_->InvalidateComputerFg(fg);
       }
     }
     if (IsPrimitiveCNode(node, prim::kPrimJ) || IsPrimitiveCNode(node, prim::kPrimVmap) ||
@@ -713,7 +713,7 @@ void FuncGraphManager::OnEdgeAdded(const AnfNodePtr &node, int index, const AnfN
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->AddFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      signals_->InvalidateComputerFg(fg);
     }
   }
 }
@@ -726,7 +726,7 @@ void FuncGraphManager::OnEdgeRemoved(const AnfNodePtr &node, int index, const An
       auto used = GetValueNode<FuncGraphPtr>(input);
       used->DropFuncGraphCNodeIndex(std::make_shared<CNodeIndexPair>(std::make_pair(node, index)));
       if (fg->DropFuncGraphUsed(used)) {
-        signals_->InvalidateComputer();
+        signals_->InvalidateComputerFg(fg);
       }
     }
     if (IsPrimitiveCNode(node, prim::kPrimJ) || IsPrimitiveCNode(node, prim::kPrimVmap) ||
@@ -735,7 +735,7 @@ void FuncGraphManager::OnEdgeRemoved(const AnfNodePtr &node, int index, const An
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->DropFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      signals_->InvalidateComputerFg(fg);
     }
   }
 }
@@ -862,6 +862,7 @@ void FuncGraphTransaction::Commit() { manager_->CommitChanges(std::move(changes_
 DepComputer::DepComputer(const FuncGraphManager *const manager) : manager_(manager) {
   MS_EXCEPTION_IF_NULL(manager_);
   manager_->signals()->InvalidateComputer.connect(this, &DepComputer::OnInvalidateComputer);
+  manager_->signals()->InvalidateComputerFg.connect(this, &DepComputer::OnInvalidateComputerFg);
   validate_ = false;
 }
 
@@ -1047,6 +1048,20 @@ void FuncGraphsUsedTotalComputer::RealRecompute(FuncGraphPtr fg) {
   }
 }
 
+void FuncGraphsUsedTotalComputer::InvalidateFuncGraph(const FuncGraphPtr &fg) {
+  // used_total(g) changes only when the changed func graph is reachable from g, and the cached set is exactly the
+  // reachable closure, so a membership test selects the stale entries without traversing the graphs.
+  for (auto iter = func_graph_used_total_analysis_.begin(); iter != func_graph_used_total_analysis_.end();) {
+    if (iter->first == fg || iter->second.contains(fg)) {
+      (void)func_graphs_validate_.erase(iter->first);
+      iter = func_graph_used_total_analysis_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  validate_ = false;
+}
+
 bool CheckRecursive(const FuncGraphManager *const manager, const FuncGraphPtr &fg) {
   MS_EXCEPTION_IF_NULL(manager);
   std::vector<FuncGraphPtr> todo;
@@ -74,6 +74,9 @@ MS_CORE_API FuncGraphManagerPtr MakeManager(const std::vector<FuncGraphPtr> &fun
 
 struct Signals {
   Signal<void()> InvalidateComputer;
+  // Raised when only the dependency info of one func graph changed, so the computers can invalidate per-subgraph
+  // instead of dropping all cached analysis results.
+  Signal<void(const FuncGraphPtr &)> InvalidateComputerFg;
 };
 
 using CNodeIndexPair = std::pair<AnfNodePtr, int>;
@@ -96,6 +99,8 @@ class DepComputer {
 
   void OnInvalidateComputer() { Reset(); }
 
+  void OnInvalidateComputerFg(const FuncGraphPtr &fg) { InvalidateFuncGraph(fg); }
+
   void Recompute();
 
   void Recompute(const FuncGraphPtr &fg);
@@ -107,6 +112,9 @@ class DepComputer {
  protected:
   // subclass can reset their own member;
   virtual void ExtraReset() {}
+  // Subclass can invalidate only the cached results that may depend on the changed func graph; the default is the
+  // safe full reset.
+  virtual void InvalidateFuncGraph(const FuncGraphPtr &) { Reset(); }
   // subclass do the real compute
   virtual void RealRecompute() {}
   virtual void RealRecompute(FuncGraphPtr) {}
@@ -229,6 +237,10 @@ class FuncGraphsUsedTotalComputer final : public DepComputer {
  protected:
   void ExtraReset() override { func_graph_used_total_analysis_.clear(); }
 
+  // used_total(g) depends exactly on the graphs in {g} + used_total(g), so only the cached entries containing the
+  // changed func graph need recomputing. This keeps a pass touching one subgraph from paying for the whole graph.
+  void InvalidateFuncGraph(const FuncGraphPtr &fg) override;
+
   void RealRecompute(FuncGraphPtr fg) override;
 };
 
@@ -533,6 +533,43 @@ class MS_CORE_API FP64Imm final : public FloatImm {
 using FP64ImmPtr = std::shared_ptr<FP64Imm>;
 IMM_TRAITS(FP64ImmPtr, double)
 
+// Interned instances for the scalar constants that dominate primitive attrs. Attr-heavy graph
+// construction creates millions of these tiny values, and a Value is immutable once created, so the
+// shared instances are safe to hand out instead of heap-allocating a fresh one each time.
+inline ValuePtr MakeValue(bool b) {
+  static const ValuePtr true_value = std::make_shared<BoolImm>(true);
+  static const ValuePtr false_value = std::make_shared<BoolImm>(false);
+  return b ? true_value : false_value;
+}
+
+inline ValuePtr MakeValue(int32_t v) {
+  static const ValuePtr zero_value = std::make_shared<Int32Imm>(0);
+  static const ValuePtr one_value = std::make_shared<Int32Imm>(1);
+  if (v == 0) {
+    return zero_value;
+  }
+  if (v == 1) {
+    return one_value;
+  }
+  return std::make_shared<Int32Imm>(v);
+}
+
+inline ValuePtr MakeValue(int64_t v) {
+  static const ValuePtr zero_value = std::make_shared<Int64Imm>(0);
+  static const ValuePtr one_value = std::make_shared<Int64Imm>(1);
+  static const ValuePtr minus_one_value = std::make_shared<Int64Imm>(-1);
+  if (v == 0) {
+    return zero_value;
+  }
+  if (v == 1) {
+    return one_value;
+  }
+  if (v == -1) {
+    return minus_one_value;
+  }
+  return std::make_shared<Int64Imm>(v);
+}
+
 }  // namespace mindspore
 
 #endif  // MINDSPORE_CORE_IR_SCALAR_H_
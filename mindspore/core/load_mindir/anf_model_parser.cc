@@ -15,7 +15,14 @@
  */
 
 #include "load_mindir/anf_model_parser.h"
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <climits>
+#include <cstring>
 #include <functional>
 #include <map>
 #include <memory>
@@ -41,6 +48,14 @@ using std::string;
 
 namespace mindspore {
 std::map<std::string, tensor::TensorPtr> MSANFModelParser::load_tensor_map_;
+
+ExternalTensorData::~ExternalTensorData() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (mapped_addr_ != nullptr) {
+    (void)munmap(mapped_addr_, size_);
+  }
+#endif
+}
 namespace {
 static constexpr char kConstantValueNode[] = "Constant";
 static constexpr char kDoSignaturePrimitivePrefix[] = "S-Prim-";
@@ -247,6 +262,30 @@ AnfNodePtr NewValueNodeWithAbstract(const T &value) {
 }
 }  // namespace
 
+// Deduplicate payloads below this size are not worth tracking: the buffers are tiny and the dedup maps
+// would fill up with the many scalar constants of a graph.
+constexpr size_t kTensorDedupMinSize = 1024;
+
+tensor::TensorPtr MSANFModelParser::FetchDedupTensor(TypeId data_type, const ShapeVector &shape,
+                                                     const std::string &payload) {
+  if (payload.size() < kTensorDedupMinSize) {
+    return nullptr;
+  }
+  auto iter = raw_data_dedup_map_.find(std::hash<std::string>{}(payload));
+  if (iter == raw_data_dedup_map_.end()) {
+    return nullptr;
+  }
+  for (const auto &cached : iter->second) {
+    MS_EXCEPTION_IF_NULL(cached);
+    if (cached->data_type() == data_type && static_cast<size_t>(cached->data().nbytes()) == payload.size() &&
+        memcmp(cached->data_c(), payload.data(), payload.size()) == 0) {
+      // Share the host buffer of the cached tensor, the new tensor only carries its own meta info.
+      return std::make_shared<tensor::Tensor>(data_type, shape, cached->data_ptr());
+    }
+  }
+  return nullptr;
+}
+
 tensor::TensorPtr MSANFModelParser::GenerateTensorPtrFromTensorProto(const mind_ir::TensorProto &attr_tensor,
                                                                      bool need_load_data) {
   ShapeVector shape;
@@ -254,24 +293,35 @@ tensor::TensorPtr MSANFModelParser::GenerateTensorPtrFromTensorProto(const mind_
   for (int i = 0; i < attr_tensor.dims_size(); ++i) {
     shape.push_back(attr_tensor.dims(i));
   }
-  tensor::TensorPtr tensor = std::make_shared<tensor::Tensor>(kDefaultValueSwitchMap[attr_tensor_type], shape);
-
-  if (!IsIncLoad() || load_tensor_map_.find(attr_tensor.name()) == load_tensor_map_.end()) {
-    load_tensor_map_[attr_tensor.name()] = tensor;
-  }
-
-  MS_EXCEPTION_IF_NULL(tensor);
+  tensor::TensorPtr tensor = nullptr;
   const std::string &tensor_buf = attr_tensor.raw_data();
   if (attr_tensor.has_raw_data()) {
-    auto *tensor_data_buf = reinterpret_cast<uint8_t *>(tensor->data_c());
-    auto ret = memcpy_s(tensor_data_buf, tensor->data().nbytes(), tensor_buf.data(), tensor_buf.size());
-    if (ret != 0) {
+    // An initializer with the same payload as an earlier one (tied embeddings, repeated masks) shares the
+    // host buffer of the earlier tensor instead of materializing another copy.
+    tensor = FetchDedupTensor(kDefaultValueSwitchMap[attr_tensor_type], shape, tensor_buf);
+    if (tensor == nullptr) {
+      tensor = std::make_shared<tensor::Tensor>(kDefaultValueSwitchMap[attr_tensor_type], shape);
+      auto *tensor_data_buf = reinterpret_cast<uint8_t *>(tensor->data_c());
+      auto ret = memcpy_s(tensor_data_buf, tensor->data().nbytes(), tensor_buf.data(), tensor_buf.size());
+      if (ret != 0) {
+        MS_LOG(ERROR) << "Failed to get tensor form tensor proto.";
+        return nullptr;
+      }
+      if (tensor_buf.size() >= kTensorDedupMinSize) {
+        (void)raw_data_dedup_map_[std::hash<std::string>{}(tensor_buf)].emplace_back(tensor);
+      }
+    }
+  } else {
+    tensor = std::make_shared<tensor::Tensor>(kDefaultValueSwitchMap[attr_tensor_type], shape);
+    if (need_load_data) {
       MS_LOG(ERROR) << "Failed to get tensor form tensor proto.";
       return nullptr;
     }
-  } else if (need_load_data) {
-    MS_LOG(ERROR) << "Failed to get tensor form tensor proto.";
-    return nullptr;
+  }
+
+  MS_EXCEPTION_IF_NULL(tensor);
+  if (!IsIncLoad() || load_tensor_map_.find(attr_tensor.name()) == load_tensor_map_.end()) {
+    load_tensor_map_[attr_tensor.name()] = tensor;
   }
   return tensor;
 }
@@ -471,9 +521,22 @@ bool MSANFModelParser::BuildParameterForFuncGraph(const ParameterPtr &node,
   if (parameter_proto.has_raw_data()) {
     node->set_default_param(tensor);
   } else if (parameter_proto.has_external_data()) {
-    auto ret = GetTensorDataFromExternal(parameter_proto, tensor);
-    if (!ret) {
-      return false;
+    // Parameters loading the same external slice (tied embeddings exported once per referencing graph)
+    // share one host buffer instead of each copying the slice into its own.
+    const auto &external_data = parameter_proto.external_data();
+    std::string slice_key = external_data.location() + ":" + std::to_string(external_data.offset()) + ":" +
+                            std::to_string(external_data.length());
+    auto dedup_iter = external_data_dedup_map_.find(slice_key);
+    if (dedup_iter != external_data_dedup_map_.end() &&
+        dedup_iter->second->data().nbytes() == tensor->data().nbytes()) {
+      tensor = std::make_shared<tensor::Tensor>(tensor->data_type(), tensor->shape(), dedup_iter->second->data_ptr());
+      tensor->set_param_info(param_info);
+    } else {
+      auto ret = GetTensorDataFromExternal(parameter_proto, tensor);
+      if (!ret) {
+        return false;
+      }
+      external_data_dedup_map_[slice_key] = tensor;
     }
     node->set_default_param(tensor);
   } else {
@@ -493,9 +556,11 @@ bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &ten
   const unsigned char *data = nullptr;
   auto it = tenor_data_.find(tensor_proto.external_data().location());
   if (it != tenor_data_.end()) {
-    data = it->second.get();
+    data = it->second->data();
   } else {
     std::string file = mindir_path_ + "/" + tensor_proto.external_data().location();
+    constexpr Byte is_little_endian = 1;
+    constexpr int byte_order_index = 0;
     if (mindir_dec_key_ != nullptr) {
       size_t plain_len;
       auto plain_data = Decrypt(&plain_len, file, mindir_dec_key_, mindir_key_size_, mindir_dec_mode_);
@@ -504,8 +569,39 @@ bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &ten
         return false;
       }
       data = plain_data.get();
-      tenor_data_.emplace(tensor_proto.external_data().location(), std::move(plain_data));
+      tenor_data_.emplace(tensor_proto.external_data().location(),
+                          std::make_unique<ExternalTensorData>(std::move(plain_data), plain_len));
     } else {
+#if !defined(_WIN32) && !defined(_WIN64)
+      // Map the weight file read only instead of copying it into memory: the pages are loaded on first access and
+      // can be reclaimed under memory pressure, so the peak RSS stays near the working set of the weights.
+      int fd = open(file.c_str(), O_RDONLY);
+      if (fd < 0) {
+        MS_LOG(EXCEPTION) << "Open file '" << file << "' failed, please check the correct of the file.";
+      }
+      struct stat file_stat {};
+      if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+        (void)close(fd);
+        MS_LOG(ERROR) << "Stat file '" << file << "' failed.";
+        return false;
+      }
+      size_t file_size = static_cast<size_t>(file_stat.st_size);
+      void *mapped_addr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      (void)close(fd);
+      if (mapped_addr == MAP_FAILED) {
+        MS_LOG(ERROR) << "Mmap file '" << file << "' failed.";
+        return false;
+      }
+      // if byte order is not same return false
+      if ((static_cast<const Byte *>(mapped_addr)[byte_order_index] == is_little_endian) != little_endian()) {
+        (void)munmap(mapped_addr, file_size);
+        MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
+        return false;
+      }
+      data = static_cast<const unsigned char *>(mapped_addr);
+      tenor_data_.emplace(tensor_proto.external_data().location(),
+                          std::make_unique<ExternalTensorData>(mapped_addr, file_size));
+#else
       // Read file
       std::basic_ifstream<char> fid(file, std::ios::in | std::ios::binary);
       if (!fid) {
@@ -516,8 +612,6 @@ bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &ten
       fid.clear();
       fid.seekg(0);
       auto plain_data = std::make_unique<char[]>(file_size);
-      constexpr Byte is_little_endian = 1;
-      constexpr int byte_order_index = 0;
       fid.read(plain_data.get(), file_size);
       fid.close();
       // if byte order is not same return false
@@ -527,7 +621,9 @@ bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &ten
       }
       data = reinterpret_cast<const unsigned char *>(plain_data.get());
       tenor_data_.emplace(tensor_proto.external_data().location(),
-                          std::unique_ptr<Byte[]>(reinterpret_cast<Byte *>(plain_data.release())));
+                          std::make_unique<ExternalTensorData>(
+                            std::unique_ptr<Byte[]>(reinterpret_cast<Byte *>(plain_data.release())), file_size));
+#endif
     }
   }
   auto *tensor_data_buf = reinterpret_cast<uint8_t *>(tensor_info->data_c());
@@ -62,6 +62,23 @@ class Layout {
 using LayoutPtr = std::shared_ptr<Layout>;
 using LayoutMap = std::map<string, LayoutPtr>;
 
+// Holds the payload of one external weight file: either a heap buffer (used for decrypted files and on platforms
+// without mmap) or a read-only file mapping, so large weight files are paged in on demand instead of being read
+// into memory as a whole.
+class ExternalTensorData {
+ public:
+  ExternalTensorData(std::unique_ptr<Byte[]> buffer, size_t size) : buffer_(std::move(buffer)), size_(size) {}
+  ExternalTensorData(void *mapped_addr, size_t size) : mapped_addr_(mapped_addr), size_(size) {}
+  ~ExternalTensorData();
+  const Byte *data() const { return buffer_ != nullptr ? buffer_.get() : static_cast<const Byte *>(mapped_addr_); }
+  size_t size() const { return size_; }
+
+ private:
+  std::unique_ptr<Byte[]> buffer_;
+  void *mapped_addr_{nullptr};
+  size_t size_{0};
+};
+
 class MSANFModelParser {
  public:
   MSANFModelParser() : producer_name_(""), model_version_(""), ir_version_("") {}
@@ -128,6 +145,7 @@ class MSANFModelParser {
   AnfNodePtr GetAnfNode(const std::string &node_name);
   tensor::TensorPtr GenerateTensorPtrFromTensorProto(const mind_ir::TensorProto &attr_tensor,
                                                      bool need_load_data = true);
+  tensor::TensorPtr FetchDedupTensor(TypeId data_type, const ShapeVector &shape, const std::string &payload);
 
   FuncGraphPtr top_graph_ = nullptr;
   std::string producer_name_;
@@ -142,7 +160,12 @@ class MSANFModelParser {
   size_t mindir_key_size_;
   std::string mindir_dec_mode_;
   bool little_endian_ = common::IsLittleByteOrder();
-  std::map<std::string, std::unique_ptr<Byte[]>> tenor_data_;
+  std::map<std::string, std::unique_ptr<ExternalTensorData>> tenor_data_;
+  // Initializers with identical payloads (tied embeddings, repeated masks) share one host buffer instead of
+  // each materializing its own copy. The raw data map is keyed by the content hash of the payload, the
+  // external map by the file slice (location:offset:length), see FetchDedupTensor.
+  std::map<size_t, std::vector<tensor::TensorPtr>> raw_data_dedup_map_;
+  std::map<std::string, tensor::TensorPtr> external_data_dedup_map_;
   static std::map<std::string, tensor::TensorPtr> load_tensor_map_;
 };
 }  // namespace mindspore
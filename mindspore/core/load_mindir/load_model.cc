@@ -277,10 +277,13 @@ FuncGraphPtr MindIRLoader::LoadMindIR(const std::string &file_name) {
       }
       for (int param_index = 0; param_index < param_graph.parameter_size(); param_index++) {
         mind_ir::TensorProto *param_proto = mod_graph->add_parameter();
-        param_proto->set_name(param_graph.parameter(param_index).name());
-        param_proto->set_data_type(param_graph.parameter(param_index).data_type());
-        param_proto->set_raw_data(param_graph.parameter(param_index).raw_data());
-        for (const auto &dim : param_graph.parameter(param_index).dims()) {
+        mind_ir::TensorProto *load_proto = param_graph.mutable_parameter(param_index);
+        param_proto->set_name(load_proto->name());
+        param_proto->set_data_type(load_proto->data_type());
+        // The raw data is the weight payload and can be huge, so it is moved rather than copied to keep the peak
+        // memory of loading near one copy of the weights.
+        param_proto->mutable_raw_data()->swap(*load_proto->mutable_raw_data());
+        for (const auto &dim : load_proto->dims()) {
           param_proto->add_dims(dim);
         }
       }
@@ -347,9 +350,8 @@ std::shared_ptr<std::vector<char>> ReadProtoFile(const std::string &file) {
 
 FuncGraphPtr ConvertStreamToFuncGraph(const char *buf, const size_t buf_size, bool is_lite) {
   MS_EXCEPTION_IF_NULL(buf);
-  std::string str(buf, buf_size);
   mind_ir::ModelProto model_;
-  if (!model_.ParseFromString(str)) {
+  if (!model_.ParseFromArray(buf, SizeToInt(buf_size))) {
     MS_LOG(ERROR) << "Parse model from buffer fail!";
   }
   MSANFModelParser model_parser;
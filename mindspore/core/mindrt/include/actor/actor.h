@@ -80,6 +80,11 @@ class MS_CORE_API ActorBase {
 
   void set_thread_pool(ActorThreadPool *pool) { pool_ = pool; }
 
+  // The dispatch priority of the actor. The thread pool pops the actors with priority above 0
+  // before the ordinary ones, the default 0 keeps the plain FIFO order.
+  inline void set_dispatch_priority(int32_t priority) { dispatch_priority_ = priority; }
+  inline int32_t dispatch_priority() const { return dispatch_priority_; }
+
   // Judge if actor running by the received message number, the default is true.
   virtual bool IsActive(int msg_num) { return true; }
 
@@ -215,6 +220,7 @@ class MS_CORE_API ActorBase {
 
   ActorThreadPool *pool_{nullptr};
   std::shared_ptr<ActorMgr> actor_mgr_;
+  int32_t dispatch_priority_{0};
 };
 using ActorReference = std::shared_ptr<ActorBase>;
 };  // namespace mindspore
@@ -28,6 +28,8 @@ constexpr int ACTOR_PARAMER_ERR = -101;
 constexpr int ACTOR_NOT_FIND = -102;
 constexpr int IO_NOT_FIND = -103;
 constexpr int ACTOR_TERMINATED = -104;
+// The message was accepted but the data lane of the mailbox is over its watermark, the sender should throttle.
+constexpr int ACTOR_MAILBOX_FULL = -105;
 
 // TCP module err code -301 ~ -400
 // Null
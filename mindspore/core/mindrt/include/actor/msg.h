@@ -36,6 +36,14 @@ class MessageBase {
     KTERMINATE,
   };
 
+  // The mailbox lane of the message. Lower lanes are drained first, so the latency-critical control and
+  // memory messages are not stuck behind bulk data traffic.
+  enum class Priority : char {
+    KCONTROL = 0,
+    KMEMORY,
+    KDATA,
+  };
+
   explicit MessageBase(Type eType = Type::KMSG) : from(), name(), data(nullptr), size(0), type(eType) {}
 
   explicit MessageBase(const std::string &sName, Type eType = Type::KMSG)
@@ -71,6 +79,10 @@ class MessageBase {
 
   inline void SetType(Type eType) { type = eType; }
 
+  inline Priority GetPriority() const { return priority; }
+
+  inline void SetPriority(Priority ePriority) { priority = ePriority; }
+
   virtual void Run(ActorBase *actor) {}
 
   friend class ActorBase;
@@ -85,6 +97,7 @@ class MessageBase {
   size_t size;
 
   Type type;
+  Priority priority = Priority::KDATA;
 };
 }  // namespace mindspore
 
@@ -21,6 +21,7 @@
 #include <set>
 #include <utility>
 #include <map>
+#include <unordered_map>
 #include <memory>
 #include <string>
 #ifndef MS_COMPILE_IOS
@@ -86,8 +87,9 @@ class MS_CORE_API ActorMgr {
   // or running on other thread pool created independently externally
   ActorThreadPool *inner_pool_{nullptr};
 
-  // Map of all local spawned and running processes.
-  std::map<std::string, ActorReference> actors;
+  // Map of all local spawned and running processes. Looked up by name on every message emit, so use a hash
+  // map rather than an ordered one to avoid O(log n) string comparisons on the hot path.
+  std::unordered_map<std::string, ActorReference> actors;
 #ifndef MS_COMPILE_IOS
   std::shared_mutex actorsMutex;
 #else
@@ -14,56 +14,88 @@
  * limitations under the License.
  */
 #include "actor/mailbox.h"
+#include <algorithm>
+#include <iterator>
+#include "actor/errcode.h"
 
 namespace mindspore {
+size_t MailBox::LaneOf(const MessageBase &msg) {
+  if (msg.GetType() == MessageBase::Type::KTERMINATE || msg.GetType() == MessageBase::Type::KEXIT) {
+    return static_cast<size_t>(MessageBase::Priority::KCONTROL);
+  }
+  return static_cast<size_t>(msg.GetPriority());
+}
+
 int BlockingMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
+  int ret = MINDRT_OK;
+  const size_t lane = LaneOf(*msg);
   {
     std::unique_lock<std::mutex> ulk(lock);
-    (void)enqueMailBox->emplace_back(std::move(msg));
+    (void)enqueLanes[lane].emplace_back(std::move(msg));
+    if (lane == static_cast<size_t>(MessageBase::Priority::KDATA) && enqueLanes[lane].size() > DATA_LANE_WATERMARK) {
+      ret = ACTOR_MAILBOX_FULL;
+    }
   }
 
   cond.notify_all();
-  return 0;
+  return ret;
 }
 
 std::list<std::unique_ptr<MessageBase>> *BlockingMailBox::GetMsgs() {
   std::list<std::unique_ptr<MessageBase>> *ret;
   {
     std::unique_lock<std::mutex> ulk(lock);
-    while (enqueMailBox->empty()) {
-      cond.wait(ulk, [this] { return !this->enqueMailBox->empty(); });
+    auto hasMsg = [this] {
+      return std::any_of(std::begin(this->enqueLanes), std::end(this->enqueLanes),
+                         [](const std::list<std::unique_ptr<MessageBase>> &lane) { return !lane.empty(); });
+    };
+    while (!hasMsg()) {
+      cond.wait(ulk, hasMsg);
     }
-    enqueMailBox->swap(*dequeMailBox);
-    ret = dequeMailBox;
+    // Drain the lanes by priority so control and memory messages are handled before the data backlog.
+    for (auto &lane : enqueLanes) {
+      dequeMailBox.splice(dequeMailBox.end(), lane);
+    }
+    ret = &dequeMailBox;
   }
   return ret;
 }
 
 int NonblockingMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
+  int ret = MINDRT_OK;
   bool empty = false;
   bool released = false;
+  const size_t lane = LaneOf(*msg);
   {
     std::unique_lock<std::mutex> ulk(lock);
-    empty = enqueMailBox->empty();
-    (void)enqueMailBox->emplace_back(std::move(msg));
+    empty = std::all_of(std::begin(enqueLanes), std::end(enqueLanes),
+                        [](const std::list<std::unique_ptr<MessageBase>> &l) { return l.empty(); });
+    (void)enqueLanes[lane].emplace_back(std::move(msg));
+    if (lane == static_cast<size_t>(MessageBase::Priority::KDATA) && enqueLanes[lane].size() > DATA_LANE_WATERMARK) {
+      ret = ACTOR_MAILBOX_FULL;
+    }
     released = this->released_;
   }
   if (empty && released && notifyHook) {
     (*notifyHook.get())();
   }
-  return 0;
+  return ret;
 }
 
 std::list<std::unique_ptr<MessageBase>> *NonblockingMailBox::GetMsgs() {
   std::list<std::unique_ptr<MessageBase>> *ret;
   {
     std::unique_lock<std::mutex> ulk(lock);
-    if (enqueMailBox->empty()) {
+    if (std::all_of(std::begin(enqueLanes), std::end(enqueLanes),
+                    [](const std::list<std::unique_ptr<MessageBase>> &l) { return l.empty(); })) {
       released_ = true;
       return nullptr;
     }
-    dequeMailBox->swap(*enqueMailBox);
-    ret = dequeMailBox;
+    // Drain the lanes by priority so control and memory messages are handled before the data backlog.
+    for (auto &lane : enqueLanes) {
+      dequeMailBox.splice(dequeMailBox.end(), lane);
+    }
+    ret = &dequeMailBox;
     released_ = false;
   }
 
@@ -36,6 +36,15 @@ class MailBox {
   inline bool TakeAllMsgsEachTime() { return takeAllMsgsEachTime; }
 
  protected:
+  // The number of priority lanes, one per MessageBase::Priority value.
+  static const size_t LANE_NUM = 3;
+  // When the data lane holds more messages than the watermark, EnqueueMessage still accepts the message but
+  // returns ACTOR_MAILBOX_FULL so the sender can throttle.
+  static const size_t DATA_LANE_WATERMARK = 4096;
+  // The lane a message goes to. Terminate/exit messages always take the control lane no matter which
+  // priority the sender set.
+  static size_t LaneOf(const MessageBase &msg);
+
   // if this flag is true, GetMsgs() should be invoked to take all enqueued msgs each time, otherwise we can only get
   // one msg by GetMsg() each time.
   bool takeAllMsgsEachTime = true;
@@ -44,40 +53,40 @@ class MailBox {
 
 class BlockingMailBox : public MailBox {
  public:
-  BlockingMailBox() : mailbox1(), mailbox2(), enqueMailBox(&mailbox1), dequeMailBox(&mailbox2) {}
+  BlockingMailBox() : enqueLanes(), dequeMailBox() {}
   virtual ~BlockingMailBox() {
-    mailbox1.clear();
-    mailbox2.clear();
+    for (auto &lane : enqueLanes) {
+      lane.clear();
+    }
+    dequeMailBox.clear();
   }
   int EnqueueMessage(std::unique_ptr<MessageBase> msg) override;
   std::list<std::unique_ptr<MessageBase>> *GetMsgs() override;
   std::unique_ptr<MessageBase> GetMsg() override { return nullptr; }
 
  private:
-  std::list<std::unique_ptr<MessageBase>> mailbox1;
-  std::list<std::unique_ptr<MessageBase>> mailbox2;
-  std::list<std::unique_ptr<MessageBase>> *enqueMailBox;
-  std::list<std::unique_ptr<MessageBase>> *dequeMailBox;
+  std::list<std::unique_ptr<MessageBase>> enqueLanes[LANE_NUM];
+  std::list<std::unique_ptr<MessageBase>> dequeMailBox;
   std::mutex lock;
   std::condition_variable cond;
 };
 
 class NonblockingMailBox : public MailBox {
  public:
-  NonblockingMailBox() : mailbox1(), mailbox2(), enqueMailBox(&mailbox1), dequeMailBox(&mailbox2) {}
+  NonblockingMailBox() : enqueLanes(), dequeMailBox() {}
   virtual ~NonblockingMailBox() {
-    mailbox1.clear();
-    mailbox2.clear();
+    for (auto &lane : enqueLanes) {
+      lane.clear();
+    }
+    dequeMailBox.clear();
   }
   int EnqueueMessage(std::unique_ptr<MessageBase> msg) override;
   std::list<std::unique_ptr<MessageBase>> *GetMsgs() override;
   std::unique_ptr<MessageBase> GetMsg() override { return nullptr; }
 
  private:
-  std::list<std::unique_ptr<MessageBase>> mailbox1;
-  std::list<std::unique_ptr<MessageBase>> mailbox2;
-  std::list<std::unique_ptr<MessageBase>> *enqueMailBox;
-  std::list<std::unique_ptr<MessageBase>> *dequeMailBox;
+  std::list<std::unique_ptr<MessageBase>> enqueLanes[LANE_NUM];
+  std::list<std::unique_ptr<MessageBase>> dequeMailBox;
   std::mutex lock;
   bool released_ = true;
 };
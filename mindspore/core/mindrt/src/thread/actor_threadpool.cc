@@ -19,6 +19,7 @@
 #endif
 #include "thread/actor_threadpool.h"
 #include "thread/core_affinity.h"
+#include "thread/thread_budget.h"
 
 namespace mindspore {
 void ActorWorker::CreateThread() { thread_ = std::thread(&ActorWorker::RunWithSpin, this); }
@@ -52,7 +53,7 @@ bool ActorWorker::RunQueueActorTask() {
   if (pool_ == nullptr) {
     return false;
   }
-  auto actor = reinterpret_cast<ActorThreadPool *>(pool_)->PopActorFromQueue();
+  auto actor = reinterpret_cast<ActorThreadPool *>(pool_)->PopActorForWorker(worker_id_);
   if (actor == nullptr) {
     return false;
   }
@@ -81,10 +82,13 @@ ActorThreadPool::~ActorThreadPool() {
   do {
     {
 #ifdef USE_HQUEUE
-      terminate = actor_queue_.Empty();
+      terminate = actor_queue_.Empty() && high_priority_actor_queue_.Empty();
+      for (auto &worker_queue : worker_actor_queues_) {
+        terminate = terminate && worker_queue->Empty();
+      }
 #else
       std::lock_guard<std::mutex> _l(actor_mutex_);
-      terminate = actor_queue_.empty();
+      terminate = actor_queue_.empty() && high_priority_actor_queue_.empty();
 #endif
     }
     if (!terminate) {
@@ -101,14 +105,29 @@ ActorThreadPool::~ActorThreadPool() {
   workers_.clear();
 #ifdef USE_HQUEUE
   actor_queue_.Clean();
+  high_priority_actor_queue_.Clean();
+  for (auto &worker_queue : worker_actor_queues_) {
+    worker_queue->Clean();
+  }
+  worker_actor_queues_.clear();
 #endif
 }
 
 ActorBase *ActorThreadPool::PopActorFromQueue() {
 #ifdef USE_HQUEUE
+  // The critical path actors always leave first.
+  auto actor = high_priority_actor_queue_.Dequeue();
+  if (actor != nullptr) {
+    return actor;
+  }
   return actor_queue_.Dequeue();
 #else
   std::lock_guard<std::mutex> _l(actor_mutex_);
+  if (!high_priority_actor_queue_.empty()) {
+    auto actor = high_priority_actor_queue_.front();
+    high_priority_actor_queue_.pop();
+    return actor;
+  }
   if (actor_queue_.empty()) {
     return nullptr;
   }
@@ -118,17 +137,80 @@ ActorBase *ActorThreadPool::PopActorFromQueue() {
 #endif
 }
 
+ActorBase *ActorThreadPool::PopActorForWorker(size_t worker_id) {
+#ifdef USE_HQUEUE
+  if (enable_work_steal_ && worker_id < worker_actor_queues_.size()) {
+    // The critical path actors win over the worker's own queue.
+    auto high_priority_actor = high_priority_actor_queue_.Dequeue();
+    if (high_priority_actor != nullptr) {
+      return high_priority_actor;
+    }
+    // The worker's own queue first.
+    auto actor = worker_actor_queues_[worker_id]->Dequeue();
+    if (actor != nullptr) {
+      return actor;
+    }
+    // Steal from the sibling workers to keep all cores busy when the load is unbalanced.
+    for (size_t i = 1; i < worker_actor_queues_.size(); ++i) {
+      auto steal_id = (worker_id + i) % worker_actor_queues_.size();
+      actor = worker_actor_queues_[steal_id]->Dequeue();
+      if (actor != nullptr) {
+        return actor;
+      }
+    }
+  }
+#endif
+  return PopActorFromQueue();
+}
+
 void ActorThreadPool::PushActorToQueue(ActorBase *actor) {
   if (!actor) {
     return;
   }
+#ifdef USE_HQUEUE
+  if (actor->dispatch_priority() > 0) {
+    // The critical path actors bypass the round robin so that any free worker picks them up
+    // before the ordinary backlog.
+    while (!high_priority_actor_queue_.Enqueue(actor)) {
+    }
+    THREAD_DEBUG("actor[%s] enqueue high priority queue success", actor->GetAID().Name().c_str());
+    for (size_t i = 0; i < actor_thread_num_; ++i) {
+      if (reinterpret_cast<ActorWorker *>(workers_[i])->ActorActive()) {
+        break;
+      }
+    }
+    return;
+  }
+  if (enable_work_steal_ && !worker_actor_queues_.empty()) {
+    // Distribute the actors to the per-worker queues in round robin to avoid the shared queue contention, and fall
+    // back to the shared queue when the target queue is full.
+    auto queue_id = next_actor_queue_.fetch_add(1, std::memory_order_relaxed) % worker_actor_queues_.size();
+    if (worker_actor_queues_[queue_id]->Enqueue(actor)) {
+      THREAD_DEBUG("actor[%s] enqueue worker queue %zu success", actor->GetAID().Name().c_str(), queue_id);
+      // Active the target worker first, then one idle sibling for stealing.
+      auto worker = reinterpret_cast<ActorWorker *>(workers_[queue_id]);
+      if (!worker->ActorActive()) {
+        for (size_t i = 0; i < actor_thread_num_; ++i) {
+          if (reinterpret_cast<ActorWorker *>(workers_[i])->ActorActive()) {
+            break;
+          }
+        }
+      }
+      return;
+    }
+  }
+#endif
   {
 #ifdef USE_HQUEUE
     while (!actor_queue_.Enqueue(actor)) {
     }
 #else
     std::lock_guard<std::mutex> _l(actor_mutex_);
-    actor_queue_.push(actor);
+    if (actor->dispatch_priority() > 0) {
+      high_priority_actor_queue_.push(actor);
+    } else {
+      actor_queue_.push(actor);
+    }
 #endif
   }
   THREAD_DEBUG("actor[%s] enqueue success", actor->GetAID().Name().c_str());
@@ -147,6 +229,29 @@ int ActorThreadPool::ActorQueueInit() {
     THREAD_ERROR("init actor queue failed.");
     return THREAD_ERROR;
   }
+  if (high_priority_actor_queue_.Init(kMaxHqueueSize) != true) {
+    THREAD_ERROR("init high priority actor queue failed.");
+    return THREAD_ERROR;
+  }
+#endif
+  return THREAD_OK;
+}
+
+int ActorThreadPool::WorkerActorQueueInit(size_t actor_thread_num) {
+#ifdef USE_HQUEUE
+  if (actor_thread_num <= 1) {
+    // The work stealing is meaningless for the single actor thread.
+    return THREAD_OK;
+  }
+  for (size_t i = 0; i < actor_thread_num; ++i) {
+    auto worker_queue = std::make_unique<HQueue<ActorBase>>();
+    if (worker_queue == nullptr || worker_queue->Init(kMaxHqueueSize) != true) {
+      THREAD_ERROR("init worker actor queue failed.");
+      return THREAD_ERROR;
+    }
+    (void)worker_actor_queues_.emplace_back(std::move(worker_queue));
+  }
+  enable_work_steal_ = true;
 #endif
   return THREAD_OK;
 }
@@ -156,6 +261,11 @@ int ActorThreadPool::CreateThreads(size_t actor_thread_num, size_t all_thread_nu
     THREAD_ERROR("thread num is invalid");
     return THREAD_ERROR;
   }
+  // Draw the thread num from the process-wide budget so concurrently living pools do not
+  // oversubscribe the machine together. The actor threads are always guaranteed because the
+  // actor queues are sized by them below.
+  all_thread_num = ThreadBudget::GetInstance().Acquire(kThreadBudgetMindRT, all_thread_num, actor_thread_num);
+  budget_acquired_ = all_thread_num;
   if (ActorQueueInit() != THREAD_OK) {
     return THREAD_ERROR;
   }
@@ -165,6 +275,9 @@ int ActorThreadPool::CreateThreads(size_t actor_thread_num, size_t all_thread_nu
   size_t core_num = std::thread::hardware_concurrency();
   THREAD_INFO("ThreadInfo, Actor: [%zu], All: [%zu], CoreNum: [%zu]", actor_thread_num, all_thread_num, core_num);
   actor_thread_num_ = actor_thread_num < core_num ? actor_thread_num : core_num;
+  if (WorkerActorQueueInit(actor_thread_num_) != THREAD_OK) {
+    return THREAD_ERROR;
+  }
   core_num -= actor_thread_num_;
   size_t kernel_thread_num =
     (all_thread_num - actor_thread_num_) < core_num ? (all_thread_num - actor_thread_num_) : core_num;
@@ -19,6 +19,7 @@
 
 #include <queue>
 #include <vector>
+#include <memory>
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
@@ -60,17 +61,33 @@ class ActorThreadPool : public ThreadPool {
   virtual int ActorQueueInit();
   virtual void PushActorToQueue(ActorBase *actor);
   virtual ActorBase *PopActorFromQueue();
+  // Pop an actor for the specified worker in the work stealing mode: the worker's own queue first, then steal from
+  // the sibling workers, and finally fall back to the shared queue.
+  ActorBase *PopActorForWorker(size_t worker_id);
 
  protected:
   ActorThreadPool() = default;
 
+  // Init the per-worker actor queues to avoid all workers contending on the single shared queue, the shared queue is
+  // kept as the fallback when a per-worker queue is full.
+  int WorkerActorQueueInit(size_t actor_thread_num);
+
   std::mutex actor_mutex_;
   std::condition_variable actor_cond_;
 #ifdef USE_HQUEUE
   HQueue<ActorBase> actor_queue_;
+  // Actors with a dispatch priority above 0 (the critical path kernels marked by the scheduler)
+  // go through this queue, which every pop checks before the ordinary queues.
+  HQueue<ActorBase> high_priority_actor_queue_;
+  // The per-worker actor queues for the work stealing mode. HQueue is multi producer/consumer safe, so the stealing
+  // needs no extra synchronization.
+  std::vector<std::unique_ptr<HQueue<ActorBase>>> worker_actor_queues_;
 #else
   std::queue<ActorBase *> actor_queue_;
+  std::queue<ActorBase *> high_priority_actor_queue_;
 #endif
+  bool enable_work_steal_{false};
+  std::atomic<size_t> next_actor_queue_{0};
 
  private:
   int CreateThreads(size_t actor_thread_num, size_t all_thread_num, const std::vector<int> &core_list);
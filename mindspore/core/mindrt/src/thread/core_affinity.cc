@@ -62,6 +62,8 @@ enum Arch {
 typedef struct {
   int core_id;
   int max_freq;
+  // The physical core the logical CPU belongs to, SMT siblings share one physical id.
+  int physical_id;
   enum Arch arch;
 } CpuInfo;
 
@@ -215,6 +217,32 @@ int GetMaxFrequency(int core_id) {
   return max_freq;
 }
 
+int ReadCpuTopologyValue(int core_id, const std::string &file_name) {
+  std::string file = "/sys/devices/system/cpu/cpu" + std::to_string(core_id) + "/topology/" + file_name;
+  FILE *fp = fopen(file.c_str(), "rb");
+  if (fp == nullptr) {
+    return -1;
+  }
+  int value = -1;
+  if (fscanf(fp, "%d", &value) != 1) {
+    value = -1;
+  }
+  (void)fclose(fp);
+  return value;
+}
+
+int GetPhysicalCoreId(int core_id) {
+  // The physical core id repeats across packages, so fold the package id in. Platforms without the sysfs
+  // topology nodes fall back to the logical id, which makes every logical CPU its own physical core.
+  static const int max_cores_per_package = 1024;
+  int physical_id = ReadCpuTopologyValue(core_id, "core_id");
+  if (physical_id < 0) {
+    return core_id;
+  }
+  int package_id = ReadCpuTopologyValue(core_id, "physical_package_id");
+  return (package_id < 0 ? 0 : package_id) * max_cores_per_package + physical_id;
+}
+
 float CoreAffinity::GetServerFrequency() {
   float max_freq = -1.0f;
 #ifdef SERVER_INFERENCE
@@ -274,6 +302,7 @@ int CoreAffinity::InitHardwareCoreInfo() {
     core_freq_[i] = max_freq;
     freq_set[i].core_id = i;
     freq_set[i].max_freq = max_freq;
+    freq_set[i].physical_id = GetPhysicalCoreId(i);
     freq_set[i].arch = UnKnown_Arch;
   }
   int err_code = SetArch(&freq_set, core_num_);
@@ -291,6 +320,35 @@ int CoreAffinity::InitHardwareCoreInfo() {
       }
     }
   }
+  // Within each frequency class, place one logical CPU per physical core first, so the binding fills the
+  // distinct physical cores of the class before falling back to their SMT siblings. Hosts without SMT keep
+  // the pure frequency order since every logical CPU has its own physical id.
+  for (size_t begin = 0; begin < core_num_;) {
+    size_t end = begin + 1;
+    while (end < core_num_ && freq_set[end].max_freq == freq_set[begin].max_freq) {
+      ++end;
+    }
+    std::vector<CpuInfo> primaries;
+    std::vector<CpuInfo> siblings;
+    std::vector<int> seen_physical_ids;
+    for (size_t i = begin; i < end; ++i) {
+      if (std::find(seen_physical_ids.begin(), seen_physical_ids.end(), freq_set[i].physical_id) ==
+          seen_physical_ids.end()) {
+        seen_physical_ids.push_back(freq_set[i].physical_id);
+        primaries.push_back(freq_set[i]);
+      } else {
+        siblings.push_back(freq_set[i]);
+      }
+    }
+    size_t pos = begin;
+    for (const auto &info : primaries) {
+      freq_set[pos++] = info;
+    }
+    for (const auto &info : siblings) {
+      freq_set[pos++] = info;
+    }
+    begin = end;
+  }
   higher_num_ = 0;
   sorted_id_.clear();
   int max_freq = freq_set.front().max_freq;
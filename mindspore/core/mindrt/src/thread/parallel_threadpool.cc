@@ -17,11 +17,15 @@
 #include <sched.h>
 #include <unistd.h>
 #endif
+#include <cstdint>
 #include "thread/parallel_threadpool.h"
 #include "thread/core_affinity.h"
+#include "thread/thread_budget.h"
 
 namespace mindspore {
 constexpr int kActorParallelThreshold = 5;
+// Drop the low pointer bits when hashing the kernel content to its base worker, one cache line.
+constexpr int kContentHashShift = 6;
 std::mutex ParallelThreadPool::create_thread_pool_muntex_;
 
 void ParallelWorker::CreateThread() { thread_ = std::thread(&ParallelWorker::Run, this); }
@@ -58,7 +62,7 @@ void ParallelWorker::WaitUntilActive() {
   }
 }
 
-bool ParallelWorker::RunLocalKernelTask() { return parallel_pool_->RunParallel(); }
+bool ParallelWorker::RunLocalKernelTask() { return parallel_pool_->RunParallel(static_cast<int>(worker_id_)); }
 
 bool ParallelWorker::RunQueueActorTask() {
   if (worker_id_ < parallel_pool_->tasks_size()) {
@@ -72,28 +76,51 @@ bool ParallelWorker::RunQueueActorTask() {
   return false;
 }
 
-inline bool ParallelThreadPool::RunTaskOnce(int start, int end) {
+inline bool ParallelThreadPool::RunSlices(ParallelTask *p_task, int worker_id) {
+  int finish = 0;
+  if (p_task->affine) {
+    int task_num = p_task->task_num;
+    // Start the scan at this worker's stable slice, so the same kernel hands the same slice to the
+    // same worker across invocations; the full scan still claims everything left behind.
+    int first = worker_id >= 0 ? (worker_id + p_task->worker_base) % task_num : 0;
+    for (int i = 0; i < task_num; i++) {
+      int slice = first + i;
+      if (slice >= task_num) {
+        slice -= task_num;
+      }
+      bool expected = false;
+      if (p_task->slice_claimed[slice].compare_exchange_strong(expected, true)) {
+        p_task->status |= p_task->func(p_task->content, slice, 0, 0);
+        finish++;
+      }
+    }
+  } else {
+    int expected_index = p_task->started;
+    while (expected_index < p_task->task_num) {
+      if (p_task->started.compare_exchange_strong(expected_index, expected_index + 1)) {
+        p_task->status |= p_task->func(p_task->content, expected_index, 0, 0);
+        expected_index = p_task->started;
+        finish++;
+      }
+    }
+  }
+  if (finish > 0) {
+    p_task->valid = false;
+    p_task->finished += finish;
+    return true;
+  }
+  return false;
+}
+
+inline bool ParallelThreadPool::RunTaskOnce(int start, int end, int worker_id) {
   bool find = false;
-  ParallelTask *p_task;
   for (int i = start; i < end; i++) {
     if (tasks_[i].valid) {
       if (i != start) {
         tasks_start_ = i;
       }
-      int finish = 0;
-      p_task = &tasks_[i];
-      int expected_index = p_task->started;
-      while (expected_index < p_task->task_num) {
-        if (p_task->started.compare_exchange_strong(expected_index, expected_index + 1)) {
-          p_task->status |= p_task->func(p_task->content, expected_index, 0, 0);
-          find = true;
-          expected_index = p_task->started;
-          finish++;
-        }
-      }
-      if (find) {
-        p_task->valid = false;
-        p_task->finished += finish;
+      if (RunSlices(&tasks_[i], worker_id)) {
+        find = true;
         break;
       }
     }
@@ -101,32 +128,17 @@ inline bool ParallelThreadPool::RunTaskOnce(int start, int end) {
   return find;
 }
 
-bool ParallelThreadPool::RunParallel() {
+bool ParallelThreadPool::RunParallel(int worker_id) {
   bool ret = false;
   bool find;
   int max_num = tasks_size_;
   if (max_num < kActorParallelThreshold) {
-    ParallelTask *p_task;
     do {
       find = false;
       for (int i = 0; i < max_num; i++) {
-        if (tasks_[i].valid) {
-          int finish = 0;
-          p_task = &tasks_[i];
-          int expected_index = p_task->started;
-          while (expected_index < p_task->task_num) {
-            if (p_task->started.compare_exchange_strong(expected_index, expected_index + 1)) {
-              p_task->status |= p_task->func(p_task->content, expected_index, 0, 0);
-              find = true;
-              expected_index = p_task->started;
-              finish++;
-            }
-          }
-          if (find) {
-            p_task->valid = false;
-            p_task->finished += finish;
-            break;
-          }
+        if (tasks_[i].valid && RunSlices(&tasks_[i], worker_id)) {
+          find = true;
+          break;
         }
       }
       ret = ret || find;
@@ -137,11 +149,11 @@ bool ParallelThreadPool::RunParallel() {
       int end = tasks_end_;
       find = false;
       if (start < end) {
-        find = RunTaskOnce(start, end);
+        find = RunTaskOnce(start, end, worker_id);
       } else if (start != end) {
-        find = RunTaskOnce(start, max_num);
+        find = RunTaskOnce(start, max_num, worker_id);
         if (find == false) {
-          find = RunTaskOnce(0, end);
+          find = RunTaskOnce(0, end, worker_id);
         }
       }
       ret = ret || find;
@@ -150,6 +162,28 @@ bool ParallelThreadPool::RunParallel() {
   return ret;
 }
 
+void ParallelThreadPool::WakeWorkersForTask(const ParallelTask &task, int task_num) {
+  size_t need = static_cast<size_t>(task_num) - 1;
+  size_t size = workers_.size();
+  if (need >= size) {
+    ActiveWorkers();
+    return;
+  }
+  if (task.affine) {
+    // Wake exactly the workers whose stable slice belongs to this task.
+    for (int slice = 1; slice < task_num; slice++) {
+      size_t worker = static_cast<size_t>(((slice - task.worker_base) % task_num + task_num) % task_num);
+      if (worker < size) {
+        workers_[worker]->Active();
+      }
+    }
+  } else {
+    for (size_t i = 0; i < need; i++) {
+      workers_[i]->Active();
+    }
+  }
+}
+
 int ParallelThreadPool::ParallelLaunch(const Func &func, Content content, int task_num) {
   // if single thread, run master thread
   if (task_num <= 1) {
@@ -189,19 +223,22 @@ int ParallelThreadPool::ParallelLaunch(const Func &func, Content content, int ta
   p_task->started = 1;
   p_task->finished = 1;
   p_task->task_num = task_num;
+  p_task->affine = task_num <= kParallelSliceCap;
+  if (p_task->affine) {
+    // The content pointer is the kernel instance, stable across invocations; hashing it gives a
+    // stable slice-to-worker mapping per kernel. The first slice runs inline on the caller.
+    p_task->worker_base =
+      static_cast<int>((reinterpret_cast<uintptr_t>(content) >> kContentHashShift) % static_cast<uintptr_t>(task_num));
+    p_task->slice_claimed[0].store(true);
+    for (int i = 1; i < task_num; i++) {
+      p_task->slice_claimed[i].store(false);
+    }
+  }
   p_task->valid.store(true);
-  ActiveWorkers();
+  WakeWorkersForTask(*p_task, task_num);
 
   p_task->status |= p_task->func(p_task->content, 0, 0, 0);
-
-  int expected_index = p_task->started;
-  while (expected_index < p_task->task_num) {
-    if (p_task->started.compare_exchange_strong(expected_index, expected_index + 1)) {
-      p_task->status |= p_task->func(p_task->content, expected_index, 0, 0);
-      (void)++p_task->finished;
-      expected_index = p_task->started;
-    }
-  }
+  (void)RunSlices(p_task, -1);
   p_task->valid = false;
   while (p_task->finished < task_num) {
     if (!RunParallel()) {
@@ -222,6 +259,9 @@ int ParallelThreadPool::CreateParallelThreads(size_t actor_thread_num, size_t al
     THREAD_ERROR("thread num is invalid");
     return THREAD_ERROR;
   }
+  // Draw the thread num from the process-wide budget, see ActorThreadPool::CreateThreads.
+  all_thread_num = ThreadBudget::GetInstance().Acquire(kThreadBudgetMindRT, all_thread_num, actor_thread_num);
+  budget_acquired_ = all_thread_num;
   if (ActorQueueInit() != THREAD_OK) {
     return THREAD_ERROR;
   }
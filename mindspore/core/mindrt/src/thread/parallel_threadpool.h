@@ -25,12 +25,21 @@
 #include "thread/actor_threadpool.h"
 
 namespace mindspore {
+// The slice count up to which the per slice claim flags are used instead of the shared counter.
+constexpr int kParallelSliceCap = 32;
 typedef struct ParallelTask : public Task {
   ParallelTask() : Task(nullptr, nullptr) {}
   std::atomic_int started{0};
   int task_num;
   std::atomic_bool valid = false;
   std::atomic_bool occupied = false;
+  // Slice affinity: when the task fits kParallelSliceCap, the slices are claimed through the per
+  // slice flags and each worker starts its scan at a slice derived from the kernel content pointer,
+  // so repeated launches of the same kernel hand the same slice to the same worker and the per
+  // worker caches stay warm. The scan still visits every slice, which keeps stealing as fallback.
+  bool affine{false};
+  int worker_base{0};
+  std::atomic_bool slice_claimed[kParallelSliceCap];
 } ParallelTask;
 class ParallelThreadPool;
 class ParallelWorker : public Worker {
@@ -113,15 +122,21 @@ class ParallelThreadPool : public ActorThreadPool {
     }
   }
 
-  inline bool RunTaskOnce(int start, int end);
+  inline bool RunTaskOnce(int start, int end, int worker_id);
 
-  bool RunParallel();
+  bool RunParallel(int worker_id = -1);
 
   size_t tasks_size() { return tasks_size_; }
 
  private:
   ParallelThreadPool() {}
   int CreateParallelThreads(size_t actor_thread_num, size_t all_thread_num, const std::vector<int> &core_list);
+  // Run the unclaimed slices of the task, starting at the stable slice of the worker when the task
+  // uses slice affinity. Returns true when at least one slice was executed.
+  inline bool RunSlices(ParallelTask *p_task, int worker_id);
+  // Wake only the workers needed by the task instead of the whole pool: the caller runs the first
+  // slice inline, so small parallel regions do not pay a wakeup syscall per sleeping thread.
+  void WakeWorkersForTask(const ParallelTask &task, int task_num);
 
   std::atomic_int tasks_start_ = 0;
   std::atomic_int tasks_end_ = 0;
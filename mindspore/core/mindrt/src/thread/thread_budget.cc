@@ -0,0 +1,87 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread/thread_budget.h"
+#include <cstdlib>
+#include <thread>
+#include "thread/threadlog.h"
+
+namespace mindspore {
+ThreadBudget &ThreadBudget::GetInstance() {
+  static ThreadBudget instance;
+  return instance;
+}
+
+ThreadBudget::ThreadBudget() {
+  total_budget_ = std::thread::hardware_concurrency();
+  const char *env_budget = std::getenv("MS_THREAD_BUDGET");
+  if (env_budget != nullptr) {
+    auto budget = std::strtoul(env_budget, nullptr, 0);
+    if (budget > 0) {
+      total_budget_ = budget;
+    } else {
+      THREAD_ERROR("Invalid MS_THREAD_BUDGET: %s, fall back to the core num.", env_budget);
+    }
+  }
+  THREAD_INFO("Process thread budget: [%zu]", total_budget_);
+}
+
+size_t ThreadBudget::Acquire(const std::string &subsystem, size_t requested, size_t min_guarantee) {
+  std::lock_guard<std::mutex> _l(mutex_);
+  size_t total_granted = 0;
+  for (const auto &item : granted_) {
+    total_granted += item.second;
+  }
+  size_t available = total_budget_ > total_granted ? total_budget_ - total_granted : 0;
+  size_t grant = requested < available ? requested : available;
+  // The guarantee overrides the budget: a starved subsystem still gets its minimum, the budget
+  // goes into debt and the other subsystems see a smaller available count afterwards.
+  size_t guarantee = min_guarantee < requested ? min_guarantee : requested;
+  if (grant < guarantee) {
+    grant = guarantee;
+  }
+  granted_[subsystem] += grant;
+  if (grant < requested) {
+    THREAD_INFO("Thread budget clamps [%s] from [%zu] to [%zu], granted in total: [%zu]", subsystem.c_str(), requested,
+                grant, total_granted + grant);
+  }
+  return grant;
+}
+
+void ThreadBudget::Release(const std::string &subsystem, size_t released) {
+  std::lock_guard<std::mutex> _l(mutex_);
+  auto iter = granted_.find(subsystem);
+  if (iter == granted_.end()) {
+    THREAD_ERROR("Release thread budget for unknown subsystem: %s", subsystem.c_str());
+    return;
+  }
+  iter->second = iter->second > released ? iter->second - released : 0;
+}
+
+size_t ThreadBudget::total_budget() const {
+  std::lock_guard<std::mutex> _l(mutex_);
+  return total_budget_;
+}
+
+size_t ThreadBudget::granted() const {
+  std::lock_guard<std::mutex> _l(mutex_);
+  size_t total_granted = 0;
+  for (const auto &item : granted_) {
+    total_granted += item.second;
+  }
+  return total_granted;
+}
+}  // namespace mindspore
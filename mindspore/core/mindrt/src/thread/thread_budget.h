@@ -0,0 +1,67 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_MINDRT_RUNTIME_THREAD_BUDGET_H_
+#define MINDSPORE_CORE_MINDRT_RUNTIME_THREAD_BUDGET_H_
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "utils/visible.h"
+
+namespace mindspore {
+// Well known subsystem names, used so repeated pool creations of one subsystem share one account.
+constexpr char kThreadBudgetMindRT[] = "mindrt";
+constexpr char kThreadBudgetMindData[] = "minddata";
+
+// Process-wide thread budget coordinator.
+// Each subsystem that spawns worker threads (the mindrt actor/kernel pools, the minddata execution
+// tree) acquires tokens from a shared budget before creating threads, so the sum of busy-waiting
+// workers stays close to the number of cores instead of each subsystem sizing itself as if it owned
+// the whole machine. A per-call minimum guarantee keeps any subsystem from being starved by the
+// others. The total budget defaults to the hardware concurrency and can be overridden with the
+// MS_THREAD_BUDGET environment variable.
+class MS_CORE_API ThreadBudget {
+ public:
+  static ThreadBudget &GetInstance();
+
+  // Acquire up to `requested` thread tokens for `subsystem`.
+  // At least min(requested, min_guarantee) tokens are always granted, even when the budget is
+  // exhausted, so callers whose internal invariants require a fixed number of threads pass that
+  // number as the guarantee. Returns the granted count.
+  size_t Acquire(const std::string &subsystem, size_t requested, size_t min_guarantee);
+
+  // Return `released` tokens of `subsystem` to the budget, e.g. when a pool is destroyed.
+  void Release(const std::string &subsystem, size_t released);
+
+  // The total number of tokens, all subsystems together.
+  size_t total_budget() const;
+  // The number of tokens currently granted, all subsystems together.
+  size_t granted() const;
+
+ private:
+  ThreadBudget();
+  ~ThreadBudget() = default;
+  ThreadBudget(const ThreadBudget &) = delete;
+  ThreadBudget &operator=(const ThreadBudget &) = delete;
+
+  mutable std::mutex mutex_;
+  size_t total_budget_{0};
+  // Key: subsystem name, Value: tokens currently granted to it.
+  std::unordered_map<std::string, size_t> granted_;
+};
+}  // namespace mindspore
+#endif  // MINDSPORE_CORE_MINDRT_RUNTIME_THREAD_BUDGET_H_
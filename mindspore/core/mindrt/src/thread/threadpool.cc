@@ -19,6 +19,7 @@
 #endif
 #include "thread/threadpool.h"
 #include "thread/core_affinity.h"
+#include "thread/thread_budget.h"
 
 namespace mindspore {
 Worker::~Worker() {
@@ -102,18 +103,42 @@ void Worker::Run() {
 #endif
   while (alive_) {
     if (RunLocalKernelTask()) {
+      UpdateSpinBudget(false);
       spin_count_ = 0;
     } else {
       RunOtherKernelTask();
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (spin_count_ > adaptive_spin_count_) {
+      UpdateSpinBudget(true);
       WaitUntilActive();
       spin_count_ = 1;
     }
   }
 }
 
+void Worker::UpdateSpinBudget(bool timed_out) {
+  // Track how many spin iterations usually pass before a task arrives, so workers in busy phases keep
+  // spinning across parallel-for boundaries while workers on an idle pool park quickly.
+  if (timed_out) {
+    // the budget was exhausted without a task, spinning longer would only waste the core
+    int decay = spin_arrival_ewma_ / kSpinArrivalEwmaWeight;
+    spin_arrival_ewma_ -= (decay > 0 || spin_arrival_ewma_ == 0) ? decay : 1;
+  } else if (spin_count_ > 0) {
+    int delta = (spin_count_ - spin_arrival_ewma_) / kSpinArrivalEwmaWeight;
+    if (delta == 0 && spin_count_ > spin_arrival_ewma_) {
+      delta = 1;
+    }
+    spin_arrival_ewma_ += delta;
+  } else {
+    // the task was assigned while the worker was busy or parked, no spin interval was observed
+    return;
+  }
+  int budget = spin_arrival_ewma_ * kSpinBudgetScale;
+  budget = budget < kMinSpinCount ? kMinSpinCount : budget;
+  adaptive_spin_count_ = budget < max_spin_count_ ? budget : max_spin_count_;
+}
+
 bool Worker::TryRunTask(TaskSplit *task_split) {
   if (task_split == nullptr) {
     return false;
@@ -233,6 +258,11 @@ ThreadPool::~ThreadPool() {
     task_queue->Clean();
   }
   task_queues_.clear();
+
+  if (budget_acquired_ > 0) {
+    ThreadBudget::GetInstance().Release(kThreadBudgetMindRT, budget_acquired_);
+    budget_acquired_ = 0;
+  }
   THREAD_INFO("destruct success");
 }
 
@@ -497,6 +527,10 @@ ThreadPool *ThreadPool::CreateThreadPool(size_t thread_num, const std::vector<in
   if (pool == nullptr) {
     return nullptr;
   }
+  // Draw the thread num from the process-wide budget so concurrently living pools do not
+  // oversubscribe the machine together. One thread is always guaranteed.
+  thread_num = ThreadBudget::GetInstance().Acquire(kThreadBudgetMindRT, thread_num, 1);
+  pool->budget_acquired_ = thread_num;
   if (pool->TaskQueuesInit(thread_num) != THREAD_OK) {
     delete pool;
     return nullptr;
@@ -44,6 +44,10 @@ constexpr int kDefaultSpinCount = 300000;
 constexpr int kMaxCount = 30000;
 constexpr int kDefaultKernelSpinCount = 3000;
 constexpr int kMinSpinCount = 1;
+// weight of the history in the exponentially weighted spin-arrival estimate
+constexpr int kSpinArrivalEwmaWeight = 8;
+// spin budget relative to the estimated arrival interval
+constexpr int kSpinBudgetScale = 2;
 constexpr int kDefaultFrequency = 1;
 constexpr float kMaxScale = 1.;
 constexpr size_t kMaxHqueueSize = 8192;
@@ -93,7 +97,10 @@ class Worker {
   // try to run a single task
   bool TryRunTask(TaskSplit *task_split);
   // set max spin count before running
-  void SetMaxSpinCount(int max_spin_count) { max_spin_count_ = max_spin_count; }
+  void SetMaxSpinCount(int max_spin_count) {
+    max_spin_count_ = max_spin_count;
+    adaptive_spin_count_ = max_spin_count;
+  }
   void InitWorkerMask(const std::vector<int> &core_list, const size_t workers_size);
   void InitLocalTaskQueue(HQueue<TaskSplit> *task_queue) { local_task_queue_ = task_queue; }
 
@@ -120,6 +127,7 @@ class Worker {
   void SetAffinity();
   void Run();
   void YieldAndDeactive();
+  void UpdateSpinBudget(bool timed_out);
   virtual void WaitUntilActive();
 
   bool alive_{true};
@@ -142,6 +150,10 @@ class Worker {
   int frequency_{kDefaultFrequency};
   int spin_count_{0};
   int max_spin_count_{kMinSpinCount};
+  // current spin budget, adapted between kMinSpinCount and max_spin_count_
+  int adaptive_spin_count_{kMinSpinCount};
+  // exponentially weighted estimate of spin iterations until a task arrives
+  int spin_arrival_ewma_{0};
   ThreadPool *pool_{nullptr};
   HQueue<TaskSplit> *local_task_queue_;
   size_t worker_id_{0};
@@ -230,6 +242,8 @@ class MS_CORE_API ThreadPool {
   size_t actor_thread_num_{0};
   size_t kernel_thread_num_{0};
   bool occupied_actor_thread_{true};
+  // thread tokens acquired from the process-wide ThreadBudget, returned on destruction
+  size_t budget_acquired_{0};
   int max_spin_count_{kDefaultSpinCount};
   int min_spin_count_{kMinSpinCount};
   float server_cpu_frequence = -1.0f;  // Unit : GHz
@@ -0,0 +1,192 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timer/timer_service.h"
+#include <chrono>
+#include <utility>
+
+namespace mindspore {
+namespace timer {
+// Tick granularity and wheel geometry: level 0 spans kWheelSize ticks (6.4s), level 1 spans kWheelSize
+// level-0 rotations (~7min). Heartbeat-style periods all fit level 0, longer TTL sweeps level 1.
+constexpr uint64_t kTickMs = 100;
+constexpr size_t kWheelSize = 64;
+constexpr uint64_t kFineSpanMs = kTickMs * kWheelSize;
+
+TimerService &TimerService::GetInstance() {
+  static TimerService instance;
+  return instance;
+}
+
+TimerService::~TimerService() { Stop(); }
+
+uint64_t TimerService::NowMs() {
+  return static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count());
+}
+
+TimerId TimerService::AddPeriodicTask(uint64_t interval_ms, const std::function<void()> &func) {
+  if (interval_ms == 0 || func == nullptr) {
+    return kInvalidTimerId;
+  }
+  return Schedule(interval_ms, interval_ms, func);
+}
+
+TimerId TimerService::AddOnceTask(uint64_t delay_ms, const std::function<void()> &func) {
+  if (func == nullptr) {
+    return kInvalidTimerId;
+  }
+  return Schedule(delay_ms, 0, func);
+}
+
+TimerId TimerService::Schedule(uint64_t first_delay_ms, uint64_t interval_ms, const std::function<void()> &func) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (stop_) {
+    return kInvalidTimerId;
+  }
+  if (!running_) {
+    fine_wheel_.resize(kWheelSize);
+    coarse_wheel_.resize(kWheelSize);
+    last_tick_ms_ = NowMs();
+    fine_index_ = static_cast<size_t>((last_tick_ms_ / kTickMs) % kWheelSize);
+    coarse_index_ = static_cast<size_t>((last_tick_ms_ / kFineSpanMs) % kWheelSize);
+    worker_ = std::thread(&TimerService::Worker, this);
+    running_ = true;
+  }
+  auto task = std::make_shared<TimerTask>();
+  task->id = next_id_++;
+  task->interval_ms = interval_ms;
+  task->deadline_ms = NowMs() + first_delay_ms;
+  task->func = func;
+  task->cancelled = false;
+  tasks_[task->id] = task;
+  ++task_count_;
+  Place(task);
+  cv_.notify_one();
+  return task->id;
+}
+
+void TimerService::CancelTask(TimerId timer_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = tasks_.find(timer_id);
+  if (iter == tasks_.end()) {
+    return;
+  }
+  // The wheels keep the shared pointer; the entry is dropped when its slot expires.
+  iter->second->cancelled = true;
+  (void)tasks_.erase(iter);
+}
+
+void TimerService::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_ || stop_) {
+      stop_ = true;
+      return;
+    }
+    stop_ = true;
+    cv_.notify_one();
+  }
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  fine_wheel_.clear();
+  coarse_wheel_.clear();
+  overflow_.clear();
+  tasks_.clear();
+  task_count_ = 0;
+  running_ = false;
+}
+
+void TimerService::Place(const TimerTaskPtr &task) {
+  uint64_t deadline_tick = task->deadline_ms / kTickMs;
+  uint64_t current_tick = last_tick_ms_ / kTickMs;
+  if (deadline_tick <= current_tick + 1) {
+    // Due or nearly due: the next processed slot, an absolute slot would wait a whole rotation.
+    fine_wheel_[(fine_index_ + 1) % kWheelSize].push_back(task);
+  } else if (deadline_tick < current_tick + kWheelSize) {
+    fine_wheel_[deadline_tick % kWheelSize].push_back(task);
+  } else if (deadline_tick < current_tick + kWheelSize * kWheelSize) {
+    coarse_wheel_[(deadline_tick / kWheelSize) % kWheelSize].push_back(task);
+  } else {
+    overflow_.push_back(task);
+  }
+}
+
+void TimerService::Cascade() {
+  std::list<TimerTaskPtr> expiring;
+  expiring.splice(expiring.end(), coarse_wheel_[coarse_index_]);
+  if (coarse_index_ == 0) {
+    expiring.splice(expiring.end(), overflow_);
+  }
+  for (auto &task : expiring) {
+    if (task->cancelled) {
+      --task_count_;
+      continue;
+    }
+    Place(task);
+  }
+}
+
+void TimerService::Worker() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_) {
+    if (task_count_ == 0) {
+      // Fully idle: sleep until a task is registered, this thread must not show up in scheduler noise.
+      cv_.wait(lock, [this] { return stop_ || task_count_ > 0; });
+      continue;
+    }
+    auto next_tick_ms = last_tick_ms_ + kTickMs;
+    auto now_ms = NowMs();
+    if (now_ms < next_tick_ms) {
+      (void)cv_.wait_for(lock, std::chrono::milliseconds(next_tick_ms - now_ms));
+      continue;
+    }
+    while (NowMs() >= last_tick_ms_ + kTickMs && !stop_) {
+      last_tick_ms_ += kTickMs;
+      fine_index_ = (fine_index_ + 1) % kWheelSize;
+      if (fine_index_ == 0) {
+        coarse_index_ = (coarse_index_ + 1) % kWheelSize;
+        Cascade();
+      }
+      std::list<TimerTaskPtr> due;
+      due.splice(due.end(), fine_wheel_[fine_index_]);
+      for (auto &task : due) {
+        if (task->cancelled) {
+          --task_count_;
+          continue;
+        }
+        // Run without the lock so a task may register or cancel timers.
+        lock.unlock();
+        task->func();
+        lock.lock();
+        if (task->interval_ms != 0 && !task->cancelled && !stop_) {
+          task->deadline_ms += task->interval_ms;
+          Place(task);
+        } else {
+          if (!task->cancelled) {
+            (void)tasks_.erase(task->id);
+          }
+          --task_count_;
+        }
+      }
+    }
+  }
+}
+}  // namespace timer
+}  // namespace mindspore
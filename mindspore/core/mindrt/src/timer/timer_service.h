@@ -0,0 +1,99 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_MINDRT_SRC_TIMER_TIMER_SERVICE_H_
+#define MINDSPORE_CORE_MINDRT_SRC_TIMER_TIMER_SERVICE_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "utils/visible.h"
+
+namespace mindspore {
+namespace timer {
+using TimerId = uint64_t;
+constexpr TimerId kInvalidTimerId = 0;
+
+// A process-wide timer service multiplexing periodic and one-shot tasks onto a single thread with a
+// two-level hierarchical timing wheel. Heartbeats, cache sweeps and flush tasks each used to own a
+// mostly-idle monitor thread; registering them here keeps one sleeping thread regardless of how many
+// sessions or components the process hosts. Tasks run on the service thread, so they must be short and
+// must not block; anything heavy should only be triggered from here and executed elsewhere.
+class MS_CORE_API TimerService {
+ public:
+  static TimerService &GetInstance();
+
+  // Schedule a task to run every interval_ms milliseconds, first run one interval from now.
+  TimerId AddPeriodicTask(uint64_t interval_ms, const std::function<void()> &func);
+
+  // Schedule a task to run once after delay_ms milliseconds.
+  TimerId AddOnceTask(uint64_t delay_ms, const std::function<void()> &func);
+
+  // Cancel a scheduled task. A task already being executed finishes, but never runs again.
+  void CancelTask(TimerId timer_id);
+
+  // Stop the service thread. Pending tasks are dropped.
+  void Stop();
+
+ private:
+  struct TimerTask {
+    TimerId id;
+    uint64_t interval_ms;  // 0 for a one-shot task
+    uint64_t deadline_ms;  // absolute deadline on the monotonic clock
+    std::function<void()> func;
+    bool cancelled;
+  };
+  using TimerTaskPtr = std::shared_ptr<TimerTask>;
+
+  TimerService() = default;
+  ~TimerService();
+  TimerService(const TimerService &) = delete;
+  TimerService &operator=(const TimerService &) = delete;
+
+  TimerId Schedule(uint64_t first_delay_ms, uint64_t interval_ms, const std::function<void()> &func);
+  // Put the task into the wheel level matching its remaining time, mutex_ must be held.
+  void Place(const TimerTaskPtr &task);
+  // Move the expiring coarse slot (or the overflow list on a coarse wrap) down a level, mutex_ must be held.
+  void Cascade();
+  void Worker();
+  static uint64_t NowMs();
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread worker_;
+  bool running_{false};
+  bool stop_{false};
+  TimerId next_id_{1};
+  size_t task_count_{0};
+  // Level 0 advances one slot per tick, level 1 one slot per level-0 rotation; tasks beyond the span of
+  // both levels wait in the overflow list and cascade down as the wheels turn.
+  std::vector<std::list<TimerTaskPtr>> fine_wheel_;
+  std::vector<std::list<TimerTaskPtr>> coarse_wheel_;
+  std::list<TimerTaskPtr> overflow_;
+  size_t fine_index_{0};
+  size_t coarse_index_{0};
+  uint64_t last_tick_ms_{0};
+  std::unordered_map<TimerId, TimerTaskPtr> tasks_;
+};
+}  // namespace timer
+}  // namespace mindspore
+#endif  // MINDSPORE_CORE_MINDRT_SRC_TIMER_TIMER_SERVICE_H_
@@ -777,6 +777,12 @@ bool CheckAndConvertUtils::CheckIrAttrtoOpAttr(const std::string &op_type, const
   return true;
 }
 
+bool CheckAndConvertUtils::HasRegisteredAttrConvert(const std::string &op_type) {
+  // Both convert tables are static, so an op type missing from them can never have a convertible attr.
+  return PrimAttrConvertMap.find(op_type) != PrimAttrConvertMap.end() ||
+         kIrAttrToOpAttr.find(op_type) != kIrAttrToOpAttr.end();
+}
+
 void CheckAndConvertUtils::CheckSummaryParam(const AbstractBasePtr &name, const AbstractBasePtr &value,
                                              const std::string &class_name) {
   MS_EXCEPTION_IF_NULL(name);
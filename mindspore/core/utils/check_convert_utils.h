@@ -294,6 +294,7 @@ class MS_CORE_API CheckAndConvertUtils {
   static void ConvertAttrValueInExport(const std::string &op_type, const std::string &attr_name, ValuePtr *const value);
   static void ConvertAttrValueInLoad(const std::string &op_type, const std::string &attr_name, ValuePtr *const value);
   static AttrConverterPair GetAttrConvertPair(const std::string &op_type, const std::string &attr_name);
+  static bool HasRegisteredAttrConvert(const std::string &op_type);
   static bool GetDataFormatEnumValue(const ValuePtr &value, int64_t *enum_value);
   static void GetPadModEnumValue(const ValuePtr &value, int64_t *enum_value, bool is_upper = false);
   static void GetReductionEnumValue(const ValuePtr &value, int64_t *enum_value);
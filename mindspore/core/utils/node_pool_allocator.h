@@ -0,0 +1,138 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_UTILS_NODE_POOL_ALLOCATOR_H_
+#define MINDSPORE_CORE_UTILS_NODE_POOL_ALLOCATOR_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+// A size class memory pool for the IR node objects. The blocks are carved out of large slabs by bump allocation and
+// recycled through per size class free lists, so constructing a big graph packs the nodes together instead of
+// scattering millions of small blocks over the heap, and the allocation fast path is a pointer pop under a short
+// lock instead of a global heap call. The pool is enabled by the env MS_DEV_IR_NODE_POOL=1.
+//
+// The singleton is intentionally leaked: the IR nodes can be destroyed during static teardown after the pool static
+// would have been destructed, and the slabs are reclaimed by the process exit anyway.
+class NodeMemPool {
+ public:
+  static NodeMemPool &GetInstance() {
+    static NodeMemPool *instance = new NodeMemPool();
+    return *instance;
+  }
+
+  static bool IsEnabled() {
+    static const bool enabled = common::GetEnv("MS_DEV_IR_NODE_POOL") == "1";
+    return enabled;
+  }
+
+  void *Allocate(size_t size) {
+    if (size == 0 || size > kMaxPooledSize) {
+      return ::operator new(size);
+    }
+    auto &size_class = classes_[SizeClassIndex(size)];
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    if (size_class.free_list != nullptr) {
+      void *block = size_class.free_list;
+      size_class.free_list = *static_cast<void **>(block);
+      return block;
+    }
+    const size_t block_size = (SizeClassIndex(size) + 1) * kAlign;
+    if (size_class.slab_remain < block_size) {
+      auto slab = static_cast<char *>(malloc(kSlabSize));
+      if (slab == nullptr) {
+        throw std::bad_alloc();
+      }
+      (void)size_class.slabs.emplace_back(slab);
+      size_class.slab_pos = slab;
+      size_class.slab_remain = kSlabSize;
+    }
+    void *block = size_class.slab_pos;
+    size_class.slab_pos += block_size;
+    size_class.slab_remain -= block_size;
+    return block;
+  }
+
+  void Free(void *block, size_t size) noexcept {
+    if (block == nullptr) {
+      return;
+    }
+    if (size == 0 || size > kMaxPooledSize) {
+      ::operator delete(block);
+      return;
+    }
+    auto &size_class = classes_[SizeClassIndex(size)];
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    *static_cast<void **>(block) = size_class.free_list;
+    size_class.free_list = block;
+  }
+
+ private:
+  NodeMemPool() = default;
+  ~NodeMemPool() = default;
+  NodeMemPool(const NodeMemPool &) = delete;
+  NodeMemPool &operator=(const NodeMemPool &) = delete;
+
+  // All the blocks are aligned and rounded up to kAlign, which matches the default new alignment.
+  static constexpr size_t kAlign = 16;
+  static constexpr size_t kSlabSize = 256 * 1024;
+  // Allocations above this size are rare and go to the global heap directly.
+  static constexpr size_t kMaxPooledSize = 1024;
+
+  static size_t SizeClassIndex(size_t size) { return (size + kAlign - 1) / kAlign - 1; }
+
+  struct SizeClass {
+    std::mutex mutex;
+    void *free_list{nullptr};
+    char *slab_pos{nullptr};
+    size_t slab_remain{0};
+    std::vector<char *> slabs;
+  };
+  std::array<SizeClass, kMaxPooledSize / kAlign> classes_;
+};
+
+// The std allocator adapter over the node memory pool, used with std::allocate_shared so the node object and the
+// shared_ptr control block come from the pool in one block.
+template <typename T>
+class NodePoolAllocator {
+ public:
+  using value_type = T;
+
+  NodePoolAllocator() = default;
+  template <typename U>
+  NodePoolAllocator(const NodePoolAllocator<U> &) noexcept {}
+
+  T *allocate(size_t n) { return static_cast<T *>(NodeMemPool::GetInstance().Allocate(n * sizeof(T))); }
+  void deallocate(T *p, size_t n) noexcept { NodeMemPool::GetInstance().Free(p, n * sizeof(T)); }
+
+  template <typename U>
+  bool operator==(const NodePoolAllocator<U> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const NodePoolAllocator<U> &) const noexcept {
+    return false;
+  }
+};
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_UTILS_NODE_POOL_ALLOCATOR_H_
@@ -155,4 +155,52 @@ Status NumaBind(void *handle, const int32_t &rank_id) {
   }
   return Status::OK();
 }
+
+Status NumaSetInterleave(void *handle) {
+  if (handle == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa package not found.");
+  }
+  auto numa_max_node_func = GetNumaAdapterFunc(handle, "numa_max_node");
+  if (numa_max_node_func == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa api: numa_max_node not found.");
+  }
+  auto numa_allocate_nodemask_func = GetNumaAdapterFunc(handle, "numa_allocate_nodemask");
+  if (numa_allocate_nodemask_func == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa api: numa_allocate_nodemask not found.");
+  }
+  auto numa_bitmask_clearall_func = GetNumaAdapterFunc(handle, "numa_bitmask_clearall");
+  if (numa_bitmask_clearall_func == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa api: numa_bitmask_clearall not found.");
+  }
+  auto numa_bitmask_setbit_func = GetNumaAdapterFunc(handle, "numa_bitmask_setbit");
+  if (numa_bitmask_setbit_func == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa api: numa_bitmask_setbit not found.");
+  }
+  auto numa_set_interleave_mask_func = GetNumaAdapterFunc(handle, "numa_set_interleave_mask");
+  if (numa_set_interleave_mask_func == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa api: numa_set_interleave_mask not found.");
+  }
+  auto numa_bitmask_free_func = GetNumaAdapterFunc(handle, "numa_bitmask_free");
+  if (numa_bitmask_free_func == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Numa api: numa_bitmask_free not found.");
+  }
+  auto numa_max_node = (int (*)(void))(numa_max_node_func);
+  auto numa_allocate_nodemask = (struct bitmask * (*)(void))(numa_allocate_nodemask_func);
+  auto numa_bitmask_clearall = (struct bitmask * (*)(struct bitmask *))(numa_bitmask_clearall_func);
+  auto numa_bitmask_setbit = (struct bitmask * (*)(struct bitmask *, unsigned int))(numa_bitmask_setbit_func);
+  auto numa_set_interleave_mask = (void (*)(struct bitmask *))(numa_set_interleave_mask_func);
+  auto numa_bitmask_free = (void (*)(struct bitmask *))(numa_bitmask_free_func);
+  int numa_node_max_id = numa_max_node();
+  if (numa_node_max_id < 0) {
+    RETURN_STATUS_UNEXPECTED("Get numa max node failed.");
+  }
+  auto bm = numa_allocate_nodemask();
+  numa_bitmask_clearall(bm);
+  for (int node_id = 0; node_id <= numa_node_max_id; ++node_id) {
+    numa_bitmask_setbit(bm, static_cast<unsigned int>(node_id));
+  }
+  numa_set_interleave_mask(bm);
+  numa_bitmask_free(bm);
+  return Status::OK();
+}
 }  // namespace mindspore
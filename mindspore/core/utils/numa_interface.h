@@ -30,5 +30,10 @@ MS_CORE_API std::shared_ptr<void> GetNumaAdapterHandle();
 // 1. Get function pointer of numa api
 // 2. Do numa_bind
 MS_CORE_API Status NumaBind(void *handle, const int32_t &rank_id);
+
+// Interleave the memory allocations of this process over all the numa nodes instead of binding them to
+// one node. Used when one process feeds devices on several sockets: the host tensors shared by those
+// devices then spread the cross-socket traffic evenly instead of loading a single node.
+MS_CORE_API Status NumaSetInterleave(void *handle);
 }  // namespace mindspore
 #endif  // MINDSPORE_CORE_UTILS_NUMA_INTERFACE_H_
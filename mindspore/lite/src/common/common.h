@@ -68,6 +68,8 @@ static const char *const kMSCacheSerializePath = "serialize_path";
 // weight path
 static const char *const kWeight = "weight";
 static const char *const kWeightPath = "weight_path";
+// tuned per-op thread numbers
+static const char *const kThreadNumPlan = "thread_num_plan";
 }  // namespace lite
 }  // namespace mindspore
 
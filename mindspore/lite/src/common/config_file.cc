@@ -153,5 +153,40 @@ void ParserExecutionPlan(const std::map<std::string, std::string> *config_infos,
     (void)data_type_plan->insert(std::make_pair(op_name, type_id));
   }
 }
+
+void ParserThreadNumPlan(const std::map<std::string, std::string> *config_infos,
+                         std::map<std::string, int> *thread_num_plan) {
+  for (auto info : *config_infos) {
+    std::string op_name = info.first;
+    std::string value = info.second;
+    if (value.empty()) {
+      MS_LOG(WARNING) << "Empty info in thread_num_plan";
+      continue;
+    }
+    if (value[0] == '"' && value[value.length() - 1] == '"') {
+      value = value.substr(1, value.length() - kLengthOfParentheses);
+    }
+    auto index = value.find(':');
+    if (index == std::string::npos) {
+      MS_LOG(WARNING) << "Invalid info in thread_num_plan: " << value;
+      continue;
+    }
+    auto thread_num_key = value.substr(0, index);
+    if (index + 1 > value.size()) {
+      return;
+    }
+    auto thread_num_value = value.substr(index + 1);
+    if (thread_num_key != "thread_num") {
+      MS_LOG(WARNING) << "Invalid key in thread_num_plan: " << value;
+      continue;
+    }
+    int thread_num = 0;
+    if (!ConvertStrToInt(thread_num_value, &thread_num) || thread_num <= 0) {
+      MS_LOG(WARNING) << "Invalid value in thread_num_plan: " << value;
+      continue;
+    }
+    (void)thread_num_plan->insert(std::make_pair(op_name, thread_num));
+  }
+}
 }  // namespace lite
 }  // namespace mindspore
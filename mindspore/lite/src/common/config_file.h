@@ -41,6 +41,9 @@ int GetAllSectionInfoFromConfigFile(const std::string &file,
 void ParserExecutionPlan(const std::map<std::string, std::string> *config_infos,
                          std::map<std::string, TypeId> *data_type_plan);
 
+void ParserThreadNumPlan(const std::map<std::string, std::string> *config_infos,
+                         std::map<std::string, int> *thread_num_plan);
+
 }  // namespace lite
 }  // namespace mindspore
 
@@ -0,0 +1,140 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "src/extendrt/utils/kv_cache_manager.h"
+
+#include "securec/include/securec.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+Status KVCacheManager::Init(size_t num_layers, size_t num_slots, size_t max_seq_len, size_t token_size,
+                            TypeId data_type) {
+  if (num_layers == 0 || num_slots == 0 || max_seq_len == 0 || token_size == 0) {
+    MS_LOG(ERROR) << "Invalid kv cache config, num_layers: " << num_layers << ", num_slots: " << num_slots
+                  << ", max_seq_len: " << max_seq_len << ", token_size: " << token_size;
+    return kLiteError;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  num_layers_ = num_layers;
+  num_slots_ = num_slots;
+  max_seq_len_ = max_seq_len;
+  token_size_ = token_size;
+  ShapeVector cache_shape = {static_cast<int64_t>(num_slots), static_cast<int64_t>(max_seq_len),
+                             static_cast<int64_t>(token_size)};
+  key_caches_.resize(num_layers);
+  value_caches_.resize(num_layers);
+  for (size_t layer = 0; layer < num_layers; ++layer) {
+    key_caches_[layer] = std::make_shared<tensor::Tensor>(data_type, cache_shape);
+    value_caches_[layer] = std::make_shared<tensor::Tensor>(data_type, cache_shape);
+    // Touch the data to allocate the whole cache up front, decode steps must not pay for allocation.
+    if (key_caches_[layer]->data_c() == nullptr || value_caches_[layer]->data_c() == nullptr) {
+      MS_LOG(ERROR) << "Alloc kv cache of layer " << layer << " failed.";
+      return kLiteError;
+    }
+  }
+  token_bytes_ = token_size * key_caches_[0]->data().itemsize();
+  slot_seq_lens_.assign(num_slots, 0);
+  slot_used_.assign(num_slots, false);
+  free_slots_.clear();
+  free_slots_.reserve(num_slots);
+  for (int slot = static_cast<int>(num_slots) - 1; slot >= 0; --slot) {
+    free_slots_.push_back(slot);
+  }
+  return kSuccess;
+}
+
+int KVCacheManager::AllocSlot() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (free_slots_.empty()) {
+    return -1;
+  }
+  int slot = free_slots_.back();
+  free_slots_.pop_back();
+  slot_used_[slot] = true;
+  slot_seq_lens_[slot] = 0;
+  return slot;
+}
+
+void KVCacheManager::FreeSlot(int slot) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!IsValidSlot(slot) || !slot_used_[slot]) {
+    MS_LOG(WARNING) << "Free an invalid or unused kv cache slot: " << slot;
+    return;
+  }
+  slot_used_[slot] = false;
+  slot_seq_lens_[slot] = 0;
+  free_slots_.push_back(slot);
+}
+
+Status KVCacheManager::AppendStep(int slot, const std::vector<const void *> &key_steps,
+                                  const std::vector<const void *> &value_steps) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!IsValidSlot(slot) || !slot_used_[slot]) {
+    MS_LOG(ERROR) << "Append to an invalid or unused kv cache slot: " << slot;
+    return kLiteError;
+  }
+  if (key_steps.size() != num_layers_ || value_steps.size() != num_layers_) {
+    MS_LOG(ERROR) << "Append step expects one key and one value per layer, layers: " << num_layers_
+                  << ", keys: " << key_steps.size() << ", values: " << value_steps.size();
+    return kLiteError;
+  }
+  auto seq_len = slot_seq_lens_[slot];
+  if (seq_len >= max_seq_len_) {
+    MS_LOG(ERROR) << "KV cache slot " << slot << " is full, max_seq_len: " << max_seq_len_;
+    return kLiteError;
+  }
+  auto slot_offset = (static_cast<size_t>(slot) * max_seq_len_ + seq_len) * token_bytes_;
+  for (size_t layer = 0; layer < num_layers_; ++layer) {
+    auto key_dst = reinterpret_cast<uint8_t *>(key_caches_[layer]->data_c()) + slot_offset;
+    auto value_dst = reinterpret_cast<uint8_t *>(value_caches_[layer]->data_c()) + slot_offset;
+    auto ret = memcpy_s(key_dst, token_bytes_, key_steps[layer], token_bytes_);
+    if (ret != EOK) {
+      MS_LOG(ERROR) << "Append key step memcpy_s failed, ret = " << ret;
+      return kLiteError;
+    }
+    ret = memcpy_s(value_dst, token_bytes_, value_steps[layer], token_bytes_);
+    if (ret != EOK) {
+      MS_LOG(ERROR) << "Append value step memcpy_s failed, ret = " << ret;
+      return kLiteError;
+    }
+  }
+  slot_seq_lens_[slot] = seq_len + 1;
+  return kSuccess;
+}
+
+size_t KVCacheManager::SeqLen(int slot) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!IsValidSlot(slot)) {
+    return 0;
+  }
+  return slot_seq_lens_[slot];
+}
+
+tensor::TensorPtr KVCacheManager::GetKeyCache(size_t layer) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (layer >= key_caches_.size()) {
+    return nullptr;
+  }
+  return key_caches_[layer];
+}
+
+tensor::TensorPtr KVCacheManager::GetValueCache(size_t layer) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (layer >= value_caches_.size()) {
+    return nullptr;
+  }
+  return value_caches_[layer];
+}
+}  // namespace mindspore
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_LITE_EXTENDRT_UTILS_KV_CACHE_MANAGER_H
+#define MINDSPORE_LITE_EXTENDRT_UTILS_KV_CACHE_MANAGER_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "include/api/status.h"
+#include "ir/tensor.h"
+
+namespace mindspore {
+// Manages the key/value caches of autoregressive decoding for a session. The caches of all the layers
+// are preallocated once as [slot, max_seq_len, token_size] tensors: a request claims a slot for its
+// lifetime, every decode step appends one token into the slot at O(1) cost, and a finished request hands
+// the slot to the next one without any reallocation. This keeps per-token cost independent of the
+// sequence length and the serving steady state free of memory churn.
+class KVCacheManager {
+ public:
+  KVCacheManager() = default;
+  ~KVCacheManager() = default;
+
+  // Preallocate the caches: one key and one value tensor per layer, each holding num_slots sequences of
+  // at most max_seq_len tokens with token_size elements per token (heads * head_dim for the usual layout).
+  Status Init(size_t num_layers, size_t num_slots, size_t max_seq_len, size_t token_size, TypeId data_type);
+
+  // Claim a free slot for a new request, return -1 when all the slots are occupied.
+  int AllocSlot();
+
+  // Return the slot of a finished request for reuse. The cached data is not cleared, the sequence length
+  // is simply reset, so the slot is reusable immediately.
+  void FreeSlot(int slot);
+
+  // Append the key/value of one decoded token to every layer's cache of the slot. The key_steps and
+  // value_steps hold one token_size chunk per layer. Fails when the slot would exceed max_seq_len.
+  Status AppendStep(int slot, const std::vector<const void *> &key_steps,
+                    const std::vector<const void *> &value_steps);
+
+  // Number of tokens currently cached for the slot.
+  size_t SeqLen(int slot) const;
+
+  // The whole cache tensor of one layer, fed to the incremental decode graph as a constant input.
+  tensor::TensorPtr GetKeyCache(size_t layer) const;
+  tensor::TensorPtr GetValueCache(size_t layer) const;
+
+  size_t num_slots() const { return num_slots_; }
+  size_t max_seq_len() const { return max_seq_len_; }
+
+ private:
+  bool IsValidSlot(int slot) const { return slot >= 0 && static_cast<size_t>(slot) < num_slots_; }
+
+  size_t num_layers_ = 0;
+  size_t num_slots_ = 0;
+  size_t max_seq_len_ = 0;
+  size_t token_size_ = 0;
+  size_t token_bytes_ = 0;
+  std::vector<tensor::TensorPtr> key_caches_;
+  std::vector<tensor::TensorPtr> value_caches_;
+  // Per slot: number of cached tokens, and whether the slot is claimed by a request.
+  std::vector<size_t> slot_seq_lens_;
+  std::vector<bool> slot_used_;
+  // Free slots are recycled in LIFO order so a hot slot's cache lines are reused first.
+  std::vector<int> free_slots_;
+  mutable std::mutex mutex_;
+};
+using KVCacheManagerPtr = std::shared_ptr<KVCacheManager>;
+}  // namespace mindspore
+#endif  // MINDSPORE_LITE_EXTENDRT_UTILS_KV_CACHE_MANAGER_H
@@ -40,7 +40,19 @@ static constexpr int kInvalidIndex = -1;
 // invalid numa node id
 static constexpr int kInvalidNodeId = -1;
 static constexpr int kInvalidRefCount = -1;
+// Blocks up to this size (64M) are served at power-of-two granularity and cached in bucket freelists after free.
+static constexpr size_t kMaxBucketedSize = 64 * 1024 * 1024;
+// The high watermark (256M) of memory held in the bucket freelists before they are trimmed back to the pool.
+static constexpr size_t kBucketCacheHighWatermark = 256 * 1024 * 1024;
 size_t Rounded(size_t size) { return (size + kMemAlginSize - 1) & (~(kMemAlginSize - 1)); }
+
+size_t BucketSize(size_t size) {
+  size_t bucket = kMemAlginSize;
+  while (bucket < size) {
+    bucket <<= 1;
+  }
+  return bucket;
+}
 }  // namespace
 
 void *MemOperator::Allocate(size_t rounded_size, int node_id, size_t *allocate_size) {
@@ -118,6 +130,20 @@ void MemOperator::AddGarbageBlock(const int64_t index) {
 void *MemOperator::Malloc(size_t size) {
   auto rounded_size = Rounded(size);
   std::lock_guard<std::mutex> locker(mutex_);
+  if (rounded_size <= kMaxBucketedSize) {
+    // Dynamic shape models revisit a small set of sizes, so small requests are served at power-of-two
+    // granularity: a repeated shape pops a warm block from its bucket without any split or coalesce work.
+    rounded_size = BucketSize(rounded_size);
+    auto bucket = bucket_free_blocks_.find(rounded_size);
+    if (bucket != bucket_free_blocks_.end() && !bucket->second.empty()) {
+      auto index = bucket->second.back();
+      bucket->second.pop_back();
+      bucket_cache_size_ -= blocks_[index].size_;
+      auto data = blocks_[index].data_;
+      datas_.emplace(data, index);
+      return data;
+    }
+  }
   auto iter = free_blocks_.lower_bound(rounded_size);
   if (iter != free_blocks_.end()) {
     auto index = iter->second;
@@ -178,6 +204,23 @@ void MemOperator::Free(void *ptr) {
 
   auto index = iter->second;
   datas_.erase(iter);
+  Block *block = &blocks_[index];
+  if (block->size_ <= kMaxBucketedSize && block->size_ == BucketSize(block->size_)) {
+    // Keep the block warm in its size bucket. It stays marked used so the neighbors are not coalesced with it
+    // until the cache is trimmed.
+    bucket_free_blocks_[block->size_].push_back(index);
+    bucket_cache_size_ += block->size_;
+    block->ref_count_ = 0;
+    if (bucket_cache_size_ > kBucketCacheHighWatermark) {
+      TrimBucketCache();
+    }
+    return;
+  }
+  FreeBlock(index);
+}
+
+// return a block to the coalescing free list, must be called with mutex_ held
+void MemOperator::FreeBlock(const int64_t index) {
   Block *block = &blocks_[index];
   auto next_index = block->next_index_;
   if (next_index != kInvalidIndex && !blocks_[next_index].used_) {
@@ -217,6 +260,18 @@ void MemOperator::Free(void *ptr) {
   }
 }
 
+// return all cached blocks to the coalescing free list once the cache passes the high watermark, so a burst
+// of shapes that are no longer revisited cannot pin the memory in stale buckets. Must be called with mutex_ held.
+void MemOperator::TrimBucketCache() {
+  for (auto &bucket : bucket_free_blocks_) {
+    for (auto index : bucket.second) {
+      FreeBlock(index);
+    }
+    bucket.second.clear();
+  }
+  bucket_cache_size_ = 0;
+}
+
 void MemOperator::EraseFreeBlock(const int64_t index) {
   auto range = free_blocks_.equal_range(blocks_[index].size_);
   for (auto item = range.first; item != range.second; ++item) {
@@ -260,6 +315,7 @@ MemOperator::~MemOperator() {
 #endif
   }
   free_blocks_.clear();
+  bucket_free_blocks_.clear();
   all_datas_.clear();
   blocks_.clear();
   MS_LOG(DEBUG) << "~MemOperator() end.";
@@ -56,6 +56,8 @@ class MemOperator {
   void EraseFreeBlock(const int64_t index);
   void AddGarbageBlock(const int64_t index);
   void *Allocate(size_t rounded_size, int node_id, size_t *allocate_size);
+  void FreeBlock(const int64_t index);
+  void TrimBucketCache();
 
  private:
   int node_id_ = -1;
@@ -70,6 +72,10 @@ class MemOperator {
   // key: data addr, value: Block index
   std::unordered_map<void *, int64_t> datas_;
   std::unordered_map<void *, size_t> all_datas_;
+  // freed blocks cached at power-of-two granularity, key: bucket size, value: Block indexes
+  std::unordered_map<size_t, std::vector<int64_t>> bucket_free_blocks_;
+  // total bytes held by bucket_free_blocks_, trimmed back to free_blocks_ at the high watermark
+  size_t bucket_cache_size_ = 0;
 };
 
 class DynamicMemManager {
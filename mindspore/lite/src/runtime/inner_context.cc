@@ -19,6 +19,9 @@
 #include "include/errorcode.h"
 #include "src/common/log_adapter.h"
 #include "src/common/log_util.h"
+#ifdef BFC_MEMORY
+#include "src/runtime/numa_pooled_allocator.h"
+#endif
 #ifdef ENABLE_MINDRT
 #include "thread/actor_threadpool.h"
 #include "thread/parallel_threadpool.h"
@@ -159,7 +162,13 @@ int InnerContext::Init() {
   }
 
   if (this->allocator == nullptr) {
+#ifdef BFC_MEMORY
+    // The pooled allocator has no global mutex and allocates the backing pages on the session's NUMA node, which
+    // matters for many concurrent sessions on multi-socket servers.
+    this->allocator = std::make_shared<NUMAPooledAllocator>(node_id_);
+#else
     this->allocator = mindspore::Allocator::Create();
+#endif
     CHECK_NULL_RETURN(this->allocator);
   }
   if (IsDeviceTypeEnabled(DT_NPU)) {
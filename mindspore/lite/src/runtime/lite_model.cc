@@ -16,6 +16,11 @@
 
 #include "src/runtime/lite_model.h"
 #include <sys/stat.h>
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 #include <iostream>
 #include <functional>
 #include <vector>
@@ -37,7 +42,15 @@ constexpr size_t kMaxModelBufferSize = static_cast<size_t>(1024) * 1024 * 1024 *
 
 void LiteModel::Free() {
   if (this->buf != nullptr) {
+#if !defined(_WIN32) && !defined(_WIN64)
+    if (this->model_buf_mmaped_) {
+      (void)munmap(this->buf, this->buf_size_);
+    } else {
+      delete[](this->buf);
+    }
+#else
     delete[](this->buf);
+#endif
     this->buf = nullptr;
   }
   auto nodes_size = this->graph_.all_nodes_.size();
@@ -463,25 +476,73 @@ SchemaTensorWrapper *LiteModel::GetSchemaTensor(const size_t &tensor_index) cons
   return this->inner_all_tensors_.at(tensor_index);
 }
 
+namespace {
+#if !defined(_WIN32) && !defined(_WIN64)
+// Map the model file copy-on-write instead of copying it through the heap: session creation does not touch the
+// weight bytes at all, the pages are demand loaded on first access, and the clean pages stay shared with every
+// other process mapping the same model file.
+char *MmapModelFile(const char *model_path, size_t *size) {
+  auto fd = open(model_path, O_RDONLY);
+  if (fd == -1) {
+    return nullptr;
+  }
+  struct stat file_state {};
+  if (fstat(fd, &file_state) != 0 || file_state.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  auto data = mmap(nullptr, static_cast<size_t>(file_state.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+  *size = static_cast<size_t>(file_state.st_size);
+  return static_cast<char *>(data);
+}
+#endif
+}  // namespace
+
 LiteModel *LiteImportFromPath(const char *model_path) {
   if (model_path == nullptr) {
     MS_LOG(ERROR) << "The model path is nullptr";
     return nullptr;
   }
   size_t size = 0;
-  auto buf = ReadFile(model_path, &size);
+  bool mmaped = false;
+  char *buf = nullptr;
+#if !defined(_WIN32) && !defined(_WIN64)
+  buf = MmapModelFile(model_path, &size);
+  mmaped = (buf != nullptr);
+#endif
+  if (buf == nullptr) {
+    buf = ReadFile(model_path, &size);
+  }
   if (buf == nullptr) {
     return nullptr;
   }
   auto *model = new (std::nothrow) LiteModel(model_path);
   if (model == nullptr) {
     MS_LOG(ERROR) << "new model fail!";
+#if !defined(_WIN32) && !defined(_WIN64)
+    if (mmaped) {
+      (void)munmap(buf, size);
+      return nullptr;
+    }
+#endif
+    delete[] buf;
     return nullptr;
   }
+  model->set_model_buf_mmaped(mmaped);
 
   auto status = model->ConstructModel(buf, size, true);
   if (status != RET_OK) {
     MS_LOG(ERROR) << "construct model failed.";
+#if !defined(_WIN32) && !defined(_WIN64)
+    if (mmaped && model->buf == nullptr) {
+      // ConstructModel drops the ownership of the buffer on failure, unmap it here.
+      (void)munmap(buf, size);
+    }
+#endif
     delete model;
     return nullptr;
   }
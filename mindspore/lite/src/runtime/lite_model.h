@@ -54,6 +54,10 @@ class LiteModel : public Model {
 
   void set_keep_model_buf(bool keep) { this->keep_model_buf_ = keep; }
 
+  bool model_buf_mmaped() const { return this->model_buf_mmaped_; }
+
+  void set_model_buf_mmaped(bool mmaped) { this->model_buf_mmaped_ = mmaped; }
+
   int GetSchemaVersion() const { return schema_version_; }
 
   SchemaTensorWrapper *GetSchemaTensor(const size_t &tensor_index) const;
@@ -314,6 +318,8 @@ class LiteModel : public Model {
  protected:
   std::vector<char *> attr_tensor_bufs_;
   bool keep_model_buf_ = false;
+  // the model buffer is a copy-on-write file mapping instead of a heap buffer, released with munmap
+  bool model_buf_mmaped_ = false;
   int schema_version_ = SCHEMA_VERSION::SCHEMA_CUR;
   // tensor_index --- external_data
   std::vector<SchemaTensorWrapper *> inner_all_tensors_;
@@ -0,0 +1,198 @@
+/**
+ * Copyright 2023 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/runtime/numa_pooled_allocator.h"
+#include <cstdlib>
+#include <new>
+#include "src/runtime/numa_adapter.h"
+#include "src/common/log_adapter.h"
+#include "src/common/utils.h"
+
+namespace mindspore {
+namespace {
+constexpr uint64_t kMemBufMagic = 0x4D534C4954454D42ULL;  // "MSLITEMB"
+}  // namespace
+
+NUMAPooledAllocator::NUMAPooledAllocator(int node_id, size_t aligned_size)
+    : node_id_(node_id), aligned_size_(aligned_size) {
+  max_malloc_size_ = lite::GetMaxMallocSize();
+}
+
+NUMAPooledAllocator::~NUMAPooledAllocator() { Clear(); }
+
+int NUMAPooledAllocator::GetSizeClass(size_t size) {
+  int size_class = kMinSizeClassShift;
+  while (size_class < kMaxSizeClassShift && (static_cast<size_t>(1) << size_class) < size) {
+    ++size_class;
+  }
+  return size_class - kMinSizeClassShift;
+}
+
+NUMAPooledAllocator::MemBuf *NUMAPooledAllocator::PopFreeBuf(int size_class) {
+  auto &sc = size_classes_[size_class];
+  while (sc.lock.test_and_set(std::memory_order_acquire)) {
+  }
+  auto *membuf = sc.free_head;
+  if (membuf != nullptr) {
+    sc.free_head = membuf->next;
+  }
+  sc.lock.clear(std::memory_order_release);
+  return membuf;
+}
+
+void NUMAPooledAllocator::PushFreeBuf(MemBuf *membuf) {
+  auto &sc = size_classes_[membuf->size_class];
+  while (sc.lock.test_and_set(std::memory_order_acquire)) {
+  }
+  membuf->next = sc.free_head;
+  sc.free_head = membuf;
+  sc.lock.clear(std::memory_order_release);
+}
+
+NUMAPooledAllocator::MemBuf *NUMAPooledAllocator::GetMemBuf(void *ptr) const {
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+  // The header pointer is stored just in front of the aligned data pointer.
+  auto *membuf = *(reinterpret_cast<MemBuf **>(ptr) - 1);
+  if (membuf == nullptr || membuf->magic != kMemBufMagic || membuf->buf != ptr) {
+    return nullptr;
+  }
+  return membuf;
+}
+
+void *NUMAPooledAllocator::Malloc(size_t size) {
+  if (size > max_malloc_size_) {
+    MS_LOG(ERROR) << "MallocData out of max_size, size: " << size;
+    return nullptr;
+  }
+  if (total_size_ >= max_malloc_size_) {
+    MS_LOG(ERROR) << "Memory pool is exhausted";
+    return nullptr;
+  }
+  auto size_class = GetSizeClass(size);
+  auto *membuf = PopFreeBuf(size_class);
+  if (membuf != nullptr) {
+    membuf->ref_count_ = 0;
+    membuf->size = size;
+    return membuf->buf;
+  }
+
+  // One fresh buffer per class miss, sized to the class so it is reusable for every request of the class.
+  size_t class_size = static_cast<size_t>(1) << (size_class + kMinSizeClassShift);
+  size_t raw_size = sizeof(MemBuf) + sizeof(MemBuf *) + class_size + aligned_size_;
+  void *raw = nullptr;
+  auto numa_adapter = numa::NUMAAdapter::GetInstance();
+  if (node_id_ >= 0 && numa_adapter->Available()) {
+    raw = numa_adapter->Malloc(node_id_, raw_size);
+  } else {
+    raw = malloc(raw_size);
+  }
+  if (raw == nullptr) {
+    MS_LOG(ERROR) << "malloc membuf return nullptr";
+    return nullptr;
+  }
+  membuf = reinterpret_cast<MemBuf *>(raw);
+  new (membuf) MemBuf();
+  membuf->magic = kMemBufMagic;
+  membuf->ref_count_ = 0;
+  membuf->size = size;
+  membuf->raw_size = raw_size;
+  membuf->size_class = size_class;
+  membuf->buf = reinterpret_cast<void *>(
+    (reinterpret_cast<uintptr_t>(raw) + sizeof(MemBuf) + sizeof(MemBuf *) + aligned_size_ - 1) &
+    (~(aligned_size_ - 1)));
+  *(reinterpret_cast<MemBuf **>(membuf->buf) - 1) = membuf;
+  total_size_ += class_size;
+  {
+    std::lock_guard<std::mutex> lock(all_blocks_mutex_);
+    all_blocks_.push_back(membuf);
+  }
+  return membuf->buf;
+}
+
+void NUMAPooledAllocator::Free(void *ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  auto *membuf = GetMemBuf(ptr);
+  if (membuf == nullptr) {
+    // Not a pooled buffer, keep the DefaultAllocator fallback behavior.
+    free(ptr);
+    return;
+  }
+  membuf->ref_count_ = 0;
+  PushFreeBuf(membuf);
+}
+
+int NUMAPooledAllocator::RefCount(void *ptr) {
+  auto *membuf = GetMemBuf(ptr);
+  if (membuf == nullptr) {
+    return -1;
+  }
+  return std::atomic_load(&membuf->ref_count_);
+}
+
+int NUMAPooledAllocator::SetRefCount(void *ptr, int ref_count) {
+  auto *membuf = GetMemBuf(ptr);
+  if (membuf == nullptr) {
+    return -1;
+  }
+  std::atomic_store(&membuf->ref_count_, ref_count);
+  return ref_count;
+}
+
+int NUMAPooledAllocator::IncRefCount(void *ptr, int ref_count) {
+  auto *membuf = GetMemBuf(ptr);
+  if (membuf == nullptr) {
+    return -1;
+  }
+  return std::atomic_fetch_add(&membuf->ref_count_, ref_count) + ref_count;
+}
+
+int NUMAPooledAllocator::DecRefCount(void *ptr, int ref_count) {
+  auto *membuf = GetMemBuf(ptr);
+  if (membuf == nullptr) {
+    return -1;
+  }
+  return std::atomic_fetch_sub(&membuf->ref_count_, ref_count) - ref_count;
+}
+
+void NUMAPooledAllocator::FreeBackingMemory(MemBuf *membuf) {
+  auto numa_adapter = numa::NUMAAdapter::GetInstance();
+  if (node_id_ >= 0 && numa_adapter->Available()) {
+    numa_adapter->Free(membuf, membuf->raw_size);
+  } else {
+    free(membuf);
+  }
+}
+
+void NUMAPooledAllocator::Clear() {
+  for (auto &sc : size_classes_) {
+    while (sc.lock.test_and_set(std::memory_order_acquire)) {
+    }
+    sc.free_head = nullptr;
+    sc.lock.clear(std::memory_order_release);
+  }
+  std::lock_guard<std::mutex> lock(all_blocks_mutex_);
+  for (auto *membuf : all_blocks_) {
+    membuf->magic = 0;
+    FreeBackingMemory(membuf);
+  }
+  all_blocks_.clear();
+  total_size_ = 0;
+}
+}  // namespace mindspore
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2023 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_NUMA_POOLED_ALLOCATOR_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_NUMA_POOLED_ALLOCATOR_H_
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "include/api/allocator.h"
+
+namespace mindspore {
+// A pooled allocator with power-of-two size-class freelists and NUMA-local backing memory.
+//
+// Unlike DefaultAllocator, there is no global mutex and no buf-to-header map: each buffer carries its header in
+// front of the data pointer, so the ref-count operations are pure atomics and Malloc/Free only take the short
+// spinlock of one size class. The backing pages are allocated on the configured NUMA node through NUMAAdapter, so
+// tensor buffers land on the socket running the session.
+class NUMAPooledAllocator : public Allocator {
+ public:
+  explicit NUMAPooledAllocator(int node_id = -1, size_t aligned_size = 32);
+  ~NUMAPooledAllocator() override;
+  void *Malloc(size_t size) override;
+  void Free(void *ptr) override;
+  int RefCount(void *ptr) override;
+  int SetRefCount(void *ptr, int ref_count) override;
+  int DecRefCount(void *ptr, int ref_count) override;
+  int IncRefCount(void *ptr, int ref_count) override;
+  size_t total_size() const { return total_size_; }
+  void Clear();
+
+ private:
+  struct MemBuf {
+    uint64_t magic = 0;
+    std::atomic_int ref_count_ = {0};
+    size_t size = 0;
+    size_t raw_size = 0;
+    int size_class = 0;
+    void *buf = nullptr;
+    MemBuf *next = nullptr;
+  };
+
+  // A size-class freelist guarded by its own spinlock, so concurrent sessions on different classes never contend.
+  struct SizeClass {
+    std::atomic_flag lock = ATOMIC_FLAG_INIT;
+    MemBuf *free_head = nullptr;
+  };
+
+  // The smallest class holds 64B buffers, the largest 2GB, each class doubles the previous one.
+  static constexpr int kMinSizeClassShift = 6;
+  static constexpr int kMaxSizeClassShift = 31;
+  static constexpr int kNumSizeClasses = kMaxSizeClassShift - kMinSizeClassShift + 1;
+
+  static int GetSizeClass(size_t size);
+  MemBuf *PopFreeBuf(int size_class);
+  void PushFreeBuf(MemBuf *membuf);
+  MemBuf *GetMemBuf(void *ptr) const;
+  void FreeBackingMemory(MemBuf *membuf);
+
+  int node_id_;
+  size_t aligned_size_;
+  std::atomic<size_t> total_size_ = {0};
+  size_t max_malloc_size_ = 0;
+  std::array<SizeClass, kNumSizeClasses> size_classes_;
+  // All buffers ever created, only touched when a fresh buffer is allocated and in Clear.
+  std::mutex all_blocks_mutex_;
+  std::vector<MemBuf *> all_blocks_;
+};
+}  // namespace mindspore
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_NUMA_POOLED_ALLOCATOR_H_
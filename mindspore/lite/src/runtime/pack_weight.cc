@@ -14,8 +14,22 @@
  * limitations under the License.
  */
 #include "src/runtime/pack_weight.h"
+#include <cstring>
 #include "src/runtime/dynamic_mem_allocator.h"
 namespace mindspore::lite {
+// Models with identical buffer content (replicas of the same model) join one share group, so their packed
+// weights can be deduplicated. The exact content compare runs once per model load.
+size_t PackWeight::FindShareGroup(const char *model_base, size_t model_size) {
+  for (auto &item : buf_model_weight_) {
+    auto &weight = item.second;
+    if (weight->model_base != nullptr && weight->model_base != model_base && weight->model_buf_size == model_size &&
+        memcmp(weight->model_base, model_base, model_size) == 0) {
+      return weight->share_group;
+    }
+  }
+  return next_share_group_++;
+}
+
 STATUS PackWeight::InitWeightManagerByBuf(const char *model_buf, size_t model_size, int numa_id, bool copy_buf) {
   MS_CHECK_TRUE_MSG(model_buf != nullptr, RET_ERROR, "model buf is nullptr in pack weight manager.");
   copy_buf_ = copy_buf;
@@ -55,10 +69,16 @@ STATUS PackWeight::InitWeightManagerByBuf(const char *model_buf, size_t model_si
       numa_model_buf_[model_buf].push_back(numa_id);
       model_buf_map_[model_buf].push_back(new_model_buf);
     }
+    model_const_weight->model_base = new_model_buf;
+    model_const_weight->model_buf_size = model_size;
+    model_const_weight->share_group = FindShareGroup(new_model_buf, model_size);
     buf_model_weight_[new_model_buf] = model_const_weight;
     buf_model_weight_[new_model_buf]->allocator = allocator;
     model_const_weight->numa_id = numa_id;
   } else {
+    model_const_weight->model_base = model_buf;
+    model_const_weight->model_buf_size = model_size;
+    model_const_weight->share_group = FindShareGroup(model_buf, model_size);
     buf_model_weight_[model_buf] = model_const_weight;
     buf_model_weight_[model_buf]->allocator = allocator;
   }
@@ -168,6 +188,32 @@ void *PackWeight::GetPackData(const void *tensor_data, const size_t size, bool *
       *is_packed = true;
       return packed_tensor_data;
     } else {
+      // A replica model with identical content may have packed this weight already; borrow its packed buffer
+      // instead of packing the same bytes again.
+      auto origin = static_cast<const char *>(tensor_data);
+      bool in_model_buf = model_weight->model_base != nullptr && origin >= model_weight->model_base &&
+                          origin < model_weight->model_base + model_weight->model_buf_size;
+      if (in_model_buf) {
+        auto share_key = std::make_tuple(model_weight->share_group, model_weight->numa_id,
+                                         static_cast<size_t>(origin - model_weight->model_base), size);
+        auto share_iter = shared_packed_data_.find(share_key);
+        if (share_iter != shared_packed_data_.end()) {
+          origin_packed_weight[tensor_data] = share_iter->second;
+          (void)model_weight->borrowed_packed_data.insert(share_iter->second);
+          *is_packed = true;
+          return share_iter->second;
+        }
+        auto weight_allocator = model_weight->allocator;
+        packed_tensor_data = weight_allocator->Malloc(size);
+        if (packed_tensor_data == nullptr) {
+          MS_LOG(ERROR) << "malloc failed.";
+          return nullptr;
+        }
+        origin_packed_weight[tensor_data] = packed_tensor_data;
+        shared_packed_data_[share_key] = packed_tensor_data;
+        *is_packed = false;
+        return packed_tensor_data;
+      }
       auto weight_allocator = model_weight->allocator;
       packed_tensor_data = weight_allocator->Malloc(size);
       if (packed_tensor_data == nullptr) {
@@ -191,11 +237,15 @@ void PackWeight::FreePackedWeight(ModelConstWeight *weight) {
     auto allocator = weight->allocator;
     MS_CHECK_TRUE_RET_VOID(allocator != nullptr);
     if (packed_data != nullptr) {
-      allocator->Free(packed_data);
+      // borrowed buffers are owned and freed by the replica model which packed them
+      if (weight->borrowed_packed_data.find(packed_data) == weight->borrowed_packed_data.end()) {
+        allocator->Free(packed_data);
+      }
       packed_data = nullptr;
     }
   }
   weight->origin_and_packed_pair.clear();
+  weight->borrowed_packed_data.clear();
 }
 
 void PackWeight::FreeTensorData(ModelConstWeight *weight) {
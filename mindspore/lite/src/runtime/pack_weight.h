@@ -19,6 +19,7 @@
 #include <map>
 #include <string>
 #include <algorithm>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include <set>
@@ -35,6 +36,13 @@ struct ModelConstWeight {
   int numa_id = -1;
   std::unordered_map<int, void *> tensors_data;
   std::set<void *> fp16_fp32_data;
+  // replica dedup: models with identical buffer content belong to one share group, so every distinct weight is
+  // packed only once per numa node no matter how many replicas are loaded
+  const char *model_base = nullptr;
+  size_t model_buf_size = 0;
+  size_t share_group = 0;
+  // packed buffers borrowed from a replica model, not owned and not freed by this model
+  std::set<void *> borrowed_packed_data;
 };
 
 class PackWeight {
@@ -52,6 +60,7 @@ class PackWeight {
   void FreePackedWeight(ModelConstWeight *weight);
   void FreeTensorData(ModelConstWeight *weight);
   void FreeFp16ToFp32Data(ModelConstWeight *weight);
+  size_t FindShareGroup(const char *model_base, size_t model_size);
 
   bool copy_buf_ = false;
   std::mutex mtx_weight_;
@@ -59,6 +68,10 @@ class PackWeight {
   std::unordered_map<const char *, std::vector<int>> numa_model_buf_;
   std::unordered_map<const char *, std::vector<char *>> model_buf_map_;
   std::unordered_map<void *, void *> fp16_fp32_data_pair_;
+  size_t next_share_group_ = 1;
+  // key: share group, numa id, weight offset in the model buf, packed size; value: the packed data of the
+  // replica which packed the weight first
+  std::map<std::tuple<size_t, int, size_t, size_t>, void *> shared_packed_data_;
 };
 }  // namespace mindspore::lite
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_PACK_WEIGHT_H_
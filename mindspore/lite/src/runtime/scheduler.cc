@@ -25,6 +25,8 @@
 #include "include/errorcode.h"
 #include "src/common/graph_util.h"
 #include "src/common/utils.h"
+#include "src/common/common.h"
+#include "src/common/config_file.h"
 #include "src/runtime/kernel_registry.h"
 #ifndef CUSTOM_KERNEL_REGISTRY_CLIP
 #include "include/registry/register_kernel.h"
@@ -429,6 +431,13 @@ int Scheduler::Schedule(std::vector<kernel::KernelExec *> *dst_kernels) {
     return check_input_ret;
   }
 
+  if (config_info_ != nullptr) {
+    auto plan_iter = config_info_->find(kThreadNumPlan);
+    if (plan_iter != config_info_->end()) {
+      ParserThreadNumPlan(&(plan_iter->second), &thread_num_plan_);
+    }
+  }
+
   shape_fusion_pass_ =
     std::make_shared<ShapeFusionPass>(context_, reinterpret_cast<LiteModel *>(src_model_), src_tensors_);
   MS_CHECK_TRUE_RET(shape_fusion_pass_ != nullptr, RET_ERROR);
@@ -730,7 +739,7 @@ int Scheduler::InferNodeShape(const lite::LiteGraph::Node *node) {
   }
 
   parameter->quant_type_ = node->quant_type_;
-  parameter->thread_num_ = context_->thread_num_;
+  parameter->thread_num_ = NodeThreadNum(node->name_);
   if (node->output_indices_.empty()) {
     MS_LOG(ERROR) << "The output size is invalid";
     if (parameter->destroy_func_ != nullptr) {
@@ -776,6 +785,15 @@ int Scheduler::InferNodeShape(const lite::LiteGraph::Node *node) {
   return ret;
 }
 
+int Scheduler::NodeThreadNum(const std::string &node_name) const {
+  auto iter = thread_num_plan_.find(node_name);
+  if (iter == thread_num_plan_.end()) {
+    return context_->thread_num_;
+  }
+  // A tuned thread num never exceeds the context thread num, the bind core list only covers that many cores.
+  return MSMIN(iter->second, context_->thread_num_);
+}
+
 void Scheduler::FreeOpParameters() {
   for (auto &param : op_parameters_) {
     if (param.second != nullptr) {
@@ -70,6 +70,9 @@ class Scheduler {
   int InferPartialShape(const LiteGraph::Node *node);
   int InferCallShape(const LiteGraph::Node *node);
   int InferNodeShape(const LiteGraph::Node *node);
+  // thread num for a node: the tuned value from the thread_num_plan config section if present, otherwise
+  // the context thread num
+  int NodeThreadNum(const std::string &node_name) const;
   void FreeOpParameters();
   int InferSubGraphShape(size_t subgraph_index);
   // schedule a node to kernel according to context and kernels registered
@@ -169,6 +172,7 @@ class Scheduler {
   ControlFlowSchedulerPtr control_flow_scheduler_ = nullptr;
   int schema_version_ = SCHEMA_VERSION::SCHEMA_CUR;
   std::map<std::string, TypeId> *execution_plan_ = nullptr;
+  std::map<std::string, int> thread_num_plan_{};
   const std::map<std::string, std::map<std::string, std::string>> *config_info_ = nullptr;
   std::shared_ptr<ShapeFusionPass> shape_fusion_pass_ = nullptr;
 };
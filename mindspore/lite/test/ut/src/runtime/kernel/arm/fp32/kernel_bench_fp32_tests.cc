@@ -0,0 +1,225 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "src/common/log_adapter.h"
+#include "common/common_test.h"
+#include "nnacl/matmul_parameter.h"
+#include "nnacl/conv_parameter.h"
+#include "mindspore/lite/src/runtime/kernel/cpu/fp32/matmul_fp32.h"
+#include "mindspore/lite/src/runtime/kernel_registry.h"
+#include "mindspore/lite/src/runtime/inner_context.h"
+
+namespace mindspore {
+namespace {
+constexpr int kWarmUpRuns = 2;
+constexpr int kMeasuredRuns = 10;
+// Accept up to 10% below the stored baseline before reporting a regression, to absorb machine noise.
+constexpr double kBaselineTolerance = 0.9;
+
+// The SoC identity the results are keyed by: the Hardware line of /proc/cpuinfo on ARM boards
+// (the same source cpu_info.cc parses), the machine architecture otherwise.
+std::string GetSocKey() {
+  std::ifstream cpu_info("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpu_info, line)) {
+    if (line.rfind("Hardware", 0) == 0) {
+      auto pos = line.find(':');
+      if (pos != std::string::npos && pos + 2 <= line.size()) {
+        std::string soc = line.substr(pos + 1);
+        std::ostringstream oss;
+        for (auto c : soc) {
+          oss << ((c == ' ' || c == '\t') ? '_' : c);
+        }
+        auto key = oss.str();
+        while (!key.empty() && key.front() == '_') {
+          key.erase(key.begin());
+        }
+        return key;
+      }
+    }
+  }
+#if defined(ENABLE_ARM64)
+  return "arm64_generic";
+#elif defined(ENABLE_ARM)
+  return "arm_generic";
+#else
+  return "x86_generic";
+#endif
+}
+
+// Baselines are loaded once from the file named by the KERNEL_BENCH_BASELINE environment variable,
+// one "<result key> <gflops>" pair per line. Without the variable the benches only report.
+const std::map<std::string, double> &Baselines() {
+  static std::map<std::string, double> baselines = []() {
+    std::map<std::string, double> loaded;
+    auto *path = std::getenv("KERNEL_BENCH_BASELINE");
+    if (path != nullptr) {
+      std::ifstream file(path);
+      std::string key;
+      double gflops = 0;
+      while (file >> key >> gflops) {
+        loaded[key] = gflops;
+      }
+    }
+    return loaded;
+  }();
+  return baselines;
+}
+
+void FillRandom(lite::Tensor *tensor) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  auto *data = reinterpret_cast<float *>(tensor->MutableData());
+  for (int i = 0; i < tensor->ElementsNum(); i++) {
+    data[i] = dist(gen);
+  }
+}
+
+lite::Tensor *MakeTensor(const std::vector<int> &shape) {
+  auto *tensor = new lite::Tensor(kNumberTypeFloat32, shape, mindspore::NHWC, lite::Category::CONST_TENSOR);
+  tensor->MallocData();
+  FillRandom(tensor);
+  return tensor;
+}
+
+// Run the prepared kernel kWarmUpRuns + kMeasuredRuns times, report GFLOPS keyed by
+// (kernel, shape, thread count, SoC) and diff against the stored baseline when one is loaded.
+void MeasureKernel(kernel::LiteKernel *kernel, const std::string &name, const std::string &shape, int thread_num,
+                   double flops_per_run) {
+  for (int i = 0; i < kWarmUpRuns; i++) {
+    ASSERT_EQ(kernel->Run(), 0);
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kMeasuredRuns; i++) {
+    ASSERT_EQ(kernel->Run(), 0);
+  }
+  auto end = std::chrono::steady_clock::now();
+  auto total_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  double gflops = (total_ns > 0) ? (flops_per_run * kMeasuredRuns) / total_ns : 0;
+
+  std::string key = GetSocKey() + "|" + name + "|" + shape + "|t" + std::to_string(thread_num);
+  std::cout << "KERNEL_BENCH_JSON: {\"key\":\"" << key << "\",\"gflops\":" << gflops << "}" << std::endl;
+
+  auto iter = Baselines().find(key);
+  if (iter != Baselines().end()) {
+    EXPECT_GE(gflops, iter->second * kBaselineTolerance)
+      << "Kernel " << key << " regressed against the stored baseline of " << iter->second << " GFLOPS.";
+  }
+}
+
+void BenchMatMul(int m, int k, int n, int thread_num) {
+  auto matmul_param = new MatMulParameter();
+  matmul_param->a_transpose_ = false;
+  matmul_param->b_transpose_ = false;
+  matmul_param->has_bias_ = false;
+
+  std::vector<lite::Tensor *> inputs = {MakeTensor({m, k}), MakeTensor({k, n})};
+  std::vector<lite::Tensor *> outputs = {MakeTensor({m, n})};
+
+  auto ctx = new lite::InnerContext;
+  ctx->thread_num_ = thread_num;
+  ASSERT_EQ(lite::RET_OK, ctx->Init());
+  auto *kernel = new kernel::MatmulCPUKernel(reinterpret_cast<OpParameter *>(matmul_param), inputs, outputs, ctx);
+  ASSERT_EQ(kernel->Prepare(), 0);
+
+  std::string shape = std::to_string(m) + "x" + std::to_string(k) + "x" + std::to_string(n);
+  MeasureKernel(kernel, "matmul", shape, thread_num, 2.0 * m * k * n);
+
+  delete kernel;
+  delete ctx;
+  for (auto *t : inputs) delete t;
+  for (auto *t : outputs) delete t;
+}
+
+void BenchConv(int hw, int in_channel, int kernel_hw, int out_channel, int thread_num) {
+  auto conv_param = new ConvParameter();
+  conv_param->input_batch_ = 1;
+  conv_param->input_h_ = hw;
+  conv_param->input_w_ = hw;
+  conv_param->input_channel_ = in_channel;
+  conv_param->output_batch_ = 1;
+  conv_param->output_h_ = hw;
+  conv_param->output_w_ = hw;
+  conv_param->output_channel_ = out_channel;
+  conv_param->kernel_h_ = kernel_hw;
+  conv_param->kernel_w_ = kernel_hw;
+  conv_param->stride_h_ = 1;
+  conv_param->stride_w_ = 1;
+  conv_param->dilation_h_ = 1;
+  conv_param->dilation_w_ = 1;
+  conv_param->pad_u_ = kernel_hw / 2;
+  conv_param->pad_l_ = kernel_hw / 2;
+  conv_param->group_ = 1;
+  conv_param->act_type_ = ActType_No;
+
+  std::vector<lite::Tensor *> inputs = {MakeTensor({1, hw, hw, in_channel}),
+                                        MakeTensor({out_channel, kernel_hw, kernel_hw, in_channel}),
+                                        MakeTensor({out_channel})};
+  std::vector<lite::Tensor *> outputs = {MakeTensor({1, hw, hw, out_channel})};
+
+  auto ctx = new lite::InnerContext;
+  ctx->thread_num_ = thread_num;
+  ASSERT_EQ(lite::RET_OK, ctx->Init());
+  // Go through the registry creator so the shape picks the real production variant
+  // (1x1, winograd, sliding window or the generic im2col kernel).
+  kernel::KernelKey desc = {kernel::KERNEL_ARCH::kCPU, kNumberTypeFloat32, NHWC, schema::PrimitiveType_Conv2DFusion};
+  auto creator = lite::KernelRegistry::GetInstance()->GetCreator(desc);
+  ASSERT_NE(creator, nullptr);
+  auto *kernel = creator(inputs, outputs, reinterpret_cast<OpParameter *>(conv_param), ctx, desc);
+  ASSERT_NE(kernel, nullptr);
+  ASSERT_EQ(kernel->Prepare(), 0);
+
+  std::string shape = std::to_string(hw) + "x" + std::to_string(hw) + "x" + std::to_string(in_channel) + "_k" +
+                      std::to_string(kernel_hw) + "_o" + std::to_string(out_channel);
+  double flops_per_run = 2.0 * hw * hw * out_channel * kernel_hw * kernel_hw * in_channel;
+  MeasureKernel(kernel, "conv2d", shape, thread_num, flops_per_run);
+
+  delete kernel;
+  delete ctx;
+  for (auto *t : inputs) delete t;
+  for (auto *t : outputs) delete t;
+}
+}  // namespace
+
+class TestKernelBenchFp32 : public mindspore::CommonTest {
+ public:
+  TestKernelBenchFp32() {}
+};
+
+TEST_F(TestKernelBenchFp32, MatMul) {
+  for (int thread_num : {1, 2, 4}) {
+    BenchMatMul(64, 256, 64, thread_num);
+    BenchMatMul(256, 256, 256, thread_num);
+    BenchMatMul(1, 1024, 1024, thread_num);
+  }
+}
+
+TEST_F(TestKernelBenchFp32, Conv2D) {
+  for (int thread_num : {1, 2, 4}) {
+    BenchConv(56, 64, 1, 128, thread_num);
+    BenchConv(112, 32, 3, 32, thread_num);
+  }
+}
@@ -0,0 +1,47 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESTS_UT_CPP_BENCHMARK_BENCHMARK_UTILS_H_
+#define TESTS_UT_CPP_BENCHMARK_BENCHMARK_UTILS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+
+namespace UT {
+namespace bench {
+// Time one run of 'body', which must perform 'num_ops' operations of the measured primitive, and print
+// one machine readable result line:
+//   BENCHMARK_JSON: {"name":"...","num_ops":N,"ns_per_op":X,"ops_per_sec":Y}
+// The benches live inside the unit test binary (select them with --gtest_filter='Benchmark*'), so CI
+// can grep the BENCHMARK_JSON lines out of the test log and track the deltas per commit.
+inline void RunBench(const std::string &name, size_t num_ops, const std::function<void()> &body) {
+  // One warm-up run so that lazily initialized state is not billed to the measured run.
+  body();
+  auto start = std::chrono::steady_clock::now();
+  body();
+  auto end = std::chrono::steady_clock::now();
+  auto total_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  double ns_per_op = (num_ops == 0) ? 0 : total_ns / static_cast<double>(num_ops);
+  double ops_per_sec = (ns_per_op > 0) ? 1e9 / ns_per_op : 0;
+  std::cout << "BENCHMARK_JSON: {\"name\":\"" << name << "\",\"num_ops\":" << num_ops
+            << ",\"ns_per_op\":" << ns_per_op << ",\"ops_per_sec\":" << ops_per_sec << "}" << std::endl;
+}
+}  // namespace bench
+}  // namespace UT
+
+#endif  // TESTS_UT_CPP_BENCHMARK_BENCHMARK_UTILS_H_
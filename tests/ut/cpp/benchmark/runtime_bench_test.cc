@@ -0,0 +1,210 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/common_test.h"
+#include "benchmark/benchmark_utils.h"
+
+#include "mindrt/src/actor/actormgr.h"
+#include "mindrt/include/async/async.h"
+#include "thread/threadpool.h"
+#include "distributed/embedding_cache/embedding_hash_map.h"
+#include "runtime/data_queue/blocking_queue.h"
+#include "ir/anf.h"
+#include "ir/func_graph.h"
+#include "ir/graph_utils.h"
+#include "mindspore/core/ops/core_ops.h"
+
+namespace mindspore {
+namespace {
+// A pair of these actors bounce a message back and forth, so one handled message equals one actor
+// message round trip through the mailbox and the actor thread pool.
+class PingPongActor : public ActorBase {
+ public:
+  explicit PingPongActor(const std::string &name) : ActorBase(name) {}
+  ~PingPongActor() override = default;
+
+  void Handle(const AID &peer, int remaining, std::promise<void> *done) {
+    if (remaining == 0) {
+      done->set_value();
+      return;
+    }
+    (void)Async(peer, &PingPongActor::Handle, GetAID(), remaining - 1, done);
+  }
+};
+
+// A host-memory ring buffer so the BlockingQueue synchronization can be measured without a device.
+class HostDataQueue : public device::DataQueue {
+ public:
+  explicit HostDataQueue(const size_t capacity) : DataQueue(capacity), ring_(capacity) {}
+  ~HostDataQueue() override = default;
+
+  device::BlockQueueStatus_T Push(std::vector<device::DataQueueItem> data) override {
+    ring_[tail_] = std::move(data);
+    tail_ = (tail_ + 1) % capacity_;
+    ++size_;
+    return device::SUCCESS;
+  }
+  device::BlockQueueStatus_T Front(std::vector<device::DataQueueItem> *data) const override {
+    *data = ring_[head_];
+    return device::SUCCESS;
+  }
+  device::BlockQueueStatus_T Pop() override {
+    head_ = (head_ + 1) % capacity_;
+    --size_;
+    return device::SUCCESS;
+  }
+  bool Destroy() override { return true; }
+
+ private:
+  std::vector<std::vector<device::DataQueueItem>> ring_;
+};
+}  // namespace
+
+class BenchmarkRuntime : public UT::Common {
+ public:
+  BenchmarkRuntime() = default;
+};
+
+/// Feature: runtime benchmarks
+/// Description: Measure the actor message round trip through the mindrt mailbox.
+/// Expectation: The round trips complete and a BENCHMARK_JSON line is printed.
+TEST_F(BenchmarkRuntime, actor_message_round_trip) {
+  auto actor_manager = ActorMgr::GetActorMgrRef();
+  ASSERT_NE(actor_manager, nullptr);
+  ASSERT_EQ(actor_manager->Initialize(true, 2, 2), MINDRT_OK);
+  auto ping = std::make_shared<PingPongActor>("benchmark_ping");
+  auto pong = std::make_shared<PingPongActor>("benchmark_pong");
+  (void)actor_manager->Spawn(ping);
+  (void)actor_manager->Spawn(pong);
+
+  constexpr int kRoundTrips = 10000;
+  UT::bench::RunBench("actor_message_round_trip", kRoundTrips, [&]() {
+    std::promise<void> done;
+    auto finished = done.get_future();
+    (void)Async(ping->GetAID(), &PingPongActor::Handle, pong->GetAID(), kRoundTrips, &done);
+    finished.wait();
+  });
+
+  actor_manager->Terminate(ping->GetAID());
+  actor_manager->Terminate(pong->GetAID());
+}
+
+/// Feature: runtime benchmarks
+/// Description: Measure ThreadPool::ParallelLaunch dispatch cost at several task counts.
+/// Expectation: All launches succeed and one BENCHMARK_JSON line per task count is printed.
+TEST_F(BenchmarkRuntime, thread_pool_parallel_launch) {
+  constexpr size_t kThreadNum = 4;
+  std::unique_ptr<ThreadPool> pool(ThreadPool::CreateThreadPool(kThreadNum));
+  ASSERT_NE(pool, nullptr);
+
+  std::atomic<size_t> counter{0};
+  auto func = [](void *content, int, float, float) -> int {
+    auto *cnt = reinterpret_cast<std::atomic<size_t> *>(content);
+    (void)cnt->fetch_add(1, std::memory_order_relaxed);
+    return 0;
+  };
+
+  constexpr int kLaunches = 1000;
+  for (int task_num : {1, 4, 16}) {
+    UT::bench::RunBench("thread_pool_parallel_launch_tasks_" + std::to_string(task_num), kLaunches, [&]() {
+      for (int i = 0; i < kLaunches; ++i) {
+        ASSERT_EQ(pool->ParallelLaunch(func, &counter, task_num), THREAD_OK);
+      }
+    });
+  }
+  EXPECT_GT(counter.load(), 0);
+}
+
+/// Feature: runtime benchmarks
+/// Description: Measure EmbeddingHashMap id lookup and insertion with eviction pressure.
+/// Expectation: Every id gets a valid slot and a BENCHMARK_JSON line is printed.
+TEST_F(BenchmarkRuntime, embedding_hash_map_lookup) {
+  constexpr size_t kCapacity = 4096;
+  distributed::EmbeddingHashMap hash_map(0, kCapacity);
+  std::vector<int> swap_out_index(kCapacity);
+  std::vector<int> swap_out_ids(kCapacity);
+
+  constexpr size_t kLookups = 100000;
+  size_t step = 1;
+  UT::bench::RunBench("embedding_hash_map_lookup", kLookups, [&]() {
+    for (size_t i = 0; i < kLookups; ++i) {
+      size_t swap_out_size = 0;
+      bool need_wait_graph = false;
+      // Twice the capacity of distinct ids keeps both the hit path and the eviction path warm.
+      auto id = static_cast<int>(i % (kCapacity * 2));
+      auto index = hash_map.ParseData(id, swap_out_index.data(), swap_out_ids.data(), step, step, &swap_out_size,
+                                      &need_wait_graph);
+      ASSERT_NE(index, distributed::INVALID_INDEX_VALUE);
+      ++step;
+    }
+  });
+}
+
+/// Feature: runtime benchmarks
+/// Description: Measure TopoSort on a synthetic chain graph.
+/// Expectation: Every sort visits the whole graph and a BENCHMARK_JSON line is printed.
+TEST_F(BenchmarkRuntime, topo_sort_chain) {
+  constexpr size_t kChainLength = 1024;
+  auto func_graph = std::make_shared<FuncGraph>();
+  AnfNodePtr node = func_graph->add_parameter();
+  for (size_t i = 0; i < kChainLength; ++i) {
+    node = func_graph->NewCNode({NewValueNode(prim::kPrimScalarAdd), node, node});
+  }
+  func_graph->set_output(node);
+
+  constexpr size_t kSorts = 100;
+  UT::bench::RunBench("topo_sort_chain_" + std::to_string(kChainLength), kSorts * kChainLength, [&]() {
+    for (size_t i = 0; i < kSorts; ++i) {
+      auto nodes = TopoSort(func_graph->get_return());
+      ASSERT_GT(nodes.size(), kChainLength);
+    }
+  });
+}
+
+/// Feature: runtime benchmarks
+/// Description: Measure BlockingQueue push/front/pop over a host-memory data queue.
+/// Expectation: All operations succeed and a BENCHMARK_JSON line is printed.
+TEST_F(BenchmarkRuntime, blocking_queue_push_pop) {
+  constexpr size_t kQueueCapacity = 64;
+  std::shared_ptr<device::DataQueue> data_queue;
+  try {
+    data_queue = std::make_shared<HostDataQueue>(kQueueCapacity);
+  } catch (const std::exception &) {
+    // The DataQueue base class binds to the device context of the current device target, which is not
+    // available in every unit test configuration.
+    GTEST_SKIP() << "No device context available for the data queue.";
+  }
+  device::BlockingQueue queue;
+  ASSERT_EQ(queue.Create(data_queue), device::SUCCESS);
+
+  std::vector<device::DataQueueItem> item(1);
+  constexpr size_t kTransfers = 100000;
+  UT::bench::RunBench("blocking_queue_push_pop", kTransfers, [&]() {
+    for (size_t i = 0; i < kTransfers; ++i) {
+      ASSERT_EQ(queue.Push(item, 0), device::SUCCESS);
+      std::vector<device::DataQueueItem> front;
+      ASSERT_EQ(queue.Front(&front), device::SUCCESS);
+      ASSERT_EQ(queue.Pop(), device::SUCCESS);
+    }
+  });
+  (void)queue.Destroy();
+}
+}  // namespace mindspore
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+
+#include "common/common.h"
+#include "benchmark/benchmark_utils.h"
+#include "minddata/dataset/engine/connector.h"
+#include "minddata/dataset/util/task_manager.h"
+
+using namespace mindspore::dataset;
+
+class MindDataBenchmarkConnector : public UT::Common {
+ public:
+  MindDataBenchmarkConnector() = default;
+};
+
+/// Feature: runtime benchmarks
+/// Description: Measure Connector throughput with a single producer and a single consumer.
+/// Expectation: All elements pass through in order and a BENCHMARK_JSON line is printed.
+TEST_F(MindDataBenchmarkConnector, connector_throughput_1p1c) {
+  constexpr uint32_t kNumElements = 100000;
+  constexpr int32_t kQueueCapacity = 64;
+
+  UT::bench::RunBench("connector_throughput_1p1c", kNumElements, [&]() {
+    auto tg = std::make_unique<TaskGroup>();
+    auto conn = std::make_shared<Connector<uint32_t>>(1, 1, kQueueCapacity);
+    ASSERT_TRUE(conn->Register(tg.get()).IsOk());
+
+    Status rc = tg->CreateAsyncTask("BenchProducer", [&]() -> Status {
+      TaskManager::FindMe()->Post();
+      for (uint32_t i = 0; i < kNumElements; i++) {
+        RETURN_IF_NOT_OK(conn->Push(0, i));
+      }
+      return Status::OK();
+    });
+    ASSERT_TRUE(rc.IsOk());
+
+    rc = tg->CreateAsyncTask("BenchConsumer", [&]() -> Status {
+      TaskManager::FindMe()->Post();
+      for (uint32_t i = 0; i < kNumElements; i++) {
+        uint32_t val = 0;
+        RETURN_IF_NOT_OK(conn->Pop(0, &val));
+        CHECK_FAIL_RETURN_UNEXPECTED(val == i, "Out of order element from the connector.");
+      }
+      return Status::OK();
+    });
+    ASSERT_TRUE(rc.IsOk());
+
+    tg->join_all(Task::WaitFlag::kNonBlocking);
+    ASSERT_TRUE(tg->GetTaskErrorIfAny().IsOk());
+  });
+}
@@ -322,6 +322,63 @@ TEST_F(TestDynamicNetworking, HeartbeatTimeout) {
   msn.Finalize(true);
 }
 
+/// Feature: test sub-second heartbeat timeout configured through environment variables.
+/// Description: start a cluster with one meta server node and two compute graph nodes with a millisecond level
+/// node timeout, and then kill one of the compute graph nodes.
+/// Expectation: the killed compute graph node is detected as timed out within a few seconds.
+TEST_F(TestDynamicNetworking, SubSecondHeartbeatTimeout) {
+  // Start the meta server node in the parent process.
+  std::string server_host = "127.0.0.1";
+  std::string server_port = "8090";
+  common::SetEnv(kEnvMetaServerHost, server_host.c_str());
+  common::SetEnv(kEnvMetaServerPort, server_port.c_str());
+  constexpr char kEnvMSRole[] = "MS_ROLE";
+  common::SetEnv(kEnvMSRole, "MS_SCHED");
+  common::SetEnv(kEnvNodeTimeout, "800");
+  common::SetEnv(kEnvHeartbeatInterval, "200");
+
+  size_t total_node_num = 2;
+  MetaServerNode msn("meta_server_node", "scheduler", total_node_num);
+  ASSERT_TRUE(msn.Initialize());
+
+  // Start compute graph nodes in separate sub processes.
+  std::vector<pid_t> cgns;
+  for (size_t i = 0; i < total_node_num; ++i) {
+    pid_t pid = fork();
+    EXPECT_LE(0, pid);
+    if (pid == 0) {
+      // Start the compute graph node in the sub process.
+      common::SetEnv(kEnvMSRole, "MS_WORKER");
+      auto cgn = std::make_shared<ComputeGraphNode>("compute_graph_node_" + std::to_string(i + 1), "worker");
+      ASSERT_TRUE(cgn->Initialize());
+      size_t time = 3600;
+      sleep(time);
+    } else {
+      cgns.push_back(pid);
+    }
+  }
+
+  size_t interval = 1;
+  size_t retry = 30;
+  while (((msn.GetAliveNodeNum() != total_node_num) || (msn.TopologyState() != TopoState::kInitialized)) &&
+         (retry-- > 0)) {
+    sleep(interval);
+  }
+  ASSERT_EQ(total_node_num, msn.GetAliveNodeNum());
+  ASSERT_EQ(TopoState::kInitialized, msn.TopologyState());
+
+  kill(cgns[0], 9);
+  // The failed node should be detected far faster than the second level default timeout.
+  size_t detect_time = 3;
+  sleep(detect_time);
+  ASSERT_EQ(total_node_num - 1, msn.GetAliveNodeNum());
+
+  kill(cgns[1], 9);
+  msn.Finalize(true);
+  common::SetEnv(kEnvNodeTimeout, "");
+  common::SetEnv(kEnvHeartbeatInterval, "");
+}
+
 /// Feature: test reconnect to meta server node if needed during node registration period.
 /// Description: first start the compute graph node and then start the meta server node.
 /// Expectation: the cluster topology is constructed successfully.